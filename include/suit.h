@@ -9,6 +9,10 @@
 
 #include <stdint.h>
 #include <suit_types.h>
+#include <suit_plan.h>
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+#include <suit_envelope_reader.h>
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
 
 #ifdef __cplusplus
 extern "C" {
@@ -72,6 +76,46 @@ int suit_processor_get_manifest_metadata(const uint8_t *envelope_str, size_t env
 					 size_t *version_len, struct zcbor_string *digest,
 					 enum suit_cose_alg *alg, unsigned int *seq_num);
 
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+/** @brief Process a sequence of the SUIT manifest, stored in a non memory-mapped storage.
+ *
+ * @details The whole envelope is copied into the window with the suit_envelope_reader_load and
+ *          processed with the suit_process_sequence, so the window has to fit the encoded envelope.
+ *          Only the manifest and severed member digests of the envelope are checked by reading
+ *          the storage through the reader, with each chunk compared against the window.
+ *          The dependency manifests are processed as with the suit_process_sequence.
+ *
+ * @param[in]  reader       The reader of the storage, that contains the envelope.
+ * @param[out] window       The buffer for the envelope.
+ * @param[in]  window_size  The size of the window.
+ * @param[in]  seq_name     Name of the sequence to process.
+ *
+ * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
+ */
+int suit_process_sequence_from_reader(struct suit_envelope_reader *reader, uint8_t *window, size_t window_size,
+				      enum suit_command_sequence seq_name);
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+/** @brief List the platform operations, that will be performed by the sequence.
+ *
+ * @details The envelope is authenticated and validated and the sequence is executed in the dry run
+ *          mode, within the same scope as the dry run, that precedes the suit_process_sequence.
+ *          Each operation, accepted by the suit_plat_check_* API, is appended to the plan,
+ *          so the plan may collect the operations of several sequences.
+ *          The operations of the dependency manifests are not listed.
+ *
+ * @param[in]     envelope_str  Reference to the input envelope to be parsed.
+ * @param[in]     envelope_len  Length of the input envelope.
+ * @param[in]     seq_name      Name of the first sequence to list.
+ * @param[inout]  plan          The plan, initialized with suit_plan_init.
+ *
+ * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
+ */
+int suit_processor_get_operation_plan(const uint8_t *envelope_str, size_t envelope_len,
+				      enum suit_command_sequence seq_name, struct suit_plan *plan);
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
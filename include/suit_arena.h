@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_ARENA_H__
+#define SUIT_ARENA_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <suit_types.h>
+#include <suit_processor.h>
+#include <cose_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_arena.h
+ * @brief Scratch region for the structures, decoded by the zcbor-generated code.
+ *
+ * The generated structures are carved from a single region instead of the stack or
+ * the SUIT processor state. The region is allocated as a stack: the user stores the
+ * allocation mark, allocates the structures and restores the mark once they are no longer
+ * needed, so the lifetime of each allocation is limited to a single processing phase:
+ *  - the decoded envelope and manifest live from suit_decoder_init until the components
+ *    are created,
+ *  - the COSE_Sign1 and Sig_structure1 live within the authentication of the manifest,
+ *  - the decoded command lives within a single step of the sequence execution,
+ *  - the COSE_Encrypt lives within the decoding of the encryption info,
+ *  - the copy of the component parameters, set by the shared sequence, lives within
+ *    the dry run.
+ *
+ * The dependency manifests are decoded while the command is executed, thus the region
+ * has to fit the command and the largest of the remaining phases.
+ * The encryption info may be decoded by the commands executed during the dry run,
+ * so the region has to fit both of them.
+ *
+ * By default the region is statically allocated by the SUIT processor.
+ * If SUIT_ARENA_EXTERNAL is defined, the region has to be provided by the integrator
+ * through suit_arena_init, before any envelope is processed.
+ */
+
+/** The alignment of the allocated structures. */
+#define SUIT_ARENA_ALIGN 8
+
+/** The size of the structure, rounded up to the allocation alignment. */
+#define SUIT_ARENA_SIZEOF(type) ((sizeof(type) + SUIT_ARENA_ALIGN - 1) & ~((size_t)SUIT_ARENA_ALIGN - 1))
+
+#define SUIT_ARENA_MAX(a, b) (((a) > (b)) ? (a) : (b))
+
+/** @brief Structures, allocated during the authentication of the manifest. */
+struct suit_arena_sign1 {
+	struct COSE_Sign1 cose_sign1;
+	struct Sig_structure1 signature;
+	uint8_t signed_data[SUIT_SUIT_SIG_STRUCTURE1_MAX_LENGTH];
+};
+
+#ifndef SUIT_PRUNE_ENCRYPTION
+#define SUIT_ARENA_ENCRYPT_SIZE SUIT_ARENA_SIZEOF(struct COSE_Encrypt)
+#else /* SUIT_PRUNE_ENCRYPTION */
+#define SUIT_ARENA_ENCRYPT_SIZE 0
+#endif /* SUIT_PRUNE_ENCRYPTION */
+
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+#define SUIT_ARENA_DRY_RUN_SIZE SUIT_ARENA_SIZEOF(struct suit_manifest_params[SUIT_MAX_NUM_COMPONENTS])
+#else /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+#define SUIT_ARENA_DRY_RUN_SIZE 0
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
+/** The minimal size of the region, that allows to process any supported envelope. */
+#define SUIT_ARENA_MIN_SIZE                                                                        \
+	(SUIT_ARENA_SIZEOF(suit_command_t) +                                                       \
+	 SUIT_ARENA_MAX(SUIT_ARENA_SIZEOF(union suit_decoded_envelope) +                           \
+				SUIT_ARENA_SIZEOF(struct suit_arena_sign1),                        \
+			SUIT_ARENA_DRY_RUN_SIZE + SUIT_ARENA_ENCRYPT_SIZE))
+
+/** @brief Provide the scratch region.
+ *
+ * @param[in]  buf   The address of the region, aligned to SUIT_ARENA_ALIGN.
+ * @param[in]  size  The size of the region.
+ *
+ * @returns SUIT_SUCCESS if the region was set,
+ *          SUIT_ERR_CRASH if the region is invalid or not aligned,
+ *          SUIT_ERR_OVERFLOW if the region is smaller than SUIT_ARENA_MIN_SIZE,
+ *          SUIT_ERR_ORDER if the current region is in use.
+ */
+int suit_arena_init(void *buf, size_t size);
+
+/** @brief Allocate the zero-initialized memory from the scratch region.
+ *
+ * @param[in]  size  The number of bytes to allocate.
+ *
+ * @returns The pointer to the allocated memory, NULL if the region is exhausted.
+ */
+void *suit_arena_alloc(size_t size);
+
+/** @brief Get the current allocation mark. */
+size_t suit_arena_mark(void);
+
+/** @brief Release all allocations, made after the mark was taken.
+ *
+ * @param[in]  mark  The allocation mark, returned by suit_arena_mark.
+ */
+void suit_arena_release(size_t mark);
+
+/** @brief Get the maximum number of bytes, allocated since the region was set. */
+size_t suit_arena_peak(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_ARENA_H__ */
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_CHECKPOINT_H__
+#define SUIT_CHECKPOINT_H__
+
+#include <suit_processor.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** The value used to identify a valid checkpoint structure. */
+#define SUIT_CHECKPOINT_MAGIC 0x53434b03
+
+/** The maximum length of the encoded SUIT_Digest of the manifest, stored inside the checkpoint. */
+#define SUIT_CHECKPOINT_MAX_DIGEST_LEN 80
+
+#if SUIT_MAX_NUM_COMPONENTS > 32
+#error "The checkpoint structure is able to store up to 32 selected components"
+#endif
+
+/** @brief Location of a byte string, relative to the beginning of the envelope. */
+struct suit_checkpoint_str {
+	uint32_t offset;
+	uint32_t len;
+};
+
+/** @brief Serialized values of the component parameters. */
+struct suit_checkpoint_params {
+	struct suit_checkpoint_str vid;
+	struct suit_checkpoint_str cid;
+	struct suit_checkpoint_str image_digest;
+	struct suit_checkpoint_str content;
+	struct suit_checkpoint_str uri;
+	struct suit_checkpoint_str invoke_args;
+	struct suit_checkpoint_str did;
+	struct suit_checkpoint_str version;
+	struct suit_checkpoint_str encryption_info;
+	struct suit_checkpoint_str compression_info;
+	struct suit_checkpoint_str base_digest;
+	uint32_t image_size;
+	uint32_t component_slot;
+	uint32_t source_component;
+	uint32_t patch_component;
+	uint32_t flags; ///! Bitmask of the *_set flags and the integrity_checked flag.
+};
+
+/** @brief Serialized command sequence execution state. */
+struct suit_checkpoint_seq {
+	struct suit_checkpoint_str cmd_seq; ///! The location of the executed command sequence.
+	uint32_t exec_offset;		    ///! The location of the current command.
+	uint32_t n_commands;
+	uint32_t current_command;
+	int32_t cmd_exec_state;
+	int32_t retval;
+	uint32_t soft_failure;
+	uint32_t current_component_idx;
+	uint32_t current_components;	    ///! Bitmask of the selected components.
+	uint32_t current_components_backup; ///! Bitmask of the backed up component selection.
+};
+
+/** @brief Pointer-free snapshot of the SUIT processor execution state.
+ *
+ * @details All references to the manifest contents are stored as offsets, relative to the
+ *          beginning of the envelope, so the checkpoint stays valid as long as the same
+ *          envelope is processed, regardless of its location in memory.
+ *          The checkpoint is bound to the manifest through the encoded manifest digest.
+ */
+struct suit_checkpoint {
+	uint32_t magic;
+	uint32_t seq_name;
+	uint32_t manifest_digest_len;
+	uint8_t manifest_digest[SUIT_CHECKPOINT_MAX_DIGEST_LEN];
+	uint32_t components_count;
+	struct suit_checkpoint_params params[SUIT_MAX_NUM_COMPONENTS];
+	uint32_t seq_stack_height;
+	struct suit_checkpoint_seq seq_stack[SUIT_MAX_SEQ_DEPTH];
+};
+
+/** @brief Serialize the sequence execution stack and the component parameters.
+ *
+ * @note Only the execution of the root manifest can be serialized. While a dependency manifest
+ *       is processed, this API returns SUIT_ERR_WAIT and the last checkpoint of the root manifest
+ *       should be used to resume the processing.
+ *
+ * @param[in]   state            The SUIT processor state to serialize.
+ * @param[in]   manifest_digest  The encoded SUIT_Digest of the root manifest.
+ * @param[out]  checkpoint       The checkpoint structure to fill.
+ *
+ * @returns SUIT_SUCCESS if the checkpoint was created, error code otherwise.
+ */
+int suit_checkpoint_save(struct suit_processor_state *state, struct zcbor_string *manifest_digest,
+			 struct suit_checkpoint *checkpoint);
+
+/** @brief Recreate the sequence execution stack and the component parameters from the checkpoint.
+ *
+ * @details The manifest has to be loaded and its component handles have to be created
+ *          before calling this API. The checkpoint is accepted only if it was created for the
+ *          current sequence of the same manifest, identified by the manifest digest.
+ *
+ * @param[in]  state            The SUIT processor state to modify.
+ * @param[in]  manifest         The loaded root manifest.
+ * @param[in]  manifest_digest  The encoded SUIT_Digest of the loaded manifest.
+ * @param[in]  checkpoint       The checkpoint to restore.
+ * @param[in]  cmd_processor    Processor to execute commands in the restored sequences.
+ *
+ * @retval SUIT_ERR_AGAIN                  If the execution stack was restored and
+ *                                         the suit_process_scheduled(..) should be called.
+ * @retval SUIT_ERR_MANIFEST_VERIFICATION  If the checkpoint was created for a different manifest.
+ * @retval SUIT_ERR_DECODING               If the checkpoint contents are invalid.
+ */
+int suit_checkpoint_restore(struct suit_processor_state *state,
+			    struct suit_manifest_state *manifest,
+			    struct zcbor_string *manifest_digest,
+			    const struct suit_checkpoint *checkpoint,
+			    seq_exec_processor_t cmd_processor);
+
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+/** @brief Store the checkpoint of the current execution state through the platform API.
+ *
+ * @details This API is called after each completed directive. It does nothing if checkpoints
+ *          are not enabled inside the processor state or if the current execution state belongs
+ *          to a dependency manifest.
+ *
+ * @param[in]  state  The SUIT processor state to serialize.
+ *
+ * @returns SUIT_SUCCESS if the checkpoint was stored or skipped, error code otherwise.
+ */
+int suit_checkpoint_commit(struct suit_processor_state *state);
+
+/** @brief Read the checkpoint of the current sequence through the platform API and restore it.
+ *
+ * @details If the stored checkpoint does not match the loaded manifest, it is discarded.
+ *
+ * @param[in]  state          The SUIT processor state to modify.
+ * @param[in]  manifest       The loaded root manifest.
+ * @param[in]  cmd_processor  Processor to execute commands in the restored sequences.
+ *
+ * @retval SUIT_ERR_AGAIN  If the execution stack was restored and
+ *                         the suit_process_scheduled(..) should be called.
+ * @returns Error code if there is no checkpoint to resume from.
+ */
+int suit_checkpoint_resume(struct suit_processor_state *state,
+			   struct suit_manifest_state *manifest,
+			   seq_exec_processor_t cmd_processor);
+
+/** @brief Remove the checkpoint of the current sequence through the platform API.
+ *
+ * @param[in]  state     The SUIT processor state.
+ * @param[in]  manifest  The loaded root manifest.
+ *
+ * @returns SUIT_SUCCESS if the checkpoint was removed, error code otherwise.
+ */
+int suit_checkpoint_discard(struct suit_processor_state *state,
+			    struct suit_manifest_state *manifest);
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_CHECKPOINT_H__ */
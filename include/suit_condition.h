@@ -29,6 +29,20 @@ int suit_condition_device_identifier(struct suit_processor_state *state,
 int suit_condition_image_match(struct suit_processor_state *state,
 			       struct suit_manifest_params *component_params);
 
+#ifdef SUIT_DEDUP_PAYLOADS
+/** @brief Find another component, that passed the image match with the same image digest.
+ *
+ * @details The memoized image match results are used, so the platform is not called and
+ *          the components, modified after the check, are not returned.
+ *
+ * @returns SUIT_SUCCESS if the component was found,
+ *          SUIT_ERR_MISSING_COMPONENT if no component contains the image.
+ */
+int suit_condition_find_verified_image(struct suit_processor_state *state,
+				       struct suit_manifest_params *component_params,
+				       suit_component_t *handle);
+#endif /* SUIT_DEDUP_PAYLOADS */
+
 /** Check a component slot based on the configured parameters. */
 int suit_condition_component_slot(struct suit_processor_state *state,
 				  struct suit_manifest_params *component_params);
@@ -41,6 +55,7 @@ int suit_condition_check_content(struct suit_processor_state *state,
 int suit_condition_abort(struct suit_processor_state *state,
 			 struct suit_manifest_params *component_params);
 
+#ifndef SUIT_PRUNE_DEPENDENCIES
 /** Check a manifest component integrity and signature. */
 int suit_condition_dependency_integrity(struct suit_processor_state *state,
 					struct suit_manifest_params *component_params);
@@ -48,6 +63,7 @@ int suit_condition_dependency_integrity(struct suit_processor_state *state,
 /** Check if component is a dependency manifest component. */
 int suit_condition_is_dependency(struct suit_processor_state *state,
 				 struct suit_manifest_params *component_params);
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 
 /** Check if component version matches the range configured by the parameter. */
 int suit_condition_version(struct suit_processor_state *state,
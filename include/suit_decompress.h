@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_DECOMPRESS_H__
+#define SUIT_DECOMPRESS_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <suit_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_decompress.h
+ * @brief Streaming decoder for payloads, described by the struct suit_compression_info.
+ *
+ * The decoder accepts raw LZMA2 streams (without the .xz or .lzma container), optionally
+ * followed by the ARM-Thumb BCJ filter, i.e. the output of:
+ *   xz --format=raw --armthumb --lzma2=dict=<window> <image>
+ *
+ * The decoder does not allocate any memory. The LZMA2 dictionary (window) is provided by the
+ * platform and bounds the amount of RAM, required to decompress the payload. A stream that
+ * references data further back than the size of the window is rejected.
+ *
+ * Both the input and the output may be passed in arbitrarily sized chunks, so the decoder
+ * can be placed between the payload source (i.e. fetch or decryption) and the digest
+ * calculation or the memory write operation.
+ */
+
+/** The maximum value of the sum of lc and lp LZMA properties, accepted by the decoder.
+ *  The size of the suit_lzma2_decoder structure grows by 1.5 kB for every unit above zero.
+ */
+#ifndef SUIT_LZMA2_LCLP_MAX
+#define SUIT_LZMA2_LCLP_MAX 4
+#endif
+
+/** The minimum size of the LZMA2 dictionary buffer. */
+#define SUIT_LZMA2_DICT_SIZE_MIN 4096
+
+/** The number of input bytes, that are sufficient to decode a single LZMA symbol. */
+#define SUIT_LZMA_IN_REQUIRED 21
+
+/** The number of probability variables in the LZMA decoder. */
+#define SUIT_LZMA_PROBS_COUNT (1846 + (0x300 << SUIT_LZMA2_LCLP_MAX))
+
+struct suit_lzma_dict {
+	uint8_t *buf;
+	size_t start; ///! The first byte, not yet copied to the output buffer.
+	size_t pos;   ///! The position of the next decoded byte.
+	size_t full;  ///! The number of valid bytes inside the buffer.
+	size_t limit; ///! The position at which the decoding has to be stopped.
+	size_t end;   ///! The size of the buffer.
+};
+
+struct suit_lzma_rc {
+	uint32_t range;
+	uint32_t code;
+	uint32_t init_bytes_left;
+	const uint8_t *in;
+	size_t in_pos;
+	size_t in_limit;
+};
+
+struct suit_lzma2_decoder {
+	struct suit_lzma_dict dict;
+	struct suit_lzma_rc rc;
+
+	/* LZMA state. */
+	uint32_t rep0;
+	uint32_t rep1;
+	uint32_t rep2;
+	uint32_t rep3;
+	uint32_t state;
+	uint32_t len; ///! The number of bytes of the current match, that are not yet decoded.
+	uint32_t lc;
+	uint32_t literal_pos_mask;
+	uint32_t pos_mask;
+	uint16_t probs[SUIT_LZMA_PROBS_COUNT];
+
+	/* LZMA2 state. */
+	uint32_t sequence;
+	uint32_t next_sequence;
+	uint32_t uncompressed;
+	uint32_t compressed;
+	bool need_dict_reset;
+	bool need_props;
+
+	/* Input bytes of a single LZMA symbol, split between two input buffers. */
+	size_t temp_size;
+	uint8_t temp_buf[3 * SUIT_LZMA_IN_REQUIRED];
+};
+
+struct suit_decompress_state {
+	struct suit_lzma2_decoder lzma2;
+
+	bool arm_thumb_filter;
+	uint32_t filter_pos;  ///! The offset of the first byte in the filter buffer.
+	size_t filter_size;   ///! The number of decoded bytes, waiting to be filtered.
+	uint8_t filter_buf[4];
+
+	size_t out_total;
+	size_t decompressed_image_size;
+	bool finished;
+};
+
+/** @brief Prepare the decoder to decompress a new payload.
+ *
+ * @param[out] state      The decoder state.
+ * @param[in]  info       The compression parameters of the payload.
+ * @param[in]  dict       The buffer for the LZMA2 dictionary. The buffer has to stay valid
+ *                        until the payload is decompressed.
+ * @param[in]  dict_size  The size of the dictionary buffer.
+ *
+ * @returns SUIT_SUCCESS if the decoder was initialized, error code otherwise.
+ */
+int suit_decompress_init(struct suit_decompress_state *state, const struct suit_compression_info *info,
+			 uint8_t *dict, size_t dict_size);
+
+/** @brief Decompress the next part of the payload.
+ *
+ * @param[in]     state    The decoder state.
+ * @param[in]     in       The next part of the compressed payload.
+ * @param[in,out] in_len   The length of the input buffer. Updated with the number of consumed bytes.
+ * @param[out]    out      The buffer for the decompressed data.
+ * @param[in,out] out_len  The size of the output buffer. Updated with the number of produced bytes.
+ *
+ * @returns SUIT_SUCCESS if the end of the payload was reached and verified,
+ *          SUIT_ERR_AGAIN if more input data or output space is required,
+ *          SUIT_ERR_DECODING if the payload is corrupted or does not fit into the dictionary,
+ *          SUIT_ERR_UNSUPPORTED_PARAMETER if the LZMA properties are not supported,
+ *          error code otherwise.
+ */
+int suit_decompress(struct suit_decompress_state *state, const uint8_t *in, size_t *in_len,
+		    uint8_t *out, size_t *out_len);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_DECOMPRESS_H__ */
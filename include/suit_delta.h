@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_DELTA_H__
+#define SUIT_DELTA_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <suit_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_delta.h
+ * @brief Streaming applier for patches, used by the suit-directive-custom-apply-delta.
+ *
+ * The patch is a sequence of bsdiff-like records, applied onto the base image:
+ *
+ *   Patch  = magic, target_size, *Record
+ *   Record = diff_len, diff_len * diff_byte, extra_len, extra_len * extra_byte, [ offset ]
+ *
+ * where magic is the four ASCII characters "SDLT", target_size, diff_len and extra_len are
+ * unsigned LEB128 integers and offset is a zigzag-encoded, signed LEB128 integer.
+ *
+ * Each diff byte is added (modulo 256) to the next byte of the base image, each extra byte is
+ * copied into the output as-is and the offset moves the position in the base image.
+ * The records are applied until target_size bytes are produced. The offset of the record that
+ * produces the last byte is omitted.
+ *
+ * The applier does not allocate any memory. The base image is read through a callback
+ * directly into the output buffer, so the RAM usage does not depend on the size of the images.
+ * Both the patch and the output may be passed in arbitrarily sized chunks.
+ */
+
+/** The first bytes of every patch. */
+#define SUIT_DELTA_MAGIC "SDLT"
+
+/** @brief Read a part of the base image.
+ *
+ * @param[in]  ctx     The context, passed to suit_delta_init.
+ * @param[in]  offset  The offset inside the base image.
+ * @param[out] buf     The buffer to fill.
+ * @param[in]  len     The number of bytes to read.
+ *
+ * @returns SUIT_SUCCESS if the data was read, error code otherwise.
+ */
+typedef int (*suit_delta_read_base_t)(void *ctx, size_t offset, uint8_t *buf, size_t len);
+
+struct suit_delta_state {
+	suit_delta_read_base_t read_base;
+	void *ctx;
+	size_t base_size;
+	size_t base_pos;    ///! The position of the next base image byte, used by the diff.
+	size_t target_size;
+	size_t out_total;   ///! The number of bytes, produced so far.
+
+	uint32_t sequence;  ///! The field of the patch, that is being decoded.
+	size_t remaining;   ///! The number of diff or extra bytes, left in the current record.
+	uint64_t varint;    ///! The value of the integer, that is being decoded.
+	uint32_t varint_shift;
+};
+
+/** @brief Prepare the applier to process a new patch.
+ *
+ * @param[out] state      The applier state.
+ * @param[in]  read_base  The callback, used to read the base image.
+ * @param[in]  ctx        The context, passed to the @p read_base callback.
+ * @param[in]  base_size  The size of the base image.
+ *
+ * @returns SUIT_SUCCESS if the applier was initialized, error code otherwise.
+ */
+int suit_delta_init(struct suit_delta_state *state, suit_delta_read_base_t read_base, void *ctx,
+		    size_t base_size);
+
+/** @brief Apply the next part of the patch.
+ *
+ * @param[in]     state    The applier state.
+ * @param[in]     in       The next part of the patch.
+ * @param[in,out] in_len   The length of the input buffer. Updated with the number of consumed bytes.
+ * @param[out]    out      The buffer for the patched data.
+ * @param[in,out] out_len  The size of the output buffer. Updated with the number of produced bytes.
+ *
+ * @returns SUIT_SUCCESS if the whole target image was produced,
+ *          SUIT_ERR_AGAIN if more input data or output space is required,
+ *          SUIT_ERR_DECODING if the patch is malformed or does not match the base image size,
+ *          error code returned by the read_base callback otherwise.
+ */
+int suit_delta_apply(struct suit_delta_state *state, const uint8_t *in, size_t *in_len,
+		     uint8_t *out, size_t *out_len);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_DELTA_H__ */
@@ -39,9 +39,11 @@ int suit_directive_override_parameters(
 	struct suit_directive_override_parameters_m_l_map_SUIT_Parameters_m *params,
 	uint_fast32_t param_count);
 
+#ifndef SUIT_PRUNE_FETCH
 /** Fetch a payload based on the configured parameters. */
 int suit_directive_fetch(struct suit_processor_state *state,
 			 struct suit_manifest_params *component_params);
+#endif /* SUIT_PRUNE_FETCH */
 
 /** Copy a payload based on the configured parameters. */
 int suit_directive_copy(struct suit_processor_state *state,
@@ -55,6 +57,10 @@ int suit_directive_write(struct suit_processor_state *state,
 int suit_directive_swap(struct suit_processor_state *state,
 			struct suit_manifest_params *component_params);
 
+/** Construct a payload from the base image and the patch, based on the configured parameters. */
+int suit_directive_apply_delta(struct suit_processor_state *state,
+			       struct suit_manifest_params *component_params);
+
 /** Invoke/boot a component based on the configured parameters. */
 int suit_directive_invoke(struct suit_processor_state *state,
 			  struct suit_manifest_params *component_params);
@@ -67,9 +73,17 @@ int suit_directive_set_parameters(
 	struct suit_directive_set_parameters_m_l_map_SUIT_Parameters_m *params,
 	uint_fast32_t param_count, struct suit_manifest_params *component_params);
 
+/** Decode the image digest, version and encryption info parameters, that are set in @p params.
+ *  Those are decoded once the parameter is set, thus this is needed only if the parameter values
+ *  were restored without the override or set parameters directive.
+ */
+int suit_directive_decode_parameters(struct suit_manifest_params *params);
+
+#ifndef SUIT_PRUNE_DEPENDENCIES
 /** Process the current sequence of the dependency manifest. */
 int suit_directive_process_dependency(struct suit_processor_state *state,
 				      struct suit_manifest_params *component_params);
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_ENVELOPE_READER_H__
+#define SUIT_ENVELOPE_READER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <suit_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_envelope_reader.h
+ * @brief Access to the envelopes, stored in a non memory-mapped storage, i.e. an external flash.
+ *
+ * The storage is read through the callback in fixed-size pages, kept in a small cache with
+ * the least recently used page replaced first.
+ *
+ * The decoder parses the envelope in place, so the envelope has to be available as
+ * a contiguous buffer while it is processed. Instead of copying the whole storage area,
+ * suit_envelope_reader_load walks the CBOR headers of the envelope through the cache and copies
+ * only the encoded envelope into the window, provided by the caller. The window can be passed
+ * to the suit_process_sequence or returned by the suit_plat_retrieve_manifest.
+ *
+ * If the envelope is processed with the suit_process_sequence_from_reader, the manifest and severed
+ * member digests are checked through the cache with the suit_plat_check_digest_chunked, so the
+ * platform does not need the digested data as a contiguous buffer. Each chunk is compared against
+ * the window, so the checked data is the data that is decoded.
+ *
+ * @note The reader does not page the envelope on demand. The window has to fit the whole encoded
+ *       envelope, and the decoder and the sequence executor work on the window only.
+ *       The dependency envelopes are not read through the reader, they are returned by
+ *       the suit_plat_retrieve_manifest as memory-mapped buffers.
+ */
+
+/** @brief Read the contents of the storage.
+ *
+ * @param[in]  ctx     The context, passed to suit_envelope_reader_init.
+ * @param[in]  offset  The offset inside the storage.
+ * @param[out] buf     The buffer to fill.
+ * @param[in]  len     The number of bytes to read.
+ *
+ * @returns SUIT_SUCCESS if the data was read, error code otherwise.
+ */
+typedef int (*suit_envelope_read_t)(void *ctx, size_t offset, uint8_t *buf, size_t len);
+
+/** @brief The cached page of the storage. */
+struct suit_envelope_page {
+	size_t offset;	///! The offset of the first byte of the page.
+	size_t len;	///! The number of valid bytes, 0 if the page is not used.
+	uint32_t used;	///! The value of the access counter during the last access.
+};
+
+struct suit_envelope_reader {
+	suit_envelope_read_t read;
+	void *ctx;
+	size_t size;	///! The size of the storage.
+	struct suit_envelope_page *pages;
+	uint8_t *buf;	///! The page contents, page_size bytes per page.
+	size_t page_size;
+	size_t page_count;
+	uint32_t access_count;
+	uint32_t miss_count; ///! The number of pages, read from the storage.
+};
+
+/** @brief Prepare the reader with an empty cache.
+ *
+ * @param[out] reader      The reader to initialize.
+ * @param[in]  read        The callback, used to read the storage.
+ * @param[in]  ctx         The context, passed to the @p read callback.
+ * @param[in]  size        The size of the storage.
+ * @param[in]  pages       The array of page descriptors.
+ * @param[in]  buf         The buffer for the page contents, at least page_count * page_size bytes.
+ * @param[in]  page_count  The number of elements in the pages array.
+ * @param[in]  page_size   The size of a single page.
+ *
+ * @returns SUIT_SUCCESS if the reader was initialized, SUIT_ERR_CRASH if the arguments are invalid.
+ */
+int suit_envelope_reader_init(struct suit_envelope_reader *reader, suit_envelope_read_t read, void *ctx,
+			      size_t size, struct suit_envelope_page *pages, uint8_t *buf,
+			      size_t page_count, size_t page_size);
+
+/** @brief Read the contents of the storage through the cache.
+ *
+ * @param[in]  reader  The reader.
+ * @param[in]  offset  The offset inside the storage.
+ * @param[out] buf     The buffer to fill.
+ * @param[in]  len     The number of bytes to read.
+ *
+ * @returns SUIT_SUCCESS if the data was read,
+ *          SUIT_ERR_CRASH if the arguments are invalid,
+ *          SUIT_ERR_OVERFLOW if the data exceeds the storage,
+ *          the error returned by the read callback otherwise.
+ */
+int suit_envelope_reader_read(struct suit_envelope_reader *reader, size_t offset, uint8_t *buf, size_t len);
+
+/** @brief Drop all cached pages, i.e. after the storage contents were modified. */
+void suit_envelope_reader_invalidate(struct suit_envelope_reader *reader);
+
+/** @brief Find the length of the envelope, stored at the beginning of the storage.
+ *
+ * @details Only the CBOR headers are read. The lengths are not checked against the SUIT CDDL,
+ *          it is done by the decoder.
+ *
+ * @param[in]  reader        The reader.
+ * @param[out] envelope_len  The length of the encoded envelope.
+ *
+ * @returns SUIT_SUCCESS if the length was found,
+ *          SUIT_ERR_DECODING if the storage does not contain a tagged envelope,
+ *          error code otherwise.
+ */
+int suit_envelope_reader_get_len(struct suit_envelope_reader *reader, size_t *envelope_len);
+
+/** @brief Copy the envelope, stored at the beginning of the storage, into the window.
+ *
+ * @param[in]  reader        The reader.
+ * @param[out] window        The buffer for the envelope.
+ * @param[in]  window_size   The size of the window.
+ * @param[out] envelope_len  The length of the copied envelope.
+ *
+ * @returns SUIT_SUCCESS if the envelope was copied,
+ *          SUIT_ERR_OVERFLOW if the envelope does not fit into the window,
+ *          error code otherwise.
+ */
+int suit_envelope_reader_load(struct suit_envelope_reader *reader, uint8_t *window, size_t window_size,
+			      size_t *envelope_len);
+
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+/** @brief Check the digest of the storage contents, read through the cache.
+ *
+ * @details The data is passed to the suit_plat_check_digest_chunked in chunks, that end at
+ *          the page boundaries, without copying it.
+ *
+ * @param[in] reader  The reader.
+ * @param[in] offset  The offset of the digested data inside the storage.
+ * @param[in] len     The length of the digested data.
+ * @param[in] copy    The copy of the digested data, i.e. inside the window, NULL if the data is not
+ *                    copied.
+ * @param[in] alg_id  The digest algorithm.
+ * @param[in] digest  The expected digest value.
+ *
+ * @returns SUIT_SUCCESS if the digest matches,
+ *          SUIT_ERR_CRASH if the arguments are invalid,
+ *          SUIT_ERR_OVERFLOW if the data exceeds the storage,
+ *          SUIT_ERR_AUTHENTICATION if the storage contents differ from the copy,
+ *          error code otherwise.
+ */
+int suit_envelope_reader_check_digest(struct suit_envelope_reader *reader, size_t offset, size_t len,
+				      const uint8_t *copy, enum suit_cose_alg alg_id,
+				      struct zcbor_string *digest);
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_ENVELOPE_READER_H__ */
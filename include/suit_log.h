@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_LOG_H__
+#define SUIT_LOG_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <suit_platform.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_log.h
+ * @brief Debug messages, emitted once per command or component.
+ *
+ * If SUIT_LOG_BINARY is defined, the messages are not formatted on the device.
+ * Only the message ID and the integer arguments are stored in a ring buffer, which can be
+ * read with suit_log_read and decoded offline with scripts/suit_log_decode.py.
+ * Otherwise the messages are passed to SUIT_DBG as regular format strings.
+ *
+ * Each message is defined by a pair of macros: SUIT_LOG_MSG_<name> with a unique ID and
+ * SUIT_LOG_MSG_<name>_FMT with the format string. The host decoder parses this file,
+ * so the IDs of the existing messages must not be changed.
+ */
+
+/** The maximum number of arguments, stored with a single message. */
+#define SUIT_LOG_MAX_ARGS 3
+
+#ifndef SUIT_LOG_BUF_SIZE
+/** The number of messages, kept in the ring buffer. */
+#define SUIT_LOG_BUF_SIZE 64
+#endif
+
+#define SUIT_LOG_MSG_CONDITION_FOUND 1
+#define SUIT_LOG_MSG_CONDITION_FOUND_FMT "%d: Condition %d found"
+#define SUIT_LOG_MSG_DIRECTIVE_FOUND 2
+#define SUIT_LOG_MSG_DIRECTIVE_FOUND_FMT "%d: Directive %d found"
+#define SUIT_LOG_MSG_COMPONENT_SELECTED 3
+#define SUIT_LOG_MSG_COMPONENT_SELECTED_FMT "Select component %d"
+#define SUIT_LOG_MSG_COMPONENTS_RECOVERED 4
+#define SUIT_LOG_MSG_COMPONENTS_RECOVERED_FMT "Selected components: 0x%x"
+#define SUIT_LOG_MSG_VALID_CONDITION 5
+#define SUIT_LOG_MSG_VALID_CONDITION_FMT "Found valid condition: %d"
+#define SUIT_LOG_MSG_VALID_DIRECTIVE 6
+#define SUIT_LOG_MSG_VALID_DIRECTIVE_FMT "Found valid directive: %d"
+#define SUIT_LOG_MSG_COMMAND_VALIDATED 7
+#define SUIT_LOG_MSG_COMMAND_VALIDATED_FMT "Single command validated (status: %d)"
+#define SUIT_LOG_MSG_CONDITION_EXECUTE 8
+#define SUIT_LOG_MSG_CONDITION_EXECUTE_FMT "Execute condition %d for component idx: %d (handle: 0x%x)"
+#define SUIT_LOG_MSG_DIRECTIVE_EXECUTE 9
+#define SUIT_LOG_MSG_DIRECTIVE_EXECUTE_FMT "Execute directive %d for component idx: %d (handle: 0x%x)"
+#define SUIT_LOG_MSG_CONDITION_EXECUTED 10
+#define SUIT_LOG_MSG_CONDITION_EXECUTED_FMT "Single condition (%d) executed (status: %d)"
+#define SUIT_LOG_MSG_DIRECTIVE_EXECUTED 11
+#define SUIT_LOG_MSG_DIRECTIVE_EXECUTED_FMT "Single directive (%d) executed (status: %d)"
+
+/** @brief A single message, stored in the ring buffer. */
+struct suit_log_entry {
+	uint16_t id; ///! The SUIT_LOG_MSG_* value.
+	uint16_t seq; ///! The running number of the message, used to detect overwritten entries.
+	int32_t args[SUIT_LOG_MAX_ARGS]; ///! The arguments, unused ones are set to zero.
+};
+
+#ifdef SUIT_LOG_BINARY
+#define SUIT_LOG_DBG(msg, ...) \
+	suit_log_record(SUIT_LOG_MSG_##msg, (const int32_t[]){__VA_ARGS__}, \
+			sizeof((const int32_t[]){__VA_ARGS__}) / sizeof(int32_t))
+#else /* SUIT_LOG_BINARY */
+#define SUIT_LOG_DBG(msg, ...) SUIT_DBG(SUIT_LOG_MSG_##msg##_FMT "\r\n", __VA_ARGS__)
+#endif /* SUIT_LOG_BINARY */
+
+/** @brief Store the message in the ring buffer, overwriting the oldest one if the buffer is full.
+ *
+ * @param[in] id     The message ID.
+ * @param[in] args   The message arguments.
+ * @param[in] nargs  The number of arguments. At most SUIT_LOG_MAX_ARGS are stored.
+ */
+void suit_log_record(uint16_t id, const int32_t *args, size_t nargs);
+
+/** @brief Move the oldest messages from the ring buffer.
+ *
+ * @param[out] entries  The array to fill.
+ * @param[in]  count    The size of the array.
+ *
+ * @returns The number of messages, copied into @p entries.
+ */
+size_t suit_log_read(struct suit_log_entry *entries, size_t count);
+
+/** @brief Drop all messages and restart the message numbering. */
+void suit_log_reset(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_LOG_H__ */
@@ -74,13 +74,25 @@ int suit_manifest_release(struct suit_manifest_state *manifest);
 int suit_manifest_get_component_params(struct suit_manifest_state *manifest, size_t component_idx,
 				       struct suit_manifest_params **params);
 
-/** @brief Get the reference to the given command sequence for a given manifest.
+/** @brief Copy the values of the SUIT component parameters.
+ *
+ * @details Only the parameter values and their presence flags are copied. The component handle,
+ *          ID, reference counter, dependency and integrity flags describe the component itself,
+ *          so they are kept unchanged.
+ *
+ * @param[out] dst  The structure to modify.
+ * @param[in]  src  The structure with the parameter values.
+ */
+void suit_manifest_params_copy_values(struct suit_manifest_params *dst,
+				      const struct suit_manifest_params *src);
+
+/** @brief Get the given command sequence for a given manifest.
  *
  * @details This function will return a command sequence only if it is marked as authenticated.
  *
  * @param[in]  manifest  Manifest structure, defining the context for the command sequence.
  * @param[in]  seq_name  Name of the command sequence to return.
- * @param[out] payload   Reference to the pointer to ZCBOR string holding the sequence.
+ * @param[out] sequence  ZCBOR string holding the sequence.
  *
  * @returns SUIT_SUCCESS if a valid, authenticated sequence was found,
  *                       SUIT_ERR_UNAVAILABLE_COMMAND_SEQ if the sequence is not available,
@@ -88,7 +100,7 @@ int suit_manifest_get_component_params(struct suit_manifest_state *manifest, siz
  */
 int suit_manifest_get_command_seq(struct suit_manifest_state *manifest,
 				  enum suit_command_sequence seq_name,
-				  struct zcbor_string **sequence);
+				  struct zcbor_string *sequence);
 
 /** @brief Get the reference to an integrated payload with a given URI for a given manifest.
  *
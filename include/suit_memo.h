@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_MEMO_H__
+#define SUIT_MEMO_H__
+
+#include <stdbool.h>
+#include <suit_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_memo.h
+ * @brief Results of the conditions, that passed for a component handle.
+ *
+ * The result depends only on the component contents and the parameter value, so it is
+ * reused until the component is modified or the condition is checked against a different value.
+ * Only the passed conditions are stored, so a failed check is always repeated by the platform.
+ *
+ * The results are kept in a single table of SUIT_MEMO_MAX_ENTRIES entries, shared by all
+ * component handles. If the table is full, the oldest entry is replaced.
+ */
+
+/** @brief The conditions, which results are memoized. */
+enum suit_memo_id {
+	SUIT_MEMO_VID,
+	SUIT_MEMO_CID,
+	SUIT_MEMO_DID,
+	SUIT_MEMO_IMAGE_MATCH,
+	SUIT_MEMO_MAX,
+};
+
+/** The maximum length of the parameter value, copied into the memo.
+ *  It fits the UUIDs and the SUIT_Digest with a SHA-256 digest. Conditions, checked against
+ *  longer values, are not memoized.
+ */
+#define SUIT_MEMO_VALUE_MAX_LEN 36
+
+/** The number of the passed conditions, stored at the same time. */
+#define SUIT_MEMO_MAX_ENTRIES 8
+
+#ifdef SUIT_CONDITION_MEMO
+/** @brief Check if the condition passed for the component with the same parameter value.
+ *
+ * @details The value is compared with the stored copy, because the memory, pointed by the
+ *          parameter, may be reused i.e. by a dependency manifest, received into the same component.
+ *
+ * @param[in] handle  The component handle.
+ * @param[in] id      The condition.
+ * @param[in] value   The parameter value, checked by the condition.
+ *
+ * @returns true if the condition passed, false if the result is not known.
+ */
+bool suit_memo_passed(suit_component_t handle, enum suit_memo_id id, const struct zcbor_string *value);
+
+/** @brief Store the passed condition.
+ *
+ * @param[in] handle  The component handle.
+ * @param[in] id      The condition.
+ * @param[in] value   The parameter value, checked by the condition.
+ */
+void suit_memo_store(suit_component_t handle, enum suit_memo_id id, const struct zcbor_string *value);
+
+/** @brief Find another component, for which the condition passed with the same parameter value.
+ *
+ * @param[in]  exclude  The component handle to skip.
+ * @param[in]  id       The condition.
+ * @param[in]  value    The parameter value, checked by the condition.
+ * @param[out] handle   The found component handle.
+ *
+ * @returns true if the component was found, false otherwise.
+ */
+bool suit_memo_find(suit_component_t exclude, enum suit_memo_id id, const struct zcbor_string *value,
+		    suit_component_t *handle);
+
+/** @brief Drop all results of the component.
+ *
+ * @param[in] handle  The component handle.
+ */
+void suit_memo_drop(suit_component_t handle);
+
+/** @brief Drop the results of all components. */
+void suit_memo_drop_all(void);
+#else /* SUIT_CONDITION_MEMO */
+static inline bool suit_memo_passed(suit_component_t handle, enum suit_memo_id id, const struct zcbor_string *value)
+{
+	return false;
+}
+
+static inline void suit_memo_store(suit_component_t handle, enum suit_memo_id id, const struct zcbor_string *value)
+{
+}
+
+static inline bool suit_memo_find(suit_component_t exclude, enum suit_memo_id id,
+				  const struct zcbor_string *value, suit_component_t *handle)
+{
+	return false;
+}
+
+static inline void suit_memo_drop(suit_component_t handle)
+{
+}
+
+static inline void suit_memo_drop_all(void)
+{
+}
+#endif /* SUIT_CONDITION_MEMO */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_MEMO_H__ */
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_PLAN_H__
+#define SUIT_PLAN_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <suit_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_plan.h
+ * @brief List of the platform operations, that will be performed by the command sequences.
+ *
+ * The plan is filled by the dry run: each directive, accepted by the suit_plat_check_* API,
+ * is recorded together with its parameters. The number of bytes, written by the recorded
+ * operations, is summed for each storage area, reported by the integrator.
+ */
+
+enum suit_plan_op_type {
+	SUIT_PLAN_OP_FETCH,
+	SUIT_PLAN_OP_FETCH_INTEGRATED,
+	SUIT_PLAN_OP_COPY,
+	SUIT_PLAN_OP_WRITE,
+	SUIT_PLAN_OP_SWAP,
+	SUIT_PLAN_OP_APPLY_DELTA,
+	SUIT_PLAN_OP_INVOKE,
+};
+
+/** @brief Single platform operation. */
+struct suit_plan_op {
+	enum suit_plan_op_type type;
+	enum suit_command_sequence seq; ///! The sequence, that performs the operation.
+	suit_component_t dst_handle;	///! The modified or invoked component.
+	suit_component_t src_handle;	///! The source of the copy, swap or the base of the delta.
+	struct zcbor_string uri;	///! The fetched URI, pointing inside the envelope.
+	size_t size;			///! The number of written bytes, 0 if unknown.
+	bool encrypted;			///! The payload is decrypted by the operation.
+	enum suit_cose_alg enc_alg_id;	///! The content encryption algorithm, if encrypted.
+};
+
+/** @brief The number of bytes, written to a single storage area. */
+struct suit_plan_area {
+	uint32_t id;
+	size_t bytes;
+};
+
+/** @brief Find the storage area of the component.
+ *
+ * @param[in]   ctx     The context, passed to suit_plan_init.
+ * @param[in]   handle  The component handle.
+ * @param[out]  area    The ID of the storage area, that contains the component.
+ *
+ * @returns SUIT_SUCCESS if the area was found, error code otherwise.
+ */
+typedef int (*suit_plan_get_area_t)(void *ctx, suit_component_t handle, uint32_t *area);
+
+struct suit_plan {
+	struct suit_plan_op *ops;
+	size_t ops_max;
+	size_t ops_count;
+	struct suit_plan_area *areas;
+	size_t areas_max;
+	size_t areas_count;
+	suit_plan_get_area_t get_area;
+	void *ctx;
+	enum suit_command_sequence seq; ///! The sequence, currently executed by the dry run.
+};
+
+/** @brief Prepare an empty plan.
+ *
+ * @param[out]  plan       The plan to initialize.
+ * @param[in]   ops        The array for the recorded operations.
+ * @param[in]   ops_max    The number of elements in the ops array.
+ * @param[in]   areas      The array for the storage area totals, NULL if not needed.
+ * @param[in]   areas_max  The number of elements in the areas array.
+ * @param[in]   get_area   The storage area lookup, NULL if the totals are not needed.
+ * @param[in]   ctx        The context, passed to the get_area function.
+ *
+ * @returns SUIT_SUCCESS if the plan was initialized, SUIT_ERR_CRASH if the arguments are invalid.
+ */
+int suit_plan_init(struct suit_plan *plan, struct suit_plan_op *ops, size_t ops_max,
+		   struct suit_plan_area *areas, size_t areas_max,
+		   suit_plan_get_area_t get_area, void *ctx);
+
+/** @brief Append the operation to the plan and add its size to the storage area totals.
+ *
+ * @details The swap rewrites both components, so its size is added to the areas of both of them.
+ *          The size of the invoke and operations of unknown size are not added to any area.
+ *
+ * @param[in]  plan  The plan to fill.
+ * @param[in]  op    The recorded operation.
+ *
+ * @returns SUIT_SUCCESS if the operation was recorded,
+ *          SUIT_ERR_CRASH if the arguments are invalid,
+ *          SUIT_ERR_OVERFLOW if the ops or areas array is full,
+ *          the error returned by the get_area function otherwise.
+ */
+int suit_plan_record(struct suit_plan *plan, const struct suit_plan_op *op);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_PLAN_H__ */
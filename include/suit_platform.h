@@ -176,12 +176,14 @@ int suit_plat_authorize_component_id(struct zcbor_string *manifest_component_id,
  * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
  *                                   in the system.
  * @param[in] enc_info               A reference to the structure, containing encryption info.
+ * @param[in] comp_info              A reference to the structure, containing compression info.
  *
  * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
  */
 int suit_plat_fetch(suit_component_t dst_handle, struct zcbor_string *uri,
 		    struct zcbor_string *manifest_component_id,
-		    struct suit_encryption_info *enc_info);
+		    struct suit_encryption_info *enc_info,
+		    struct suit_compression_info *comp_info);
 
 /** @brief Fetch the given integrated payload into @p dst_handle.
  *
@@ -190,12 +192,14 @@ int suit_plat_fetch(suit_component_t dst_handle, struct zcbor_string *uri,
  * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
  *                                   in the system.
  * @param[in] enc_info               A reference to the structure, containing encryption info.
+ * @param[in] comp_info              A reference to the structure, containing compression info.
  *
  * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
  */
 int suit_plat_fetch_integrated(suit_component_t dst_handle, struct zcbor_string *payload,
 			       struct zcbor_string *manifest_component_id,
-			       struct suit_encryption_info *enc_info);
+			       struct suit_encryption_info *enc_info,
+			       struct suit_compression_info *comp_info);
 
 /** @brief Copy a payload from @p src_handle to @p dst_handle.
  *
@@ -204,14 +208,21 @@ int suit_plat_fetch_integrated(suit_component_t dst_handle, struct zcbor_string
  * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
  *                                   in the system.
  * @param[in] enc_info               A reference to the structure, containing encryption info.
+ * @param[in] comp_info              A reference to the structure, containing compression info.
  *
  * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
  */
 int suit_plat_copy(suit_component_t dst_handle, suit_component_t src_handle,
 		   struct zcbor_string *manifest_component_id,
-		   struct suit_encryption_info *enc_info);
+		   struct suit_encryption_info *enc_info,
+		   struct suit_compression_info *comp_info);
 
 /** @brief Swap a payload from @p src_handle to @p dst_handle.
+ *
+ * @details The contents of both components are exchanged. The operation may be split into
+ *          several steps by returning SUIT_ERR_AGAIN. In such case the platform is called again
+ *          with the same arguments until it returns a different value, so the platform must keep
+ *          track of the swap progress.
  *
  * @param[in] dst_handle             A reference to the destination component.
  * @param[in] src_handle             A reference to the source component.
@@ -225,6 +236,29 @@ int suit_plat_swap(suit_component_t dst_handle, suit_component_t src_handle,
 		   struct zcbor_string *manifest_component_id,
 		   struct suit_encryption_info *enc_info);
 
+/** @brief Construct a payload in @p dst_handle by applying a patch onto a base image.
+ *
+ * @details The patch, stored in @p patch_handle, is applied onto the contents of @p base_handle
+ *          and the result is written into @p dst_handle. The patch format is described in
+ *          suit_delta.h, which also provides a streaming patch applier.
+ *          The digest of the base image is verified before this function is called and the digest
+ *          of the result is verified after it returns SUIT_SUCCESS.
+ *          The operation may be split into several steps by returning SUIT_ERR_AGAIN. In such case
+ *          the platform is called again with the same arguments until it returns a different value,
+ *          so the platform must keep track of the progress.
+ *
+ * @param[in] dst_handle             A reference to the destination component.
+ * @param[in] base_handle            A reference to the component, containing the base image.
+ * @param[in] patch_handle           A reference to the component, containing the patch.
+ * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
+ *                                   in the system.
+ *
+ * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
+ */
+int suit_plat_apply_delta(suit_component_t dst_handle, suit_component_t base_handle,
+			  suit_component_t patch_handle,
+			  struct zcbor_string *manifest_component_id);
+
 /** @brief Write a payload from @p content to @p dst_handle.
  *
  * @param[in] dst_handle             A reference to the destination component.
@@ -232,12 +266,14 @@ int suit_plat_swap(suit_component_t dst_handle, suit_component_t src_handle,
  * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
  *                                   in the system.
  * @param[in] enc_info               A reference to the structure, containing encryption info.
+ * @param[in] comp_info              A reference to the structure, containing compression info.
  *
  * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
  */
 int suit_plat_write(suit_component_t dst_handle, struct zcbor_string *content,
 		    struct zcbor_string *manifest_component_id,
-		    struct suit_encryption_info *enc_info);
+		    struct suit_encryption_info *enc_info,
+		    struct suit_compression_info *comp_info);
 
 /** @brief Invoke the given image.
  *
@@ -251,7 +287,10 @@ int suit_plat_invoke(suit_component_t image_handle, struct zcbor_string *invoke_
 
 /** @brief File a report on a command result.
  *
- * @note This API is currently not supported.
+ * @details If CONFIG_SUIT_PLATFORM_REPORT_SUPPORT is enabled, the results of the commands are
+ *          buffered and passed to the platform at the end of the sequence or once the buffer
+ *          is full. Reports with the system information are passed right after the command
+ *          is executed, so the parameter references are valid only until this function returns.
  *
  * @param[in] rep_policy  Reporting policy.
  * @param[in] report      Reference to the structure with the SUIT report to store.
@@ -327,6 +366,124 @@ int suit_plat_authorize_process_dependency(struct zcbor_string *parent_component
  */
 int suit_plat_component_version_get(suit_component_t handle, int *version, size_t *version_len);
 
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+/** @brief Persist the checkpoint of the sequence execution.
+ *
+ * @details The checkpoint is stored after each completed directive. It is an opaque,
+ *          pointer-free structure that has to be returned by the suit_plat_checkpoint_load(..)
+ *          after reboot in order to resume the sequence execution.
+ *
+ * @param[in] seq_name               The executed SUIT manifest sequence.
+ * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
+ *                                   in the system.
+ * @param[in] checkpoint             A reference to the checkpoint data.
+ * @param[in] checkpoint_len         The length of the checkpoint data.
+ *
+ * @returns SUIT_SUCCESS if the checkpoint was stored, error code otherwise.
+ */
+int suit_plat_checkpoint_store(enum suit_command_sequence seq_name,
+			       struct zcbor_string *manifest_component_id,
+			       const uint8_t *checkpoint, size_t checkpoint_len);
+
+/** @brief Read the last stored checkpoint of the sequence execution.
+ *
+ * @param[in]     seq_name               The SUIT manifest sequence to be executed.
+ * @param[in]     manifest_component_id  The manifest component ID, identifying the type of
+ *                                       manifest in the system.
+ * @param[out]    checkpoint             A buffer to store the checkpoint data.
+ * @param[in,out] checkpoint_len         As input - the size of the buffer,
+ *                                       as output - the length of the checkpoint data.
+ *
+ * @returns SUIT_SUCCESS if the checkpoint was found, error code otherwise.
+ */
+int suit_plat_checkpoint_load(enum suit_command_sequence seq_name,
+			      struct zcbor_string *manifest_component_id,
+			      uint8_t *checkpoint, size_t *checkpoint_len);
+
+/** @brief Remove the stored checkpoint of the sequence execution.
+ *
+ * @param[in] seq_name               The executed SUIT manifest sequence.
+ * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
+ *                                   in the system.
+ *
+ * @returns SUIT_SUCCESS if the checkpoint was removed or does not exist, error code otherwise.
+ */
+int suit_plat_checkpoint_clear(enum suit_command_sequence seq_name,
+			       struct zcbor_string *manifest_component_id);
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+
+#ifdef SUIT_PLATFORM_TRACE_SUPPORT
+/** @brief Get the current timestamp, used to measure the duration of the traced calls.
+ *
+ * @details The unit is defined by the platform, i.e. the value of a cycle counter.
+ *          The timestamp must be monotonic, except for the wrap-around.
+ *
+ * @returns The current timestamp.
+ */
+uint32_t suit_plat_trace_timestamp(void);
+#endif /* SUIT_PLATFORM_TRACE_SUPPORT */
+
+#ifdef SUIT_PLATFORM_PREFETCH_SUPPORT
+/** @brief Announce the dependency manifest, that may be retrieved by the following sequences.
+ *
+ * @details The dependency manifests are announced in the order of the components, before the shared
+ *          sequence of the root manifest is validated. The platform may start reading the manifest
+ *          in the background, so the suit_plat_retrieve_manifest call does not block.
+ *          The same component may be announced more than once. The hint does not guarantee
+ *          that the manifest will be retrieved.
+ *
+ * @param[in] component_handle  Handle of the dependency manifest component.
+ *
+ * @returns SUIT_SUCCESS if the hint was accepted, error code otherwise. The result is ignored.
+ */
+int suit_plat_prefetch_manifest(suit_component_t component_handle);
+
+/** @brief Announce the URI, that may be fetched by the following sequences.
+ *
+ * @details The URIs are announced in the order of the commands, while the sequences are validated.
+ *          The platform may start downloading the payload in the background, so the suit_plat_fetch
+ *          call does not block. URIs of the integrated payloads are not announced.
+ *          The same URI may be announced more than once. The hint does not guarantee
+ *          that the URI will be fetched.
+ *
+ * @param[in] uri                    The URI, pointing inside the envelope.
+ * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
+ *                                   in the system.
+ *
+ * @returns SUIT_SUCCESS if the hint was accepted, error code otherwise. The result is ignored.
+ */
+int suit_plat_prefetch_uri(struct zcbor_string *uri, struct zcbor_string *manifest_component_id);
+#endif /* SUIT_PLATFORM_PREFETCH_SUPPORT */
+
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+/** @brief Get the chunk of the data, starting at the given offset.
+ *
+ * @param[in]  ctx     The context, passed to suit_plat_check_digest_chunked.
+ * @param[in]  offset  The offset inside the data.
+ * @param[out] chunk   The chunk, valid until the next call. Its length is never zero.
+ *
+ * @returns SUIT_SUCCESS if the chunk is available, error code otherwise.
+ */
+typedef int (*suit_plat_digest_chunk_t)(void *ctx, size_t offset, struct zcbor_string *chunk);
+
+/** @brief Check the data, read in chunks, against the provided digest.
+ *
+ * @details The platform calls @p get_chunk with the offset of the first byte, that is not yet
+ *          digested, until @p len bytes are digested. If the chunk cannot be read,
+ *          the error returned by @p get_chunk is returned.
+ *
+ * @param[in] alg_id     The digest verification algorithm to use.
+ * @param[in] digest     Expected digest value.
+ * @param[in] len        The length of the data.
+ * @param[in] get_chunk  The callback, used to read the data.
+ * @param[in] ctx        The context, passed to the @p get_chunk callback.
+ *
+ * @returns SUIT_SUCCESS if the digest matches, error code otherwise.
+ */
+int suit_plat_check_digest_chunked(enum suit_cose_alg alg_id, struct zcbor_string *digest, size_t len,
+				   suit_plat_digest_chunk_t get_chunk, void *ctx);
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 /** @brief Check that the given fetch operation can be performed.
  *
@@ -335,12 +492,14 @@ int suit_plat_component_version_get(suit_component_t handle, int *version, size_
  * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
  *                                   in the system.
  * @param[in] enc_info               A reference to the structure, containing encryption info.
+ * @param[in] comp_info              A reference to the structure, containing compression info.
  *
  * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
  */
 int suit_plat_check_fetch(suit_component_t dst_handle, struct zcbor_string *uri,
 			  struct zcbor_string *manifest_component_id,
-			  struct suit_encryption_info *enc_info);
+			  struct suit_encryption_info *enc_info,
+			  struct suit_compression_info *comp_info);
 
 /** @brief Check that the given fetch of integrated payload can be performed.
  *
@@ -349,12 +508,14 @@ int suit_plat_check_fetch(suit_component_t dst_handle, struct zcbor_string *uri,
  * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
  *                                   in the system.
  * @param[in] enc_info               A reference to the structure, containing encryption info.
+ * @param[in] comp_info              A reference to the structure, containing compression info.
  *
  * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
  */
 int suit_plat_check_fetch_integrated(suit_component_t dst_handle, struct zcbor_string *payload,
 				     struct zcbor_string *manifest_component_id,
-				     struct suit_encryption_info *enc_info);
+				     struct suit_encryption_info *enc_info,
+				     struct suit_compression_info *comp_info);
 
 /** @brief Check that the given copy operation can be performed.
  *
@@ -363,12 +524,14 @@ int suit_plat_check_fetch_integrated(suit_component_t dst_handle, struct zcbor_s
  * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
  *                                   in the system.
  * @param[in] enc_info               A reference to the structure, containing encryption info.
+ * @param[in] comp_info              A reference to the structure, containing compression info.
  *
  * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
  */
 int suit_plat_check_copy(suit_component_t dst_handle, suit_component_t src_handle,
 			 struct zcbor_string *manifest_component_id,
-			 struct suit_encryption_info *enc_info);
+			 struct suit_encryption_info *enc_info,
+			 struct suit_compression_info *comp_info);
 
 /** @brief Check that the given swap operation can be performed.
  *
@@ -384,6 +547,20 @@ int suit_plat_check_swap(suit_component_t dst_handle, suit_component_t src_handl
 			 struct zcbor_string *manifest_component_id,
 			 struct suit_encryption_info *enc_info);
 
+/** @brief Check that the given patch can be applied.
+ *
+ * @param[in] dst_handle             A reference to the destination component.
+ * @param[in] base_handle            A reference to the component, containing the base image.
+ * @param[in] patch_handle           A reference to the component, containing the patch.
+ * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
+ *                                   in the system.
+ *
+ * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
+ */
+int suit_plat_check_apply_delta(suit_component_t dst_handle, suit_component_t base_handle,
+				suit_component_t patch_handle,
+				struct zcbor_string *manifest_component_id);
+
 /** @brief Check that the given invoke operation can be performed.
  *
  * @param[in] dst_handle             A reference to the destination component.
@@ -391,12 +568,14 @@ int suit_plat_check_swap(suit_component_t dst_handle, suit_component_t src_handl
  * @param[in] manifest_component_id  The manifest component ID, identifying the type of manifest
  *                                   in the system.
  * @param[in] enc_info               A reference to the structure, containing encryption info.
+ * @param[in] comp_info              A reference to the structure, containing compression info.
  *
  * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
  */
 int suit_plat_check_write(suit_component_t dst_handle, struct zcbor_string *content,
 			  struct zcbor_string *manifest_component_id,
-			  struct suit_encryption_info *enc_info);
+			  struct suit_encryption_info *enc_info,
+			  struct suit_compression_info *comp_info);
 
 /** @brief Check that the given invoke operation can be performed.
  *
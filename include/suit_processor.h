@@ -8,6 +8,10 @@
 #define SUIT_PROCESSOR_H__
 
 #include <suit_types.h>
+#include <suit_plan.h>
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+#include <suit_envelope_reader.h>
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
 #include "manifest_types.h"
 
 #ifdef __cplusplus
@@ -31,6 +35,7 @@ typedef struct {
 		struct SUIT_Condition_r condition;
 		struct SUIT_Directive_r directive;
 	};
+	uint32_t rep_policy; ///! The SUIT_Rep_Policy bits or zero if the command has no reporting policy.
 } suit_command_t;
 
 /** @brief Single command handler function prototype.
@@ -50,10 +55,53 @@ struct suit_semver {
 	uint_fast32_t count;
 };
 
+/** @brief Identifiers of the SUIT component parameters, tracked inside the presence mask. */
+enum suit_param_id {
+	SUIT_PARAM_VID,
+	SUIT_PARAM_CID,
+	SUIT_PARAM_IMAGE_DIGEST,
+	SUIT_PARAM_IMAGE_SIZE,
+	SUIT_PARAM_CONTENT,
+	SUIT_PARAM_COMPONENT_SLOT,
+	SUIT_PARAM_URI,
+	SUIT_PARAM_SOURCE_COMPONENT,
+	SUIT_PARAM_INVOKE_ARGS,
+	SUIT_PARAM_DID,
+	SUIT_PARAM_VERSION,
+	SUIT_PARAM_ENCRYPTION_INFO,
+	SUIT_PARAM_COMPRESSION_INFO,
+	SUIT_PARAM_BASE_DIGEST,
+	SUIT_PARAM_PATCH_COMPONENT,
+	SUIT_PARAM_MAX,
+};
+
+/** @brief The parameter values, decoded and validated when the parameter is set.
+ *
+ * @note The raw byte string values are kept inside the suit_manifest_params structure,
+ *       so the parameters may be reported and stored inside the checkpoint.
+ */
+struct suit_decoded_params {
+	enum suit_cose_alg image_digest_alg; ///! The algorithm of the image digest.
+	struct zcbor_string image_digest_bytes; ///! The image digest bytes.
+	struct suit_semver version; ///! The version to compare with the component version.
+	unsigned int version_comparison; ///! The version comparison type, as encoded in the manifest.
+#ifndef SUIT_PRUNE_ENCRYPTION
+	struct suit_encryption_info enc_info;
+#endif /* SUIT_PRUNE_ENCRYPTION */
+	struct suit_compression_info comp_info;
+	enum suit_cose_alg base_digest_alg; ///! The algorithm of the base image digest.
+	struct zcbor_string base_digest_bytes; ///! The base image digest bytes.
+};
+
+/** @brief The values of the SUIT component parameters.
+ *
+ * @note The byte string values are kept as pointers, because a parameter may be set by
+ *       a dependency manifest, located outside of the envelope of the manifest, that
+ *       uses the component.
+ */
 struct suit_manifest_params {
 	suit_component_t component_handle;
 	struct zcbor_string component_id;
-	uint_fast32_t ref_count;
 
 	struct zcbor_string vid;
 	struct zcbor_string cid;
@@ -67,24 +115,49 @@ struct suit_manifest_params {
 	struct zcbor_string did;
 	struct zcbor_string version;
 	struct zcbor_string encryption_info;
-
-	bool vid_set;
-	bool cid_set;
-	bool image_digest_set;
-	bool image_size_set;
-	bool content_set;
-	bool component_slot_set;
-	bool uri_set;
-	bool source_component_set;
-	bool invoke_args_set;
-	bool did_set;
-	bool version_set;
-	bool encryption_info_set;
+	struct zcbor_string compression_info;
+	struct zcbor_string base_digest;
+	unsigned int patch_component;
+	struct suit_decoded_params decoded;
 
 	enum suit_bool is_dependency;
+	uint16_t set_mask; ///! Bitmask of the parameters, set by the manifest, indexed by the
+			   /// enum suit_param_id values.
+	uint8_t ref_count;
 	bool integrity_checked;
 };
 
+#if SUIT_MANIFEST_STACK_MAX_ENTRIES > UINT8_MAX
+#error "The component reference counter is able to store up to 255 references"
+#endif
+
+/** @brief Check if the parameter value is set.
+ *
+ * @param[in] params  The component parameters.
+ * @param[in] param   The parameter to check.
+ *
+ * @returns true if the parameter value is set, false otherwise.
+ */
+static inline bool suit_param_is_set(const struct suit_manifest_params *params, enum suit_param_id param)
+{
+	return ((params->set_mask & (1U << param)) != 0);
+}
+
+/** @brief Mark the parameter value as set or unset.
+ *
+ * @param[in] params  The component parameters to modify.
+ * @param[in] param   The parameter to mark.
+ * @param[in] set     The new state of the parameter.
+ */
+static inline void suit_param_set_flag(struct suit_manifest_params *params, enum suit_param_id param, bool set)
+{
+	if (set) {
+		params->set_mask |= (uint16_t)(1U << param);
+	} else {
+		params->set_mask &= (uint16_t)~(1U << param);
+	}
+}
+
 /** The envelope contains the manifest and its signature plus a few other things.
  *
  *  The envelope contains:
@@ -120,6 +193,12 @@ enum suit_decoder_step {
 	LAST_STEP,
 };
 
+/** @brief The envelope, decoded by the decoder, replaced by the manifest once it is decoded. */
+union suit_decoded_envelope {
+	suit_manifest_envelope_t envelope;
+	suit_manifest_t manifest;
+};
+
 struct suit_decoder_state {
 	struct suit_manifest_state *decoded_manifest;
 	enum suit_decoder_step step;
@@ -128,10 +207,18 @@ struct suit_decoder_state {
 	struct zcbor_string authentication_bstr[2];
 	uint_fast32_t authentication_bstr_count;
 
-	union {
-		suit_manifest_envelope_t envelope;
-		suit_manifest_t manifest;
-	};
+	/** The decoded structures, allocated from the scratch region (see suit_arena.h).
+	 *  Released, once the components are created or the decoder state is reset.
+	 */
+	union suit_decoded_envelope *decoded;
+	size_t arena_mark; ///! The allocation mark, restored when the decoded structures are released.
+
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+	/** The reader of the storage, the decoded envelope was loaded from, NULL if the envelope
+	 *  digests are checked inside the envelope buffer.
+	 */
+	struct suit_envelope_reader *envelope_reader;
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
 };
 
 enum suit_seq_status {
@@ -140,50 +227,301 @@ enum suit_seq_status {
 	AUTHENTICATED,
 };
 
+/** @brief Side effects of a command sequence, ordered by their scope.
+ *
+ * @details The effect of a sequence includes the effects of the try-each and run-sequence
+ *          bodies, nested inside it.
+ */
+enum suit_seq_effect {
+	SUIT_SEQ_EFFECT_PURE,	     ///! Conditions and parameters, that are not passed to the platform.
+	SUIT_SEQ_EFFECT_LOCAL_WRITE, ///! Overrides the image size, that is passed to the platform.
+	SUIT_SEQ_EFFECT_EXTERNAL,    ///! Modifies or invokes components or processes dependencies.
+};
+
+#ifdef SUIT_ENVELOPE_16BIT_OFFSETS
+/** Offset or length of a byte string inside the envelope, limiting the envelope size to 64 kB. */
+typedef uint16_t suit_envelope_off_t;
+#define SUIT_ENVELOPE_MAX_LEN UINT16_MAX
+#else /* SUIT_ENVELOPE_16BIT_OFFSETS */
+/** Offset or length of a byte string inside the envelope. */
+typedef uint32_t suit_envelope_off_t;
+#define SUIT_ENVELOPE_MAX_LEN UINT32_MAX
+#endif /* SUIT_ENVELOPE_16BIT_OFFSETS */
+
+/** @brief Location of a byte string, relative to the beginning of the envelope.
+ *
+ * @note A zero offset with zero length is used to encode an empty (NULL) byte string.
+ */
+struct suit_envelope_ref {
+	suit_envelope_off_t offset;
+	suit_envelope_off_t len;
+};
+
 struct suit_integrated_payload {
-	struct zcbor_string key;
-	struct zcbor_string payload;
+	struct suit_envelope_ref key;
+	struct suit_envelope_ref payload;
 };
 
+/** The pseudo-sequence name, used to access the text manifest member. */
+#define SUIT_MANIFEST_TEXT ((enum suit_command_sequence)SUIT_SEQ_MAX)
+/** The number of manifest members, stored inside the manifest state: all sequences and the text. */
+#define SUIT_MANIFEST_MEMBERS_COUNT (SUIT_MANIFEST_TEXT - SUIT_SEQ_SHARED + 1)
+/** The number of bits, used to store the status of a single manifest member. */
+#define SUIT_SEQ_STATUS_BITS 2
+
+#if SUIT_MAX_NUM_COMPONENT_PARAMS > UINT8_MAX
+#error "The component map is able to address up to 255 component parameters"
+#endif
+
+/** @brief Decoded manifest.
+ *
+ * @details The command sequences, the text, the current version and the integrated payloads are
+ *          stored as locations, relative to the envelope_str.
+ *          Use the suit_manifest_get_command_seq, suit_manifest_get_seq and
+ *          suit_manifest_get_seq_status to access the manifest members.
+ */
 struct suit_manifest_state {
 	struct zcbor_string envelope_str;
 	struct zcbor_string manifest_component_id;
-	struct zcbor_string current_version;
+	struct suit_envelope_ref current_version;
 	uint32_t sequence_number;
 
 	struct suit_integrated_payload integrated_payloads[SUIT_MAX_NUM_INTEGRATED_PAYLOADS];
-	size_t integrated_payloads_count;
+	uint8_t integrated_payloads_count;
 
-	size_t component_map[SUIT_MAX_NUM_COMPONENTS];
-	size_t components_count;
+	uint8_t components_count;
+	uint8_t component_map[SUIT_MAX_NUM_COMPONENTS];
+	uint8_t seq_effect_pending; ///! The enum suit_seq_effect value, collected while a sequence is validated.
 
-	struct zcbor_string shared_sequence;
-	enum suit_seq_status shared_sequence_status;
+	/** Locations of the manifest members, indexed by (enum suit_command_sequence - SUIT_SEQ_SHARED). */
+	struct suit_envelope_ref sequences[SUIT_MANIFEST_MEMBERS_COUNT];
+	uint32_t seq_status; ///! The enum suit_seq_status values, SUIT_SEQ_STATUS_BITS per member.
+	uint32_t seq_effect; ///! The enum suit_seq_effect values, SUIT_SEQ_STATUS_BITS per member,
+			     /// stored once the sequences are validated.
+};
 
-	struct zcbor_string dependency_resolution_seq;
-	enum suit_seq_status dependency_resolution_seq_status;
+/** @brief Get the index of the manifest member inside the suit_manifest_state structure.
+ *
+ * @param[in]  seq_name  Name of the command sequence or SUIT_MANIFEST_TEXT.
+ * @param[out] index     The index of the manifest member.
+ *
+ * @returns true if the manifest member is stored inside the manifest state, false otherwise.
+ */
+static inline bool suit_manifest_seq_index(enum suit_command_sequence seq_name, size_t *index)
+{
+	if ((seq_name < SUIT_SEQ_SHARED) || (seq_name > SUIT_MANIFEST_TEXT)) {
+		return false;
+	}
 
-	struct zcbor_string payload_fetch_seq;
-	enum suit_seq_status payload_fetch_seq_status;
+	*index = (size_t)(seq_name - SUIT_SEQ_SHARED);
 
-	struct zcbor_string candidate_verification_seq;
-	enum suit_seq_status candidate_verification_seq_status;
+	return true;
+}
 
-	struct zcbor_string install_seq;
-	enum suit_seq_status install_seq_status;
+/** @brief Convert the byte string into the location, relative to the envelope of the manifest.
+ *
+ * @param[in]  manifest  Manifest structure, defining the envelope.
+ * @param[in]  str       ZCBOR string to convert. A NULL string is converted into an empty location.
+ * @param[out] ref       The location of the byte string.
+ *
+ * @returns SUIT_SUCCESS if the string was converted,
+ *          SUIT_ERR_OVERFLOW if the string is not located inside the envelope or the location
+ *                            does not fit into the suit_envelope_off_t type,
+ *          SUIT_ERR_CRASH if one of the arguments is invalid.
+ */
+static inline int suit_manifest_str_to_ref(const struct suit_manifest_state *manifest,
+					   const struct zcbor_string *str, struct suit_envelope_ref *ref)
+{
+	const struct zcbor_string *envelope;
+	size_t offset;
+
+	if ((manifest == NULL) || (str == NULL) || (ref == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if (str->value == NULL) {
+		ref->offset = 0;
+		ref->len = 0;
+		return SUIT_SUCCESS;
+	}
+
+	envelope = &manifest->envelope_str;
+	if ((envelope->value == NULL) || (str->value < envelope->value) ||
+	    (str->len > envelope->len) ||
+	    ((size_t)(str->value - envelope->value) > (envelope->len - str->len))) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	offset = (size_t)(str->value - envelope->value);
+	if ((offset > SUIT_ENVELOPE_MAX_LEN) || (str->len > SUIT_ENVELOPE_MAX_LEN)) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	ref->offset = (suit_envelope_off_t)offset;
+	ref->len = (suit_envelope_off_t)str->len;
+
+	return SUIT_SUCCESS;
+}
 
-	struct zcbor_string validate_seq;
-	enum suit_seq_status validate_seq_status;
+/** @brief Convert the location, relative to the envelope of the manifest, into the byte string.
+ *
+ * @param[in]  manifest  Manifest structure, defining the envelope.
+ * @param[in]  ref       The location of the byte string.
+ * @param[out] str       ZCBOR string. An empty location is converted into a NULL string.
+ */
+static inline void suit_manifest_ref_to_str(const struct suit_manifest_state *manifest,
+					    const struct suit_envelope_ref *ref, struct zcbor_string *str)
+{
+	if ((ref->len == 0) && (ref->offset == 0)) {
+		str->value = NULL;
+		str->len = 0;
+	} else {
+		str->value = manifest->envelope_str.value + ref->offset;
+		str->len = ref->len;
+	}
+}
 
-	struct zcbor_string load_seq;
-	enum suit_seq_status load_seq_status;
+/** @brief Get the status of the manifest member.
+ *
+ * @param[in] manifest  Manifest structure, defining the context for the command sequence.
+ * @param[in] seq_name  Name of the command sequence or SUIT_MANIFEST_TEXT.
+ *
+ * @returns The status of the manifest member, UNAVAILABLE for unknown members.
+ */
+static inline enum suit_seq_status suit_manifest_get_seq_status(const struct suit_manifest_state *manifest,
+								enum suit_command_sequence seq_name)
+{
+	size_t index;
 
-	struct zcbor_string invoke_seq;
-	enum suit_seq_status invoke_seq_status;
+	if ((manifest == NULL) || !suit_manifest_seq_index(seq_name, &index)) {
+		return UNAVAILABLE;
+	}
 
-	struct zcbor_string text;
-	enum suit_seq_status text_status;
-};
+	return (enum suit_seq_status)((manifest->seq_status >> (index * SUIT_SEQ_STATUS_BITS)) &
+				      ((1UL << SUIT_SEQ_STATUS_BITS) - 1));
+}
+
+/** @brief Set the status of the manifest member.
+ *
+ * @param[in] manifest  Manifest structure to modify.
+ * @param[in] seq_name  Name of the command sequence or SUIT_MANIFEST_TEXT.
+ * @param[in] status    The new status of the manifest member.
+ *
+ * @returns SUIT_SUCCESS if the status was set, SUIT_ERR_CRASH otherwise.
+ */
+static inline int suit_manifest_set_seq_status(struct suit_manifest_state *manifest,
+					       enum suit_command_sequence seq_name,
+					       enum suit_seq_status status)
+{
+	const uint32_t mask = ((1UL << SUIT_SEQ_STATUS_BITS) - 1);
+	size_t index;
+
+	if ((manifest == NULL) || !suit_manifest_seq_index(seq_name, &index) || (status > mask)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	manifest->seq_status &= ~(mask << (index * SUIT_SEQ_STATUS_BITS));
+	manifest->seq_status |= ((uint32_t)status << (index * SUIT_SEQ_STATUS_BITS));
+
+	return SUIT_SUCCESS;
+}
+
+/** @brief Get the side effects of the command sequence.
+ *
+ * @details The effect is stored once the sequence is successfully validated with
+ *          suit_schedule_validation. Until then, SUIT_SEQ_EFFECT_EXTERNAL is returned.
+ *          The values are stored inverted, so the zeroed manifest state reports the external effect.
+ *
+ * @param[in] manifest  Manifest structure, defining the context for the command sequence.
+ * @param[in] seq_name  Name of the command sequence.
+ *
+ * @returns The side effects of the command sequence, SUIT_SEQ_EFFECT_EXTERNAL for unknown sequences.
+ */
+static inline enum suit_seq_effect suit_manifest_get_seq_effect(const struct suit_manifest_state *manifest,
+								enum suit_command_sequence seq_name)
+{
+	size_t index;
+
+	if ((manifest == NULL) || (seq_name == SUIT_MANIFEST_TEXT) ||
+	    !suit_manifest_seq_index(seq_name, &index)) {
+		return SUIT_SEQ_EFFECT_EXTERNAL;
+	}
+
+	return (enum suit_seq_effect)(SUIT_SEQ_EFFECT_EXTERNAL -
+				      ((manifest->seq_effect >> (index * SUIT_SEQ_STATUS_BITS)) &
+				       ((1UL << SUIT_SEQ_STATUS_BITS) - 1)));
+}
+
+/** @brief Set the side effects of the command sequence.
+ *
+ * @param[in] manifest  Manifest structure to modify.
+ * @param[in] seq_name  Name of the command sequence.
+ * @param[in] effect    The side effects of the command sequence.
+ *
+ * @returns SUIT_SUCCESS if the value was set, SUIT_ERR_CRASH otherwise.
+ */
+static inline int suit_manifest_set_seq_effect(struct suit_manifest_state *manifest,
+					       enum suit_command_sequence seq_name,
+					       enum suit_seq_effect effect)
+{
+	const uint32_t mask = ((1UL << SUIT_SEQ_STATUS_BITS) - 1);
+	size_t index;
+
+	if ((manifest == NULL) || (seq_name == SUIT_MANIFEST_TEXT) ||
+	    !suit_manifest_seq_index(seq_name, &index) || (effect > SUIT_SEQ_EFFECT_EXTERNAL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	manifest->seq_effect &= ~(mask << (index * SUIT_SEQ_STATUS_BITS));
+	manifest->seq_effect |= ((uint32_t)(SUIT_SEQ_EFFECT_EXTERNAL - effect) << (index * SUIT_SEQ_STATUS_BITS));
+
+	return SUIT_SUCCESS;
+}
+
+/** @brief Get the manifest member, regardless of its status.
+ *
+ * @param[in]  manifest  Manifest structure, defining the context for the command sequence.
+ * @param[in]  seq_name  Name of the command sequence or SUIT_MANIFEST_TEXT.
+ * @param[out] sequence  ZCBOR string holding the manifest member.
+ *
+ * @returns SUIT_SUCCESS if the manifest member was returned, SUIT_ERR_CRASH otherwise.
+ */
+static inline int suit_manifest_get_seq(const struct suit_manifest_state *manifest,
+					enum suit_command_sequence seq_name,
+					struct zcbor_string *sequence)
+{
+	size_t index;
+
+	if ((manifest == NULL) || (sequence == NULL) || !suit_manifest_seq_index(seq_name, &index)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	suit_manifest_ref_to_str(manifest, &manifest->sequences[index], sequence);
+
+	return SUIT_SUCCESS;
+}
+
+/** @brief Store the location of the manifest member.
+ *
+ * @param[in] manifest  Manifest structure to modify.
+ * @param[in] seq_name  Name of the command sequence or SUIT_MANIFEST_TEXT.
+ * @param[in] sequence  ZCBOR string holding the manifest member.
+ *                      The string must be located inside the envelope of the manifest.
+ *
+ * @returns SUIT_SUCCESS if the location was stored, error code otherwise.
+ */
+static inline int suit_manifest_set_seq(struct suit_manifest_state *manifest,
+					enum suit_command_sequence seq_name,
+					const struct zcbor_string *sequence)
+{
+	size_t index;
+
+	if ((manifest == NULL) || (sequence == NULL) || !suit_manifest_seq_index(seq_name, &index)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	return suit_manifest_str_to_ref(manifest, sequence, &manifest->sequences[index]);
+}
 
 /** @brief Structure describing manifest processor execution state.
  *
@@ -222,13 +560,31 @@ struct suit_processor_state {
 
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 	enum suit_bool dry_run;
+	struct suit_plan *plan; ///! The plan, filled by the dry run, NULL if not requested.
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+	enum suit_bool checkpoint_enabled;
+	struct zcbor_string checkpoint_manifest_digest; ///! The digest of the root manifest.
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+	struct suit_envelope_reader *envelope_reader; ///! The reader of the root envelope, NULL if not loaded from a storage.
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
 	struct suit_manifest_params components[SUIT_MAX_NUM_COMPONENT_PARAMS];
 
 	size_t manifest_stack_height;
 	struct suit_manifest_state manifest_stack[SUIT_MANIFEST_STACK_MAX_ENTRIES];
 
+#ifndef SUIT_PRUNE_DEPENDENCIES
+	struct suit_manifest_params *pinned_owners[SUIT_MAX_PINNED_MANIFESTS]; ///! The dependency
+									///  components, that
+									///  own the pinned
+									///  manifests.
+	struct suit_manifest_state pinned_manifests[SUIT_MAX_PINNED_MANIFESTS];
+#endif /* SUIT_PRUNE_DEPENDENCIES */
+
 	size_t seq_stack_height;
 	struct suit_seq_exec_state seq_stack[SUIT_MAX_SEQ_DEPTH];
 };
@@ -256,6 +612,46 @@ struct suit_processor_state {
 int suit_processor_load_envelope(struct suit_processor_state *state, const uint8_t *envelope_str,
 				 size_t envelope_len);
 
+#ifndef SUIT_PRUNE_DEPENDENCIES
+/** @brief Move the manifest from the top of the manifest stack into the pinned manifest pool.
+ *
+ * @details The dependency manifest, checked by the suit-condition-dependency-integrity,
+ *          is kept loaded, so the suit-directive-process-dependency does not have to
+ *          retrieve, authenticate and validate it again.
+ *          The pinned manifest is owned by the dependency component and is valid as long as
+ *          the integrity_checked flag of the component is set.
+ *
+ * @param[in]  state       The SUIT processor state to be modified.
+ * @param[in]  dependency  The dependency component, that owns the manifest.
+ *
+ * @returns True if the manifest was pinned, false if the pool is full.
+ */
+bool suit_processor_pin_manifest(struct suit_processor_state *state,
+				 struct suit_manifest_params *dependency);
+
+/** @brief Move the manifest, pinned by the dependency component, back onto the manifest stack.
+ *
+ * @param[in]  state       The SUIT processor state to be modified.
+ * @param[in]  dependency  The dependency component, that owns the manifest.
+ *
+ * @returns True if the manifest was moved, false if there is no valid manifest pinned
+ *          by the component or the manifest stack is full.
+ */
+bool suit_processor_unpin_manifest(struct suit_processor_state *state,
+				   struct suit_manifest_params *dependency);
+
+/** @brief Release the manifests, pinned by the dependency component.
+ *
+ * @param[in]  state       The SUIT processor state to be modified.
+ * @param[in]  dependency  The dependency component, that owns the manifest.
+ *                         If set to NULL, all pinned manifests are released.
+ *
+ * @returns SUIT_SUCCESS if the operation succeeds, error code otherwise.
+ */
+int suit_processor_release_pinned_manifests(struct suit_processor_state *state,
+					    struct suit_manifest_params *dependency);
+#endif /* SUIT_PRUNE_DEPENDENCIES */
+
 #ifdef CONFIG_UNITY
 /** @brief Override the internal state variable with a pointer to the external memory.
  *
@@ -8,22 +8,59 @@
 #define SUIT_REPORT_H__
 
 #include "suit_types.h"
+#include "suit_processor.h"
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+/** Report the successful execution of the command. */
+#define SUIT_REP_POLICY_RECORD_SUCCESS	(1 << 0)
+/** Report the failed execution of the command. */
+#define SUIT_REP_POLICY_RECORD_FAILURE	(1 << 1)
+/** Attach the parameters, used by the successfully executed command. */
+#define SUIT_REP_POLICY_SYSINFO_SUCCESS (1 << 2)
+/** Attach the parameters, used by the command that failed. */
+#define SUIT_REP_POLICY_SYSINFO_FAILURE (1 << 3)
+
 /** @brief Construct a report for the given command.
+ *
+ *  @details The arguments are filled only if the parameters are provided.
  *
  *  @param[in]  command     The command that was executed.
  *  @param[in]  result      The result of the command.
  *  @param[in]  parameters  The current parameters.
  *  @param[out] report      The constructed report.
+ *
+ *  @returns SUIT_SUCCESS if the report was constructed, error code otherwise.
  */
 int suit_construct_report(unsigned int command, int result, struct suit_manifest_params *parameters,
 			  struct suit_report *report);
 
+/** @brief Record the result of the command, according to its reporting policy.
+ *
+ *  @details The records are kept in a fixed-size buffer and passed to the platform
+ *           by suit_report_flush or once the buffer is full.
+ *           If the policy requests the system information, the parameters are
+ *           reported immediately, after all previously buffered records.
+ *
+ *  @param[in] command     The executed command.
+ *  @param[in] result      The result of the command.
+ *  @param[in] parameters  The parameters of the component, for which the command was executed.
+ */
+void suit_report_record(const suit_command_t *command, int result,
+			struct suit_manifest_params *parameters);
+
+/** @brief Pass all buffered records to the platform.
+ *
+ *  @returns SUIT_SUCCESS if all records were reported, error code otherwise.
+ */
+int suit_report_flush(void);
+
+/** @brief Drop all buffered records. */
+void suit_report_reset(void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -42,6 +42,19 @@ int suit_schedule_validation(struct suit_processor_state *state,
 			     struct suit_manifest_state *manifest,
 			     enum suit_command_sequence seq_name);
 
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+/** Schedule execution of the current sequence from the last stored checkpoint.
+ *
+ * @param[in]  state     The SUIT processor state to use.
+ * @param[in]  manifest  Manifest structure that holds the command sequence.
+ *
+ * @returns SUIT_ERR_AGAIN if the sequence execution was successfully restored, error code
+ *                         otherwise.
+ */
+int suit_schedule_resumed_execution(struct suit_processor_state *state,
+				    struct suit_manifest_state *manifest);
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+
 /** Process all operations scheduled.
  *
  * @param[in]  state  The SUIT processor state to use.
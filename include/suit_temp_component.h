@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_TEMP_COMPONENT_H__
+#define SUIT_TEMP_COMPONENT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <suit_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_temp_component.h
+ * @brief Allocator for the temporary components, that can be used by the platform.
+ *
+ * The temporary components are identified by the following component ID:
+ *
+ *   Temp_Component_ID = ['temp', UID: bstr, Size: bstr .cbor uint, Align: bstr .cbor uint, ?Context: bstr]
+ *
+ * The platform parses the ID inside suit_plat_create_component_handle and allocates the
+ * component inside the scratch area, given to suit_temp_allocator_init.
+ * The regions are carved from the top of the area (bump allocation) and the regions, freed
+ * with suit_temp_free, are reused on the first-fit basis. Adjacent free regions are merged.
+ *
+ * The temporary components live until the current invocation of the manifest is complete, so the
+ * releasing of the component handle does not free the region.
+ *
+ * @note The allocator is owned by the platform and the SUIT processor never calls it. The platform
+ *       has to call suit_temp_free_all once the whole group of sequences (i.e. update or boot)
+ *       is processed, after the last suit_process_sequence returns.
+ */
+
+/** The first element of the temporary component ID. */
+#define SUIT_TEMP_COMPONENT_PREFIX "temp"
+
+/** The maximum length of the temporary component UID, copied into the region. */
+#define SUIT_TEMP_UID_MAX_LEN 16
+
+struct suit_temp_component_id {
+	struct zcbor_string uid;
+	size_t size;
+	size_t align;
+	struct zcbor_string context; ///! Zero-length if the context is not present.
+};
+
+struct suit_temp_region {
+	size_t offset;           ///! The offset of the region, relative to the scratch area address.
+	size_t size;
+	uint8_t uid[SUIT_TEMP_UID_MAX_LEN]; ///! The UID of the component, stored in the region.
+	uint8_t uid_len;
+	bool used;
+};
+
+struct suit_temp_allocator {
+	uintptr_t area_address;
+	size_t area_size;
+	size_t top;                       ///! The end of the last allocated region.
+
+	struct suit_temp_region *regions; ///! Regions below the top, sorted by the offset.
+	size_t regions_count;
+	size_t regions_max;
+};
+
+/** @brief Decode the temporary component ID.
+ *
+ * @note The UID and the context point into the component ID buffer.
+ *
+ * @param[in]  component_id  The component ID, as passed to suit_plat_create_component_handle.
+ * @param[out] temp_id       The decoded temporary component ID.
+ *
+ * @returns SUIT_SUCCESS if the ID was decoded,
+ *          SUIT_ERR_UNSUPPORTED_COMPONENT_ID if the ID does not describe a temporary component,
+ *          SUIT_ERR_DECODING if the temporary component ID is malformed or the UID is longer
+ *          than SUIT_TEMP_UID_MAX_LEN.
+ */
+int suit_temp_component_id_decode(struct zcbor_string *component_id,
+				  struct suit_temp_component_id *temp_id);
+
+/** @brief Initialize the allocator.
+ *
+ * @param[out] alloc        The allocator state.
+ * @param[in]  address      The address of the scratch area.
+ * @param[in]  size         The size of the scratch area.
+ * @param[in]  regions      The table of regions. Each allocation uses up to three entries
+ *                          of the table, at least for the time the region is allocated.
+ * @param[in]  regions_max  The number of entries in the table of regions.
+ *
+ * @returns SUIT_SUCCESS if the allocator was initialized, error code otherwise.
+ */
+int suit_temp_allocator_init(struct suit_temp_allocator *alloc, uintptr_t address, size_t size,
+			     struct suit_temp_region *regions, size_t regions_max);
+
+/** @brief Allocate the region for the temporary component.
+ *
+ * @details If a component with the same UID is already allocated, its address is returned,
+ *          so the same temporary component can be referred to by several manifests.
+ *
+ * @note The UID is copied into the region, so the component ID buffer may be released.
+ *
+ * @param[in]  alloc    The allocator state.
+ * @param[in]  temp_id  The decoded temporary component ID.
+ * @param[out] address  The address of the allocated region.
+ *
+ * @returns SUIT_SUCCESS if the region was allocated,
+ *          SUIT_ERR_UNSUPPORTED_COMPONENT_ID if a different component with the same UID exists
+ *          or the UID is longer than SUIT_TEMP_UID_MAX_LEN,
+ *          SUIT_ERR_OVERFLOW if there is not enough space in the area or in the table of regions.
+ */
+int suit_temp_alloc(struct suit_temp_allocator *alloc, const struct suit_temp_component_id *temp_id,
+		    uintptr_t *address);
+
+/** @brief Free a single region.
+ *
+ * @param[in] alloc    The allocator state.
+ * @param[in] address  The address of the region, returned by suit_temp_alloc.
+ *
+ * @returns SUIT_SUCCESS if the region was freed,
+ *          SUIT_ERR_MISSING_COMPONENT if there is no region at the given address.
+ */
+int suit_temp_free(struct suit_temp_allocator *alloc, uintptr_t address);
+
+/** @brief Free all regions, i.e. at the end of the group of sequences.
+ *
+ * @note It has to be called by the platform, the SUIT processor does not free the regions.
+ *
+ * @param[in] alloc  The allocator state.
+ *
+ * @returns SUIT_SUCCESS if the regions were freed, error code otherwise.
+ */
+int suit_temp_free_all(struct suit_temp_allocator *alloc);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_TEMP_COMPONENT_H__ */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef SUIT_TRACE_H__
+#define SUIT_TRACE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <suit_types.h>
+#include <suit_processor.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/** @file suit_trace.h
+ * @brief Timing statistics of the commands, decoder steps and platform calls.
+ *
+ * If SUIT_PLATFORM_TRACE_SUPPORT is defined, each traced call is timed using
+ * suit_plat_trace_timestamp and aggregated into per-event statistics.
+ * Otherwise the tracepoints are compiled out and the calls are executed as-is.
+ *
+ * The command events cover both validation and execution of the command.
+ * The time spent in the nested events (i.e. platform calls of the command) is included
+ * in the time of the outer event.
+ */
+
+/** The maximum nesting level of traced calls. Deeper calls are executed, but not traced. */
+#define SUIT_TRACE_MAX_DEPTH 8
+
+enum suit_trace_event {
+	/* Conditions and directives. */
+	SUIT_TRACE_CMD_VENDOR_IDENTIFIER,
+	SUIT_TRACE_CMD_CLASS_IDENTIFIER,
+	SUIT_TRACE_CMD_DEVICE_IDENTIFIER,
+	SUIT_TRACE_CMD_IMAGE_MATCH,
+	SUIT_TRACE_CMD_COMPONENT_SLOT,
+	SUIT_TRACE_CMD_CHECK_CONTENT,
+	SUIT_TRACE_CMD_DEPENDENCY_INTEGRITY,
+	SUIT_TRACE_CMD_IS_DEPENDENCY,
+	SUIT_TRACE_CMD_ABORT,
+	SUIT_TRACE_CMD_VERSION,
+	SUIT_TRACE_CMD_SET_COMPONENT_INDEX,
+	SUIT_TRACE_CMD_OVERRIDE_PARAMETERS,
+	SUIT_TRACE_CMD_SET_PARAMETERS,
+	SUIT_TRACE_CMD_TRY_EACH,
+	SUIT_TRACE_CMD_RUN_SEQUENCE,
+	SUIT_TRACE_CMD_PROCESS_DEPENDENCY,
+	SUIT_TRACE_CMD_FETCH,
+	SUIT_TRACE_CMD_COPY,
+	SUIT_TRACE_CMD_SWAP,
+	SUIT_TRACE_CMD_WRITE,
+	SUIT_TRACE_CMD_INVOKE,
+	SUIT_TRACE_CMD_APPLY_DELTA,
+	SUIT_TRACE_CMD_OTHER,
+
+	/* Steps of the envelope decoder. */
+	SUIT_TRACE_DECODE_ENVELOPE,
+	SUIT_TRACE_DECODE_AUTHENTICATE,
+	SUIT_TRACE_DECODE_AUTHORIZE,
+	SUIT_TRACE_DECODE_SEQUENCES,
+	SUIT_TRACE_DECODE_CREATE_COMPONENTS,
+
+	/* Platform calls. */
+	SUIT_TRACE_PLAT_CHECK_DIGEST,
+	SUIT_TRACE_PLAT_AUTHENTICATE_MANIFEST,
+	SUIT_TRACE_PLAT_AUTHORIZE_UNSIGNED_MANIFEST,
+	SUIT_TRACE_PLAT_AUTHORIZE_COMPONENT_ID,
+	SUIT_TRACE_PLAT_AUTHORIZE_PROCESS_DEPENDENCY,
+	SUIT_TRACE_PLAT_RETRIEVE_MANIFEST,
+	SUIT_TRACE_PLAT_SEQUENCE_COMPLETED,
+	SUIT_TRACE_PLAT_OVERRIDE_IMAGE_SIZE,
+	SUIT_TRACE_PLAT_CHECK_VID,
+	SUIT_TRACE_PLAT_CHECK_CID,
+	SUIT_TRACE_PLAT_CHECK_DID,
+	SUIT_TRACE_PLAT_CHECK_IMAGE_MATCH,
+	SUIT_TRACE_PLAT_CHECK_SLOT,
+	SUIT_TRACE_PLAT_CHECK_CONTENT,
+	SUIT_TRACE_PLAT_COMPONENT_VERSION_GET,
+	SUIT_TRACE_PLAT_FETCH,
+	SUIT_TRACE_PLAT_FETCH_INTEGRATED,
+	SUIT_TRACE_PLAT_COPY,
+	SUIT_TRACE_PLAT_WRITE,
+	SUIT_TRACE_PLAT_SWAP,
+	SUIT_TRACE_PLAT_APPLY_DELTA,
+	SUIT_TRACE_PLAT_INVOKE,
+	SUIT_TRACE_PLAT_DRY_RUN, ///! Any of the suit_plat_check_* calls, made during the dry run.
+
+	SUIT_TRACE_EVENT_MAX,
+};
+
+/** @brief Timing statistics of a single event. The unit is defined by the platform timestamp. */
+struct suit_trace_stats {
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+};
+
+#ifdef SUIT_PLATFORM_TRACE_SUPPORT
+/** @brief Execute and time the call, returning its result. */
+#define SUIT_TRACE(event, call) (suit_trace_begin(), suit_trace_end((event), (call)))
+#else /* SUIT_PLATFORM_TRACE_SUPPORT */
+#define SUIT_TRACE(event, call) (call)
+#endif /* SUIT_PLATFORM_TRACE_SUPPORT */
+
+/** @brief Add the duration of the event to the statistics.
+ *
+ * @param[in] event     The traced event.
+ * @param[in] duration  The difference between the platform timestamps.
+ */
+void suit_trace_record(enum suit_trace_event event, uint32_t duration);
+
+#ifdef SUIT_PLATFORM_TRACE_SUPPORT
+/** @brief Mark the beginning of the traced call. */
+void suit_trace_begin(void);
+
+/** @brief Mark the end of the traced call and update the event statistics.
+ *
+ * @param[in] event   The traced event.
+ * @param[in] result  The result of the traced call.
+ *
+ * @returns The @p result value.
+ */
+int suit_trace_end(enum suit_trace_event event, int result);
+#endif /* SUIT_PLATFORM_TRACE_SUPPORT */
+
+/** @brief Get the event, assigned to the given command.
+ *
+ * @param[in] command  The condition or directive.
+ *
+ * @returns The event, used to trace the command.
+ */
+enum suit_trace_event suit_trace_command_event(const suit_command_t *command);
+
+/** @brief Copy the current statistics, i.e. to send them with the device telemetry.
+ *
+ * @param[out] stats  The array of statistics, indexed by the event.
+ * @param[in]  count  The size of the array. At most SUIT_TRACE_EVENT_MAX entries are filled.
+ *
+ * @returns SUIT_SUCCESS if the statistics were copied, error code otherwise.
+ */
+int suit_trace_snapshot(struct suit_trace_stats *stats, size_t count);
+
+/** @brief Clear the statistics. */
+void suit_trace_reset(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SUIT_TRACE_H__ */
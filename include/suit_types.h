@@ -41,6 +41,12 @@ extern "C" {
  *  One entry for each manifest level + one for additional processing.
  */
 #define SUIT_MANIFEST_STACK_MAX_ENTRIES	    (SUIT_MAX_MANIFEST_DEPTH + 1)
+/** The maximum number of dependency manifests, kept loaded between the
+ *  suit-condition-dependency-integrity and the suit-directive-process-dependency.
+ */
+#define SUIT_MAX_PINNED_MANIFESTS	    2
+/** The maximum number of report records, buffered before passing them to the platform. */
+#define SUIT_MAX_NUM_REPORT_RECORDS	    16
 
 /** Errors from the suit API
  *
@@ -159,6 +165,14 @@ struct suit_report {
 	struct zcbor_string *addititional_info;
 };
 
+/** @brief Compact form of the report, buffered until the end of the sequence. */
+struct suit_report_record {
+	suit_component_t component_handle;
+	int16_t command;     ///! The identifier of the condition or directive
+	int16_t result;
+	uint8_t rep_policy;  ///! The SUIT_Rep_Policy bits of the command
+};
+
 struct suit_aes_kw_data {
 	/** @brief The key encryption key identifier. */
 	struct zcbor_string key_id;
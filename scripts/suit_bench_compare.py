@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Compare two console logs of the SUIT processor benchmark (tests/benchmark).
+
+Each measurement is printed by the benchmark as a JSON object in a line prefixed
+with SUIT_BENCH. The measurements are matched by their name and parameter.
+The script exits with a nonzero code if any of the measurements regressed by more
+than the given threshold or if the status of a measurement changed.
+The sizes of the processor structures (name "sizeof") are compared by their "bytes" value.
+"""
+
+import argparse
+import json
+import sys
+
+PREFIX = "SUIT_BENCH "
+METRICS = ("iterations", "cycles_min", "cycles_avg", "insns_min", "insns_avg", "bytes", "status")
+
+
+def parse_log(path):
+    """Return the dictionary of measurements, keyed by the name and the parameter."""
+    results = {}
+    with open(path, encoding="utf-8", errors="replace") as log:
+        for line in log:
+            pos = line.find(PREFIX)
+            if pos < 0:
+                continue
+            entry = json.loads(line[pos + len(PREFIX):])
+            params = ",".join(f"{key}={value}" for key, value in entry.items()
+                              if key not in METRICS and key != "name")
+            results[f"{entry['name']}[{params}]"] = entry
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="benchmark log of the reference revision")
+    parser.add_argument("current", help="benchmark log of the tested revision")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="allowed increase of the metric, in percent (default: %(default)s)")
+    parser.add_argument("-m", "--metric", default=None,
+                        help="compared metric (default: insns_min if available, cycles_min otherwise)")
+    args = parser.parse_args()
+
+    baseline = parse_log(args.baseline)
+    current = parse_log(args.current)
+    failed = False
+
+    for key in sorted(baseline.keys() | current.keys()):
+        if key not in current:
+            print(f"{key:<60} missing in the current log")
+            failed = True
+            continue
+        if key not in baseline:
+            print(f"{key:<60} new")
+            continue
+
+        old, new = baseline[key], current[key]
+        if "bytes" in old:
+            # The structure sizes are always compared, regardless of the selected metric.
+            metric = "bytes"
+        else:
+            metric = args.metric or ("insns_min" if "insns_min" in old else "cycles_min")
+        if metric not in old or metric not in new:
+            print(f"{key:<60} metric {metric} not available")
+            failed = True
+            continue
+
+        change = 0.0 if old[metric] == 0 else (new[metric] - old[metric]) * 100.0 / old[metric]
+        verdict = ""
+        if old["status"] != new["status"]:
+            verdict = f"STATUS {old['status']} -> {new['status']}"
+            failed = True
+        elif change > args.threshold:
+            verdict = "REGRESSION"
+            failed = True
+        print(f"{key:<60} {metric}: {old[metric]:>10} -> {new[metric]:>10} ({change:+6.1f}%) {verdict}")
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
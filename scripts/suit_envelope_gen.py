@@ -0,0 +1,436 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Generate synthetic SUIT envelopes with parameterised shape.
+
+The numeric values of all keys, commands and parameters are read from the CDDL files
+in the cddl directory and the processor limits are read from include/suit_types.h,
+so the generated envelopes follow the same revision of the SUIT specification as the
+decoders, generated from the CDDL.
+
+Each generated manifest contains:
+ - the requested number of image components, with vendor and class identifiers,
+ - the shared sequence, setting and checking the identifiers,
+ - the payload-fetch sequence, fetching integrated payloads and checking their digests,
+ - the install sequence, nested inside try-each or run-sequence directives,
+ - the validate and invoke sequences,
+ - a dependency manifest, processed from every sequence, if the dependency depth is not zero.
+
+The adversarial presets select the largest shapes, allowed by the processor limits,
+and make all but the last try-each case fail after executing all of its commands.
+"""
+
+import argparse
+import hashlib
+import random
+import re
+import sys
+import uuid
+from pathlib import Path
+
+ROOT_DIR = Path(__file__).resolve().parent.parent
+CDDL_DIR = ROOT_DIR / "cddl"
+TYPES_HEADER = ROOT_DIR / "include" / "suit_types.h"
+
+# The CDDL files, used to generate the manifest and COSE decoders (see CMakeLists.txt).
+MANIFEST_CDDL_FILES = ("manifest.cddl", "trust_domains.cddl", "update_management.cddl",
+                       "firmware_encryption.cddl", "compression_info.cddl", "delta_update.cddl")
+COSE_CDDL_FILES = ("cose_sign.cddl", "cose_encrypt.cddl")
+
+VENDOR_ID = uuid.uuid5(uuid.NAMESPACE_DNS, "nordicsemi.com")
+
+PRESETS = {
+    "worst-nesting": {
+        "components": 15, "commands": 8, "nesting": "try-each", "depth": None,
+        "fan_out": 4, "fail_cases": True, "severed": True,
+    },
+    "worst-components": {
+        "components": 16, "commands": 32, "nesting": "run-sequence", "depth": None,
+    },
+    "worst-dependencies": {
+        "components": 15, "commands": 8, "dependency_depth": None, "severed": True,
+        "payloads": 1, "payload_size": 1024,
+    },
+    "worst-payloads": {
+        "components": 16, "payloads": None, "payload_size": 65536, "severed": True,
+    },
+}
+
+DEFAULTS = {
+    "components": 1, "commands": 2, "nesting": "none", "depth": 0, "fan_out": 2,
+    "fail_cases": False, "dependency_depth": 0, "payloads": 0, "payload_size": 256,
+    "severed": False,
+}
+
+
+class Tag:
+    """CBOR tagged item."""
+
+    def __init__(self, tag, value):
+        self.tag = tag
+        self.value = value
+
+
+def cbor_head(major, value):
+    if value < 24:
+        return bytes([(major << 5) | value])
+    for ai, size in ((24, 1), (25, 2), (26, 4), (27, 8)):
+        if value < (1 << (8 * size)):
+            return bytes([(major << 5) | ai]) + value.to_bytes(size, "big")
+    raise ValueError(f"Value too large: {value}")
+
+
+def cbor(obj):
+    """Encode the object as CBOR, keeping the order of map entries."""
+    if obj is None:
+        return b"\xf6"
+    if isinstance(obj, bool):
+        return b"\xf5" if obj else b"\xf4"
+    if isinstance(obj, int):
+        return cbor_head(0, obj) if obj >= 0 else cbor_head(1, -1 - obj)
+    if isinstance(obj, (bytes, bytearray)):
+        return cbor_head(2, len(obj)) + bytes(obj)
+    if isinstance(obj, str):
+        data = obj.encode("utf-8")
+        return cbor_head(3, len(data)) + data
+    if isinstance(obj, (list, tuple)):
+        return cbor_head(4, len(obj)) + b"".join(cbor(item) for item in obj)
+    if isinstance(obj, dict):
+        return cbor_head(5, len(obj)) + b"".join(cbor(k) + cbor(v) for k, v in obj.items())
+    if isinstance(obj, Tag):
+        return cbor_head(6, obj.tag) + cbor(obj.value)
+    raise TypeError(f"Unsupported type: {type(obj)}")
+
+
+def read_cddl(names):
+    return "\n".join((CDDL_DIR / name).read_text() for name in names)
+
+
+class Cddl:
+    """Numeric values and quantity limits, defined by the CDDL."""
+
+    def __init__(self):
+        text = read_cddl(MANIFEST_CDDL_FILES + COSE_CDDL_FILES)
+        self.values = {}
+        for line in text.splitlines():
+            line = line.split(";")[0]
+            match = re.match(r"^\s*([A-Za-z][\w-]*)\s*/{0,2}=\s*(-?\d+)\s*$", line)
+            if match:
+                # For redefined keys (i.e. suit-install) the last value is used.
+                self.values[match.group(1)] = int(match.group(2))
+        # Labels of the group members (i.e. alg_id: 1) and enumerated choices (i.e. ES256: -7).
+        self.values.update({name: int(value) for name, value in
+                            re.findall(r"(\w+): (-?\d+)\b", text)})
+        self.values.update({name: int(value) for name, value in
+                            re.findall(r"^(\w+) = #6\.(\d+)\(", text, re.MULTILINE)})
+
+        self.max_try_each_cases = int(
+            re.search(r"SUIT_Directive_Try_Each_Argument = \[\s*2\*(\d+)", text).group(1))
+        self.max_parameters = int(
+            re.search(r"suit-directive-override-parameters,\s*\{ 1\*(\d+)", text).group(1))
+
+    def __getitem__(self, name):
+        return self.values[name]
+
+
+class Limits:
+    """Limits of the processor, defined in include/suit_types.h."""
+
+    def __init__(self):
+        text = TYPES_HEADER.read_text()
+        for name in ("SUIT_MAX_NUM_COMPONENTS", "SUIT_MAX_NUM_INTEGRATED_PAYLOADS",
+                     "SUIT_MAX_SEQ_DEPTH", "SUIT_MAX_MANIFEST_DEPTH"):
+            value = re.search(rf"#define {name}\s+(\d+)", text).group(1)
+            setattr(self, name.lower()[len("suit_max_"):], int(value))
+
+
+class EnvelopeGenerator:
+
+    def __init__(self, args, cddl, key=None):
+        self.args = args
+        self.k = cddl
+        self.key = key
+        self.rng = random.Random(args.seed)
+
+    def component_id(self, level, kind, index):
+        return [kind, uuid.uuid5(VENDOR_ID, f"suit-gen-{level}-{index}").bytes]
+
+    def seq(self, commands):
+        """Encode the list of (command, argument) pairs as a command sequence."""
+        return cbor([item for command in commands for item in command])
+
+    def digest(self, data):
+        return [self.k["cose-alg-sha-256"], hashlib.sha256(data).digest()]
+
+    def cmd(self, name, arg=0):
+        return (self.k[name], arg)
+
+    def checks(self, count):
+        """Alternating vendor and class identifier conditions."""
+        names = ("suit-condition-vendor-identifier", "suit-condition-class-identifier")
+        return [self.cmd(names[i % 2]) for i in range(count)]
+
+    def nest(self, body):
+        """Wrap the command sequence inside the requested number of nested directives."""
+        args = self.args
+        for _ in range(args.depth):
+            if args.nesting == "run-sequence":
+                body = [self.cmd("suit-directive-run-sequence", self.seq(body))]
+            elif args.nesting == "try-each":
+                case = self.seq(body)
+                if args.fail_cases:
+                    # Fail after executing all commands, so the next case is tried.
+                    failing = self.seq(body + [self.cmd("suit-condition-abort")])
+                else:
+                    failing = case
+                cases = [failing] * (args.fan_out - 1) + [case]
+                body = [self.cmd("suit-directive-try-each", cases)]
+        return body
+
+    def dependency_block(self):
+        """Fetch the dependency manifest into the candidate component and process it."""
+        return [
+            self.cmd("suit-directive-set-component-index", 0),
+            self.cmd("suit-directive-override-parameters", {self.k["suit-parameter-uri"]: "#dependency"}),
+            self.cmd("suit-directive-fetch"),
+            self.cmd("suit-condition-dependency-integrity"),
+            self.cmd("suit-directive-process-dependency"),
+        ]
+
+    def envelope(self, level=0):
+        args = self.args
+        k = self.k
+        has_dependency = level < args.dependency_depth
+        first_image = 1 if has_dependency else 0
+        images = list(range(first_image, first_image + args.components))
+        image_index = images if len(images) > 1 else images[0]
+        payloads = {f"#payload{i}": self.rng.randbytes(args.payload_size)
+                    for i in range(args.payloads)}
+
+        components = [self.component_id(level, b"I", i) for i in images]
+        if has_dependency:
+            components.insert(0, [b"C", bytes([level])])
+
+        shared = [
+            self.cmd("suit-directive-set-component-index", image_index),
+            self.cmd("suit-directive-override-parameters", {
+                k["suit-parameter-vendor-identifier"]: VENDOR_ID.bytes,
+                k["suit-parameter-class-identifier"]: uuid.uuid5(VENDOR_ID, f"suit-gen-{level}").bytes,
+            }),
+        ]
+        for index, payload in zip(images, payloads.values()):
+            shared += [
+                self.cmd("suit-directive-set-component-index", index),
+                self.cmd("suit-directive-override-parameters", {
+                    k["suit-parameter-image-digest"]: cbor(self.digest(payload)),
+                    k["suit-parameter-image-size"]: len(payload),
+                }),
+            ]
+        shared += [self.cmd("suit-directive-set-component-index", image_index)] + self.checks(args.commands)
+
+        common = {k["suit-components"]: components, k["suit-shared-sequence"]: self.seq(shared)}
+        if has_dependency:
+            common[k["suit-dependencies"]] = {0: {}}
+
+        dependency = self.dependency_block() if has_dependency else []
+        fetch = []
+        for index, name in zip(images, payloads):
+            fetch += [
+                self.cmd("suit-directive-set-component-index", index),
+                self.cmd("suit-directive-override-parameters", {k["suit-parameter-uri"]: name}),
+                self.cmd("suit-directive-fetch"),
+                self.cmd("suit-condition-image-match"),
+            ]
+        install = self.nest([self.cmd("suit-directive-set-component-index", image_index)]
+                            + self.checks(args.commands))
+        validate = [self.cmd("suit-directive-set-component-index", image_index)] + self.checks(args.commands)
+        invoke = [self.cmd("suit-directive-set-component-index", images[0]), self.cmd("suit-directive-invoke")]
+
+        manifest = {
+            k["suit-manifest-version"]: 1,
+            k["suit-manifest-sequence-number"]: args.sequence_number,
+            k["suit-common"]: cbor(common),
+            k["suit-validate"]: self.seq(validate + dependency),
+            k["suit-invoke"]: self.seq(invoke + dependency),
+        }
+        severable = {
+            k["suit-payload-fetch"]: self.seq(fetch + dependency) if (fetch or dependency) else None,
+            k["suit-install"]: self.seq(install + dependency),
+            k["suit-dependency-resolution"]: self.seq(dependency) if dependency else None,
+        }
+        severed = {}
+        for key, value in severable.items():
+            if value is None:
+                continue
+            if args.severed:
+                severed[key] = value
+                manifest[key] = self.digest(cbor(value))
+            else:
+                manifest[key] = value
+        manifest[k["suit-manifest-component-id"]] = self.component_id(level, b"I", 0xff)
+
+        manifest_bstr = cbor(manifest)
+        envelope = {
+            k["suit-authentication-wrapper"]: cbor(self.authentication(cbor(manifest_bstr))),
+            k["suit-manifest"]: manifest_bstr,
+        }
+        envelope.update(severed)
+        envelope.update(payloads)
+        if has_dependency:
+            envelope["#dependency"] = cbor(self.envelope(level + 1))
+
+        return Tag(k["SUIT_Envelope_Tagged"], envelope)
+
+    def authentication(self, manifest):
+        """Digest of the manifest, including the byte string header and the COSE_Sign1 block."""
+        digest = cbor(self.digest(manifest))
+        protected = {self.k["alg_id"]: self.k["ES256"]}
+        if self.args.key_id is not None:
+            protected[self.k["key_id"]] = self.args.key_id.encode()
+        protected = cbor(protected)
+        sig_structure = cbor(["Signature1", protected, b"", digest])
+        signature = sign(self.key, sig_structure) if self.key is not None else bytes(64)
+        return [digest, cbor(Tag(self.k["COSE_Sign1_Tagged"], [protected, {}, None, signature]))]
+
+
+def load_key(path):
+    try:
+        from cryptography.hazmat.primitives.serialization import load_pem_private_key
+    except ImportError:
+        sys.exit("Signing requires the cryptography package")
+    return load_pem_private_key(Path(path).read_bytes(), password=None)
+
+
+def sign(key, data):
+    """Create the ES256 signature in the raw (r || s) format, used by COSE."""
+    from cryptography.hazmat.primitives import hashes
+    from cryptography.hazmat.primitives.asymmetric import ec
+    from cryptography.hazmat.primitives.asymmetric.utils import decode_dss_signature
+
+    r, s = decode_dss_signature(key.sign(data, ec.ECDSA(hashes.SHA256())))
+    return r.to_bytes(32, "big") + s.to_bytes(32, "big")
+
+
+def validate(envelope):
+    """Validate the envelope against the CDDL, using zcbor."""
+    try:
+        from zcbor.zcbor import DataTranslator
+    except ImportError:
+        sys.exit("Validation requires the zcbor package (see scripts/requirements.txt)")
+    types = DataTranslator.from_cddl(read_cddl(MANIFEST_CDDL_FILES), 1024).my_types
+    types["SUIT_Envelope_Tagged"].validate_str(envelope)
+
+
+def check_limits(args, cddl, limits):
+    """Return the list of violated limits."""
+    errors = []
+    dependency = 1 if args.dependency_depth > 0 else 0
+    if not 1 <= args.components + dependency <= limits.num_components:
+        errors.append(f"Number of components must be in range 1..{limits.num_components - dependency}")
+    if args.payloads > args.components:
+        errors.append("Each integrated payload requires a separate component")
+    if args.payloads + dependency > limits.num_integrated_payloads:
+        errors.append(f"Up to {limits.num_integrated_payloads - dependency} integrated payloads are supported")
+    if args.dependency_depth > limits.manifest_depth:
+        errors.append(f"Dependency depth must not exceed {limits.manifest_depth}")
+    # Each manifest on the dependency path occupies one level of the sequence stack.
+    if args.depth + args.dependency_depth + 1 > limits.seq_depth:
+        errors.append(f"Nesting depth must not exceed {limits.seq_depth - args.dependency_depth - 1}")
+    if not 2 <= args.fan_out <= cddl.max_try_each_cases:
+        errors.append(f"Try-each fan-out must be in range 2..{cddl.max_try_each_cases}")
+    return errors
+
+
+def write_c_array(path, name, data):
+    lines = [", ".join(f"0x{b:02X}" for b in data[i:i + 8]) + "," for i in range(0, len(data), 8)]
+    body = "\n".join(f"\t{line}" for line in lines)
+    Path(path).write_text(
+        "/*\n"
+        " * Copyright (c) 2023 Nordic Semiconductor ASA\n"
+        " *\n"
+        " * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause\n"
+        " */\n\n"
+        "/* Generated by scripts/suit_envelope_gen.py. Do not edit. */\n\n"
+        "#include <stdint.h>\n"
+        "#include <stddef.h>\n\n"
+        f"uint8_t {name}[] = {{\n{body}\n}};\n"
+        f"const size_t {name}_len = sizeof({name});\n")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-o", "--output", required=True, help="output file")
+    parser.add_argument("--c-array", metavar="NAME",
+                        help="write the envelope as a C array with the given name, instead of binary")
+    parser.add_argument("--preset", choices=PRESETS.keys(), help="adversarial worst-case shape")
+    parser.add_argument("--components", type=int, help="number of image components in each manifest")
+    parser.add_argument("--commands", type=int, help="number of conditions in each command sequence")
+    parser.add_argument("--nesting", choices=("none", "run-sequence", "try-each"),
+                        help="directive used to nest the install sequence")
+    parser.add_argument("--depth", type=int, help="nesting depth of the install sequence")
+    parser.add_argument("--fan-out", type=int, help="number of try-each cases")
+    parser.add_argument("--fail-cases", action="store_true", default=None,
+                        help="make all but the last try-each case fail after executing all commands")
+    parser.add_argument("--dependency-depth", type=int, help="depth of the dependency manifests chain")
+    parser.add_argument("--payloads", type=int, help="number of integrated payloads in each manifest")
+    parser.add_argument("--payload-size", type=int, help="size of each integrated payload")
+    parser.add_argument("--severed", action="store_true", default=None,
+                        help="move severable sequences from the manifest into the envelope")
+    parser.add_argument("--sequence-number", type=int, default=1, help="manifest sequence number")
+    parser.add_argument("--key", help="PEM file with the ES256 private key; zero signature if not given")
+    parser.add_argument("--key-id", help="key ID placed in the protected COSE header")
+    parser.add_argument("--seed", type=int, default=0, help="seed of the payload generator")
+    parser.add_argument("--no-limits", action="store_true",
+                        help="allow shapes exceeding the processor limits, i.e. to test their enforcement")
+    parser.add_argument("--validate", action="store_true", help="validate the output against the CDDL")
+    args = parser.parse_args()
+
+    cddl = Cddl()
+    limits = Limits()
+    preset = PRESETS.get(args.preset, {})
+    for name, default in DEFAULTS.items():
+        if getattr(args, name) is None:
+            setattr(args, name, preset.get(name, default))
+
+    # Unspecified values of the adversarial presets are the largest allowed by the limits.
+    dependency = 1 if args.dependency_depth != 0 else 0
+    if args.dependency_depth is None:
+        args.dependency_depth = limits.manifest_depth
+        dependency = 1
+    if args.payloads is None:
+        args.payloads = min(args.components, limits.num_integrated_payloads - dependency)
+    if args.depth is None:
+        args.depth = limits.seq_depth - 1 - args.dependency_depth
+
+    return args, cddl, limits
+
+
+def main():
+    args, cddl, limits = parse_args()
+
+    errors = check_limits(args, cddl, limits)
+    if errors and not args.no_limits:
+        sys.exit("\n".join(errors))
+
+    key = load_key(args.key) if args.key else None
+    envelope = cbor(EnvelopeGenerator(args, cddl, key).envelope())
+
+    if args.validate:
+        validate(envelope)
+
+    if args.c_array:
+        write_c_array(args.output, args.c_array, envelope)
+    else:
+        Path(args.output).write_bytes(envelope)
+
+    print(f"Generated envelope: {len(envelope)} bytes", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Decode the binary SUIT log messages, read from the device with suit_log_read.
+
+The input is a raw dump of struct suit_log_entry elements. The message formats are
+taken from include/suit_log.h, so the same revision of the header must be used.
+"""
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+DEFAULT_HEADER = Path(__file__).resolve().parent.parent / "include" / "suit_log.h"
+
+
+def parse_header(path):
+    """Return the maximum number of arguments and the dictionary of message formats."""
+    text = Path(path).read_text()
+    max_args = int(re.search(r"#define SUIT_LOG_MAX_ARGS (\d+)", text).group(1))
+    ids = {name: int(value) for name, value in
+           re.findall(r"#define SUIT_LOG_MSG_(\w+) (\d+)\s*$", text, re.MULTILINE)}
+    fmts = dict(re.findall(r'#define SUIT_LOG_MSG_(\w+)_FMT "(.*)"', text))
+    return max_args, {ids[name]: fmts[name] for name in ids}
+
+
+def format_message(fmt, args):
+    """Apply the C format string, converting the arguments according to the specifiers."""
+    specifiers = re.findall(r"%[-+ #0]*\d*([dixXu])", fmt)
+    values = []
+    for spec, arg in zip(specifiers, args):
+        values.append(arg & 0xFFFFFFFF if spec in "xXu" else arg)
+    return re.sub(r"%[-+ #0]*\d*u", "%d", fmt) % tuple(values)
+
+
+def decode(data, max_args, messages):
+    """Yield the decoded log lines."""
+    entry = struct.Struct("<HH" + "i" * max_args)
+    prev_seq = None
+    for offset in range(0, len(data) - entry.size + 1, entry.size):
+        msg_id, seq, *args = entry.unpack_from(data, offset)
+        if prev_seq is not None and seq != (prev_seq + 1) & 0xFFFF:
+            yield f"<{(seq - prev_seq - 1) & 0xFFFF} messages lost>"
+        prev_seq = seq
+        if msg_id in messages:
+            yield f"[{seq:5}] {format_message(messages[msg_id], args)}"
+        else:
+            yield f"[{seq:5}] <unknown message {msg_id}: {args}>"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", type=Path, help="The binary dump of the log entries.")
+    parser.add_argument("--header", type=Path, default=DEFAULT_HEADER,
+                        help="The suit_log.h file with the message definitions.")
+    args = parser.parse_args()
+
+    max_args, messages = parse_header(args.header)
+    for line in decode(args.input.read_bytes(), max_args, messages):
+        print(line)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
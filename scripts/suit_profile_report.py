@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+#
+
+"""Report the code size and the boot time of the SUIT processor benchmark profiles.
+
+Run the benchmark scenarios (tests/benchmark) with the twister size report enabled and
+pass the twister output directory to the script:
+
+  twister -T tests/benchmark --platform mps2/an521/cpu0 -i --enable-size-report
+  scripts/suit_profile_report.py twister-out
+
+For each benchmark build, the profile is read from the SUIT_BENCH_START line of the
+console log, the ROM and RAM usage from the twister.json report and the boot time is
+the sum of the process_sequence measurements of the validate, load and invoke sequences.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+from suit_bench_compare import parse_log
+
+START_PREFIX = "SUIT_BENCH_START "
+PRUNE_OPTIONS = ("prune_encryption", "prune_fetch", "prune_dependencies")
+# The values of enum suit_command_sequence, executed while booting.
+BOOT_SEQUENCES = {7: "validate", 8: "load", 9: "invoke"}
+
+
+def parse_start(path):
+    """Return the benchmark configuration, printed at the start of the log."""
+    with open(path, encoding="utf-8", errors="replace") as log:
+        for line in log:
+            pos = line.find(START_PREFIX)
+            if pos >= 0:
+                return json.loads(line[pos + len(START_PREFIX):])
+    return None
+
+
+def load_sizes(outdir):
+    """Return the list of (platform, scenario name, used ROM, used RAM) from the twister report."""
+    path = os.path.join(outdir, "twister.json")
+    if not os.path.exists(path):
+        return []
+    with open(path, encoding="utf-8") as report:
+        suites = json.load(report).get("testsuites", [])
+    return [(suite.get("platform", ""), suite.get("name", ""), suite.get("used_rom"),
+             suite.get("used_ram")) for suite in suites]
+
+
+def find_size(sizes, outdir, build_dir):
+    """Match the build directory with the twister report entry."""
+    scenario = os.path.basename(build_dir)
+    build_path = os.path.relpath(build_dir, outdir)
+    for platform, name, rom, ram in sizes:
+        if name.endswith(scenario) and build_path.startswith(platform.replace("/", "_")):
+            return rom, ram
+    return None, None
+
+
+def boot_time(results, metric):
+    """Sum the measurements of the boot sequences, None if any of them is missing."""
+    entries = [entry for entry in results.values()
+               if entry["name"] == "process_sequence" and entry.get("seq") in BOOT_SEQUENCES]
+    if len(entries) != len(BOOT_SEQUENCES) or any(metric not in entry for entry in entries):
+        return None
+    return sum(entry[metric] for entry in entries)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("outdir", nargs="?", default="twister-out",
+                        help="twister output directory (default: %(default)s)")
+    parser.add_argument("-m", "--metric", default=None,
+                        help="boot time metric (default: insns_min if available, cycles_min otherwise)")
+    args = parser.parse_args()
+
+    sizes = load_sizes(args.outdir)
+    rows = []
+
+    for root, _, files in os.walk(args.outdir):
+        if "handler.log" not in files:
+            continue
+        log = os.path.join(root, "handler.log")
+        config = parse_start(log)
+        if config is None:
+            continue
+
+        results = parse_log(log)
+        metric = args.metric or ("insns_min" if any("insns_min" in entry for entry in results.values())
+                                 else "cycles_min")
+        profile = ",".join(option for option in PRUNE_OPTIONS if config.get(option)) or "full"
+        rom, ram = find_size(sizes, args.outdir, root)
+        rows.append((os.path.basename(root), config.get("board", ""), profile, rom, ram,
+                     boot_time(results, metric), metric))
+
+    if not rows:
+        print(f"No benchmark logs found in {args.outdir}")
+        return 1
+
+    print(f"{'scenario':<40} {'board':<12} {'profile':<50} {'rom':>8} {'ram':>8} {'boot':>12}")
+    for scenario, board, profile, rom, ram, boot, metric in sorted(rows):
+        print(f"{scenario:<40} {board:<12} {profile:<50} {rom if rom is not None else '-':>8} "
+              f"{ram if ram is not None else '-':>8} {boot if boot is not None else '-':>12} {metric}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -10,14 +10,32 @@
 #include <suit_manifest.h>
 #include <suit_schedule_seq.h>
 #include <manifest_decode.h>
+#include <suit_trace.h>
+#include <suit_arena.h>
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+#include <suit_checkpoint.h>
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+#ifdef SUIT_PLATFORM_REPORT_SUPPORT
+#include <suit_report.h>
+#endif /* SUIT_PLATFORM_REPORT_SUPPORT */
 
 static struct suit_processor_state processor_state;
 static struct suit_processor_state *state = &processor_state;
 
 
-static int suit_processor_decode_envelope(struct suit_decoder_state *decoder_state, struct suit_manifest_state *manifest,
+/** @brief Release the scratch memory, held by the decoder if the envelope was not fully processed. */
+static void release_decoded_envelope(struct suit_decoder_state *decoder_state)
+{
+	if (decoder_state->decoded != NULL) {
+		suit_arena_release(decoder_state->arena_mark);
+		decoder_state->decoded = NULL;
+	}
+}
+
+static int suit_processor_decode_envelope(struct suit_processor_state *state, struct suit_manifest_state *manifest,
 	const uint8_t *envelope_str, size_t envelope_len)
 {
+	struct suit_decoder_state *decoder_state = &state->decoder_state;
 	int ret = SUIT_SUCCESS;
 
 	memset(manifest, 0, sizeof(*manifest));
@@ -27,6 +45,15 @@ static int suit_processor_decode_envelope(struct suit_decoder_state *decoder_sta
 		ret = suit_decoder_init(decoder_state, manifest);
 	}
 
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+	/* Only the root envelope is loaded from the storage, the dependency manifests are retrieved
+	 * from the platform.
+	 */
+	if ((ret == SUIT_SUCCESS) && (manifest == &state->manifest_stack[0])) {
+		decoder_state->envelope_reader = state->envelope_reader;
+	}
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
 	if (ret == SUIT_SUCCESS) {
 		SUIT_DBG("Decode envelope: %p (%d)\r\n", envelope_str, envelope_len);
 		ret = suit_decoder_decode_envelope(decoder_state, envelope_str, envelope_len);
@@ -45,7 +72,103 @@ static int suit_processor_decode_envelope(struct suit_decoder_state *decoder_sta
 	return ret;
 }
 
+/** @brief Validate all command sequences of the loaded manifest. */
+static int suit_validate_manifest(struct suit_manifest_state *manifest_state,
+				  enum suit_command_sequence seq_name)
+{
+	int ret = SUIT_SUCCESS;
+
+	SUIT_DBG("Validate sequences\r\n");
+
+	/* Verify manifest members */
+	for (enum suit_command_sequence seq = SUIT_SEQ_SHARED; seq < SUIT_SEQ_MAX; seq++) {
+		ret = suit_schedule_validation(state, manifest_state, seq);
+		if ((ret == SUIT_ERR_UNAUTHORIZED_COMMAND_SEQ) && (seq != seq_name)) {
+			/* Since this loop goes through all possible sequences, mask error that indicates missing,
+			 * severed sequence if the sequence is not the one that is curreclty executed.
+			 */
+			ret = SUIT_SUCCESS;
+		} else if (ret == SUIT_ERR_UNAVAILABLE_COMMAND_SEQ) {
+			ret = SUIT_SUCCESS;
+		} else if (ret == SUIT_ERR_AGAIN) {
+			ret = suit_process_scheduled(state);
+		}
+
+		if (ret != SUIT_SUCCESS) {
+			SUIT_ERR("Manifest sequence %d validation failed (%d)\r\n", seq, ret);
+			break;
+		} else {
+			SUIT_DBG("Manifest sequence %d validated\r\n", seq);
+		}
+	}
+
+	SUIT_DBG("Manifest validation finished\r\n");
+
+	return ret;
+}
+
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+/** @brief Store the parameter values of the manifest components, set by the shared sequence.
+ *
+ * @returns The copy of the parameters, allocated from the scratch region,
+ *          NULL if the region is exhausted.
+ */
+static struct suit_manifest_params *snapshot_shared_params(struct suit_manifest_state *manifest_state)
+{
+	struct suit_manifest_params *snapshot = suit_arena_alloc(
+		manifest_state->components_count * sizeof(struct suit_manifest_params));
+
+	if (snapshot == NULL) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < manifest_state->components_count; i++) {
+		struct suit_manifest_params *params;
+
+		if (suit_manifest_get_component_params(manifest_state, i, &params) != SUIT_SUCCESS) {
+			return NULL;
+		}
+
+		suit_manifest_params_copy_values(&snapshot[i], params);
+	}
+
+	return snapshot;
+}
+
+/** @brief Bring the parameter values of the manifest components back to the state after the shared sequence. */
+static int restore_shared_params(struct suit_manifest_state *manifest_state,
+				 const struct suit_manifest_params *snapshot)
+{
+	for (size_t i = 0; i < manifest_state->components_count; i++) {
+		struct suit_manifest_params *params;
+		int ret = suit_manifest_get_component_params(manifest_state, i, &params);
+
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+
+		/* The image size is the only parameter, that is also passed to the platform. */
+		if (suit_param_is_set(&snapshot[i], SUIT_PARAM_IMAGE_SIZE) &&
+		    (!suit_param_is_set(params, SUIT_PARAM_IMAGE_SIZE) ||
+		     (params->image_size != snapshot[i].image_size))) {
+			ret = SUIT_TRACE(SUIT_TRACE_PLAT_OVERRIDE_IMAGE_SIZE,
+					 suit_plat_override_image_size(params->component_handle,
+								       snapshot[i].image_size,
+								       &manifest_state->manifest_component_id));
+			if (ret != SUIT_SUCCESS) {
+				return ret;
+			}
+		}
+
+		/* The components may be referenced or checked by a dependency manifest,
+		 * processed by the sequence, so only the parameter values are restored.
+		 */
+		suit_manifest_params_copy_values(params, &snapshot[i]);
+	}
+
+	return SUIT_SUCCESS;
+}
+
 static int suit_dry_run_manifest(struct suit_manifest_state *manifest_state,
 				 enum suit_command_sequence seq_name)
 {
@@ -79,12 +202,18 @@ static int suit_dry_run_manifest(struct suit_manifest_state *manifest_state,
 		ret = SUIT_SUCCESS;
 	}
 
+	/* The parameters after the shared sequence, restored before each sequence instead of
+	 * executing the shared sequence again.
+	 */
+	struct suit_manifest_params *shared_params = NULL;
+	size_t arena_mark = suit_arena_mark();
+
 	state->dry_run = suit_bool_true;
 
 	for (enum suit_command_sequence seq = seq_name; seq <= end_seq; seq++) {
 		SUIT_DBG("Dry-run sequence: %d\r\n", seq);
 
-		struct zcbor_string *step_seq = NULL;
+		struct zcbor_string step_seq;
 		int seq_get_ret = suit_manifest_get_command_seq(manifest_state, seq, &step_seq);
 		if (seq_get_ret != SUIT_SUCCESS) {
 			if (seq_get_ret == SUIT_ERR_UNAVAILABLE_COMMAND_SEQ)
@@ -93,19 +222,34 @@ static int suit_dry_run_manifest(struct suit_manifest_state *manifest_state,
 				continue;
 			}
 			SUIT_ERR("Error when getting command sequences %d\r\n", seq);
-			return seq_get_ret;
+			ret = seq_get_ret;
+			break;
 		}
 
-		/* Execute shared command sequence */
-		ret = suit_schedule_execution(state, manifest_state, SUIT_SEQ_SHARED);
-		if (ret == SUIT_ERR_AGAIN) {
-			ret = suit_process_scheduled(state);
+		if (state->plan != NULL) {
+			state->plan->seq = seq;
 		}
 
-		if (ret == SUIT_ERR_UNAVAILABLE_COMMAND_SEQ) {
-			ret = SUIT_SUCCESS;
+		if (shared_params == NULL) {
+			/* Execute shared command sequence */
+			ret = suit_schedule_execution(state, manifest_state, SUIT_SEQ_SHARED);
+			if (ret == SUIT_ERR_AGAIN) {
+				ret = suit_process_scheduled(state);
+			}
+
+			if (ret == SUIT_ERR_UNAVAILABLE_COMMAND_SEQ) {
+				ret = SUIT_SUCCESS;
+			} else {
+				SUIT_DBG("Shared sequence executed. Status: %d\r\n", ret);
+			}
+
+			if (ret == SUIT_SUCCESS) {
+				/* If the scratch region is exhausted, the shared sequence is executed again. */
+				shared_params = snapshot_shared_params(manifest_state);
+			}
 		} else {
-			SUIT_DBG("Shared sequence executed. Status: %d\r\n", ret);
+			ret = restore_shared_params(manifest_state, shared_params);
+			SUIT_DBG("Shared sequence parameters restored. Status: %d\r\n", ret);
 		}
 
 		if (ret == SUIT_SUCCESS) {
@@ -128,6 +272,7 @@ static int suit_dry_run_manifest(struct suit_manifest_state *manifest_state,
 	}
 
 	SUIT_DBG("Manifest dry-run finished\r\n");
+	suit_arena_release(arena_mark);
 	state->dry_run = suit_bool_false;
 
 	return ret;
@@ -162,29 +307,33 @@ int suit_processor_load_envelope(struct suit_processor_state *state, const uint8
 
 	SUIT_DBG("Parse manifest: %p (%d)\r\n", envelope_str, envelope_len);
 	manifest_state = &state->manifest_stack[state->manifest_stack_height];
-	retval = suit_processor_decode_envelope(
-		&state->decoder_state,
+	retval = SUIT_TRACE(SUIT_TRACE_DECODE_ENVELOPE, suit_processor_decode_envelope(
+		state,
 		manifest_state,
-		envelope_str, envelope_len);
+		envelope_str, envelope_len));
 
 	if (retval == SUIT_SUCCESS) {
 		SUIT_DBG("Authenticate manifest digest\r\n");
-		retval = suit_decoder_authenticate_manifest(&state->decoder_state);
+		retval = SUIT_TRACE(SUIT_TRACE_DECODE_AUTHENTICATE,
+				    suit_decoder_authenticate_manifest(&state->decoder_state));
 	}
 
 	if (retval == SUIT_SUCCESS) {
 		SUIT_DBG("Authorize manifest\r\n");
-		retval = suit_decoder_authorize_manifest(&state->decoder_state);
+		retval = SUIT_TRACE(SUIT_TRACE_DECODE_AUTHORIZE,
+				    suit_decoder_authorize_manifest(&state->decoder_state));
 	}
 
 	if (retval == SUIT_SUCCESS) {
 		SUIT_DBG("Decode sequences\r\n");
-		retval = suit_decoder_decode_sequences(&state->decoder_state);
+		retval = SUIT_TRACE(SUIT_TRACE_DECODE_SEQUENCES,
+				    suit_decoder_decode_sequences(&state->decoder_state));
 	}
 
 	if (retval == SUIT_SUCCESS) {
 		SUIT_DBG("Create component handles\r\n");
-		retval = suit_decoder_create_components(&state->decoder_state);
+		retval = SUIT_TRACE(SUIT_TRACE_DECODE_CREATE_COMPONENTS,
+				    suit_decoder_create_components(&state->decoder_state));
 	}
 
 	if (retval == SUIT_SUCCESS) {
@@ -204,15 +353,93 @@ int suit_processor_load_envelope(struct suit_processor_state *state, const uint8
 
 	if (retval != SUIT_SUCCESS) {
 		SUIT_ERR("Failed to load manifest\r\n");
+		release_decoded_envelope(&state->decoder_state);
+	}
+
+	return retval;
+}
+
+#ifndef SUIT_PRUNE_DEPENDENCIES
+bool suit_processor_pin_manifest(struct suit_processor_state *state, struct suit_manifest_params *dependency)
+{
+	/* The root manifest is never pinned. */
+	if ((state == NULL) || (dependency == NULL) || (state->manifest_stack_height < 2)) {
+		return false;
+	}
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(state->pinned_owners); i++) {
+		if (state->pinned_owners[i] == NULL) {
+			state->manifest_stack_height--;
+			state->pinned_manifests[i] = state->manifest_stack[state->manifest_stack_height];
+			memset(&state->manifest_stack[state->manifest_stack_height], 0,
+			       sizeof(state->manifest_stack[state->manifest_stack_height]));
+			state->pinned_owners[i] = dependency;
+			SUIT_DBG("Manifest pinned in slot %d\r\n", i);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool suit_processor_unpin_manifest(struct suit_processor_state *state, struct suit_manifest_params *dependency)
+{
+	if ((state == NULL) || (dependency == NULL) || (dependency->integrity_checked != true) ||
+	    (state->manifest_stack_height >= ZCBOR_ARRAY_SIZE(state->manifest_stack))) {
+		return false;
+	}
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(state->pinned_owners); i++) {
+		if (state->pinned_owners[i] == dependency) {
+			state->manifest_stack[state->manifest_stack_height] = state->pinned_manifests[i];
+			state->manifest_stack_height++;
+			memset(&state->pinned_manifests[i], 0, sizeof(state->pinned_manifests[i]));
+			state->pinned_owners[i] = NULL;
+			SUIT_DBG("Manifest unpinned from slot %d\r\n", i);
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int suit_processor_release_pinned_manifests(struct suit_processor_state *state, struct suit_manifest_params *dependency)
+{
+	int retval = SUIT_SUCCESS;
+
+	if (state == NULL) {
+		return SUIT_ERR_CRASH;
+	}
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(state->pinned_owners); i++) {
+		if ((state->pinned_owners[i] == NULL) ||
+		    ((dependency != NULL) && (state->pinned_owners[i] != dependency))) {
+			continue;
+		}
+
+		int ret = suit_manifest_release(&state->pinned_manifests[i]);
+		if (ret == SUIT_ERR_AGAIN) {
+			/* Do not allow component release to spread over more than one iteration. */
+			ret = SUIT_ERR_CRASH;
+		}
+
+		state->pinned_owners[i] = NULL;
+		if (retval == SUIT_SUCCESS) {
+			retval = ret;
+		}
 	}
 
 	return retval;
 }
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 
 int suit_process_sequence(const uint8_t *envelope_str, size_t envelope_len, enum suit_command_sequence seq_name)
 {
 	int ret = SUIT_SUCCESS;
 	struct suit_manifest_state *manifest_state = NULL;
+	bool resumed = false;
 
 	if ((seq_name < SUIT_SEQ_PARSE) || (seq_name >= SUIT_SEQ_MAX)) {
 		return SUIT_ERR_UNAVAILABLE_COMMAND_SEQ;
@@ -226,31 +453,16 @@ int suit_process_sequence(const uint8_t *envelope_str, size_t envelope_len, enum
 	ret = suit_processor_load_envelope(state, envelope_str, envelope_len);
 
 	if (ret == SUIT_SUCCESS) {
-		SUIT_DBG("Validate sequences\r\n");
-
-		/* Verify manifest members */
-		for (enum suit_command_sequence seq = SUIT_SEQ_SHARED; seq < SUIT_SEQ_MAX; seq++) {
-			int ret = suit_schedule_validation(state, manifest_state, seq);
-			if ((ret == SUIT_ERR_UNAUTHORIZED_COMMAND_SEQ) && (seq != seq_name)) {
-				/* Since this loop goes through all possible sequences, mask error that indicates missing,
-				 * severed sequence if the sequence is not the one that is curreclty executed.
-				 */
-				ret = SUIT_SUCCESS;
-			} else if (ret == SUIT_ERR_UNAVAILABLE_COMMAND_SEQ) {
-				ret = SUIT_SUCCESS;
-			} else if (ret == SUIT_ERR_AGAIN) {
-				ret = suit_process_scheduled(state);
-			}
-
-			if (ret != SUIT_SUCCESS) {
-				SUIT_ERR("Manifest sequence %d validation failed (%d)\r\n", seq, ret);
-				break;
-			} else {
-				SUIT_DBG("Manifest sequence %d validated\r\n", seq);
-			}
-		}
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+		/* The digest is used to bind checkpoints with the manifest. It has to be captured
+		 * before the decoder state is reused by dependency manifests.
+		 */
+		state->checkpoint_enabled = suit_bool_false;
+		state->checkpoint_manifest_digest = state->decoder_state.manifest_digest_bytes;
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
 
-		SUIT_DBG("Manifest validation finished\r\n");
+		/* The validation failures are only logged here, the sequence execution reports them. */
+		(void)suit_validate_manifest(manifest_state, seq_name);
 
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 		/* Do not execute dry run while booting.
@@ -274,7 +486,7 @@ int suit_process_sequence(const uint8_t *envelope_str, size_t envelope_len, enum
 	if ((ret == SUIT_SUCCESS) && (seq_name > SUIT_SEQ_PARSE)) {
 		SUIT_DBG("Check if sequence %d is defined inside the manifest\r\n", seq_name);
 
-		struct zcbor_string *step_seq = NULL;
+		struct zcbor_string step_seq;
 		ret = suit_manifest_get_command_seq(manifest_state, seq_name, &step_seq);
 		if (ret != SUIT_SUCCESS) {
 			SUIT_ERR("Failed to execute sequence %d: sequence not found\r\n", seq_name);
@@ -284,39 +496,76 @@ int suit_process_sequence(const uint8_t *envelope_str, size_t envelope_len, enum
 	if ((ret == SUIT_SUCCESS) && (seq_name > SUIT_SEQ_PARSE)) {
 		SUIT_DBG("Execute sequence: %d\r\n", seq_name);
 
-		/* Execute shared command sequence */
-		ret = suit_schedule_execution(state, manifest_state, SUIT_SEQ_SHARED);
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+		/* Continue the interrupted execution, including the parameter values set by the shared
+		 * sequence. The checkpoint is accepted only if the manifest digest matches.
+		 */
+		ret = suit_schedule_resumed_execution(state, manifest_state);
 		if (ret == SUIT_ERR_AGAIN) {
+			SUIT_INF("Resume sequence %d from checkpoint\r\n", seq_name);
+			resumed = true;
+			state->checkpoint_enabled = suit_bool_true;
 			ret = suit_process_scheduled(state);
-		}
-
-		if (ret == SUIT_ERR_UNAVAILABLE_COMMAND_SEQ) {
-			ret = SUIT_SUCCESS;
 		} else {
-			SUIT_DBG("Shared sequence executed. Status: %d\r\n", ret);
+			ret = SUIT_SUCCESS;
 		}
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
 
-		if (ret == SUIT_SUCCESS) {
-			ret = suit_schedule_execution(state, manifest_state, seq_name);
+		if (!resumed) {
+			/* Execute shared command sequence */
+			ret = suit_schedule_execution(state, manifest_state, SUIT_SEQ_SHARED);
 			if (ret == SUIT_ERR_AGAIN) {
 				ret = suit_process_scheduled(state);
 			}
 
 			if (ret == SUIT_ERR_UNAVAILABLE_COMMAND_SEQ) {
-				SUIT_ERR("Failed to execute sequence %d: sequence not found\r\n", seq_name);
+				ret = SUIT_SUCCESS;
 			} else {
-				SUIT_DBG("Command sequence %d executed. Status: %d\r\n", seq_name, ret);
+				SUIT_DBG("Shared sequence executed. Status: %d\r\n", ret);
+			}
+
+			if (ret == SUIT_SUCCESS) {
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+				state->checkpoint_enabled = suit_bool_true;
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+				ret = suit_schedule_execution(state, manifest_state, seq_name);
+				if (ret == SUIT_ERR_AGAIN) {
+					ret = suit_process_scheduled(state);
+				}
+
+				if (ret == SUIT_ERR_UNAVAILABLE_COMMAND_SEQ) {
+					SUIT_ERR("Failed to execute sequence %d: sequence not found\r\n", seq_name);
+				} else {
+					SUIT_DBG("Command sequence %d executed. Status: %d\r\n", seq_name, ret);
+				}
 			}
 		}
 
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+		/* The sequence is finished, so it must not be resumed. */
+		state->checkpoint_enabled = suit_bool_false;
+		(void)suit_checkpoint_discard(state, manifest_state);
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+
+#ifdef SUIT_PLATFORM_REPORT_SUPPORT
+		/* Pass the results of the commands, executed within the sequence, to the platform. */
+		(void)suit_report_flush();
+#endif /* SUIT_PLATFORM_REPORT_SUPPORT */
+
 		if (ret == SUIT_SUCCESS) {
-			ret = suit_plat_sequence_completed(state->current_seq,
-				&manifest_state->manifest_component_id,
-				manifest_state->envelope_str.value,
-				manifest_state->envelope_str.len);
+			ret = SUIT_TRACE(SUIT_TRACE_PLAT_SEQUENCE_COMPLETED,
+				suit_plat_sequence_completed(state->current_seq,
+					&manifest_state->manifest_component_id,
+					manifest_state->envelope_str.value,
+					manifest_state->envelope_str.len));
 		}
 	}
 
+#ifndef SUIT_PRUNE_DEPENDENCIES
+	/* The dependency manifests, that were checked but not processed, are no longer needed. */
+	(void)suit_processor_release_pinned_manifests(state, NULL);
+#endif /* SUIT_PRUNE_DEPENDENCIES */
+
 	if (manifest_state != NULL) {
 		(void)suit_manifest_release(manifest_state);
 		state->manifest_stack_height--;
@@ -325,6 +574,76 @@ int suit_process_sequence(const uint8_t *envelope_str, size_t envelope_len, enum
 	return ret;
 }
 
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+int suit_process_sequence_from_reader(struct suit_envelope_reader *reader, uint8_t *window, size_t window_size,
+				      enum suit_command_sequence seq_name)
+{
+	size_t envelope_len = 0;
+
+	int ret = suit_envelope_reader_load(reader, window, window_size, &envelope_len);
+	if (ret != SUIT_SUCCESS) {
+		SUIT_ERR("Failed to load envelope from storage (%d)\r\n", ret);
+		return ret;
+	}
+
+	state->envelope_reader = reader;
+	ret = suit_process_sequence(window, envelope_len, seq_name);
+	state->envelope_reader = NULL;
+
+	return ret;
+}
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+int suit_processor_get_operation_plan(const uint8_t *envelope_str, size_t envelope_len,
+				      enum suit_command_sequence seq_name, struct suit_plan *plan)
+{
+	struct suit_manifest_state *manifest_state = NULL;
+	int ret;
+
+	if ((plan == NULL) || (seq_name <= SUIT_SEQ_SHARED) || (seq_name >= SUIT_SEQ_MAX)) {
+		return SUIT_ERR_UNAVAILABLE_COMMAND_SEQ;
+	}
+
+	/* The plan may be requested from a platform callback, while another manifest is processed. */
+	if (state->manifest_stack_height >= SUIT_MAX_MANIFEST_DEPTH) {
+		SUIT_ERR("Unable to plan operations: Stack too small (%d).\r\n", state->manifest_stack_height);
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	state->current_seq = seq_name;
+	manifest_state = &state->manifest_stack[state->manifest_stack_height];
+
+	ret = suit_processor_load_envelope(state, envelope_str, envelope_len);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	/* The loaded manifest is released from the top of the stack. */
+	if ((state->manifest_stack_height == 0) ||
+	    (state->manifest_stack_height > SUIT_MAX_MANIFEST_DEPTH) ||
+	    (manifest_state != &state->manifest_stack[state->manifest_stack_height - 1])) {
+		return SUIT_ERR_CRASH;
+	}
+
+	ret = suit_validate_manifest(manifest_state, seq_name);
+	if (ret == SUIT_SUCCESS) {
+		state->plan = plan;
+		ret = suit_dry_run_manifest(manifest_state, seq_name);
+		state->plan = NULL;
+	}
+
+#ifndef SUIT_PRUNE_DEPENDENCIES
+	(void)suit_processor_release_pinned_manifests(state, NULL);
+#endif /* SUIT_PRUNE_DEPENDENCIES */
+
+	(void)suit_manifest_release(manifest_state);
+	state->manifest_stack_height--;
+
+	return ret;
+}
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
 int suit_processor_get_manifest_metadata(const uint8_t *envelope_str, size_t envelope_len, bool authenticate, struct zcbor_string *manifest_component_id, int *version, size_t *version_len, struct zcbor_string *digest, enum suit_cose_alg *alg, unsigned int *seq_num)
 {
 	int ret = SUIT_SUCCESS;
@@ -348,7 +667,7 @@ int suit_processor_get_manifest_metadata(const uint8_t *envelope_str, size_t env
 		}
 
 		manifest = &state->manifest_stack[state->manifest_stack_height];
-		ret = suit_processor_decode_envelope(decoder_state, manifest, envelope_str, envelope_len);
+		ret = suit_processor_decode_envelope(state, manifest, envelope_str, envelope_len);
 	}
 
 	if (authenticate) {
@@ -416,13 +735,17 @@ int suit_processor_get_manifest_metadata(const uint8_t *envelope_str, size_t env
 			/* Initialize returned memory with zero. */
 			memset(version, 0, sizeof(*version) * (*version_len));
 
-			if (decoder_state->decoded_manifest->current_version.len > 0) {
+			struct zcbor_string current_version;
+
+			suit_manifest_ref_to_str(decoder_state->decoded_manifest,
+						 &decoder_state->decoded_manifest->current_version, &current_version);
+			if (current_version.len > 0) {
 				ret = cbor_decode_SUIT_Condition_Version_Comparison_Value(
-					decoder_state->decoded_manifest->current_version.value,
-					decoder_state->decoded_manifest->current_version.len,
+					current_version.value,
+					current_version.len,
 					&cbor_version,
 					&cbor_version_len);
-				if ((ret != ZCBOR_SUCCESS) || (cbor_version_len != decoder_state->decoded_manifest->current_version.len)) {
+				if ((ret != ZCBOR_SUCCESS) || (cbor_version_len != current_version.len)) {
 					ret = SUIT_ERR_DECODING;
 				} if (cbor_version.SUIT_Condition_Version_Comparison_Value_int_count > *version_len) {
 					ret = SUIT_ERR_DECODING;
@@ -441,6 +764,7 @@ int suit_processor_get_manifest_metadata(const uint8_t *envelope_str, size_t env
 	}
 
 	/* Reset the decoder state */
+	release_decoded_envelope(decoder_state);
 	decoder_state->step = INVALID;
 
 	/* There is no need to call suit_manifest_release(..) because
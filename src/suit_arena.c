@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_arena.h>
+#include <suit_platform.h>
+
+#ifndef SUIT_ARENA_EXTERNAL
+static union {
+	uint64_t align;
+	uint8_t buf[SUIT_ARENA_MIN_SIZE];
+} default_region;
+
+static uint8_t *region_buf = default_region.buf;
+static size_t region_size = sizeof(default_region.buf);
+#else /* SUIT_ARENA_EXTERNAL */
+static uint8_t *region_buf;
+static size_t region_size;
+#endif /* SUIT_ARENA_EXTERNAL */
+
+static size_t used;
+static size_t peak;
+
+
+int suit_arena_init(void *buf, size_t size)
+{
+	if ((buf == NULL) || (((uintptr_t)buf % SUIT_ARENA_ALIGN) != 0)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if (size < SUIT_ARENA_MIN_SIZE) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	if (used != 0) {
+		return SUIT_ERR_ORDER;
+	}
+
+	region_buf = buf;
+	region_size = size;
+	peak = 0;
+
+	return SUIT_SUCCESS;
+}
+
+void *suit_arena_alloc(size_t size)
+{
+	size_t aligned_size = (size + SUIT_ARENA_ALIGN - 1) & ~((size_t)SUIT_ARENA_ALIGN - 1);
+	uint8_t *ptr;
+
+	if ((region_buf == NULL) || (aligned_size < size) || (aligned_size > region_size - used)) {
+		SUIT_ERR("Unable to allocate %d bytes from the scratch region (%d/%d used)\r\n",
+			 size, used, region_size);
+		return NULL;
+	}
+
+	ptr = &region_buf[used];
+	used += aligned_size;
+	if (used > peak) {
+		peak = used;
+	}
+
+	memset(ptr, 0, aligned_size);
+
+	return ptr;
+}
+
+size_t suit_arena_mark(void)
+{
+	return used;
+}
+
+void suit_arena_release(size_t mark)
+{
+	if (mark < used) {
+		used = mark;
+	}
+}
+
+size_t suit_arena_peak(void)
+{
+	return peak;
+}
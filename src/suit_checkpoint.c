@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_checkpoint.h>
+#include <suit_platform.h>
+#include <suit_manifest.h>
+#include <suit_directive.h>
+#include <suit_trace.h>
+
+/** Bits of the suit_checkpoint_params.flags field.
+ *
+ * @note The *_SET bits are equal to the enum suit_param_id values.
+ */
+enum checkpoint_param_flag {
+	CHECKPOINT_VID_SET,
+	CHECKPOINT_CID_SET,
+	CHECKPOINT_IMAGE_DIGEST_SET,
+	CHECKPOINT_IMAGE_SIZE_SET,
+	CHECKPOINT_CONTENT_SET,
+	CHECKPOINT_COMPONENT_SLOT_SET,
+	CHECKPOINT_URI_SET,
+	CHECKPOINT_SOURCE_COMPONENT_SET,
+	CHECKPOINT_INVOKE_ARGS_SET,
+	CHECKPOINT_DID_SET,
+	CHECKPOINT_VERSION_SET,
+	CHECKPOINT_ENCRYPTION_INFO_SET,
+	CHECKPOINT_COMPRESSION_INFO_SET,
+	CHECKPOINT_BASE_DIGEST_SET,
+	CHECKPOINT_PATCH_COMPONENT_SET,
+	CHECKPOINT_INTEGRITY_CHECKED,
+};
+
+#define CHECKPOINT_FLAG(flag) (1UL << (flag))
+
+/* The try-each directive stores the index of the next command block to execute. */
+#define CHECKPOINT_MAX_TRY_EACH_STATE                                                              \
+	ZCBOR_ARRAY_SIZE(((struct SUIT_Directive_Try_Each_Argument *)NULL)                         \
+				 ->SUIT_Directive_Try_Each_Argument_SUIT_Command_Sequence_bstr)
+
+/* The dependency directives step through the manifest sequences, followed by two extra states. */
+#define CHECKPOINT_MAX_DEPENDENCY_STATE (SUIT_SEQ_MAX + 2)
+
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+/* The checkpoint is too big to be allocated on the stack. */
+static struct suit_checkpoint checkpoint_buf;
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+
+
+static bool str_to_offset(struct zcbor_string *envelope, struct zcbor_string *str,
+			  struct suit_checkpoint_str *location)
+{
+	if (str->value == NULL) {
+		location->offset = 0;
+		location->len = 0;
+		return true;
+	}
+
+	if ((str->value < envelope->value) || (str->len > envelope->len) ||
+	    ((size_t)(str->value - envelope->value) > (envelope->len - str->len))) {
+		return false;
+	}
+
+	location->offset = (uint32_t)(str->value - envelope->value);
+	location->len = (uint32_t)str->len;
+
+	return true;
+}
+
+static bool offset_valid(struct zcbor_string *envelope, const struct suit_checkpoint_str *location)
+{
+	return ((location->offset <= envelope->len) &&
+		(location->len <= (envelope->len - location->offset)));
+}
+
+static void offset_to_str(struct zcbor_string *envelope, const struct suit_checkpoint_str *location,
+			  struct zcbor_string *str)
+{
+	if ((location->offset == 0) && (location->len == 0)) {
+		str->value = NULL;
+		str->len = 0;
+	} else {
+		str->value = envelope->value + location->offset;
+		str->len = location->len;
+	}
+}
+
+static uint32_t components_to_mask(const bool *components)
+{
+	uint32_t mask = 0;
+
+	for (size_t i = 0; i < SUIT_MAX_NUM_COMPONENTS; i++) {
+		if (components[i]) {
+			mask |= (1UL << i);
+		}
+	}
+
+	return mask;
+}
+
+static void mask_to_components(uint32_t mask, bool *components)
+{
+	for (size_t i = 0; i < SUIT_MAX_NUM_COMPONENTS; i++) {
+		components[i] = ((mask & (1UL << i)) != 0);
+	}
+}
+
+static int save_params(struct zcbor_string *envelope, struct suit_manifest_params *params,
+		       struct suit_checkpoint_params *checkpoint)
+{
+	uint32_t flags;
+
+	/* Parameters, set by a dependency manifest may point outside of the root envelope. */
+	if (!str_to_offset(envelope, &params->vid, &checkpoint->vid) ||
+	    !str_to_offset(envelope, &params->cid, &checkpoint->cid) ||
+	    !str_to_offset(envelope, &params->image_digest, &checkpoint->image_digest) ||
+	    !str_to_offset(envelope, &params->content, &checkpoint->content) ||
+	    !str_to_offset(envelope, &params->uri, &checkpoint->uri) ||
+	    !str_to_offset(envelope, &params->invoke_args, &checkpoint->invoke_args) ||
+	    !str_to_offset(envelope, &params->did, &checkpoint->did) ||
+	    !str_to_offset(envelope, &params->version, &checkpoint->version) ||
+	    !str_to_offset(envelope, &params->encryption_info, &checkpoint->encryption_info) ||
+	    !str_to_offset(envelope, &params->compression_info, &checkpoint->compression_info) ||
+	    !str_to_offset(envelope, &params->base_digest, &checkpoint->base_digest)) {
+		return SUIT_ERR_UNSUPPORTED_PARAMETER;
+	}
+
+	if (params->image_size > UINT32_MAX) {
+		return SUIT_ERR_UNSUPPORTED_PARAMETER;
+	}
+
+	checkpoint->image_size = (uint32_t)params->image_size;
+	checkpoint->component_slot = (uint32_t)params->component_slot;
+	checkpoint->source_component = (uint32_t)params->source_component;
+	checkpoint->patch_component = (uint32_t)params->patch_component;
+
+	/* The checkpoint flags share the bit layout with the parameter presence mask. */
+	flags = params->set_mask;
+	flags |= (params->integrity_checked ? CHECKPOINT_FLAG(CHECKPOINT_INTEGRITY_CHECKED) : 0);
+	checkpoint->flags = flags;
+
+	return SUIT_SUCCESS;
+}
+
+static bool params_valid(struct zcbor_string *envelope, const struct suit_checkpoint_params *checkpoint)
+{
+	return (offset_valid(envelope, &checkpoint->vid) &&
+		offset_valid(envelope, &checkpoint->cid) &&
+		offset_valid(envelope, &checkpoint->image_digest) &&
+		offset_valid(envelope, &checkpoint->content) &&
+		offset_valid(envelope, &checkpoint->uri) &&
+		offset_valid(envelope, &checkpoint->invoke_args) &&
+		offset_valid(envelope, &checkpoint->did) &&
+		offset_valid(envelope, &checkpoint->version) &&
+		offset_valid(envelope, &checkpoint->encryption_info) &&
+		offset_valid(envelope, &checkpoint->compression_info) &&
+		offset_valid(envelope, &checkpoint->base_digest) &&
+		(checkpoint->flags < CHECKPOINT_FLAG(CHECKPOINT_INTEGRITY_CHECKED + 1)));
+}
+
+static void restore_params(struct zcbor_string *envelope, const struct suit_checkpoint_params *checkpoint,
+			   struct suit_manifest_params *params)
+{
+	uint32_t flags = checkpoint->flags;
+
+	offset_to_str(envelope, &checkpoint->vid, &params->vid);
+	offset_to_str(envelope, &checkpoint->cid, &params->cid);
+	offset_to_str(envelope, &checkpoint->image_digest, &params->image_digest);
+	offset_to_str(envelope, &checkpoint->content, &params->content);
+	offset_to_str(envelope, &checkpoint->uri, &params->uri);
+	offset_to_str(envelope, &checkpoint->invoke_args, &params->invoke_args);
+	offset_to_str(envelope, &checkpoint->did, &params->did);
+	offset_to_str(envelope, &checkpoint->version, &params->version);
+	offset_to_str(envelope, &checkpoint->encryption_info, &params->encryption_info);
+	offset_to_str(envelope, &checkpoint->compression_info, &params->compression_info);
+	offset_to_str(envelope, &checkpoint->base_digest, &params->base_digest);
+
+	params->image_size = checkpoint->image_size;
+	params->component_slot = checkpoint->component_slot;
+	params->source_component = checkpoint->source_component;
+	params->patch_component = checkpoint->patch_component;
+
+	params->set_mask = (uint16_t)(flags & (CHECKPOINT_FLAG(CHECKPOINT_INTEGRITY_CHECKED) - 1));
+	params->integrity_checked = ((flags & CHECKPOINT_FLAG(CHECKPOINT_INTEGRITY_CHECKED)) != 0);
+}
+
+static bool cmd_exec_state_valid(int32_t cmd_exec_state)
+{
+	return ((cmd_exec_state >= SUIT_SEQ_EXEC_DEFAULT_STATE) &&
+		((cmd_exec_state <= CHECKPOINT_MAX_DEPENDENCY_STATE) ||
+		 (cmd_exec_state <= (int32_t)CHECKPOINT_MAX_TRY_EACH_STATE)));
+}
+
+static bool retval_valid(int32_t retval)
+{
+	/* The nested sequence result is passed to the caller stack frame without any conversion. */
+	return (((retval >= SUIT_SUCCESS) && (retval <= SUIT_ERR_UNAUTHORIZED_COMMAND_SEQ)) ||
+		((retval >= SUIT_ERR_AGAIN) && (retval <= SUIT_FAIL_SOFT_CONDITION)) ||
+		((retval >= SUIT_ZCBOR_ERR_OFFSET) &&
+		 (retval <= ZCBOR_ERR_TO_SUIT_ERR(ZCBOR_ERR_UNKNOWN))));
+}
+
+static int save_seq(struct zcbor_string *envelope, struct suit_seq_exec_state *seq_exec_state,
+		    struct suit_checkpoint_seq *checkpoint)
+{
+	if (!str_to_offset(envelope, &seq_exec_state->cmd_seq_str, &checkpoint->cmd_seq) ||
+	    (seq_exec_state->exec_ptr < seq_exec_state->cmd_seq_str.value) ||
+	    (seq_exec_state->exec_ptr >
+	     seq_exec_state->cmd_seq_str.value + seq_exec_state->cmd_seq_str.len)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	checkpoint->exec_offset = (uint32_t)(seq_exec_state->exec_ptr - envelope->value);
+	checkpoint->n_commands = (uint32_t)seq_exec_state->n_commands;
+	checkpoint->current_command = (uint32_t)seq_exec_state->current_command;
+	checkpoint->cmd_exec_state = seq_exec_state->cmd_exec_state;
+	checkpoint->retval = seq_exec_state->retval;
+	checkpoint->soft_failure = (uint32_t)seq_exec_state->soft_failure;
+	checkpoint->current_component_idx = (uint32_t)seq_exec_state->current_component_idx;
+	checkpoint->current_components = components_to_mask(seq_exec_state->current_components);
+	checkpoint->current_components_backup =
+		components_to_mask(seq_exec_state->current_components_backup);
+
+	return SUIT_SUCCESS;
+}
+
+static int restore_seq(struct zcbor_string *envelope, const struct suit_checkpoint_str *parent,
+		       const struct suit_checkpoint_seq *checkpoint, size_t components_count,
+		       struct suit_seq_exec_state *seq_exec_state)
+{
+	uint32_t components_mask = (uint32_t)((1ULL << components_count) - 1);
+
+	/* Nested sequences are always located inside the parent sequence. */
+	if (!offset_valid(envelope, &checkpoint->cmd_seq) ||
+	    (checkpoint->cmd_seq.offset < parent->offset) ||
+	    (checkpoint->cmd_seq.len > parent->len) ||
+	    ((checkpoint->cmd_seq.offset - parent->offset) > (parent->len - checkpoint->cmd_seq.len))) {
+		return SUIT_ERR_DECODING;
+	}
+
+	if ((checkpoint->exec_offset < checkpoint->cmd_seq.offset) ||
+	    ((checkpoint->exec_offset - checkpoint->cmd_seq.offset) > checkpoint->cmd_seq.len) ||
+	    (checkpoint->current_command > checkpoint->n_commands) ||
+	    !cmd_exec_state_valid(checkpoint->cmd_exec_state) ||
+	    !retval_valid(checkpoint->retval) ||
+	    ((checkpoint->soft_failure != suit_bool_true) &&
+	     (checkpoint->soft_failure != suit_bool_false)) ||
+	    ((checkpoint->current_component_idx >= components_count) &&
+	     (checkpoint->current_component_idx != SUIT_MAX_NUM_COMPONENTS)) ||
+	    ((checkpoint->current_components & ~components_mask) != 0) ||
+	    ((checkpoint->current_components_backup & ~components_mask) != 0)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	offset_to_str(envelope, &checkpoint->cmd_seq, &seq_exec_state->cmd_seq_str);
+	seq_exec_state->exec_ptr = envelope->value + checkpoint->exec_offset;
+	seq_exec_state->n_commands = checkpoint->n_commands;
+	seq_exec_state->current_command = checkpoint->current_command;
+	seq_exec_state->cmd_exec_state = checkpoint->cmd_exec_state;
+	seq_exec_state->retval = checkpoint->retval;
+	seq_exec_state->soft_failure = (enum suit_bool)checkpoint->soft_failure;
+	seq_exec_state->current_component_idx = checkpoint->current_component_idx;
+	mask_to_components(checkpoint->current_components, seq_exec_state->current_components);
+	mask_to_components(checkpoint->current_components_backup,
+			   seq_exec_state->current_components_backup);
+
+	return SUIT_SUCCESS;
+}
+
+
+int suit_checkpoint_save(struct suit_processor_state *state, struct zcbor_string *manifest_digest,
+			 struct suit_checkpoint *checkpoint)
+{
+	struct suit_manifest_state *manifest;
+	struct suit_manifest_params *params;
+	int ret = SUIT_SUCCESS;
+
+	if ((state == NULL) || (manifest_digest == NULL) || (checkpoint == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if ((state->seq_stack_height == 0) || (state->seq_stack_height > SUIT_MAX_SEQ_DEPTH)) {
+		return SUIT_ERR_ORDER;
+	}
+
+	if (state->manifest_stack_height != 1) {
+		/* Dependency manifests are not serialized. */
+		return SUIT_ERR_WAIT;
+	}
+
+	if ((manifest_digest->value == NULL) ||
+	    (manifest_digest->len > SUIT_CHECKPOINT_MAX_DIGEST_LEN)) {
+		return SUIT_ERR_UNSUPPORTED_ALG;
+	}
+
+	manifest = &state->manifest_stack[0];
+
+	memset(checkpoint, 0, sizeof(*checkpoint));
+	checkpoint->magic = SUIT_CHECKPOINT_MAGIC;
+	checkpoint->seq_name = (uint32_t)state->current_seq;
+	checkpoint->manifest_digest_len = (uint32_t)manifest_digest->len;
+	memcpy(checkpoint->manifest_digest, manifest_digest->value, manifest_digest->len);
+
+	checkpoint->components_count = (uint32_t)manifest->components_count;
+	for (size_t i = 0; (ret == SUIT_SUCCESS) && (i < manifest->components_count); i++) {
+		ret = suit_manifest_get_component_params(manifest, i, &params);
+		if (ret == SUIT_SUCCESS) {
+			ret = save_params(&manifest->envelope_str, params, &checkpoint->params[i]);
+		}
+	}
+
+	checkpoint->seq_stack_height = (uint32_t)state->seq_stack_height;
+	for (size_t i = 0; (ret == SUIT_SUCCESS) && (i < state->seq_stack_height); i++) {
+		if (state->seq_stack[i].manifest != manifest) {
+			return SUIT_ERR_WAIT;
+		}
+
+		ret = save_seq(&manifest->envelope_str, &state->seq_stack[i], &checkpoint->seq_stack[i]);
+	}
+
+	return ret;
+}
+
+int suit_checkpoint_restore(struct suit_processor_state *state,
+			    struct suit_manifest_state *manifest,
+			    struct zcbor_string *manifest_digest,
+			    const struct suit_checkpoint *checkpoint,
+			    seq_exec_processor_t cmd_processor)
+{
+	struct zcbor_string *envelope;
+	struct zcbor_string cmd_seq_str;
+	struct suit_checkpoint_str seq_location;
+	struct suit_manifest_params *params;
+	int ret = SUIT_SUCCESS;
+
+	if ((state == NULL) || (manifest == NULL) || (manifest_digest == NULL) ||
+	    (checkpoint == NULL) || (cmd_processor == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if ((state->seq_stack_height != 0) || (state->manifest_stack_height != 1) ||
+	    (manifest != &state->manifest_stack[0])) {
+		return SUIT_ERR_ORDER;
+	}
+
+	if ((checkpoint->magic != SUIT_CHECKPOINT_MAGIC) ||
+	    (checkpoint->seq_name != (uint32_t)state->current_seq) ||
+	    (checkpoint->components_count != manifest->components_count) ||
+	    (checkpoint->seq_stack_height == 0) ||
+	    (checkpoint->seq_stack_height > SUIT_MAX_SEQ_DEPTH)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	if ((checkpoint->manifest_digest_len != manifest_digest->len) ||
+	    (memcmp(checkpoint->manifest_digest, manifest_digest->value, manifest_digest->len) != 0)) {
+		SUIT_ERR("Checkpoint created for a different manifest\r\n");
+		return SUIT_ERR_MANIFEST_VERIFICATION;
+	}
+
+	envelope = &manifest->envelope_str;
+
+	/* The bottom of the execution stack has to be the sequence being processed. */
+	ret = suit_manifest_get_command_seq(manifest, state->current_seq, &cmd_seq_str);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	if (!str_to_offset(envelope, &cmd_seq_str, &seq_location) ||
+	    (seq_location.offset != checkpoint->seq_stack[0].cmd_seq.offset) ||
+	    (seq_location.len != checkpoint->seq_stack[0].cmd_seq.len)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	for (size_t i = 0; i < checkpoint->seq_stack_height; i++) {
+		ret = restore_seq(envelope, &seq_location, &checkpoint->seq_stack[i],
+				  manifest->components_count, &state->seq_stack[i]);
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+
+		state->seq_stack[i].manifest = manifest;
+		state->seq_stack[i].cmd_processor = cmd_processor;
+		seq_location = checkpoint->seq_stack[i].cmd_seq;
+	}
+
+	/* Verify all parameters before modifying any of them. */
+	for (size_t i = 0; i < manifest->components_count; i++) {
+		if (!params_valid(envelope, &checkpoint->params[i])) {
+			return SUIT_ERR_DECODING;
+		}
+	}
+
+	for (size_t i = 0; i < manifest->components_count; i++) {
+		ret = suit_manifest_get_component_params(manifest, i, &params);
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+
+		restore_params(envelope, &checkpoint->params[i], params);
+
+		/* The checkpoint stores only the raw parameter values. */
+		ret = suit_directive_decode_parameters(params);
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+
+		/* The image size is the only parameter, that is also passed to the platform,
+		 * which does not keep it after the reset.
+		 */
+		if (suit_param_is_set(params, SUIT_PARAM_IMAGE_SIZE)) {
+			ret = SUIT_TRACE(SUIT_TRACE_PLAT_OVERRIDE_IMAGE_SIZE,
+					 suit_plat_override_image_size(params->component_handle,
+								       params->image_size,
+								       &manifest->manifest_component_id));
+			if (ret != SUIT_SUCCESS) {
+				return ret;
+			}
+		}
+	}
+
+	state->seq_stack_height = checkpoint->seq_stack_height;
+
+	SUIT_DBG("Execution restored (depth: %d, command: %d)\r\n", state->seq_stack_height,
+		 state->seq_stack[state->seq_stack_height - 1].current_command);
+
+	return SUIT_ERR_AGAIN;
+}
+
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+int suit_checkpoint_commit(struct suit_processor_state *state)
+{
+	if (state == NULL) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if (state->checkpoint_enabled != suit_bool_true) {
+		return SUIT_SUCCESS;
+	}
+
+	int ret = suit_checkpoint_save(state, &state->checkpoint_manifest_digest, &checkpoint_buf);
+	if (ret == SUIT_ERR_WAIT) {
+		/* Keep the last checkpoint of the root manifest. */
+		return SUIT_SUCCESS;
+	} else if (ret != SUIT_SUCCESS) {
+		SUIT_WRN("Unable to create checkpoint (%d)\r\n", ret);
+		return ret;
+	}
+
+	ret = suit_plat_checkpoint_store(state->current_seq,
+					 &state->manifest_stack[0].manifest_component_id,
+					 (const uint8_t *)&checkpoint_buf, sizeof(checkpoint_buf));
+	if (ret != SUIT_SUCCESS) {
+		SUIT_WRN("Unable to store checkpoint (%d)\r\n", ret);
+	}
+
+	return ret;
+}
+
+int suit_checkpoint_resume(struct suit_processor_state *state,
+			   struct suit_manifest_state *manifest,
+			   seq_exec_processor_t cmd_processor)
+{
+	size_t checkpoint_len = sizeof(checkpoint_buf);
+
+	if ((state == NULL) || (manifest == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	int ret = suit_plat_checkpoint_load(state->current_seq, &manifest->manifest_component_id,
+					    (uint8_t *)&checkpoint_buf, &checkpoint_len);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	if (checkpoint_len != sizeof(checkpoint_buf)) {
+		ret = SUIT_ERR_DECODING;
+	} else {
+		ret = suit_checkpoint_restore(state, manifest, &state->checkpoint_manifest_digest,
+					      &checkpoint_buf, cmd_processor);
+	}
+
+	if (ret != SUIT_ERR_AGAIN) {
+		SUIT_WRN("Stored checkpoint rejected (%d)\r\n", ret);
+		(void)suit_checkpoint_discard(state, manifest);
+	}
+
+	return ret;
+}
+
+int suit_checkpoint_discard(struct suit_processor_state *state,
+			    struct suit_manifest_state *manifest)
+{
+	if ((state == NULL) || (manifest == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	return suit_plat_checkpoint_clear(state->current_seq, &manifest->manifest_component_id);
+}
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
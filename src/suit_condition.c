@@ -6,10 +6,11 @@
 
 #include <suit_condition.h>
 #include <suit_platform.h>
-#include <manifest_decode.h>
+#include <suit_trace.h>
 #include <suit_seq_exec.h>
 #include <suit_schedule_seq.h>
 #include <suit_manifest.h>
+#include <suit_memo.h>
 #include <suit.h>
 
 
@@ -21,46 +22,6 @@ enum comparison_type {
 	comparison_lesser = SUIT_Condition_Version_Comparison_Types_suit_condition_version_comparison_lesser_m_c,
 };
 
-static int parse_version_check(struct zcbor_string *version_check_cbor, struct suit_semver *version, enum comparison_type *comparison)
-{
-	struct SUIT_Parameter_Version_Match result = {0};
-	size_t result_len = 0;
-
-	if ((version_check_cbor == NULL) || (version == NULL) || (comparison == NULL)) {
-		return SUIT_ERR_CRASH;
-	}
-
-	int ret = cbor_decode_SUIT_Parameter_Version_Match(
-		version_check_cbor->value,
-		version_check_cbor->len,
-		&result,
-		&result_len
-	);
-
-	if ((ret != ZCBOR_SUCCESS) || (result_len != version_check_cbor->len)) {
-		return SUIT_ERR_DECODING;
-	}
-
-	*comparison = (enum comparison_type)result
-		.SUIT_Parameter_Version_Match_suit_condition_version_comparison_type
-		.SUIT_Condition_Version_Comparison_Types_choice;
-	version->count = result
-		.SUIT_Parameter_Version_Match_suit_condition_version_comparison_value
-		.SUIT_Condition_Version_Comparison_Value_int_count;
-	if (version->count > ZCBOR_ARRAY_SIZE(version->value)) {
-		version->count = 0;
-		return SUIT_ERR_DECODING;
-	}
-
-	for (size_t i = 0; i < version->count; i++) {
-		version->value[i] = result
-			.SUIT_Parameter_Version_Match_suit_condition_version_comparison_value
-			.SUIT_Condition_Version_Comparison_Value_int[i];
-	}
-
-	return SUIT_SUCCESS;
-}
-
 static int compare_versions(struct suit_semver *version_a, struct suit_semver *version_b)
 {
 	if ((version_a == NULL) || (version_b == NULL)) {
@@ -97,10 +58,27 @@ static int compare_versions(struct suit_semver *version_a, struct suit_semver *v
 	return 0;
 }
 
+/** @brief Store the result of the condition, evaluated with the given parameter value.
+ *
+ * @details Other results may be caused by a temporary platform state, so only the passed
+ *          conditions are stored.
+ */
+static int memo_put(struct suit_manifest_params *params, enum suit_memo_id id,
+		    const struct zcbor_string *value, int result)
+{
+	if (result == SUIT_SUCCESS) {
+		suit_memo_store(params->component_handle, id, value);
+	}
+
+	return result;
+}
+
 int suit_condition_vendor_identifier(struct suit_processor_state *state,
 		struct suit_manifest_params *component_params)
 {
-	if (!component_params->vid_set) {
+	int ret;
+
+	if (!suit_param_is_set(component_params, SUIT_PARAM_VID)) {
 		SUIT_ERR("Failed to check vendor ID: value not set (handle: %p)\r\n", (void *)component_params->component_handle);
 		return SUIT_ERR_UNAVAILABLE_PARAMETER;
 	}
@@ -111,15 +89,23 @@ int suit_condition_vendor_identifier(struct suit_processor_state *state,
 	}
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
-	return suit_plat_check_vid(component_params->component_handle,
-				&component_params->vid);
+	if (suit_memo_passed(component_params->component_handle, SUIT_MEMO_VID, &component_params->vid)) {
+		return SUIT_SUCCESS;
+	}
+
+	ret = SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_VID, suit_plat_check_vid(component_params->component_handle,
+				&component_params->vid));
+
+	return memo_put(component_params, SUIT_MEMO_VID, &component_params->vid, ret);
 }
 
 
 int suit_condition_class_identifier(struct suit_processor_state *state,
 		struct suit_manifest_params *component_params)
 {
-	if (!component_params->cid_set) {
+	int ret;
+
+	if (!suit_param_is_set(component_params, SUIT_PARAM_CID)) {
 		SUIT_ERR("Failed to check class ID: value not set (handle: %p)\r\n", (void *)component_params->component_handle);
 		return SUIT_ERR_UNAVAILABLE_PARAMETER;
 	}
@@ -130,15 +116,23 @@ int suit_condition_class_identifier(struct suit_processor_state *state,
 	}
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
-	return suit_plat_check_cid(component_params->component_handle,
-				&component_params->cid);
+	if (suit_memo_passed(component_params->component_handle, SUIT_MEMO_CID, &component_params->cid)) {
+		return SUIT_SUCCESS;
+	}
+
+	ret = SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_CID, suit_plat_check_cid(component_params->component_handle,
+				&component_params->cid));
+
+	return memo_put(component_params, SUIT_MEMO_CID, &component_params->cid, ret);
 }
 
 
 int suit_condition_device_identifier(struct suit_processor_state *state,
 		struct suit_manifest_params *component_params)
 {
-	if (!component_params->did_set) {
+	int ret;
+
+	if (!suit_param_is_set(component_params, SUIT_PARAM_DID)) {
 		SUIT_ERR("Failed to check device ID: value not set (handle: %p)\r\n", (void *)component_params->component_handle);
 		return SUIT_ERR_UNAVAILABLE_PARAMETER;
 	}
@@ -149,65 +143,72 @@ int suit_condition_device_identifier(struct suit_processor_state *state,
 	}
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
-	return suit_plat_check_did(component_params->component_handle,
-				&component_params->did);
+	if (suit_memo_passed(component_params->component_handle, SUIT_MEMO_DID, &component_params->did)) {
+		return SUIT_SUCCESS;
+	}
+
+	ret = SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_DID, suit_plat_check_did(component_params->component_handle,
+				&component_params->did));
+
+	return memo_put(component_params, SUIT_MEMO_DID, &component_params->did, ret);
 }
 
 
 int suit_condition_image_match(struct suit_processor_state *state,
 		struct suit_manifest_params *component_params)
 {
-	struct SUIT_Digest digest = {0};
-	size_t bytes_processed = 0;
+	int ret;
 
-	if (!component_params->image_digest_set) {
+	if (!suit_param_is_set(component_params, SUIT_PARAM_IMAGE_DIGEST)) {
 		SUIT_ERR("Failed to check image digest: digest not set (handle: %p)\r\n", (void *)component_params->component_handle);
 		return SUIT_ERR_UNAVAILABLE_PARAMETER;
 	}
 
-	int ret = cbor_decode_SUIT_Digest(
-		component_params->image_digest.value,
-		component_params->image_digest.len,
-		&digest, &bytes_processed);
-	if ((ret != ZCBOR_SUCCESS) || (bytes_processed != component_params->image_digest.len)) {
-		return SUIT_ERR_DECODING;
+	/* The digest algorithm and length were verified when the parameter was set. */
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+	if (state->dry_run != suit_bool_false) {
+		return SUIT_SUCCESS;
 	}
-	else
-	{
-		ret = SUIT_SUCCESS;
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
+	/* The raw digest is used as the key, so it covers the digest algorithm as well. */
+	if (suit_memo_passed(component_params->component_handle, SUIT_MEMO_IMAGE_MATCH, &component_params->image_digest)) {
+		return SUIT_SUCCESS;
 	}
 
-	if (digest.SUIT_Digest_suit_digest_algorithm_id.suit_cose_hash_algs_choice == suit_cose_hash_algs_cose_alg_sha_256_m_c) {
-		/* The SHA256 algorithm is allowed by CDDL. Verify the digest length. */
-		if (digest.SUIT_Digest_suit_digest_bytes.len != 32) {
-			return SUIT_ERR_DECODING;
-		}
-	} else if (digest.SUIT_Digest_suit_digest_algorithm_id.suit_cose_hash_algs_choice == suit_cose_hash_algs_cose_alg_sha_512_m_c) {
-		/* The SHA512 algorithm is allowed by CDDL. Verify the digest length. */
-		if (digest.SUIT_Digest_suit_digest_bytes.len != 64) {
-			return SUIT_ERR_DECODING;
-		}
-	} else {
-		/* Other algorithms are not supported. */
-		return SUIT_ERR_UNSUPPORTED_ALG;
+	ret = SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_IMAGE_MATCH, suit_plat_check_image_match(component_params->component_handle,
+		component_params->decoded.image_digest_alg,
+		&component_params->decoded.image_digest_bytes));
+
+	return memo_put(component_params, SUIT_MEMO_IMAGE_MATCH, &component_params->image_digest, ret);
+}
+
+#ifdef SUIT_DEDUP_PAYLOADS
+int suit_condition_find_verified_image(struct suit_processor_state *state,
+				       struct suit_manifest_params *component_params,
+				       suit_component_t *handle)
+{
+	if (!suit_param_is_set(component_params, SUIT_PARAM_IMAGE_DIGEST)) {
+		return SUIT_ERR_MISSING_COMPONENT;
 	}
 
-#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
-	if (state->dry_run != suit_bool_false) {
-		return ret;
+	/* The results are dropped when the component handle is released, so only the components
+	 * of the loaded manifests, including the dependencies, are found.
+	 */
+	if (suit_memo_find(component_params->component_handle, SUIT_MEMO_IMAGE_MATCH,
+			   &component_params->image_digest, handle)) {
+		return SUIT_SUCCESS;
 	}
-#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
-	return suit_plat_check_image_match(component_params->component_handle,
-		digest.SUIT_Digest_suit_digest_algorithm_id.suit_cose_hash_algs_choice,
-		&digest.SUIT_Digest_suit_digest_bytes);
+	return SUIT_ERR_MISSING_COMPONENT;
 }
+#endif /* SUIT_DEDUP_PAYLOADS */
 
 
 int suit_condition_component_slot(struct suit_processor_state *state,
 		struct suit_manifest_params *component_params)
 {
-	if (!component_params->component_slot_set) {
+	if (!suit_param_is_set(component_params, SUIT_PARAM_COMPONENT_SLOT)) {
 		SUIT_ERR("Failed to check slot: value not set (handle: %p)\r\n", (void *)component_params->component_handle);
 		return SUIT_ERR_UNAVAILABLE_PARAMETER;
 	}
@@ -218,13 +219,13 @@ int suit_condition_component_slot(struct suit_processor_state *state,
 	}
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
-	return suit_plat_check_slot(component_params->component_handle, component_params->component_slot);
+	return SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_SLOT, suit_plat_check_slot(component_params->component_handle, component_params->component_slot));
 }
 
 int suit_condition_check_content(struct suit_processor_state *state,
 		struct suit_manifest_params *component_params)
 {
-	if (!component_params->content_set) {
+	if (!suit_param_is_set(component_params, SUIT_PARAM_CONTENT)) {
 		SUIT_ERR("Failed to check content: value not set (handle: %p)\r\n",
 			 (void *)component_params->component_handle);
 		return SUIT_ERR_UNAVAILABLE_PARAMETER;
@@ -236,8 +237,8 @@ int suit_condition_check_content(struct suit_processor_state *state,
 	}
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
-	return suit_plat_check_content(component_params->component_handle,
-				       &component_params->content);
+	return SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_CONTENT, suit_plat_check_content(component_params->component_handle,
+				       &component_params->content));
 }
 
 int suit_condition_abort(struct suit_processor_state *state,
@@ -246,6 +247,7 @@ int suit_condition_abort(struct suit_processor_state *state,
 	return SUIT_FAIL_CONDITION;
 }
 
+#ifndef SUIT_PRUNE_DEPENDENCIES
 int suit_condition_dependency_integrity(struct suit_processor_state *state,
 		struct suit_manifest_params *component_params)
 {
@@ -277,8 +279,15 @@ int suit_condition_dependency_integrity(struct suit_processor_state *state,
 	manifest_state = &state->manifest_stack[state->manifest_stack_height - 1];
 
 	if (seq_exec_state->cmd_exec_state == SUIT_SEQ_EXEC_DEFAULT_STATE) {
+		/* The manifest, pinned by the previous check, is replaced by the one checked now. */
+		retval = suit_processor_release_pinned_manifests(state, component_params);
+		if (retval != SUIT_SUCCESS) {
+			component_params->integrity_checked = false;
+			return retval;
+		}
+
 		/** Return a pointer to the manifest contents, stored inside the component. */
-		retval = suit_plat_retrieve_manifest(component_params->component_handle, &envelope_str, &envelope_len);
+		retval = SUIT_TRACE(SUIT_TRACE_PLAT_RETRIEVE_MANIFEST, suit_plat_retrieve_manifest(component_params->component_handle, &envelope_str, &envelope_len));
 
 		if (retval == SUIT_SUCCESS) {
 			retval = suit_processor_load_envelope(state, envelope_str, envelope_len);
@@ -326,7 +335,11 @@ int suit_condition_dependency_integrity(struct suit_processor_state *state,
 		retval = seq_exec_state->retval;
 	}
 
-	if ((retval != SUIT_ERR_AGAIN) && (seq_exec_state->cmd_exec_state != SUIT_SEQ_EXEC_DEFAULT_STATE)) {
+	if ((retval == SUIT_SUCCESS) && (seq_exec_state->cmd_exec_state != SUIT_SEQ_EXEC_DEFAULT_STATE) &&
+	    suit_processor_pin_manifest(state, component_params)) {
+		/* Keep the checked manifest loaded, until the dependency is processed. */
+		SUIT_DBG("Pin manifest\r\n");
+	} else if ((retval != SUIT_ERR_AGAIN) && (seq_exec_state->cmd_exec_state != SUIT_SEQ_EXEC_DEFAULT_STATE)) {
 		SUIT_DBG("Release manifest\r\n");
 		/* Remove the checked manifest from the stack */
 		int ret = suit_manifest_release(manifest_state);
@@ -360,6 +373,7 @@ int suit_condition_is_dependency(struct suit_processor_state *state,
 
 	return SUIT_ERR_TAMP;
 }
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 
 int suit_condition_version(struct suit_processor_state *state,
 		struct suit_manifest_params *component_params)
@@ -368,22 +382,19 @@ int suit_condition_version(struct suit_processor_state *state,
 		.value = {0, 0, 0, 0, 0},
 		.count = 0,
 	};
-	struct suit_semver cmp_version = {
-		.value = {0, 0, 0, 0, 0},
-		.count = 0,
-	};
+	struct suit_semver cmp_version;
 	enum comparison_type comparison;
 	bool result = false;
+	int ret;
 
-	if (!component_params->version_set) {
+	if (!suit_param_is_set(component_params, SUIT_PARAM_VERSION)) {
 		SUIT_ERR("Failed to check version: value not set (handle: %p)\r\n", (void *)component_params->component_handle);
 		return SUIT_ERR_UNAVAILABLE_PARAMETER;
 	}
 
-	int ret = parse_version_check(&component_params->version, &cmp_version, &comparison);
-	if (ret != SUIT_SUCCESS) {
-		return ret;
-	}
+	/* The version is modified by the comparison, so work on a copy of the decoded value. */
+	cmp_version = component_params->decoded.version;
+	comparison = (enum comparison_type)component_params->decoded.version_comparison;
 
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 	if (state->dry_run != suit_bool_false) {
@@ -393,7 +404,7 @@ int suit_condition_version(struct suit_processor_state *state,
 
 	component_version.count = ZCBOR_ARRAY_SIZE(component_version.value);
 
-	ret = suit_plat_component_version_get(component_params->component_handle, component_version.value, &component_version.count);
+	ret = SUIT_TRACE(SUIT_TRACE_PLAT_COMPONENT_VERSION_GET, suit_plat_component_version_get(component_params->component_handle, component_version.value, &component_version.count));
 	if (ret != SUIT_SUCCESS) {
 		return ret;
 	}
@@ -10,6 +10,8 @@
 #include <cose_encode.h>
 #include <cose_decode.h>
 #include <suit_manifest.h>
+#include <suit_trace.h>
+#include <suit_arena.h>
 
 /** Extract the major type, i.e. the first 3 bits of the header byte. */
 #define MAJOR_TYPE(header_byte) ((zcbor_major_type_t)(((header_byte) >> 5) & 0x7))
@@ -27,7 +29,8 @@ static int header_len(size_t len, const uint8_t *value, zcbor_major_type_t major
 	return exp_len;
 }
 
-static int verify_suit_digest(struct SUIT_Digest *digest, struct zcbor_string *data_bstr)
+static int verify_suit_digest(struct suit_decoder_state *state, struct SUIT_Digest *digest,
+			      struct zcbor_string *data_bstr)
 {
 	/* Include CBOR header (type, length) in digest calculation */
 	int offset = header_len(data_bstr->len, &data_bstr->value[0], ZCBOR_MAJOR_TYPE_BSTR);
@@ -56,13 +59,27 @@ static int verify_suit_digest(struct SUIT_Digest *digest, struct zcbor_string *d
 		.len = data_bstr->len + offset,
 	};
 
-	return suit_plat_check_digest(
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+	if (state->envelope_reader != NULL) {
+		/* The envelope buffer is a copy of the storage, starting at its beginning. */
+		return SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_DIGEST, suit_envelope_reader_check_digest(
+			state->envelope_reader,
+			(size_t)(data_bytes.value - state->decoded_manifest->envelope_str.value),
+			data_bytes.len,
+			data_bytes.value,
+			digest->SUIT_Digest_suit_digest_algorithm_id.suit_cose_hash_algs_choice,
+			&digest->SUIT_Digest_suit_digest_bytes));
+	}
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
+	return SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_DIGEST, suit_plat_check_digest(
 		digest->SUIT_Digest_suit_digest_algorithm_id.suit_cose_hash_algs_choice,
 		&digest->SUIT_Digest_suit_digest_bytes,
-		&data_bytes);
+		&data_bytes));
 }
 
-static int cose_verify_digest(struct zcbor_string *digest_bstr, struct zcbor_string *data_bstr)
+static int cose_verify_digest(struct suit_decoder_state *state, struct zcbor_string *digest_bstr,
+			      struct zcbor_string *data_bstr)
 {
 	struct SUIT_Digest digest = {0};
 	size_t bytes_processed = 0;
@@ -74,24 +91,23 @@ static int cose_verify_digest(struct zcbor_string *digest_bstr, struct zcbor_str
 	}
 
 	return verify_suit_digest(
+		state,
 		&digest,
 		data_bstr
 	);
 }
 
-static int cose_sign1_authenticate_digest(struct zcbor_string *manifest_component_id, struct zcbor_string *COSE_Sign1_bstr, struct zcbor_string *digest_bstr)
+static int cose_sign1_authenticate_with_scratch(struct suit_arena_sign1 *sign1, struct zcbor_string *manifest_component_id, struct zcbor_string *COSE_Sign1_bstr, struct zcbor_string *digest_bstr)
 {
-	uint8_t signed_data[SUIT_SUIT_SIG_STRUCTURE1_MAX_LENGTH];
 	size_t signed_data_size = 0;
 
 	/* Decode COSE_Sign1 structure */
-	struct COSE_Sign1 cose_sign1_struct = {0};
 	size_t cose_sign1_struct_size = 0;
 
 	int ret = cbor_decode_COSE_Sign1_Tagged(
 		COSE_Sign1_bstr->value,
 		COSE_Sign1_bstr->len,
-		&cose_sign1_struct,
+		&sign1->cose_sign1,
 		&cose_sign1_struct_size);
 	if ((ret != ZCBOR_SUCCESS) || (cose_sign1_struct_size != COSE_Sign1_bstr->len)) {
 		return SUIT_ERR_UNSUPPORTED_COSE;
@@ -99,49 +115,89 @@ static int cose_sign1_authenticate_digest(struct zcbor_string *manifest_componen
 
 	/* Both ES256 and EdDSA25519 algorithms which are currently supported by CDDL
 	   produce a signature of length 64. */
-	if (cose_sign1_struct.COSE_Sign1_signature.len != 64) {
+	if (sign1->cose_sign1.COSE_Sign1_signature.len != 64) {
 		return SUIT_ERR_UNSUPPORTED_ALG;
 	}
 
 	/* Construct Sig_structure1 structure */
-	struct Sig_structure1 signature;
-
-	memset(&signature, 0, sizeof(signature));
-	signature.Sig_structure1_body_protected_cbor = cose_sign1_struct.COSE_Sign1_Headers_m.Headers_protected_cbor;
-	signature.Sig_structure1_payload = *digest_bstr;
+	sign1->signature.Sig_structure1_body_protected_cbor = sign1->cose_sign1.COSE_Sign1_Headers_m.Headers_protected_cbor;
+	sign1->signature.Sig_structure1_payload = *digest_bstr;
 
 	/* Encode Sig_structure1 structure as byte string */
-	memset(signed_data, 0, sizeof(signed_data));
 	ret = cbor_encode_Sig_structure1(
-		signed_data, sizeof(signed_data),
-		&signature,
+		sign1->signed_data, sizeof(sign1->signed_data),
+		&sign1->signature,
 		&signed_data_size);
 	if (ret != ZCBOR_SUCCESS) {
 		return SUIT_ERR_DECODING;
 	}
 
 	struct zcbor_string signed_bstr = {
-		.value = signed_data,
+		.value = sign1->signed_data,
 		.len = signed_data_size,
 	};
 
 	/* Authenticate data using platform API */
-	ret = suit_plat_authenticate_manifest(
+	ret = SUIT_TRACE(SUIT_TRACE_PLAT_AUTHENTICATE_MANIFEST, suit_plat_authenticate_manifest(
 		manifest_component_id,
-		cose_sign1_struct.COSE_Sign1_Headers_m.Headers_protected_cbor.header_map_alg_id.supported_algs_choice,
-		(cose_sign1_struct.COSE_Sign1_Headers_m.Headers_protected_cbor.header_map_key_id_present ?
-			&cose_sign1_struct.COSE_Sign1_Headers_m.Headers_protected_cbor.header_map_key_id.header_map_key_id :
+		sign1->cose_sign1.COSE_Sign1_Headers_m.Headers_protected_cbor.header_map_alg_id.supported_algs_choice,
+		(sign1->cose_sign1.COSE_Sign1_Headers_m.Headers_protected_cbor.header_map_key_id_present ?
+			&sign1->cose_sign1.COSE_Sign1_Headers_m.Headers_protected_cbor.header_map_key_id.header_map_key_id :
 			(struct zcbor_string *)NULL),
 		/* Pass signature, specific for the key */
-		&cose_sign1_struct.COSE_Sign1_signature,
+		&sign1->cose_sign1.COSE_Sign1_signature,
 		/* Authenticate Signature1 structure, including both algorithm ID and digest bytes of the manifest */
-		&signed_bstr);
+		&signed_bstr));
+
+	return ret;
+}
+
+static int cose_sign1_authenticate_digest(struct zcbor_string *manifest_component_id, struct zcbor_string *COSE_Sign1_bstr, struct zcbor_string *digest_bstr)
+{
+	size_t arena_mark = suit_arena_mark();
+	struct suit_arena_sign1 *sign1 = suit_arena_alloc(sizeof(*sign1));
+	int ret;
+
+	if (sign1 == NULL) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	ret = cose_sign1_authenticate_with_scratch(sign1, manifest_component_id, COSE_Sign1_bstr, digest_bstr);
+	suit_arena_release(arena_mark);
+
+	return ret;
+}
+
+static int store_severed_member(struct suit_manifest_state *manifest, enum suit_command_sequence seq_name,
+				const struct zcbor_string *member)
+{
+	/* If the length of the sequence is zero, it is impossible to calculate the digest of it.
+	 * In such case, invalidate envelope to avoid possible random memory accesses.
+	 */
+	if (member->len < 1) {
+		return SUIT_ERR_DECODING;
+	}
+
+	int ret = suit_manifest_set_seq(manifest, seq_name, member);
+
+	if (ret == SUIT_SUCCESS) {
+		ret = suit_manifest_set_seq_status(manifest, seq_name, SEVERED);
+	}
 
 	return ret;
 }
 
+static void suit_decoder_release_decoded(struct suit_decoder_state *state)
+{
+	if (state->decoded != NULL) {
+		suit_arena_release(state->arena_mark);
+		state->decoded = NULL;
+	}
+}
+
 static void suit_decoder_reset_state(struct suit_decoder_state *state)
 {
+	suit_decoder_release_decoded(state);
 	memset(state, 0, sizeof(*state));
 	state->step = INVALID;
 }
@@ -267,6 +323,13 @@ int suit_decoder_init(struct suit_decoder_state *state, struct suit_manifest_sta
 	}
 
 	suit_decoder_reset_state(state);
+
+	state->arena_mark = suit_arena_mark();
+	state->decoded = suit_arena_alloc(sizeof(*state->decoded));
+	if (state->decoded == NULL) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
 	state->decoded_manifest = manifest;
 	state->step = INITIALIZED;
 
@@ -287,7 +350,7 @@ int suit_decoder_decode_envelope(struct suit_decoder_state *state, const uint8_t
 	}
 
 	ret = cbor_decode_SUIT_Envelope_Tagged(
-		(uint8_t *)envelope_str, envelope_len, &state->envelope, &decoded_len);
+		(uint8_t *)envelope_str, envelope_len, &state->decoded->envelope, &decoded_len);
 
 	/* For development, condition on expected envelope size was modified.
 	   Now envelope_len represents max allowed size of envelope */
@@ -299,11 +362,20 @@ int suit_decoder_decode_envelope(struct suit_decoder_state *state, const uint8_t
 		ret = SUIT_SUCCESS;
 	}
 
+	if ((ret == SUIT_SUCCESS) && (decoded_len > SUIT_ENVELOPE_MAX_LEN)) {
+		SUIT_ERR("The envelope is too big to be addressed by the manifest state.\r\n");
+		ret = SUIT_ERR_OVERFLOW;
+	}
+
 	if (ret == SUIT_SUCCESS) {
-		struct SUIT_Authentication *auth = &state->envelope.SUIT_Envelope_suit_authentication_wrapper_cbor;
+		struct SUIT_Authentication *auth = &state->decoded->envelope.SUIT_Envelope_suit_authentication_wrapper_cbor;
+
+		/* All manifest members are stored as locations, relative to the envelope. */
+		state->decoded_manifest->envelope_str.value = envelope_str;
+		state->decoded_manifest->envelope_str.len = decoded_len;
 
 		if ((auth->SUIT_Authentication_bstr_count > SUIT_MAX_NUM_SIGNERS) ||
-		    (state->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m_count > SUIT_MAX_NUM_INTEGRATED_PAYLOADS)) {
+		    (state->decoded->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m_count > SUIT_MAX_NUM_INTEGRATED_PAYLOADS)) {
 			ret = SUIT_ERR_DECODING;
 		}
 
@@ -316,97 +388,68 @@ int suit_decoder_decode_envelope(struct suit_decoder_state *state, const uint8_t
 			state->manifest_digest_bytes = auth->SUIT_Authentication_SUIT_Digest_bstr;
 		}
 
-		/* Store pointers to the severable sequences for further verification and execution. */
-		if (state->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_text_present) {
-			state->decoded_manifest->text = state->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_text.SUIT_Severable_Manifest_Members_suit_text;
-			/* If the length of the sequence is zero, it is impossible to calculate the digest of it.
-			 * In such case, invalidate envelope to avoid possible random memory accesses.
-			 */
-			if (state->decoded_manifest->text.len < 1) {
-				ret = SUIT_ERR_DECODING;
-				state->decoded_manifest->text.len = 0;
-				state->decoded_manifest->text.value = NULL;
-			} else {
-				state->decoded_manifest->text_status = SEVERED;
-			}
+		/* Store locations of the severable sequences for further verification and execution. */
+		if ((ret == SUIT_SUCCESS) &&
+		    state->decoded->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_text_present) {
+			ret = store_severed_member(state->decoded_manifest, SUIT_MANIFEST_TEXT,
+				&state->decoded->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_text.SUIT_Severable_Manifest_Members_suit_text);
 		}
 
-		if (state->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_payload_fetch_present) {
-			state->decoded_manifest->payload_fetch_seq = state->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_payload_fetch.SUIT_Severable_Manifest_Members_suit_payload_fetch;
-			if (state->decoded_manifest->payload_fetch_seq.len < 1) {
-				ret = SUIT_ERR_DECODING;
-				state->decoded_manifest->payload_fetch_seq.len = 0;
-				state->decoded_manifest->payload_fetch_seq.value = NULL;
-			} else {
-				state->decoded_manifest->payload_fetch_seq_status = SEVERED;
-			}
+		if ((ret == SUIT_SUCCESS) &&
+		    state->decoded->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_payload_fetch_present) {
+			ret = store_severed_member(state->decoded_manifest, SUIT_SEQ_PAYLOAD_FETCH,
+				&state->decoded->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_payload_fetch.SUIT_Severable_Manifest_Members_suit_payload_fetch);
 		}
 
-		if (state->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_install_present) {
-			state->decoded_manifest->install_seq = state->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_install.SUIT_Severable_Manifest_Members_suit_install;
-			if (state->decoded_manifest->install_seq.len < 1) {
-				ret = SUIT_ERR_DECODING;
-				state->decoded_manifest->install_seq.len = 0;
-				state->decoded_manifest->install_seq.value = NULL;
-			} else {
-				state->decoded_manifest->install_seq_status = SEVERED;
-			}
+		if ((ret == SUIT_SUCCESS) &&
+		    state->decoded->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_install_present) {
+			ret = store_severed_member(state->decoded_manifest, SUIT_SEQ_INSTALL,
+				&state->decoded->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_suit_install.SUIT_Severable_Manifest_Members_suit_install);
 		}
 
-		const size_t ext_count = state->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_SUIT_severable_members_extensions_m_count;
-		for (size_t ext_i = 0; ext_i < ext_count; ext_i++) {
-			struct SUIT_severable_members_extensions_r *ext = &state->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_SUIT_severable_members_extensions_m[ext_i].SUIT_Severable_Manifest_Members_SUIT_severable_members_extensions_m;
+		const size_t ext_count = state->decoded->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_SUIT_severable_members_extensions_m_count;
+		for (size_t ext_i = 0; (ret == SUIT_SUCCESS) && (ext_i < ext_count); ext_i++) {
+			struct SUIT_severable_members_extensions_r *ext = &state->decoded->envelope.SUIT_Envelope_SUIT_Severable_Manifest_Members_m.SUIT_Severable_Manifest_Members_SUIT_severable_members_extensions_m[ext_i].SUIT_Severable_Manifest_Members_SUIT_severable_members_extensions_m;
 
 			switch (ext->SUIT_severable_members_extensions_choice) {
 				case SUIT_severable_members_extensions_suit_dependency_resolution_c:
-					state->decoded_manifest->dependency_resolution_seq = ext->SUIT_severable_members_extensions_suit_dependency_resolution;
-					if (state->decoded_manifest->dependency_resolution_seq.len < 1) {
-						ret = SUIT_ERR_DECODING;
-						state->decoded_manifest->dependency_resolution_seq.len = 0;
-						state->decoded_manifest->dependency_resolution_seq.value = NULL;
-					} else {
-						state->decoded_manifest->dependency_resolution_seq_status = SEVERED;
-					}
-
+					ret = store_severed_member(state->decoded_manifest, SUIT_SEQ_DEP_RESOLUTION,
+						&ext->SUIT_severable_members_extensions_suit_dependency_resolution);
 					break;
 
 				case SUIT_severable_members_extensions_suit_candidate_verification_c:
-					state->decoded_manifest->candidate_verification_seq = ext->SUIT_severable_members_extensions_suit_candidate_verification;
-					if (state->decoded_manifest->candidate_verification_seq.len < 1) {
-						ret = SUIT_ERR_DECODING;
-						state->decoded_manifest->candidate_verification_seq.len = 0;
-						state->decoded_manifest->candidate_verification_seq.value = NULL;
-					} else {
-						state->decoded_manifest->candidate_verification_seq_status = SEVERED;
-					}
-
+					ret = store_severed_member(state->decoded_manifest, SUIT_SEQ_CAND_VERIFICATION,
+						&ext->SUIT_severable_members_extensions_suit_candidate_verification);
 					break;
 
 				default:
 					ret = SUIT_ERR_DECODING;
 					break;
 			}
+		}
 
-			if (ret != SUIT_SUCCESS) {
-				break;
+		/* Store locations of the integrated payloads and their keys. */
+		for (size_t i = 0; (ret == SUIT_SUCCESS) && (i < state->decoded->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m_count); i++) {
+			ret = suit_manifest_str_to_ref(state->decoded_manifest,
+				&state->decoded->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m[i].SUIT_Envelope_SUIT_Integrated_Payload_m.SUIT_Integrated_Payload_suit_integrated_payload_key_key,
+				&state->decoded_manifest->integrated_payloads[i].key);
+			if (ret == SUIT_SUCCESS) {
+				ret = suit_manifest_str_to_ref(state->decoded_manifest,
+					&state->decoded->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m[i].SUIT_Envelope_SUIT_Integrated_Payload_m.SUIT_Integrated_Payload_suit_integrated_payload_key,
+					&state->decoded_manifest->integrated_payloads[i].payload);
 			}
 		}
 
-		/* Store pointers to the integrated payloads and their keys. */
 		if (ret == SUIT_SUCCESS) {
-			for (size_t i = 0; i < state->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m_count; i++) {
-				state->decoded_manifest->integrated_payloads[i].key = state->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m[i].SUIT_Envelope_SUIT_Integrated_Payload_m.SUIT_Integrated_Payload_suit_integrated_payload_key_key;
-				state->decoded_manifest->integrated_payloads[i].payload = state->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m[i].SUIT_Envelope_SUIT_Integrated_Payload_m.SUIT_Integrated_Payload_suit_integrated_payload_key;
-			}
-			state->decoded_manifest->integrated_payloads_count = state->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m_count;
-
-			state->decoded_manifest->envelope_str.value = envelope_str;
-			state->decoded_manifest->envelope_str.len = decoded_len;
+			state->decoded_manifest->integrated_payloads_count = (uint8_t)state->decoded->envelope.SUIT_Envelope_SUIT_Integrated_Payload_m_count;
 			state->step = ENVELOPE_DECODED;
 			return SUIT_SUCCESS;
 		}
 	}
 
+	if (state->decoded_manifest != NULL) {
+		state->decoded_manifest->envelope_str = (struct zcbor_string){NULL, 0};
+	}
 	suit_decoder_reset_state(state);
 	if (ret != SUIT_SUCCESS) {
 		return ret;
@@ -429,8 +472,8 @@ int suit_decoder_check_manifest_digest(struct suit_decoder_state *state)
 		return SUIT_ERR_ORDER;
 	}
 
-	manifest_bstr = state->envelope.SUIT_Envelope_suit_manifest;
-	ret = cose_verify_digest(&state->manifest_digest_bytes, &manifest_bstr);
+	manifest_bstr = state->decoded->envelope.SUIT_Envelope_suit_manifest;
+	ret = cose_verify_digest(state, &state->manifest_digest_bytes, &manifest_bstr);
 
 	if (ret == SUIT_SUCCESS) {
 		state->step = MANIFEST_DIGEST_VERIFIED;
@@ -459,14 +502,14 @@ int suit_decoder_decode_manifest(struct suit_decoder_state *state)
 		return SUIT_ERR_ORDER;
 	}
 
-	manifest_bstr = state->envelope.SUIT_Envelope_suit_manifest;
+	manifest_bstr = state->decoded->envelope.SUIT_Envelope_suit_manifest;
 
 	/* Verify manifest version - enforced by the CDDL and checked by the ZCBOR parser code */
 
 	ret = cbor_decode_SUIT_Manifest(
 		manifest_bstr.value,
 		manifest_bstr.len,
-		&state->manifest,
+		&state->decoded->manifest,
 		&decoded_len);
 
 	if ((ret != ZCBOR_SUCCESS) || decoded_len != manifest_bstr.len) {
@@ -478,8 +521,8 @@ int suit_decoder_decode_manifest(struct suit_decoder_state *state)
 	}
 
 	if (ret == SUIT_SUCCESS) {
-		if (state->manifest.SUIT_Manifest_Extensions_m_present) {
-			const struct SUIT_Manifest_Extensions_m *ext = &state->manifest.SUIT_Manifest_Extensions_m;
+		if (state->decoded->manifest.SUIT_Manifest_Extensions_m_present) {
+			const struct SUIT_Manifest_Extensions_m *ext = &state->decoded->manifest.SUIT_Manifest_Extensions_m;
 			const struct SUIT_Manifest_Extensions_suit_manifest_component_id *component_id_ext = &ext->SUIT_Manifest_Extensions_m;
 			const struct SUIT_Component_Identifier *manifest_component = &component_id_ext->SUIT_Manifest_Extensions_suit_manifest_component_id;
 
@@ -488,13 +531,15 @@ int suit_decoder_decode_manifest(struct suit_decoder_state *state)
 			state->decoded_manifest->manifest_component_id = (struct zcbor_string){NULL, 0};
 		}
 
-		if (state->manifest.SUIT_Manifest_SUIT_Unseverable_Members_m.SUIT_Unseverable_Members_unseverable_manifest_member_extensions_m_present) {
-			const struct SUIT_Unseverable_Members_unseverable_manifest_member_extensions_m *ext = &state->manifest.SUIT_Manifest_SUIT_Unseverable_Members_m.SUIT_Unseverable_Members_unseverable_manifest_member_extensions_m;
+		if (state->decoded->manifest.SUIT_Manifest_SUIT_Unseverable_Members_m.SUIT_Unseverable_Members_unseverable_manifest_member_extensions_m_present) {
+			const struct SUIT_Unseverable_Members_unseverable_manifest_member_extensions_m *ext = &state->decoded->manifest.SUIT_Manifest_SUIT_Unseverable_Members_m.SUIT_Unseverable_Members_unseverable_manifest_member_extensions_m;
 			const struct unseverable_manifest_member_extensions_suit_current_version *version_ext = &ext->SUIT_Unseverable_Members_unseverable_manifest_member_extensions_m;
 
-			state->decoded_manifest->current_version = version_ext->unseverable_manifest_member_extensions_suit_current_version;
+			ret = suit_manifest_str_to_ref(state->decoded_manifest,
+				&version_ext->unseverable_manifest_member_extensions_suit_current_version,
+				&state->decoded_manifest->current_version);
 		} else {
-			state->decoded_manifest->current_version = (struct zcbor_string){NULL, 0};
+			state->decoded_manifest->current_version = (struct suit_envelope_ref){0, 0};
 		}
 	}
 
@@ -502,7 +547,7 @@ int suit_decoder_decode_manifest(struct suit_decoder_state *state)
 		/* Cannot perform universal sequence number authorization.
 		 * Skip this check in decoder logic and store the sequence number value inside the output structure.
 		 */
-		state->decoded_manifest->sequence_number = state->manifest.SUIT_Manifest_suit_manifest_sequence_number;
+		state->decoded_manifest->sequence_number = state->decoded->manifest.SUIT_Manifest_suit_manifest_sequence_number;
 	}
 
 	if (ret == SUIT_SUCCESS) {
@@ -534,7 +579,7 @@ int suit_decoder_authenticate_manifest(struct suit_decoder_state *state)
 	}
 
 	if (state->authentication_bstr_count == 0) {
-		ret = suit_plat_authorize_unsigned_manifest(&state->decoded_manifest->manifest_component_id);
+		ret = SUIT_TRACE(SUIT_TRACE_PLAT_AUTHORIZE_UNSIGNED_MANIFEST, suit_plat_authorize_unsigned_manifest(&state->decoded_manifest->manifest_component_id));
 	} else {
 		volatile enum suit_bool results[SUIT_MAX_NUM_SIGNERS * 2]; /* Use every other entry as canary */
 		volatile int num_ok = 0;
@@ -607,7 +652,7 @@ int suit_decoder_authorize_manifest(struct suit_decoder_state *state)
 	}
 
 	/* Verify common sequence */
-	common = &state->manifest.SUIT_Manifest_suit_common_cbor;
+	common = &state->decoded->manifest.SUIT_Manifest_suit_common_cbor;
 
 	/* Verify list of components */
 	if (common->SUIT_Common_suit_components_present) {
@@ -626,7 +671,7 @@ int suit_decoder_authorize_manifest(struct suit_decoder_state *state)
 				&common->SUIT_Common_suit_components.SUIT_Common_suit_components.SUIT_Components_SUIT_Component_Identifier_m[i]);
 
 			if (ret == SUIT_SUCCESS) {
-				ret = suit_plat_authorize_component_id(&state->decoded_manifest->manifest_component_id, &component_id);
+				ret = SUIT_TRACE(SUIT_TRACE_PLAT_AUTHORIZE_COMPONENT_ID, suit_plat_authorize_component_id(&state->decoded_manifest->manifest_component_id, &component_id));
 			}
 
 			if (ret == SUIT_SUCCESS) {
@@ -662,38 +707,76 @@ int suit_decoder_authorize_manifest(struct suit_decoder_state *state)
 	return SUIT_ERR_TAMP;
 }
 
-#define UNSEVERABLE_SEQUENCE_DECODE(sequence) \
-	if (state->manifest.SUIT_Manifest_SUIT_Unseverable_Members_m.SUIT_Unseverable_Members_suit_##sequence##_present) { \
-		if (state->decoded_manifest->sequence##_seq_status == UNAVAILABLE) { \
-			state->decoded_manifest->sequence##_seq = state->manifest.SUIT_Manifest_SUIT_Unseverable_Members_m.SUIT_Unseverable_Members_suit_##sequence.SUIT_Unseverable_Members_suit_##sequence; \
-			state->decoded_manifest->sequence##_seq_status = AUTHENTICATED; \
+#define SEQ_STATUS(seq_name) suit_manifest_get_seq_status(state->decoded_manifest, seq_name)
+#define SET_SEQ_STATUS(seq_name, status) (void)suit_manifest_set_seq_status(state->decoded_manifest, seq_name, status)
+
+/* Store the sequence location and mark it as authenticated. */
+static int store_authenticated_seq(struct suit_manifest_state *manifest, enum suit_command_sequence seq_name,
+				   const struct zcbor_string *sequence)
+{
+	int ret = suit_manifest_set_seq(manifest, seq_name, sequence);
+
+	if (ret == SUIT_SUCCESS) {
+		ret = suit_manifest_set_seq_status(manifest, seq_name, AUTHENTICATED);
+	} else {
+		(void)suit_manifest_set_seq_status(manifest, seq_name, UNAVAILABLE);
+	}
+
+	return ret;
+}
+
+/* Verify the digest of the severed sequence and mark it as authenticated. */
+static int verify_severed_seq(struct suit_decoder_state *state, enum suit_command_sequence seq_name,
+			      struct SUIT_Digest *digest)
+{
+	struct suit_manifest_state *manifest = state->decoded_manifest;
+	struct zcbor_string sequence;
+	int ret = suit_manifest_get_seq(manifest, seq_name, &sequence);
+
+	if (ret == SUIT_SUCCESS) {
+		ret = verify_suit_digest(state, digest, &sequence);
+	}
+
+	if (ret == SUIT_SUCCESS) {
+		(void)suit_manifest_set_seq_status(manifest, seq_name, AUTHENTICATED);
+	} else {
+		(void)suit_manifest_set_seq_status(manifest, seq_name, UNAVAILABLE);
+		ret = SUIT_ERR_MANIFEST_VALIDATION;
+	}
+
+	return ret;
+}
+
+#define UNSEVERABLE_SEQUENCE_DECODE(sequence, seq_name) \
+	if (state->decoded->manifest.SUIT_Manifest_SUIT_Unseverable_Members_m.SUIT_Unseverable_Members_suit_##sequence##_present) { \
+		if (SEQ_STATUS(seq_name) == UNAVAILABLE) { \
+			if (store_authenticated_seq(state->decoded_manifest, seq_name, \
+				&state->decoded->manifest.SUIT_Manifest_SUIT_Unseverable_Members_m.SUIT_Unseverable_Members_suit_##sequence.SUIT_Unseverable_Members_suit_##sequence) != SUIT_SUCCESS) { \
+				ret = SUIT_ERR_MANIFEST_VALIDATION; \
+			} \
 		} else { \
-			state->decoded_manifest->sequence##_seq_status = UNAVAILABLE; \
+			SET_SEQ_STATUS(seq_name, UNAVAILABLE); \
 			ret = SUIT_ERR_MANIFEST_VALIDATION; \
 		} \
 	} else { \
-		state->decoded_manifest->sequence##_seq_status = UNAVAILABLE; \
+		SET_SEQ_STATUS(seq_name, UNAVAILABLE); \
 	}
 
-#define SEVERABLE_SEQUENCE_DECODE(sequence) \
-	if (state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence##_present) { \
-		if (state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence.SUIT_Severable_Members_Choice_suit_##sequence##_choice \
+#define SEVERABLE_SEQUENCE_DECODE(sequence, seq_name) \
+	if (state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence##_present) { \
+		if (state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence.SUIT_Severable_Members_Choice_suit_##sequence##_choice \
 			== SUIT_Severable_Members_Choice_suit_##sequence##_SUIT_Command_Sequence_bstr_c \
-		    && state->decoded_manifest->sequence##_seq_status == UNAVAILABLE) { \
-			state->decoded_manifest->sequence##_seq = state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence.SUIT_Severable_Members_Choice_suit_##sequence##_SUIT_Command_Sequence_bstr; \
-			state->decoded_manifest->sequence##_seq_status = AUTHENTICATED; \
+		    && SEQ_STATUS(seq_name) == UNAVAILABLE) { \
+			if (store_authenticated_seq(state->decoded_manifest, seq_name, \
+				&state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence.SUIT_Severable_Members_Choice_suit_##sequence##_SUIT_Command_Sequence_bstr) != SUIT_SUCCESS) { \
+				ret = SUIT_ERR_MANIFEST_VALIDATION; \
+			} \
 		} \
-		else if (state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence.SUIT_Severable_Members_Choice_suit_##sequence##_choice \
+		else if (state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence.SUIT_Severable_Members_Choice_suit_##sequence##_choice \
 			== SUIT_Severable_Members_Choice_suit_##sequence##_SUIT_Digest_m_c) { \
-			if (state->decoded_manifest->sequence##_seq_status == SEVERED) { \
-				int digest_ret = verify_suit_digest( \
-					&state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence.SUIT_Severable_Members_Choice_suit_##sequence##_SUIT_Digest_m, \
-					&state->decoded_manifest->sequence##_seq \
-				); \
-				if (digest_ret == SUIT_SUCCESS) { \
-					state->decoded_manifest->sequence##_seq_status = AUTHENTICATED; \
-				} else { \
-					state->decoded_manifest->sequence##_seq_status = UNAVAILABLE; \
+			if (SEQ_STATUS(seq_name) == SEVERED) { \
+				if (verify_severed_seq(state, seq_name, \
+					&state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_##sequence.SUIT_Severable_Members_Choice_suit_##sequence##_SUIT_Digest_m) != SUIT_SUCCESS) { \
 					ret = SUIT_ERR_MANIFEST_VALIDATION; \
 				} \
 			} else { \
@@ -704,34 +787,30 @@ int suit_decoder_authorize_manifest(struct suit_decoder_state *state)
 				 * However, if an attempt to run the sequence is made, an error should be issued, \
 				 * instead of treating the sequence as unavailable. \
 				 */ \
-				state->decoded_manifest->sequence##_seq_status = SEVERED; \
+				SET_SEQ_STATUS(seq_name, SEVERED); \
 			} \
 		} else { \
-			state->decoded_manifest->sequence##_seq_status = UNAVAILABLE; \
+			SET_SEQ_STATUS(seq_name, UNAVAILABLE); \
 			ret = SUIT_ERR_MANIFEST_VALIDATION; \
 		} \
 	} else { \
-		state->decoded_manifest->sequence##_seq_status = UNAVAILABLE; \
+		SET_SEQ_STATUS(seq_name, UNAVAILABLE); \
 	}
 
-#define SEVERABLE_EXTENSION_SEQUENCE_DECODE(sequence) \
+#define SEVERABLE_EXTENSION_SEQUENCE_DECODE(sequence, seq_name) \
 	if (ext->severable_manifest_members_choice_extensions_suit_##sequence##_choice \
 		== severable_manifest_members_choice_extensions_suit_##sequence##_SUIT_Command_Sequence_bstr_c \
-	    && state->decoded_manifest->sequence##_seq_status == UNAVAILABLE) { \
-		state->decoded_manifest->sequence##_seq = ext->severable_manifest_members_choice_extensions_suit_##sequence##_SUIT_Command_Sequence_bstr; \
-		state->decoded_manifest->sequence##_seq_status = AUTHENTICATED; \
+	    && SEQ_STATUS(seq_name) == UNAVAILABLE) { \
+		if (store_authenticated_seq(state->decoded_manifest, seq_name, \
+			&ext->severable_manifest_members_choice_extensions_suit_##sequence##_SUIT_Command_Sequence_bstr) != SUIT_SUCCESS) { \
+			ret = SUIT_ERR_MANIFEST_VALIDATION; \
+		} \
 	} \
 	else if (ext->severable_manifest_members_choice_extensions_suit_##sequence##_choice \
 					== severable_manifest_members_choice_extensions_suit_##sequence##_SUIT_Digest_m_c) { \
-		if (state->decoded_manifest->sequence##_seq_status == SEVERED) { \
-			int digest_ret = verify_suit_digest( \
-				&ext->severable_manifest_members_choice_extensions_suit_##sequence##_SUIT_Digest_m, \
-				&state->decoded_manifest->sequence##_seq \
-			); \
-			if (digest_ret == SUIT_SUCCESS) { \
-				state->decoded_manifest->sequence##_seq_status = AUTHENTICATED; \
-			} else { \
-				state->decoded_manifest->sequence##_seq_status = UNAVAILABLE; \
+		if (SEQ_STATUS(seq_name) == SEVERED) { \
+			if (verify_severed_seq(state, seq_name, \
+				&ext->severable_manifest_members_choice_extensions_suit_##sequence##_SUIT_Digest_m) != SUIT_SUCCESS) { \
 				ret = SUIT_ERR_MANIFEST_VALIDATION; \
 			} \
 		} else { \
@@ -742,10 +821,10 @@ int suit_decoder_authorize_manifest(struct suit_decoder_state *state)
 			 * However, if an attempt to run the sequence is made, an error should be issued, \
 			 * instead of treating the sequence as unavailable. \
 			 */ \
-			state->decoded_manifest->sequence##_seq_status = SEVERED; \
+			SET_SEQ_STATUS(seq_name, SEVERED); \
 		} \
 	} else { \
-		state->decoded_manifest->sequence##_seq_status = UNAVAILABLE; \
+		SET_SEQ_STATUS(seq_name, UNAVAILABLE); \
 		ret = SUIT_ERR_MANIFEST_VALIDATION; \
 	} \
 
@@ -761,42 +840,37 @@ int suit_decoder_decode_sequences(struct suit_decoder_state *state)
 		return SUIT_ERR_ORDER;
 	}
 
-	if (state->manifest.SUIT_Manifest_suit_common_cbor.SUIT_Common_suit_shared_sequence_present) {
-		if (state->decoded_manifest->shared_sequence_status == UNAVAILABLE) {
-			state->decoded_manifest->shared_sequence = state->manifest.SUIT_Manifest_suit_common_cbor.SUIT_Common_suit_shared_sequence.SUIT_Common_suit_shared_sequence;
-			state->decoded_manifest->shared_sequence_status = AUTHENTICATED;
+	if (state->decoded->manifest.SUIT_Manifest_suit_common_cbor.SUIT_Common_suit_shared_sequence_present) {
+		if (SEQ_STATUS(SUIT_SEQ_SHARED) == UNAVAILABLE) {
+			if (store_authenticated_seq(state->decoded_manifest, SUIT_SEQ_SHARED,
+				&state->decoded->manifest.SUIT_Manifest_suit_common_cbor.SUIT_Common_suit_shared_sequence.SUIT_Common_suit_shared_sequence) != SUIT_SUCCESS) {
+				ret = SUIT_ERR_MANIFEST_VALIDATION;
+			}
 		} else {
-			state->decoded_manifest->shared_sequence_status = UNAVAILABLE;
+			SET_SEQ_STATUS(SUIT_SEQ_SHARED, UNAVAILABLE);
 			ret = SUIT_ERR_MANIFEST_VALIDATION;
 		}
 	} else {
-		state->decoded_manifest->shared_sequence_status = UNAVAILABLE;
+		SET_SEQ_STATUS(SUIT_SEQ_SHARED, UNAVAILABLE);
 		ret = SUIT_ERR_MANIFEST_VALIDATION;
 	}
 
 
-	UNSEVERABLE_SEQUENCE_DECODE(validate);
-	UNSEVERABLE_SEQUENCE_DECODE(load);
-	UNSEVERABLE_SEQUENCE_DECODE(invoke);
+	UNSEVERABLE_SEQUENCE_DECODE(validate, SUIT_SEQ_VALIDATE);
+	UNSEVERABLE_SEQUENCE_DECODE(load, SUIT_SEQ_LOAD);
+	UNSEVERABLE_SEQUENCE_DECODE(invoke, SUIT_SEQ_INVOKE);
 
-	SEVERABLE_SEQUENCE_DECODE(payload_fetch)
-	SEVERABLE_SEQUENCE_DECODE(install)
+	SEVERABLE_SEQUENCE_DECODE(payload_fetch, SUIT_SEQ_PAYLOAD_FETCH)
+	SEVERABLE_SEQUENCE_DECODE(install, SUIT_SEQ_INSTALL)
 
 	/* The CDDL enforces to severe the text field from the manifest.
 	 * Due to that fact, if the text field is present inside the manifest, it contains the digest of the severed text field.
 	 * If the text field was found before (status SEVERED), verify its digest.
 	 */
-	if (state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_text_present) {
-		if (state->decoded_manifest->text_status == SEVERED) {
-			int digest_ret = verify_suit_digest(
-				&state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_text.SUIT_Severable_Members_Choice_suit_text,
-				&state->decoded_manifest->text
-			);
-
-			if (digest_ret == SUIT_SUCCESS) {
-				state->decoded_manifest->text_status = AUTHENTICATED;
-			} else {
-				state->decoded_manifest->text_status = UNAVAILABLE;
+	if (state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_text_present) {
+		if (SEQ_STATUS(SUIT_MANIFEST_TEXT) == SEVERED) {
+			if (verify_severed_seq(state, SUIT_MANIFEST_TEXT,
+				&state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_suit_text.SUIT_Severable_Members_Choice_suit_text) != SUIT_SUCCESS) {
 				ret = SUIT_ERR_MANIFEST_VALIDATION;
 			}
 		} else {
@@ -805,27 +879,27 @@ int suit_decoder_decode_sequences(struct suit_decoder_state *state)
 			 * This is a valid case, ie once minified envelope is transferred into the
 			 * SUIT storage partition.
 			 */
-			state->decoded_manifest->text_status = UNAVAILABLE;
+			SET_SEQ_STATUS(SUIT_MANIFEST_TEXT, UNAVAILABLE);
 		}
 	} else {
-		if (state->decoded_manifest->text_status != UNAVAILABLE) {
+		if (SEQ_STATUS(SUIT_MANIFEST_TEXT) != UNAVAILABLE) {
 			ret = SUIT_ERR_MANIFEST_VALIDATION;
 		}
-		state->decoded_manifest->text_status = UNAVAILABLE;
+		SET_SEQ_STATUS(SUIT_MANIFEST_TEXT, UNAVAILABLE);
 	}
 
 	/* Parse severable manifest members extensions. */
-	const size_t ext_count = state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_severable_manifest_members_choice_extensions_m_count;
+	const size_t ext_count = state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_severable_manifest_members_choice_extensions_m_count;
 	for (size_t ext_i = 0; ext_i < ext_count; ext_i++) {
-		struct severable_manifest_members_choice_extensions_r *ext = &state->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_severable_manifest_members_choice_extensions_m[ext_i].SUIT_Severable_Members_Choice_severable_manifest_members_choice_extensions_m;
+		struct severable_manifest_members_choice_extensions_r *ext = &state->decoded->manifest.SUIT_Manifest_SUIT_Severable_Members_Choice_m.SUIT_Severable_Members_Choice_severable_manifest_members_choice_extensions_m[ext_i].SUIT_Severable_Members_Choice_severable_manifest_members_choice_extensions_m;
 
 		switch (ext->severable_manifest_members_choice_extensions_choice) {
 			case severable_manifest_members_choice_extensions_suit_dependency_resolution_c:
-				SEVERABLE_EXTENSION_SEQUENCE_DECODE(dependency_resolution)
+				SEVERABLE_EXTENSION_SEQUENCE_DECODE(dependency_resolution, SUIT_SEQ_DEP_RESOLUTION)
 				break;
 
 			case severable_manifest_members_choice_extensions_suit_candidate_verification_c:
-				SEVERABLE_EXTENSION_SEQUENCE_DECODE(candidate_verification)
+				SEVERABLE_EXTENSION_SEQUENCE_DECODE(candidate_verification, SUIT_SEQ_CAND_VERIFICATION)
 				break;
 
 			default:
@@ -862,7 +936,7 @@ int suit_decoder_create_components(struct suit_decoder_state *state)
 		return SUIT_ERR_ORDER;
 	}
 
-	common = &state->manifest.SUIT_Manifest_suit_common_cbor;
+	common = &state->decoded->manifest.SUIT_Manifest_suit_common_cbor;
 
 	/* Verify list of components */
 	if (common->SUIT_Common_suit_components_present) {
@@ -897,6 +971,8 @@ int suit_decoder_create_components(struct suit_decoder_state *state)
 	}
 
 	if (ret == SUIT_SUCCESS) {
+		/* The decoded manifest is no longer needed - all members are stored in the manifest state. */
+		suit_decoder_release_decoded(state);
 		state->step = COMPONENTS_CREATED;
 	} else  {
 		(void)suit_manifest_release(state->decoded_manifest);
@@ -0,0 +1,894 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_decompress.h>
+
+/* Range decoder constants. */
+#define RC_INIT_BYTES		5
+#define RC_TOP_VALUE		(1U << 24)
+#define RC_BIT_MODEL_TOTAL_BITS 11
+#define RC_BIT_MODEL_TOTAL	(1U << RC_BIT_MODEL_TOTAL_BITS)
+#define RC_MOVE_BITS		5
+
+/* LZMA model constants. */
+#define STATES		 12
+#define LIT_STATES	 7
+#define POS_STATES_MAX	 16
+#define MATCH_LEN_MIN	 2
+#define LEN_LOW_BITS	 3
+#define LEN_MID_BITS	 3
+#define LEN_HIGH_BITS	 8
+#define LEN_LOW_SYMBOLS	 (1 << LEN_LOW_BITS)
+#define LEN_MID_SYMBOLS	 (1 << LEN_MID_BITS)
+#define LEN_HIGH_SYMBOLS (1 << LEN_HIGH_BITS)
+#define DIST_STATES	 4
+#define DIST_SLOT_BITS	 6
+#define DIST_MODEL_START 4
+#define DIST_MODEL_END	 14
+#define FULL_DISTANCES	 128
+#define ALIGN_BITS	 4
+#define ALIGN_SIZE	 (1 << ALIGN_BITS)
+#define LITERAL_CODER_SIZE 0x300
+
+/* Layout of a single length coder inside the probability array. */
+#define LEN_CHOICE  0
+#define LEN_CHOICE2 1
+#define LEN_LOW	    2
+#define LEN_MID	    (LEN_LOW + POS_STATES_MAX * LEN_LOW_SYMBOLS)
+#define LEN_HIGH    (LEN_MID + POS_STATES_MAX * LEN_MID_SYMBOLS)
+#define LEN_CODER_SIZE (LEN_HIGH + LEN_HIGH_SYMBOLS)
+
+/* Layout of the probability array. */
+#define PROBS_IS_MATCH	   0
+#define PROBS_IS_REP	   (PROBS_IS_MATCH + STATES * POS_STATES_MAX)
+#define PROBS_IS_REP0	   (PROBS_IS_REP + STATES)
+#define PROBS_IS_REP1	   (PROBS_IS_REP0 + STATES)
+#define PROBS_IS_REP2	   (PROBS_IS_REP1 + STATES)
+#define PROBS_IS_REP0_LONG (PROBS_IS_REP2 + STATES)
+#define PROBS_DIST_SLOT	   (PROBS_IS_REP0_LONG + STATES * POS_STATES_MAX)
+#define PROBS_DIST_SPECIAL (PROBS_DIST_SLOT + DIST_STATES * (1 << DIST_SLOT_BITS))
+#define PROBS_DIST_ALIGN   (PROBS_DIST_SPECIAL + FULL_DISTANCES - DIST_MODEL_END)
+#define PROBS_MATCH_LEN	   (PROBS_DIST_ALIGN + ALIGN_SIZE)
+#define PROBS_REP_LEN	   (PROBS_MATCH_LEN + LEN_CODER_SIZE)
+#define PROBS_LITERAL	   (PROBS_REP_LEN + LEN_CODER_SIZE)
+
+#if PROBS_LITERAL != 1846
+#error "Invalid layout of the LZMA probability array"
+#endif
+
+/* States of the LZMA2 chunk parser. */
+enum lzma2_seq {
+	SEQ_CONTROL,
+	SEQ_UNCOMPRESSED_1,
+	SEQ_UNCOMPRESSED_2,
+	SEQ_COMPRESSED_0,
+	SEQ_COMPRESSED_1,
+	SEQ_PROPERTIES,
+	SEQ_LZMA_PREPARE,
+	SEQ_LZMA_RUN,
+	SEQ_COPY,
+	SEQ_FINISHED,
+};
+
+/* Input and output buffers of a single decoder call. */
+struct lzma2_buf {
+	const uint8_t *in;
+	size_t in_pos;
+	size_t in_size;
+	uint8_t *out;
+	size_t out_pos;
+	size_t out_size;
+};
+
+
+static void dict_reset(struct suit_lzma_dict *dict)
+{
+	dict->start = 0;
+	dict->pos = 0;
+	dict->limit = 0;
+	dict->full = 0;
+}
+
+static void dict_limit(struct suit_lzma_dict *dict, size_t out_max)
+{
+	if ((dict->end - dict->pos) <= out_max) {
+		dict->limit = dict->end;
+	} else {
+		dict->limit = dict->pos + out_max;
+	}
+}
+
+static bool dict_has_space(const struct suit_lzma_dict *dict)
+{
+	return dict->pos < dict->limit;
+}
+
+static uint8_t dict_get(const struct suit_lzma_dict *dict, uint32_t dist)
+{
+	size_t offset = dict->pos - dist - 1;
+
+	if (dist >= dict->pos) {
+		offset += dict->end;
+	}
+
+	return (dict->full > 0) ? dict->buf[offset] : 0;
+}
+
+static void dict_put(struct suit_lzma_dict *dict, uint8_t byte)
+{
+	dict->buf[dict->pos++] = byte;
+
+	if (dict->full < dict->pos) {
+		dict->full = dict->pos;
+	}
+}
+
+/* Repeat the match, limited by the end of the dictionary or the size of the output buffer. */
+static bool dict_repeat(struct suit_lzma_dict *dict, uint32_t *len, uint32_t dist)
+{
+	size_t back;
+	uint32_t left;
+
+	if ((dist >= dict->full) || (dist >= dict->end)) {
+		return false;
+	}
+
+	left = *len;
+	if (left > (dict->limit - dict->pos)) {
+		left = (uint32_t)(dict->limit - dict->pos);
+	}
+	*len -= left;
+
+	back = dict->pos - dist - 1;
+	if (dist >= dict->pos) {
+		back += dict->end;
+	}
+
+	while (left > 0) {
+		dict->buf[dict->pos++] = dict->buf[back++];
+		if (back == dict->end) {
+			back = 0;
+		}
+		left--;
+	}
+
+	if (dict->full < dict->pos) {
+		dict->full = dict->pos;
+	}
+
+	return true;
+}
+
+/* Copy an uncompressed chunk, both to the dictionary and to the output buffer. */
+static void dict_uncompressed(struct suit_lzma_dict *dict, struct lzma2_buf *b, uint32_t *left)
+{
+	while ((*left > 0) && (b->in_pos < b->in_size) && (b->out_pos < b->out_size)) {
+		size_t copy_size = b->in_size - b->in_pos;
+
+		if (copy_size > (b->out_size - b->out_pos)) {
+			copy_size = b->out_size - b->out_pos;
+		}
+		if (copy_size > (dict->end - dict->pos)) {
+			copy_size = dict->end - dict->pos;
+		}
+		if (copy_size > *left) {
+			copy_size = *left;
+		}
+
+		*left -= (uint32_t)copy_size;
+
+		memcpy(&dict->buf[dict->pos], &b->in[b->in_pos], copy_size);
+		memcpy(&b->out[b->out_pos], &b->in[b->in_pos], copy_size);
+		dict->pos += copy_size;
+		b->in_pos += copy_size;
+		b->out_pos += copy_size;
+
+		if (dict->full < dict->pos) {
+			dict->full = dict->pos;
+		}
+		if (dict->pos == dict->end) {
+			dict->pos = 0;
+		}
+
+		dict->start = dict->pos;
+	}
+}
+
+/* Move the decoded bytes from the dictionary to the output buffer. */
+static size_t dict_flush(struct suit_lzma_dict *dict, struct lzma2_buf *b)
+{
+	size_t copy_size = dict->pos - dict->start;
+
+	memcpy(&b->out[b->out_pos], &dict->buf[dict->start], copy_size);
+	b->out_pos += copy_size;
+
+	if (dict->pos == dict->end) {
+		dict->pos = 0;
+	}
+	dict->start = dict->pos;
+
+	return copy_size;
+}
+
+static void rc_reset(struct suit_lzma_rc *rc)
+{
+	rc->range = UINT32_MAX;
+	rc->code = 0;
+	rc->init_bytes_left = RC_INIT_BYTES;
+}
+
+/* Read the range coder initialization bytes. The first byte is always ignored. */
+static bool rc_read_init(struct suit_lzma_rc *rc, struct lzma2_buf *b)
+{
+	while (rc->init_bytes_left > 0) {
+		if (b->in_pos == b->in_size) {
+			return false;
+		}
+
+		rc->code = (rc->code << 8) + b->in[b->in_pos++];
+		rc->init_bytes_left--;
+	}
+
+	return true;
+}
+
+static bool rc_limit_exceeded(const struct suit_lzma_rc *rc)
+{
+	return rc->in_pos > rc->in_limit;
+}
+
+static bool rc_is_finished(const struct suit_lzma_rc *rc)
+{
+	return rc->code == 0;
+}
+
+static void rc_normalize(struct suit_lzma_rc *rc)
+{
+	if (rc->range < RC_TOP_VALUE) {
+		rc->range <<= 8;
+		rc->code = (rc->code << 8) + rc->in[rc->in_pos++];
+	}
+}
+
+static uint32_t rc_bit(struct suit_lzma_rc *rc, uint16_t *prob)
+{
+	uint32_t bound;
+
+	rc_normalize(rc);
+	bound = (rc->range >> RC_BIT_MODEL_TOTAL_BITS) * *prob;
+
+	if (rc->code < bound) {
+		rc->range = bound;
+		*prob += (RC_BIT_MODEL_TOTAL - *prob) >> RC_MOVE_BITS;
+		return 0;
+	}
+
+	rc->range -= bound;
+	rc->code -= bound;
+	*prob -= *prob >> RC_MOVE_BITS;
+
+	return 1;
+}
+
+static uint32_t rc_bittree(struct suit_lzma_rc *rc, uint16_t *probs, uint32_t limit)
+{
+	uint32_t symbol = 1;
+
+	do {
+		symbol = (symbol << 1) + rc_bit(rc, &probs[symbol]);
+	} while (symbol < limit);
+
+	return symbol;
+}
+
+static void rc_bittree_reverse(struct suit_lzma_rc *rc, uint16_t *probs, uint32_t *dest, uint32_t limit)
+{
+	uint32_t symbol = 1;
+
+	for (uint32_t i = 0; i < limit; i++) {
+		uint32_t bit = rc_bit(rc, &probs[symbol]);
+
+		symbol = (symbol << 1) + bit;
+		*dest += bit << i;
+	}
+}
+
+static void rc_direct(struct suit_lzma_rc *rc, uint32_t *dest, uint32_t limit)
+{
+	for (uint32_t i = 0; i < limit; i++) {
+		uint32_t mask;
+
+		rc_normalize(rc);
+		rc->range >>= 1;
+		rc->code -= rc->range;
+		mask = (uint32_t)0 - (rc->code >> 31);
+		rc->code += rc->range & mask;
+		*dest = (*dest << 1) + (mask + 1);
+	}
+}
+
+static bool lzma_state_is_literal(uint32_t state)
+{
+	return state < LIT_STATES;
+}
+
+static void lzma_literal(struct suit_lzma2_decoder *s)
+{
+	uint32_t prev_byte = dict_get(&s->dict, 0);
+	uint32_t low = prev_byte >> (8 - s->lc);
+	uint32_t high = ((uint32_t)s->dict.pos & s->literal_pos_mask) << s->lc;
+	uint16_t *probs = &s->probs[PROBS_LITERAL + LITERAL_CODER_SIZE * (low + high)];
+	uint32_t symbol;
+
+	if (lzma_state_is_literal(s->state)) {
+		symbol = rc_bittree(&s->rc, probs, 0x100);
+	} else {
+		uint32_t match_byte = dict_get(&s->dict, s->rep0);
+		uint32_t offset = 0x100;
+
+		symbol = 1;
+		do {
+			uint32_t match_bit;
+			uint32_t bit;
+
+			match_byte <<= 1;
+			match_bit = match_byte & offset;
+			bit = rc_bit(&s->rc, &probs[offset + match_bit + symbol]);
+			symbol = (symbol << 1) + bit;
+
+			/* Keep using the matched byte as long as the decoded bits are equal. */
+			if (bit != 0) {
+				offset = match_bit;
+			} else {
+				offset &= ~match_bit;
+			}
+		} while (symbol < 0x100);
+	}
+
+	dict_put(&s->dict, (uint8_t)symbol);
+
+	if (s->state < 4) {
+		s->state = 0;
+	} else if (s->state < 10) {
+		s->state -= 3;
+	} else {
+		s->state -= 6;
+	}
+}
+
+static uint32_t lzma_len(struct suit_lzma2_decoder *s, uint16_t *l, uint32_t pos_state)
+{
+	if (rc_bit(&s->rc, &l[LEN_CHOICE]) == 0) {
+		return MATCH_LEN_MIN - LEN_LOW_SYMBOLS +
+		       rc_bittree(&s->rc, &l[LEN_LOW + pos_state * LEN_LOW_SYMBOLS], LEN_LOW_SYMBOLS);
+	}
+
+	if (rc_bit(&s->rc, &l[LEN_CHOICE2]) == 0) {
+		return MATCH_LEN_MIN + LEN_LOW_SYMBOLS - LEN_MID_SYMBOLS +
+		       rc_bittree(&s->rc, &l[LEN_MID + pos_state * LEN_MID_SYMBOLS], LEN_MID_SYMBOLS);
+	}
+
+	return MATCH_LEN_MIN + LEN_LOW_SYMBOLS + LEN_MID_SYMBOLS - LEN_HIGH_SYMBOLS +
+	       rc_bittree(&s->rc, &l[LEN_HIGH], LEN_HIGH_SYMBOLS);
+}
+
+static void lzma_match(struct suit_lzma2_decoder *s, uint32_t pos_state)
+{
+	uint32_t dist_state;
+	uint32_t dist_slot;
+
+	s->state = lzma_state_is_literal(s->state) ? 7 : 10;
+	s->rep3 = s->rep2;
+	s->rep2 = s->rep1;
+	s->rep1 = s->rep0;
+
+	s->len = lzma_len(s, &s->probs[PROBS_MATCH_LEN], pos_state);
+
+	dist_state = (s->len < DIST_STATES + MATCH_LEN_MIN) ? (s->len - MATCH_LEN_MIN) : (DIST_STATES - 1);
+	dist_slot = rc_bittree(&s->rc, &s->probs[PROBS_DIST_SLOT + (dist_state << DIST_SLOT_BITS)],
+			       1 << DIST_SLOT_BITS) - (1 << DIST_SLOT_BITS);
+
+	if (dist_slot < DIST_MODEL_START) {
+		s->rep0 = dist_slot;
+	} else {
+		uint32_t limit = (dist_slot >> 1) - 1;
+
+		s->rep0 = 2 + (dist_slot & 1);
+
+		if (dist_slot < DIST_MODEL_END) {
+			s->rep0 <<= limit;
+			rc_bittree_reverse(&s->rc,
+					   &s->probs[PROBS_DIST_SPECIAL + s->rep0 - dist_slot - 1],
+					   &s->rep0, limit);
+		} else {
+			rc_direct(&s->rc, &s->rep0, limit - ALIGN_BITS);
+			s->rep0 <<= ALIGN_BITS;
+			rc_bittree_reverse(&s->rc, &s->probs[PROBS_DIST_ALIGN], &s->rep0, ALIGN_BITS);
+		}
+	}
+}
+
+static void lzma_rep_match(struct suit_lzma2_decoder *s, uint32_t pos_state)
+{
+	uint32_t tmp;
+
+	if (rc_bit(&s->rc, &s->probs[PROBS_IS_REP0 + s->state]) == 0) {
+		if (rc_bit(&s->rc, &s->probs[PROBS_IS_REP0_LONG + s->state * POS_STATES_MAX + pos_state]) == 0) {
+			/* Short repetition - a single byte from the last distance. */
+			s->state = lzma_state_is_literal(s->state) ? 9 : 11;
+			s->len = 1;
+			return;
+		}
+	} else {
+		if (rc_bit(&s->rc, &s->probs[PROBS_IS_REP1 + s->state]) == 0) {
+			tmp = s->rep1;
+		} else {
+			if (rc_bit(&s->rc, &s->probs[PROBS_IS_REP2 + s->state]) == 0) {
+				tmp = s->rep2;
+			} else {
+				tmp = s->rep3;
+				s->rep3 = s->rep2;
+			}
+
+			s->rep2 = s->rep1;
+		}
+
+		s->rep1 = s->rep0;
+		s->rep0 = tmp;
+	}
+
+	s->state = lzma_state_is_literal(s->state) ? 8 : 11;
+	s->len = lzma_len(s, &s->probs[PROBS_REP_LEN], pos_state);
+}
+
+/* Decode symbols until the dictionary limit or the input limit is reached. */
+static bool lzma_main(struct suit_lzma2_decoder *s)
+{
+	if (dict_has_space(&s->dict) && (s->len > 0)) {
+		if (!dict_repeat(&s->dict, &s->len, s->rep0)) {
+			return false;
+		}
+	}
+
+	while (dict_has_space(&s->dict) && !rc_limit_exceeded(&s->rc)) {
+		uint32_t pos_state = (uint32_t)s->dict.pos & s->pos_mask;
+
+		if (rc_bit(&s->rc, &s->probs[PROBS_IS_MATCH + s->state * POS_STATES_MAX + pos_state]) == 0) {
+			lzma_literal(s);
+		} else {
+			if (rc_bit(&s->rc, &s->probs[PROBS_IS_REP + s->state]) == 0) {
+				lzma_match(s, pos_state);
+			} else {
+				lzma_rep_match(s, pos_state);
+			}
+
+			if (!dict_repeat(&s->dict, &s->len, s->rep0)) {
+				return false;
+			}
+		}
+	}
+
+	/* Having the range normalized here allows to verify the end of the chunk. */
+	rc_normalize(&s->rc);
+
+	return true;
+}
+
+static void lzma_reset(struct suit_lzma2_decoder *s)
+{
+	s->state = 0;
+	s->rep0 = 0;
+	s->rep1 = 0;
+	s->rep2 = 0;
+	s->rep3 = 0;
+	s->len = 0;
+
+	for (size_t i = 0; i < SUIT_LZMA_PROBS_COUNT; i++) {
+		s->probs[i] = RC_BIT_MODEL_TOTAL >> 1;
+	}
+
+	rc_reset(&s->rc);
+}
+
+/* Decode the lc, lp and pb values from the LZMA properties byte. */
+static int lzma_props(struct suit_lzma2_decoder *s, uint8_t props)
+{
+	uint32_t lc;
+	uint32_t lp;
+	uint32_t pb;
+
+	if (props > (4 * 45 + 4 * 9 + 8)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	pb = props / 45;
+	lp = (props % 45) / 9;
+	lc = props % 9;
+
+	if ((lc + lp) > 4) {
+		return SUIT_ERR_DECODING;
+	}
+
+	if ((lc + lp) > SUIT_LZMA2_LCLP_MAX) {
+		return SUIT_ERR_UNSUPPORTED_PARAMETER;
+	}
+
+	s->pos_mask = (1U << pb) - 1;
+	s->literal_pos_mask = (1U << lp) - 1;
+	s->lc = lc;
+
+	return SUIT_SUCCESS;
+}
+
+/* Run the LZMA decoder on the input, splitting symbols between calls through the temporary buffer. */
+static bool lzma2_lzma(struct suit_lzma2_decoder *s, struct lzma2_buf *b)
+{
+	size_t in_avail = b->in_size - b->in_pos;
+	size_t tmp;
+
+	if ((s->temp_size > 0) || (s->compressed == 0)) {
+		tmp = 2 * SUIT_LZMA_IN_REQUIRED - s->temp_size;
+		if (tmp > (s->compressed - s->temp_size)) {
+			tmp = s->compressed - s->temp_size;
+		}
+		if (tmp > in_avail) {
+			tmp = in_avail;
+		}
+
+		memcpy(&s->temp_buf[s->temp_size], &b->in[b->in_pos], tmp);
+
+		if ((s->temp_size + tmp) == s->compressed) {
+			memset(&s->temp_buf[s->temp_size + tmp], 0,
+			       sizeof(s->temp_buf) - s->temp_size - tmp);
+			s->rc.in_limit = s->temp_size + tmp;
+		} else if ((s->temp_size + tmp) < SUIT_LZMA_IN_REQUIRED) {
+			s->temp_size += tmp;
+			b->in_pos += tmp;
+			return true;
+		} else {
+			s->rc.in_limit = s->temp_size + tmp - SUIT_LZMA_IN_REQUIRED;
+		}
+
+		s->rc.in = s->temp_buf;
+		s->rc.in_pos = 0;
+
+		if (!lzma_main(s) || (s->rc.in_pos > (s->temp_size + tmp))) {
+			return false;
+		}
+
+		s->compressed -= (uint32_t)s->rc.in_pos;
+
+		if (s->rc.in_pos < s->temp_size) {
+			s->temp_size -= s->rc.in_pos;
+			memmove(s->temp_buf, &s->temp_buf[s->rc.in_pos], s->temp_size);
+			return true;
+		}
+
+		b->in_pos += s->rc.in_pos - s->temp_size;
+		s->temp_size = 0;
+	}
+
+	in_avail = b->in_size - b->in_pos;
+	if (in_avail >= SUIT_LZMA_IN_REQUIRED) {
+		s->rc.in = b->in;
+		s->rc.in_pos = b->in_pos;
+
+		if (in_avail >= (s->compressed + SUIT_LZMA_IN_REQUIRED)) {
+			s->rc.in_limit = b->in_pos + s->compressed;
+		} else {
+			s->rc.in_limit = b->in_size - SUIT_LZMA_IN_REQUIRED;
+		}
+
+		if (!lzma_main(s)) {
+			return false;
+		}
+
+		in_avail = s->rc.in_pos - b->in_pos;
+		if (in_avail > s->compressed) {
+			return false;
+		}
+
+		s->compressed -= (uint32_t)in_avail;
+		b->in_pos = s->rc.in_pos;
+	}
+
+	in_avail = b->in_size - b->in_pos;
+	if (in_avail < SUIT_LZMA_IN_REQUIRED) {
+		if (in_avail > s->compressed) {
+			in_avail = s->compressed;
+		}
+
+		memcpy(s->temp_buf, &b->in[b->in_pos], in_avail);
+		s->temp_size = in_avail;
+		b->in_pos += in_avail;
+	}
+
+	return true;
+}
+
+/* Parse the LZMA2 chunk headers and decode chunks until the input or the output is exhausted. */
+static int lzma2_decode(struct suit_lzma2_decoder *s, struct lzma2_buf *b)
+{
+	uint8_t byte;
+	int ret;
+
+	while ((b->in_pos < b->in_size) || (s->sequence == SEQ_LZMA_RUN)) {
+		switch (s->sequence) {
+		case SEQ_CONTROL:
+			/*
+			 * 0x00             - end of the stream
+			 * 0x01             - uncompressed chunk with the dictionary reset
+			 * 0x02             - uncompressed chunk
+			 * 0x80 + reset     - LZMA chunk, where the bits 5-6 define what is reset:
+			 *                    0: nothing, 1: state, 2: state and properties,
+			 *                    3: state, properties and dictionary.
+			 */
+			byte = b->in[b->in_pos++];
+
+			if (byte == 0x00) {
+				s->sequence = SEQ_FINISHED;
+				return SUIT_SUCCESS;
+			}
+
+			if ((byte >= 0xE0) || (byte == 0x01)) {
+				s->need_props = true;
+				s->need_dict_reset = false;
+				dict_reset(&s->dict);
+			} else if (s->need_dict_reset) {
+				return SUIT_ERR_DECODING;
+			}
+
+			if (byte >= 0x80) {
+				s->uncompressed = (uint32_t)(byte & 0x1F) << 16;
+				s->sequence = SEQ_UNCOMPRESSED_1;
+
+				if (byte >= 0xC0) {
+					/* New properties imply the state reset. */
+					s->need_props = false;
+					s->next_sequence = SEQ_PROPERTIES;
+				} else if (s->need_props) {
+					return SUIT_ERR_DECODING;
+				} else {
+					s->next_sequence = SEQ_LZMA_PREPARE;
+					if (byte >= 0xA0) {
+						lzma_reset(s);
+					}
+				}
+			} else {
+				if (byte > 0x02) {
+					return SUIT_ERR_DECODING;
+				}
+
+				s->sequence = SEQ_COMPRESSED_0;
+				s->next_sequence = SEQ_COPY;
+			}
+			break;
+
+		case SEQ_UNCOMPRESSED_1:
+			s->uncompressed += (uint32_t)b->in[b->in_pos++] << 8;
+			s->sequence = SEQ_UNCOMPRESSED_2;
+			break;
+
+		case SEQ_UNCOMPRESSED_2:
+			s->uncompressed += (uint32_t)b->in[b->in_pos++] + 1;
+			s->sequence = SEQ_COMPRESSED_0;
+			break;
+
+		case SEQ_COMPRESSED_0:
+			/* For the uncompressed chunks this field holds the chunk size. */
+			s->compressed = (uint32_t)b->in[b->in_pos++] << 8;
+			s->sequence = SEQ_COMPRESSED_1;
+			break;
+
+		case SEQ_COMPRESSED_1:
+			s->compressed += (uint32_t)b->in[b->in_pos++] + 1;
+			if (s->next_sequence == SEQ_COPY) {
+				s->uncompressed = s->compressed;
+			}
+			s->sequence = s->next_sequence;
+			break;
+
+		case SEQ_PROPERTIES:
+			ret = lzma_props(s, b->in[b->in_pos++]);
+			if (ret != SUIT_SUCCESS) {
+				return ret;
+			}
+
+			lzma_reset(s);
+			s->sequence = SEQ_LZMA_PREPARE;
+			break;
+
+		case SEQ_LZMA_PREPARE:
+			if (s->compressed < RC_INIT_BYTES) {
+				return SUIT_ERR_DECODING;
+			}
+
+			if (!rc_read_init(&s->rc, b)) {
+				return SUIT_ERR_AGAIN;
+			}
+
+			s->compressed -= RC_INIT_BYTES;
+			s->sequence = SEQ_LZMA_RUN;
+			break;
+
+		case SEQ_LZMA_RUN:
+			dict_limit(&s->dict, ((b->out_size - b->out_pos) < s->uncompressed) ?
+						     (b->out_size - b->out_pos) : s->uncompressed);
+
+			if (!lzma2_lzma(s, b)) {
+				return SUIT_ERR_DECODING;
+			}
+
+			s->uncompressed -= (uint32_t)dict_flush(&s->dict, b);
+
+			if (s->uncompressed == 0) {
+				if ((s->compressed > 0) || (s->len > 0) || !rc_is_finished(&s->rc)) {
+					return SUIT_ERR_DECODING;
+				}
+
+				rc_reset(&s->rc);
+				s->sequence = SEQ_CONTROL;
+			} else if ((b->out_pos == b->out_size) ||
+				   ((b->in_pos == b->in_size) && (s->temp_size < s->compressed))) {
+				return SUIT_ERR_AGAIN;
+			}
+			break;
+
+		case SEQ_COPY:
+			dict_uncompressed(&s->dict, b, &s->uncompressed);
+			if (s->uncompressed > 0) {
+				return SUIT_ERR_AGAIN;
+			}
+
+			s->sequence = SEQ_CONTROL;
+			break;
+
+		case SEQ_FINISHED:
+			/* Ignore any data after the end of the stream. */
+			return SUIT_SUCCESS;
+
+		default:
+			return SUIT_ERR_CRASH;
+		}
+	}
+
+	return (s->sequence == SEQ_FINISHED) ? SUIT_SUCCESS : SUIT_ERR_AGAIN;
+}
+
+/* Convert the absolute addresses of the Thumb BL instructions back to relative ones.
+ * Returns the number of bytes that were processed.
+ */
+static size_t arm_thumb_filter(uint8_t *buf, size_t size, uint32_t pos)
+{
+	size_t i;
+
+	for (i = 0; (i + 4) <= size; i += 2) {
+		if (((buf[i + 1] & 0xF8) == 0xF0) && ((buf[i + 3] & 0xF8) == 0xF8)) {
+			uint32_t src = (((uint32_t)buf[i + 1] & 0x07) << 19) |
+				       ((uint32_t)buf[i + 0] << 11) |
+				       (((uint32_t)buf[i + 3] & 0x07) << 8) |
+				       (uint32_t)buf[i + 2];
+			uint32_t dest;
+
+			src <<= 1;
+			dest = (src - (pos + (uint32_t)i + 4)) >> 1;
+
+			buf[i + 1] = (uint8_t)(0xF0 | ((dest >> 19) & 0x07));
+			buf[i + 0] = (uint8_t)(dest >> 11);
+			buf[i + 3] = (uint8_t)(0xF8 | ((dest >> 8) & 0x07));
+			buf[i + 2] = (uint8_t)dest;
+			i += 2;
+		}
+	}
+
+	return i;
+}
+
+int suit_decompress_init(struct suit_decompress_state *state, const struct suit_compression_info *info,
+			 uint8_t *dict, size_t dict_size)
+{
+	if ((state == NULL) || (info == NULL) || (dict == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if (info->compression_alg_id != suit_lzma2) {
+		return SUIT_ERR_UNSUPPORTED_ALG;
+	}
+
+	if ((dict_size < SUIT_LZMA2_DICT_SIZE_MIN) || (dict_size > UINT32_MAX)) {
+		return SUIT_ERR_UNSUPPORTED_PARAMETER;
+	}
+
+	memset(state, 0, sizeof(*state));
+
+	state->lzma2.dict.buf = dict;
+	state->lzma2.dict.end = dict_size;
+	state->lzma2.sequence = SEQ_CONTROL;
+	state->lzma2.need_dict_reset = true;
+	state->lzma2.need_props = true;
+	rc_reset(&state->lzma2.rc);
+
+	state->arm_thumb_filter = info->arm_thumb_filter;
+	state->decompressed_image_size = info->decompressed_image_size;
+
+	return SUIT_SUCCESS;
+}
+
+int suit_decompress(struct suit_decompress_state *state, const uint8_t *in, size_t *in_len,
+		    uint8_t *out, size_t *out_len)
+{
+	struct lzma2_buf b;
+	size_t filtered;
+	int ret;
+
+	if ((state == NULL) || (in_len == NULL) || (out_len == NULL) ||
+	    ((in == NULL) && (*in_len > 0)) || ((out == NULL) && (*out_len > 0))) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if (state->finished) {
+		*in_len = 0;
+		*out_len = 0;
+		return SUIT_SUCCESS;
+	}
+
+	b.in = in;
+	b.in_pos = 0;
+	b.in_size = *in_len;
+	b.out = out;
+	b.out_pos = 0;
+	b.out_size = *out_len;
+
+	if (state->arm_thumb_filter) {
+		/* The filter needs the whole instruction, so up to 3 bytes are held between calls. */
+		if (b.out_size <= sizeof(state->filter_buf)) {
+			return SUIT_ERR_OVERFLOW;
+		}
+
+		memcpy(out, state->filter_buf, state->filter_size);
+		b.out_pos = state->filter_size;
+	}
+
+	ret = lzma2_decode(&state->lzma2, &b);
+	if ((ret != SUIT_SUCCESS) && (ret != SUIT_ERR_AGAIN)) {
+		return ret;
+	}
+
+	filtered = b.out_pos;
+	if (state->arm_thumb_filter) {
+		filtered = arm_thumb_filter(out, b.out_pos, state->filter_pos);
+
+		if (ret == SUIT_SUCCESS) {
+			/* The last bytes of the stream are never converted. */
+			filtered = b.out_pos;
+		}
+
+		state->filter_pos += (uint32_t)filtered;
+		state->filter_size = b.out_pos - filtered;
+		memcpy(state->filter_buf, &out[filtered], state->filter_size);
+	}
+
+	state->out_total += filtered;
+	if ((state->decompressed_image_size > 0) &&
+	    (state->out_total > state->decompressed_image_size)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	*in_len = b.in_pos;
+	*out_len = filtered;
+
+	if (ret == SUIT_SUCCESS) {
+		if ((state->decompressed_image_size > 0) &&
+		    (state->out_total != state->decompressed_image_size)) {
+			return SUIT_ERR_DECODING;
+		}
+
+		state->finished = true;
+	}
+
+	return ret;
+}
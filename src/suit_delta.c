@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_delta.h>
+
+#define MAGIC_LEN (sizeof(SUIT_DELTA_MAGIC) - 1)
+
+/* Fields of the patch. */
+enum delta_seq {
+	SEQ_MAGIC,
+	SEQ_TARGET_SIZE,
+	SEQ_DIFF_LEN,
+	SEQ_DIFF,
+	SEQ_EXTRA_LEN,
+	SEQ_EXTRA,
+	SEQ_OFFSET,
+	SEQ_FINISHED,
+};
+
+/* Input and output buffers of a single applier call. */
+struct delta_buf {
+	const uint8_t *in;
+	size_t in_pos;
+	size_t in_size;
+	uint8_t *out;
+	size_t out_pos;
+	size_t out_size;
+};
+
+
+/* Decode the next part of the LEB128 integer. Sets complete to true once the last byte is read. */
+static int varint_read(struct suit_delta_state *state, struct delta_buf *b, bool *complete)
+{
+	*complete = false;
+
+	while (b->in_pos < b->in_size) {
+		uint8_t byte = b->in[b->in_pos++];
+
+		/* Only a single bit of the tenth byte fits into the 64-bit value. */
+		if ((state->varint_shift == 63) && (byte > 1)) {
+			return SUIT_ERR_DECODING;
+		}
+
+		state->varint |= ((uint64_t)(byte & 0x7F) << state->varint_shift);
+
+		if ((byte & 0x80) == 0) {
+			state->varint_shift = 0;
+			*complete = true;
+			break;
+		}
+
+		state->varint_shift += 7;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+static uint64_t varint_take(struct suit_delta_state *state)
+{
+	uint64_t value = state->varint;
+
+	state->varint = 0;
+
+	return value;
+}
+
+static size_t chunk_len(const struct suit_delta_state *state, const struct delta_buf *b)
+{
+	size_t len = state->remaining;
+
+	if (len > (b->in_size - b->in_pos)) {
+		len = b->in_size - b->in_pos;
+	}
+
+	if (len > (b->out_size - b->out_pos)) {
+		len = b->out_size - b->out_pos;
+	}
+
+	return len;
+}
+
+static enum delta_seq record_end(const struct suit_delta_state *state, enum delta_seq next)
+{
+	return (state->out_total == state->target_size) ? SEQ_FINISHED : next;
+}
+
+/* Move the base image position by the zigzag-encoded offset. */
+static int base_seek(struct suit_delta_state *state, uint64_t zigzag)
+{
+	uint64_t magnitude = (zigzag >> 1) + (zigzag & 1);
+
+	if ((zigzag & 1) != 0) {
+		if (magnitude > state->base_pos) {
+			return SUIT_ERR_DECODING;
+		}
+
+		state->base_pos -= (size_t)magnitude;
+	} else {
+		if (magnitude > (state->base_size - state->base_pos)) {
+			return SUIT_ERR_DECODING;
+		}
+
+		state->base_pos += (size_t)magnitude;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+static int delta_apply(struct suit_delta_state *state, struct delta_buf *b)
+{
+	bool complete;
+	uint64_t value;
+	size_t len;
+	int ret;
+
+	while (true) {
+		switch (state->sequence) {
+		case SEQ_MAGIC:
+			if (b->in_pos == b->in_size) {
+				return SUIT_ERR_AGAIN;
+			}
+
+			if (b->in[b->in_pos] != (uint8_t)SUIT_DELTA_MAGIC[MAGIC_LEN - state->remaining]) {
+				return SUIT_ERR_DECODING;
+			}
+
+			b->in_pos++;
+			state->remaining--;
+			if (state->remaining == 0) {
+				state->sequence = SEQ_TARGET_SIZE;
+			}
+			break;
+
+		case SEQ_TARGET_SIZE:
+			ret = varint_read(state, b, &complete);
+			if ((ret != SUIT_SUCCESS) || !complete) {
+				return (ret != SUIT_SUCCESS) ? ret : SUIT_ERR_AGAIN;
+			}
+
+			value = varint_take(state);
+			if (value > SIZE_MAX) {
+				return SUIT_ERR_DECODING;
+			}
+
+			state->target_size = (size_t)value;
+			state->sequence = record_end(state, SEQ_DIFF_LEN);
+			break;
+
+		case SEQ_DIFF_LEN:
+			ret = varint_read(state, b, &complete);
+			if ((ret != SUIT_SUCCESS) || !complete) {
+				return (ret != SUIT_SUCCESS) ? ret : SUIT_ERR_AGAIN;
+			}
+
+			value = varint_take(state);
+			if ((value > (state->target_size - state->out_total)) ||
+			    (value > (state->base_size - state->base_pos))) {
+				return SUIT_ERR_DECODING;
+			}
+
+			state->remaining = (size_t)value;
+			state->sequence = SEQ_DIFF;
+			break;
+
+		case SEQ_DIFF:
+			if (state->remaining == 0) {
+				state->sequence = SEQ_EXTRA_LEN;
+				break;
+			}
+
+			len = chunk_len(state, b);
+			if (len == 0) {
+				return SUIT_ERR_AGAIN;
+			}
+
+			/* Read the base image directly into the output buffer and add the diff bytes. */
+			ret = state->read_base(state->ctx, state->base_pos, &b->out[b->out_pos], len);
+			if (ret != SUIT_SUCCESS) {
+				return ret;
+			}
+
+			for (size_t i = 0; i < len; i++) {
+				b->out[b->out_pos + i] += b->in[b->in_pos + i];
+			}
+
+			b->in_pos += len;
+			b->out_pos += len;
+			state->base_pos += len;
+			state->out_total += len;
+			state->remaining -= len;
+			break;
+
+		case SEQ_EXTRA_LEN:
+			ret = varint_read(state, b, &complete);
+			if ((ret != SUIT_SUCCESS) || !complete) {
+				return (ret != SUIT_SUCCESS) ? ret : SUIT_ERR_AGAIN;
+			}
+
+			value = varint_take(state);
+			if (value > (state->target_size - state->out_total)) {
+				return SUIT_ERR_DECODING;
+			}
+
+			state->remaining = (size_t)value;
+			state->sequence = SEQ_EXTRA;
+			break;
+
+		case SEQ_EXTRA:
+			if (state->remaining == 0) {
+				state->sequence = record_end(state, SEQ_OFFSET);
+				break;
+			}
+
+			len = chunk_len(state, b);
+			if (len == 0) {
+				return SUIT_ERR_AGAIN;
+			}
+
+			memcpy(&b->out[b->out_pos], &b->in[b->in_pos], len);
+
+			b->in_pos += len;
+			b->out_pos += len;
+			state->out_total += len;
+			state->remaining -= len;
+			break;
+
+		case SEQ_OFFSET:
+			ret = varint_read(state, b, &complete);
+			if ((ret != SUIT_SUCCESS) || !complete) {
+				return (ret != SUIT_SUCCESS) ? ret : SUIT_ERR_AGAIN;
+			}
+
+			ret = base_seek(state, varint_take(state));
+			if (ret != SUIT_SUCCESS) {
+				return ret;
+			}
+
+			state->sequence = SEQ_DIFF_LEN;
+			break;
+
+		case SEQ_FINISHED:
+			return SUIT_SUCCESS;
+
+		default:
+			return SUIT_ERR_CRASH;
+		}
+	}
+}
+
+int suit_delta_init(struct suit_delta_state *state, suit_delta_read_base_t read_base, void *ctx,
+		    size_t base_size)
+{
+	if ((state == NULL) || (read_base == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	memset(state, 0, sizeof(*state));
+
+	state->read_base = read_base;
+	state->ctx = ctx;
+	state->base_size = base_size;
+	state->sequence = SEQ_MAGIC;
+	state->remaining = MAGIC_LEN;
+
+	return SUIT_SUCCESS;
+}
+
+int suit_delta_apply(struct suit_delta_state *state, const uint8_t *in, size_t *in_len,
+		     uint8_t *out, size_t *out_len)
+{
+	struct delta_buf b;
+
+	if ((state == NULL) || (state->read_base == NULL) || (in_len == NULL) || (out_len == NULL) ||
+	    ((in == NULL) && (*in_len > 0)) || ((out == NULL) && (*out_len > 0))) {
+		return SUIT_ERR_CRASH;
+	}
+
+	b.in = in;
+	b.in_pos = 0;
+	b.in_size = *in_len;
+	b.out = out;
+	b.out_pos = 0;
+	b.out_size = *out_len;
+
+	int ret = delta_apply(state, &b);
+	if ((ret != SUIT_SUCCESS) && (ret != SUIT_ERR_AGAIN)) {
+		return ret;
+	}
+
+	*in_len = b.in_pos;
+	*out_len = b.out_pos;
+
+	return ret;
+}
@@ -7,13 +7,19 @@
 #include <suit_types.h>
 #include <suit_platform.h>
 #include <suit_directive.h>
+#include <suit_condition.h>
 #include <suit_manifest.h>
 #include <suit_seq_exec.h>
 #include <suit_schedule_seq.h>
 #include <cose_encode.h>
 #include <cose_decode.h>
+#include <manifest_decode.h>
+#include <suit_trace.h>
+#include <suit_arena.h>
+#include <suit_memo.h>
 
 
+#ifndef SUIT_PRUNE_ENCRYPTION
 static const uint8_t suit_aad_aes256_gcm[] = {
 	0x83, /* array (3 elements) */
 		0x67, /* context: text (7 characters) */
@@ -24,15 +30,15 @@ static const uint8_t suit_aad_aes256_gcm[] = {
 		0x40 /* external_aad: h'' */
 };
 
-static int decode_encryption_info(struct zcbor_string enc_info_bstr, struct suit_encryption_info *enc_info)
+static int decode_encryption_info_with_scratch(struct COSE_Encrypt *enc_info_cbor, struct zcbor_string enc_info_bstr,
+					      struct suit_encryption_info *enc_info)
 {
-	struct COSE_Encrypt enc_info_cbor = { 0 };
 	size_t enc_info_size = 0;
 
 	int ret = cbor_decode_COSE_Encrypt_Tagged(
 			enc_info_bstr.value,
 			enc_info_bstr.len,
-			&enc_info_cbor,
+			enc_info_cbor,
 			&enc_info_size
 		);
 
@@ -41,18 +47,18 @@ static int decode_encryption_info(struct zcbor_string enc_info_bstr, struct suit
 	}
 
 	enc_info->enc_alg_id = suit_cose_aes256_gcm;
-	enc_info->IV = enc_info_cbor.COSE_Encrypt_unprotected.enc_header_map_IV;
+	enc_info->IV = enc_info_cbor->COSE_Encrypt_unprotected.enc_header_map_IV;
 	enc_info->aad.value = suit_aad_aes256_gcm;
 	enc_info->aad.len = sizeof(suit_aad_aes256_gcm);
 
-	enc_info->kw_alg_id = enc_info_cbor.COSE_Encrypt_recipients.COSE_recipients_protected_l_unprotected.rec_header_map_alg_id.supported_kdf_algs_choice;
+	enc_info->kw_alg_id = enc_info_cbor->COSE_Encrypt_recipients.COSE_recipients_protected_l_unprotected.rec_header_map_alg_id.supported_kdf_algs_choice;
 
 	switch (enc_info->kw_alg_id) {
 		case suit_cose_aes256_kw:
-			enc_info->kw_key.aes.key_id = enc_info_cbor.COSE_Encrypt_recipients.COSE_recipients_protected_l_unprotected.rec_header_map_key_id;
-			if (enc_info_cbor.COSE_Encrypt_recipients.COSE_recipients_protected_l_ciphertext_choice
+			enc_info->kw_key.aes.key_id = enc_info_cbor->COSE_Encrypt_recipients.COSE_recipients_protected_l_unprotected.rec_header_map_key_id;
+			if (enc_info_cbor->COSE_Encrypt_recipients.COSE_recipients_protected_l_ciphertext_choice
 				== COSE_recipients_protected_l_ciphertext_bstr_c) {
-				enc_info->kw_key.aes.ciphertext = enc_info_cbor.COSE_Encrypt_recipients.COSE_recipients_protected_l_ciphertext_bstr;
+				enc_info->kw_key.aes.ciphertext = enc_info_cbor->COSE_Encrypt_recipients.COSE_recipients_protected_l_ciphertext_bstr;
 			}
 			else
 			{
@@ -60,7 +66,7 @@ static int decode_encryption_info(struct zcbor_string enc_info_bstr, struct suit
 			}
 			break;
 		case suit_cose_direct:
-			enc_info->kw_key.direct.key_id = enc_info_cbor.COSE_Encrypt_recipients.COSE_recipients_protected_l_unprotected.rec_header_map_key_id;
+			enc_info->kw_key.direct.key_id = enc_info_cbor->COSE_Encrypt_recipients.COSE_recipients_protected_l_unprotected.rec_header_map_key_id;
 			break;
 		default:
 			return SUIT_ERR_UNSUPPORTED_ALG;
@@ -69,14 +75,273 @@ static int decode_encryption_info(struct zcbor_string enc_info_bstr, struct suit
 	return SUIT_SUCCESS;
 }
 
-static void component_modified(struct suit_manifest_params *component_params)
+static int decode_encryption_info(struct zcbor_string enc_info_bstr, struct suit_encryption_info *enc_info)
+{
+	size_t arena_mark = suit_arena_mark();
+	struct COSE_Encrypt *enc_info_cbor = suit_arena_alloc(sizeof(*enc_info_cbor));
+	struct suit_encryption_info decoded = {0};
+	int ret;
+
+	if (enc_info_cbor == NULL) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	/* Keep the previously decoded value if the new one is invalid. */
+	ret = decode_encryption_info_with_scratch(enc_info_cbor, enc_info_bstr, &decoded);
+	suit_arena_release(arena_mark);
+
+	if (ret == SUIT_SUCCESS) {
+		*enc_info = decoded;
+	}
+
+	return ret;
+}
+#endif /* SUIT_PRUNE_ENCRYPTION */
+
+static int decode_compression_info(struct zcbor_string comp_info_bstr, struct suit_compression_info *comp_info)
+{
+	struct SUIT_Compression_Info comp_info_cbor = { 0 };
+	size_t comp_info_size = 0;
+
+	int ret = cbor_decode_SUIT_Compression_Info(
+			comp_info_bstr.value,
+			comp_info_bstr.len,
+			&comp_info_cbor,
+			&comp_info_size
+		);
+
+	if ((ret != ZCBOR_SUCCESS) || (comp_info_size != comp_info_bstr.len)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	if (comp_info_cbor.SUIT_Compression_Info_suit_compression_algorithm != suit_lzma2) {
+		return SUIT_ERR_UNSUPPORTED_ALG;
+	}
+
+	comp_info->compression_alg_id = suit_lzma2;
+	comp_info->arm_thumb_filter = false;
+	comp_info->decompressed_image_size = 0;
+
+	if (comp_info_cbor.SUIT_Compression_Info_suit_compression_arm_thumb_filter_present) {
+		comp_info->arm_thumb_filter = comp_info_cbor
+			.SUIT_Compression_Info_suit_compression_arm_thumb_filter
+			.SUIT_Compression_Info_suit_compression_arm_thumb_filter;
+	}
+
+	if (comp_info_cbor.SUIT_Compression_Info_suit_compression_decompressed_size_present) {
+		comp_info->decompressed_image_size = comp_info_cbor
+			.SUIT_Compression_Info_suit_compression_decompressed_size
+			.SUIT_Compression_Info_suit_compression_decompressed_size;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+static int decode_digest(struct zcbor_string *digest_bstr, enum suit_cose_alg *alg_id, struct zcbor_string *digest)
+{
+	struct SUIT_Digest digest_cbor = {0};
+	size_t bytes_processed = 0;
+
+	int ret = cbor_decode_SUIT_Digest(digest_bstr->value, digest_bstr->len, &digest_cbor, &bytes_processed);
+
+	if ((ret != ZCBOR_SUCCESS) || (bytes_processed != digest_bstr->len)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	switch (digest_cbor.SUIT_Digest_suit_digest_algorithm_id.suit_cose_hash_algs_choice) {
+	case suit_cose_hash_algs_cose_alg_sha_256_m_c:
+		if (digest_cbor.SUIT_Digest_suit_digest_bytes.len != 32) {
+			return SUIT_ERR_DECODING;
+		}
+		break;
+	case suit_cose_hash_algs_cose_alg_sha_512_m_c:
+		if (digest_cbor.SUIT_Digest_suit_digest_bytes.len != 64) {
+			return SUIT_ERR_DECODING;
+		}
+		break;
+	default:
+		return SUIT_ERR_UNSUPPORTED_ALG;
+	}
+
+	*alg_id = digest_cbor.SUIT_Digest_suit_digest_algorithm_id.suit_cose_hash_algs_choice;
+	*digest = digest_cbor.SUIT_Digest_suit_digest_bytes;
+
+	return SUIT_SUCCESS;
+}
+
+static int decode_version_match(struct zcbor_string *version_bstr, struct suit_semver *version, unsigned int *comparison)
+{
+	struct SUIT_Parameter_Version_Match result = {0};
+	struct suit_semver decoded = {0};
+	size_t result_len = 0;
+
+	int ret = cbor_decode_SUIT_Parameter_Version_Match(
+		version_bstr->value,
+		version_bstr->len,
+		&result,
+		&result_len
+	);
+
+	if ((ret != ZCBOR_SUCCESS) || (result_len != version_bstr->len)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	decoded.count = result
+		.SUIT_Parameter_Version_Match_suit_condition_version_comparison_value
+		.SUIT_Condition_Version_Comparison_Value_int_count;
+	if (decoded.count > ZCBOR_ARRAY_SIZE(decoded.value)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	for (size_t i = 0; i < decoded.count; i++) {
+		decoded.value[i] = result
+			.SUIT_Parameter_Version_Match_suit_condition_version_comparison_value
+			.SUIT_Condition_Version_Comparison_Value_int[i];
+	}
+
+	*version = decoded;
+	*comparison = result
+		.SUIT_Parameter_Version_Match_suit_condition_version_comparison_type
+		.SUIT_Condition_Version_Comparison_Types_choice;
+
+	return SUIT_SUCCESS;
+}
+
+/** @brief Get the encryption info, decoded when the parameter was set, or NULL if it is not set. */
+static struct suit_encryption_info *get_encryption_info(struct suit_manifest_params *component_params)
 {
+#ifndef SUIT_PRUNE_ENCRYPTION
+	if (suit_param_is_set(component_params, SUIT_PARAM_ENCRYPTION_INFO)) {
+		return &component_params->decoded.enc_info;
+	}
+#endif /* SUIT_PRUNE_ENCRYPTION */
+
+	return NULL;
+}
+
+/** @brief Get the compression info, decoded when the parameter was set, or NULL if it is not set. */
+static struct suit_compression_info *get_compression_info(struct suit_manifest_params *component_params)
+{
+	if (suit_param_is_set(component_params, SUIT_PARAM_COMPRESSION_INFO)) {
+		return &component_params->decoded.comp_info;
+	}
+
+	return NULL;
+}
+
+#ifdef SUIT_SKIP_MATCHING_PAYLOADS
+/** @brief Check if the destination component already contains the image with the expected digest.
+ *
+ * @details The image match condition is evaluated, so the memoized result is used if available.
+ *          A component without the image digest parameter never matches.
+ */
+static bool destination_matches(struct suit_processor_state *state,
+				struct suit_manifest_params *component_params)
+{
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+	/* The conditions always pass during the dry run, so the operation has to be checked. */
+	if (state->dry_run != suit_bool_false) {
+		return false;
+	}
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
+	if (!suit_param_is_set(component_params, SUIT_PARAM_IMAGE_DIGEST)) {
+		return false;
+	}
+
+	if (suit_condition_image_match(state, component_params) != SUIT_SUCCESS) {
+		return false;
+	}
+
+	SUIT_DBG("Destination already matches the image digest (handle: 0x%lx)\r\n",
+		 component_params->component_handle);
+
+	return true;
+}
+#endif /* SUIT_SKIP_MATCHING_PAYLOADS */
+
+#ifdef SUIT_DEDUP_PAYLOADS
+/** @brief Find another component, that contains the verified image to be fetched.
+ *
+ * @returns true if the image may be copied from the source component instead of being fetched.
+ */
+static bool find_fetched_copy(struct suit_processor_state *state,
+			      struct suit_manifest_params *component_params,
+			      suit_component_t *src_handle)
+{
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+	/* The images are not verified during the dry run, so the fetch has to be checked. */
+	if (state->dry_run != suit_bool_false) {
+		return false;
+	}
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
+	return (suit_condition_find_verified_image(state, component_params, src_handle) == SUIT_SUCCESS);
+}
+#endif /* SUIT_DEDUP_PAYLOADS */
+
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+/** @brief Add the operation, accepted by the dry run, to the requested plan.
+ *
+ * @param[in]  size  The number of written bytes, used if the image size is not set.
+ */
+static int plan_record(struct suit_processor_state *state, enum suit_plan_op_type type,
+		       struct suit_manifest_params *component_params, suit_component_t src_handle,
+		       size_t size)
+{
+	struct suit_encryption_info *enc_info = get_encryption_info(component_params);
+	struct suit_plan_op op = {
+		.type = type,
+		.dst_handle = component_params->component_handle,
+		.src_handle = src_handle,
+		.size = size,
+	};
+
+	if (state->plan == NULL) {
+		return SUIT_SUCCESS;
+	}
+
+	op.seq = state->plan->seq;
+
+	if (((type == SUIT_PLAN_OP_FETCH) || (type == SUIT_PLAN_OP_FETCH_INTEGRATED)) &&
+	    suit_param_is_set(component_params, SUIT_PARAM_URI)) {
+		op.uri = component_params->uri;
+	}
+
+	if ((type != SUIT_PLAN_OP_INVOKE) && suit_param_is_set(component_params, SUIT_PARAM_IMAGE_SIZE)) {
+		op.size = component_params->image_size;
+	}
+
+	if (enc_info != NULL) {
+		op.encrypted = true;
+		op.enc_alg_id = enc_info->enc_alg_id;
+	}
+
+	return suit_plan_record(state->plan, &op);
+}
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
+static void component_modified(struct suit_processor_state *state, struct suit_manifest_params *component_params)
+{
+	if ((state == NULL) || (component_params == NULL)) {
+		return;
+	}
+
+	/* The memoized condition results describe the previous contents of the component. */
+	suit_memo_drop(component_params->component_handle);
+
 	/* Reset integrity validation flag, whenever the dependency component is modified.
 	 * This is required, so each manifest processed through CAND_MFST component must be
 	 * checked for integrity before processing.
 	 */
-	if ((component_params != NULL) && (component_params->is_dependency == suit_bool_true)) {
+	if (component_params->is_dependency == suit_bool_true) {
 		component_params->integrity_checked = false;
+
+		/* The parameters of the components, referenced by the dependency manifest, may point
+		 * to the previous contents of the component. The references are not tracked, so
+		 * the results of all components are dropped.
+		 */
+		suit_memo_drop_all();
 	}
 }
 
@@ -215,30 +480,38 @@ int suit_directive_run_sequence(struct suit_processor_state *state, struct zcbor
 	return seq_exec_state->retval;
 }
 
-static int suit_directive_override_parameter(struct SUIT_Parameters_r *param, struct suit_manifest_params *dst, struct zcbor_string *manifest_component_id)
+static int suit_directive_override_parameter(struct suit_processor_state *state, struct SUIT_Parameters_r *param, struct suit_manifest_params *dst, struct zcbor_string *manifest_component_id)
 {
 	switch (param->SUIT_Parameters_choice) {
 	case SUIT_Parameters_suit_parameter_vendor_identifier_c:
 		SUIT_DBG("Override VID (handle: 0x%lx)\r\n", dst->component_handle);
 		memcpy(&dst->vid, &param->SUIT_Parameters_suit_parameter_vendor_identifier, sizeof(dst->vid));
-		dst->vid_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_VID, true);
 		break;
 	case SUIT_Parameters_suit_parameter_class_identifier_c:
 		SUIT_DBG("Override CID (handle: 0x%lx)\r\n", dst->component_handle);
 		memcpy(&dst->cid, &param->SUIT_Parameters_suit_parameter_class_identifier, sizeof(dst->cid));
-		dst->cid_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_CID, true);
 		break;
-	case SUIT_Parameters_suit_parameter_image_digest_c:
+	case SUIT_Parameters_suit_parameter_image_digest_c: {
+		int ret = decode_digest(&param->SUIT_Parameters_suit_parameter_image_digest,
+					&dst->decoded.image_digest_alg, &dst->decoded.image_digest_bytes);
+		if (ret != SUIT_SUCCESS) {
+			SUIT_ERR("Failed to override digest: invalid value (handle: 0x%lx)\r\n", dst->component_handle);
+			return ret;
+		}
+
 		SUIT_DBG("Override digest (handle: 0x%lx)\r\n", dst->component_handle);
 		memcpy(&dst->image_digest, &param->SUIT_Parameters_suit_parameter_image_digest, sizeof(dst->image_digest));
-		dst->image_digest_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_IMAGE_DIGEST, true);
 		break;
+	}
 	case SUIT_Parameters_suit_parameter_image_size_c: {
-		int ret = suit_plat_override_image_size(dst->component_handle, param->SUIT_Parameters_suit_parameter_image_size, manifest_component_id);
+		int ret = SUIT_TRACE(SUIT_TRACE_PLAT_OVERRIDE_IMAGE_SIZE, suit_plat_override_image_size(dst->component_handle, param->SUIT_Parameters_suit_parameter_image_size, manifest_component_id));
 		if (ret == SUIT_SUCCESS) {
 			SUIT_DBG("Override image size (handle: 0x%lx)\r\n", dst->component_handle);
 			dst->image_size = param->SUIT_Parameters_suit_parameter_image_size;
-			dst->image_size_set = true;
+			suit_param_set_flag(dst, SUIT_PARAM_IMAGE_SIZE, true);
 		} else {
 			SUIT_DBG("Unable to override image size (handle: 0x%lx, status: %d)\r\n", dst->component_handle, ret);
 			return ret;
@@ -247,43 +520,92 @@ static int suit_directive_override_parameter(struct SUIT_Parameters_r *param, st
 	case SUIT_Parameters_suit_parameter_content_c:
 		SUIT_DBG("Override content parameter (handle: 0x%lx)\r\n", dst->component_handle);
 		memcpy(&dst->content, &param->SUIT_Parameters_suit_parameter_content, sizeof(dst->content));
-		dst->content_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_CONTENT, true);
 		break;
 	case SUIT_Parameters_suit_parameter_component_slot_c:
 		SUIT_DBG("Override slot (handle: 0x%lx)\r\n", dst->component_handle);
-		component_modified(dst);
+		component_modified(state, dst);
 		dst->component_slot = param->SUIT_Parameters_suit_parameter_component_slot;
-		dst->component_slot_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_COMPONENT_SLOT, true);
 		break;
 	case SUIT_Parameters_suit_parameter_uri_c:
 		SUIT_DBG("Override URI (handle: 0x%lx)\r\n", dst->component_handle);
 		memcpy(&dst->uri, &param->SUIT_Parameters_suit_parameter_uri, sizeof(dst->uri));
-		dst->uri_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_URI, true);
 		break;
 	case SUIT_Parameters_suit_parameter_source_component_c:
 		SUIT_DBG("Override source component (handle: 0x%lx)\r\n", dst->component_handle);
 		dst->source_component = param->SUIT_Parameters_suit_parameter_source_component;
-		dst->source_component_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_SOURCE_COMPONENT, true);
 		break;
 	case SUIT_Parameters_suit_parameter_invoke_args_c:
 		SUIT_DBG("Override invoke args (handle: 0x%lx)\r\n", dst->component_handle);
 		dst->invoke_args = param->SUIT_Parameters_suit_parameter_invoke_args;
-		dst->invoke_args_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_INVOKE_ARGS, true);
 		break;
 	case SUIT_Parameters_suit_parameter_device_identifier_c:
 		SUIT_DBG("Override DID (handle: 0x%lx)\r\n", dst->component_handle);
 		memcpy(&dst->did, &param->SUIT_Parameters_suit_parameter_device_identifier, sizeof(dst->did));
-		dst->did_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_DID, true);
 		break;
-	case SUIT_Parameters_suit_parameter_version_c:
+	case SUIT_Parameters_suit_parameter_version_c: {
+		int ret = decode_version_match(&param->SUIT_Parameters_suit_parameter_version,
+					       &dst->decoded.version, &dst->decoded.version_comparison);
+		if (ret != SUIT_SUCCESS) {
+			SUIT_ERR("Failed to override version: invalid value (handle: 0x%lx)\r\n", dst->component_handle);
+			return ret;
+		}
+
 		SUIT_DBG("Override version (handle: 0x%lx)\r\n", dst->component_handle);
 		memcpy(&dst->version, &param->SUIT_Parameters_suit_parameter_version, sizeof(dst->version));
-		dst->version_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_VERSION, true);
 		break;
-	case SUIT_Parameters_suit_parameter_encryption_info_c:
+	}
+#ifndef SUIT_PRUNE_ENCRYPTION
+	case SUIT_Parameters_suit_parameter_encryption_info_c: {
+		int ret = decode_encryption_info(param->SUIT_Parameters_suit_parameter_encryption_info,
+						 &dst->decoded.enc_info);
+		if (ret != SUIT_SUCCESS) {
+			SUIT_ERR("Failed to override encryption info: invalid value (handle: 0x%lx)\r\n", dst->component_handle);
+			return ret;
+		}
+
 		SUIT_DBG("Override encryption info (handle: 0x%lx)\r\n", dst->component_handle);
 		dst->encryption_info = param->SUIT_Parameters_suit_parameter_encryption_info;
-		dst->encryption_info_set = true;
+		suit_param_set_flag(dst, SUIT_PARAM_ENCRYPTION_INFO, true);
+		break;
+	}
+#endif /* SUIT_PRUNE_ENCRYPTION */
+	case SUIT_Parameters_suit_parameter_custom_compression_info_c: {
+		int ret = decode_compression_info(param->SUIT_Parameters_suit_parameter_custom_compression_info,
+						  &dst->decoded.comp_info);
+		if (ret != SUIT_SUCCESS) {
+			SUIT_ERR("Failed to override compression info: invalid value (handle: 0x%lx)\r\n", dst->component_handle);
+			return ret;
+		}
+
+		SUIT_DBG("Override compression info (handle: 0x%lx)\r\n", dst->component_handle);
+		dst->compression_info = param->SUIT_Parameters_suit_parameter_custom_compression_info;
+		suit_param_set_flag(dst, SUIT_PARAM_COMPRESSION_INFO, true);
+		break;
+	}
+	case SUIT_Parameters_suit_parameter_custom_base_digest_c: {
+		int ret = decode_digest(&param->SUIT_Parameters_suit_parameter_custom_base_digest,
+					&dst->decoded.base_digest_alg, &dst->decoded.base_digest_bytes);
+		if (ret != SUIT_SUCCESS) {
+			SUIT_ERR("Failed to override base digest: invalid value (handle: 0x%lx)\r\n", dst->component_handle);
+			return ret;
+		}
+
+		SUIT_DBG("Override base digest (handle: 0x%lx)\r\n", dst->component_handle);
+		dst->base_digest = param->SUIT_Parameters_suit_parameter_custom_base_digest;
+		suit_param_set_flag(dst, SUIT_PARAM_BASE_DIGEST, true);
+		break;
+	}
+	case SUIT_Parameters_suit_parameter_custom_patch_component_c:
+		SUIT_DBG("Override patch component (handle: 0x%lx)\r\n", dst->component_handle);
+		dst->patch_component = param->SUIT_Parameters_suit_parameter_custom_patch_component;
+		suit_param_set_flag(dst, SUIT_PARAM_PATCH_COMPONENT, true);
 		break;
 	default:
 		return SUIT_ERR_UNSUPPORTED_PARAMETER;
@@ -336,7 +658,7 @@ int suit_directive_override_parameters(struct suit_processor_state *state,
 				return retval;
 			}
 
-			retval = suit_directive_override_parameter(param, component_params, &seq_exec_state->manifest->manifest_component_id);
+			retval = suit_directive_override_parameter(state, param, component_params, &seq_exec_state->manifest->manifest_component_id);
 			/* Command finished - execute it for the next component. */
 			if (retval != SUIT_ERR_AGAIN) {
 				int ret = suit_seq_exec_component_idx_next(seq_exec_state, &component_idx);
@@ -357,53 +679,64 @@ int suit_directive_override_parameters(struct suit_processor_state *state,
 	return retval;
 }
 
-static int suit_directive_set_parameter(struct SUIT_Parameters_r *param, struct suit_manifest_params *dst, struct zcbor_string *manifest_component_id)
+static int suit_directive_set_parameter(struct suit_processor_state *state, struct SUIT_Parameters_r *param, struct suit_manifest_params *dst, struct zcbor_string *manifest_component_id)
 {
 	bool parameter_set = false;
 
 	switch (param->SUIT_Parameters_choice) {
 	case SUIT_Parameters_suit_parameter_vendor_identifier_c:
-		parameter_set = dst->vid_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_VID);
 		break;
 	case SUIT_Parameters_suit_parameter_class_identifier_c:
-		parameter_set = dst->cid_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_CID);
 		break;
 	case SUIT_Parameters_suit_parameter_image_digest_c:
-		parameter_set = dst->image_digest_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_IMAGE_DIGEST);
 		break;
 	case SUIT_Parameters_suit_parameter_image_size_c:
-		parameter_set = dst->image_size_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_IMAGE_SIZE);
 		break;
 	case SUIT_Parameters_suit_parameter_content_c:
-		parameter_set = dst->content_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_CONTENT);
 		break;
 	case SUIT_Parameters_suit_parameter_component_slot_c:
-		parameter_set = dst->component_slot_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_COMPONENT_SLOT);
 		break;
 	case SUIT_Parameters_suit_parameter_uri_c:
-		parameter_set = dst->uri_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_URI);
 		break;
 	case SUIT_Parameters_suit_parameter_source_component_c:
-		parameter_set = dst->source_component_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_SOURCE_COMPONENT);
 		break;
 	case SUIT_Parameters_suit_parameter_invoke_args_c:
-		parameter_set = dst->invoke_args_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_INVOKE_ARGS);
 		break;
 	case SUIT_Parameters_suit_parameter_device_identifier_c:
-		parameter_set = dst->did_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_DID);
 		break;
 	case SUIT_Parameters_suit_parameter_version_c:
-		parameter_set = dst->version_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_VERSION);
 		break;
+#ifndef SUIT_PRUNE_ENCRYPTION
 	case SUIT_Parameters_suit_parameter_encryption_info_c:
-		parameter_set = dst->encryption_info_set;
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_ENCRYPTION_INFO);
+		break;
+#endif /* SUIT_PRUNE_ENCRYPTION */
+	case SUIT_Parameters_suit_parameter_custom_compression_info_c:
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_COMPRESSION_INFO);
+		break;
+	case SUIT_Parameters_suit_parameter_custom_base_digest_c:
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_BASE_DIGEST);
+		break;
+	case SUIT_Parameters_suit_parameter_custom_patch_component_c:
+		parameter_set = suit_param_is_set(dst, SUIT_PARAM_PATCH_COMPONENT);
 		break;
 	default:
 		return SUIT_ERR_UNSUPPORTED_PARAMETER;
 	}
 
 	if (parameter_set == false) {
-		return suit_directive_override_parameter(param, dst, manifest_component_id);
+		return suit_directive_override_parameter(state, param, dst, manifest_component_id);
 	}
 
 	return SUIT_SUCCESS;
@@ -430,7 +763,7 @@ int suit_directive_set_parameters(struct suit_processor_state *state,
 		struct SUIT_Parameters_r *param = &params[j].suit_directive_set_parameters_m_l_map_SUIT_Parameters_m;
 		SUIT_DBG("Set parameter %d (handle: 0x%lx)\r\n", param->SUIT_Parameters_choice, component_params->component_handle);
 
-		retval = suit_directive_set_parameter(param, component_params, &seq_exec_state->manifest->manifest_component_id);
+		retval = suit_directive_set_parameter(state, param, component_params, &seq_exec_state->manifest->manifest_component_id);
 		if (retval == SUIT_ERR_AGAIN) {
 			/* Setting parameters must not use execution stack to take place. */
 			retval = SUIT_ERR_TAMP;
@@ -444,6 +777,55 @@ int suit_directive_set_parameters(struct suit_processor_state *state,
 	return retval;
 }
 
+int suit_directive_decode_parameters(struct suit_manifest_params *params)
+{
+	int ret = SUIT_SUCCESS;
+
+	if (params == NULL) {
+		return SUIT_ERR_DECODING;
+	}
+
+	if (suit_param_is_set(params, SUIT_PARAM_IMAGE_DIGEST)) {
+		ret = decode_digest(&params->image_digest, &params->decoded.image_digest_alg,
+				    &params->decoded.image_digest_bytes);
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+	}
+
+	if (suit_param_is_set(params, SUIT_PARAM_VERSION)) {
+		ret = decode_version_match(&params->version, &params->decoded.version,
+					   &params->decoded.version_comparison);
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+	}
+
+#ifndef SUIT_PRUNE_ENCRYPTION
+	if (suit_param_is_set(params, SUIT_PARAM_ENCRYPTION_INFO)) {
+		ret = decode_encryption_info(params->encryption_info, &params->decoded.enc_info);
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+	}
+#endif /* SUIT_PRUNE_ENCRYPTION */
+
+	if (suit_param_is_set(params, SUIT_PARAM_COMPRESSION_INFO)) {
+		ret = decode_compression_info(params->compression_info, &params->decoded.comp_info);
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+	}
+
+	if (suit_param_is_set(params, SUIT_PARAM_BASE_DIGEST)) {
+		ret = decode_digest(&params->base_digest, &params->decoded.base_digest_alg,
+				    &params->decoded.base_digest_bytes);
+	}
+
+	return ret;
+}
+
+#ifndef SUIT_PRUNE_DEPENDENCIES
 int suit_directive_process_dependency(struct suit_processor_state *state, struct suit_manifest_params *component_params)
 {
 	const uint8_t *envelope_str = NULL;
@@ -493,21 +875,29 @@ int suit_directive_process_dependency(struct suit_processor_state *state, struct
 		}
 
 	} else if (seq_exec_state->cmd_exec_state == SUIT_SEQ_EXEC_DEFAULT_STATE) {
-		/** Return a pointer to the manifest contents, stored inside the component. */
-		retval = suit_plat_retrieve_manifest(component_params->component_handle, &envelope_str, &envelope_len);
+		int next_state = SUIT_SEQ_SHARED;
 
-		if (retval == SUIT_SUCCESS) {
-			retval = suit_processor_load_envelope(state, envelope_str, envelope_len);
+		if (suit_processor_unpin_manifest(state, component_params)) {
+			/* The manifest was already authenticated and validated by the integrity check. */
+			SUIT_DBG("Reuse pinned manifest\r\n");
+			next_state = SUIT_SEQ_MAX;
+		} else {
+			/** Return a pointer to the manifest contents, stored inside the component. */
+			retval = SUIT_TRACE(SUIT_TRACE_PLAT_RETRIEVE_MANIFEST, suit_plat_retrieve_manifest(component_params->component_handle, &envelope_str, &envelope_len));
+
+			if (retval == SUIT_SUCCESS) {
+				retval = suit_processor_load_envelope(state, envelope_str, envelope_len);
+			}
 		}
 
 		if (retval == SUIT_SUCCESS) {
 			/* Change state to mark that the manifest stack was populated. */
-			seq_exec_state->cmd_exec_state = SUIT_SEQ_SHARED;
+			seq_exec_state->cmd_exec_state = next_state;
 			SUIT_DBG("Authorize execution of sequence\r\n");
-			retval = suit_plat_authorize_process_dependency(
+			retval = SUIT_TRACE(SUIT_TRACE_PLAT_AUTHORIZE_PROCESS_DEPENDENCY, suit_plat_authorize_process_dependency(
 				&state->manifest_stack[state->manifest_stack_height - 2].manifest_component_id,
 				&state->manifest_stack[state->manifest_stack_height - 1].manifest_component_id,
-				state->current_seq);
+				state->current_seq));
 		}
 
 		if (retval == SUIT_SUCCESS) {
@@ -557,10 +947,10 @@ int suit_directive_process_dependency(struct suit_processor_state *state, struct
 
 	} else if (seq_exec_state->cmd_exec_state == SUIT_SEQ_MAX + 2) {
 		if (seq_exec_state->retval == SUIT_SUCCESS) {
-			seq_exec_state->retval = suit_plat_sequence_completed(state->current_seq,
+			seq_exec_state->retval = SUIT_TRACE(SUIT_TRACE_PLAT_SEQUENCE_COMPLETED, suit_plat_sequence_completed(state->current_seq,
 				&manifest_state->manifest_component_id,
 				manifest_state->envelope_str.value,
-				manifest_state->envelope_str.len);
+				manifest_state->envelope_str.len));
 		}
 		if (seq_exec_state->retval != SUIT_ERR_AGAIN) {
 			SUIT_DBG("Command sequence %d executed. Status: %d\r\n", state->current_seq, seq_exec_state->retval);
@@ -588,11 +978,13 @@ int suit_directive_process_dependency(struct suit_processor_state *state, struct
 
 	return retval;
 }
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 
+#ifndef SUIT_PRUNE_FETCH
 int suit_directive_fetch(struct suit_processor_state *state, struct suit_manifest_params *component_params)
 {
-	struct suit_encryption_info enc_info_struct = {0};
-	struct suit_encryption_info *enc_info = NULL;
+	struct suit_encryption_info *enc_info = get_encryption_info(component_params);
+	struct suit_compression_info *comp_info = get_compression_info(component_params);
 	struct suit_seq_exec_state *seq_exec_state;
 	bool integrated = false;
 	struct zcbor_string integrated_payload;
@@ -603,19 +995,15 @@ int suit_directive_fetch(struct suit_processor_state *state, struct suit_manifes
 		return SUIT_ERR_DECODING;
 	}
 
-	if (!component_params->uri_set) {
+	if (!suit_param_is_set(component_params, SUIT_PARAM_URI)) {
 		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
 	}
 
-	if (component_params->encryption_info_set) {
-		int ret = decode_encryption_info(component_params->encryption_info, &enc_info_struct);
-
-		if (ret != SUIT_SUCCESS) {
-			return ret;
-		}
-
-		enc_info = &enc_info_struct;
+#ifdef SUIT_SKIP_MATCHING_PAYLOADS
+	if (destination_matches(state, component_params)) {
+		return SUIT_SUCCESS;
 	}
+#endif /* SUIT_SKIP_MATCHING_PAYLOADS */
 
 	ret = suit_seq_exec_state_get(state, &seq_exec_state);
 	if (ret != SUIT_SUCCESS) {
@@ -627,45 +1015,74 @@ int suit_directive_fetch(struct suit_processor_state *state, struct suit_manifes
 		integrated = true;
 	}
 
+#ifdef SUIT_DEDUP_PAYLOADS
+	suit_component_t src_handle;
+
+	/* The verified image is already stored by another component, so copy it instead of
+	 * downloading it again. The source contains the decrypted and decompressed image.
+	 * Only the fetch was checked by the dry run, so it is used if the copy fails.
+	 */
+	if (!integrated && find_fetched_copy(state, component_params, &src_handle)) {
+		SUIT_DBG("Copy the fetched image (handle: 0x%lx -> 0x%lx)\r\n", src_handle,
+			 component_params->component_handle);
+		component_modified(state, component_params);
+		ret = SUIT_TRACE(SUIT_TRACE_PLAT_COPY, suit_plat_copy(component_params->component_handle, src_handle,
+				      &seq_exec_state->manifest->manifest_component_id, NULL, NULL));
+		if (ret == SUIT_SUCCESS) {
+			return ret;
+		}
+
+		SUIT_WRN("Unable to copy the fetched image (%d), fetch it instead\r\n", ret);
+	}
+#endif /* SUIT_DEDUP_PAYLOADS */
+
 	if (!integrated) {
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 		if (state->dry_run != suit_bool_false) {
-			ret = suit_plat_check_fetch(component_params->component_handle, &component_params->uri,
-						    &seq_exec_state->manifest->manifest_component_id, enc_info);
+			ret = SUIT_TRACE(SUIT_TRACE_PLAT_DRY_RUN, suit_plat_check_fetch(component_params->component_handle, &component_params->uri,
+						    &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
+			if (ret == SUIT_SUCCESS) {
+				ret = plan_record(state, SUIT_PLAN_OP_FETCH, component_params, 0, 0);
+			}
 		} else {
-			component_modified(component_params);
-			ret = suit_plat_fetch(component_params->component_handle, &component_params->uri,
-					      &seq_exec_state->manifest->manifest_component_id, enc_info);
+			component_modified(state, component_params);
+			ret = SUIT_TRACE(SUIT_TRACE_PLAT_FETCH, suit_plat_fetch(component_params->component_handle, &component_params->uri,
+					      &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
 		}
 #else /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
-		component_modified(component_params);
-		ret = suit_plat_fetch(component_params->component_handle, &component_params->uri,
-				      &seq_exec_state->manifest->manifest_component_id, enc_info);
+		component_modified(state, component_params);
+		ret = SUIT_TRACE(SUIT_TRACE_PLAT_FETCH, suit_plat_fetch(component_params->component_handle, &component_params->uri,
+				      &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 	} else {
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 		if (state->dry_run != suit_bool_false) {
-			ret = suit_plat_check_fetch_integrated(component_params->component_handle, &integrated_payload,
-							       &seq_exec_state->manifest->manifest_component_id, enc_info);
+			ret = SUIT_TRACE(SUIT_TRACE_PLAT_DRY_RUN, suit_plat_check_fetch_integrated(component_params->component_handle, &integrated_payload,
+							       &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
+			if (ret == SUIT_SUCCESS) {
+				ret = plan_record(state, SUIT_PLAN_OP_FETCH_INTEGRATED, component_params, 0,
+						  integrated_payload.len);
+			}
 		} else {
-			component_modified(component_params);
-			ret = suit_plat_fetch_integrated(component_params->component_handle, &integrated_payload,
-							 &seq_exec_state->manifest->manifest_component_id, enc_info);
+			component_modified(state, component_params);
+			ret = SUIT_TRACE(SUIT_TRACE_PLAT_FETCH_INTEGRATED, suit_plat_fetch_integrated(component_params->component_handle, &integrated_payload,
+							 &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
 		}
 #else /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
-		component_modified(component_params);
-		ret = suit_plat_fetch_integrated(component_params->component_handle, &integrated_payload,
-						 &seq_exec_state->manifest->manifest_component_id, enc_info);
+		component_modified(state, component_params);
+		ret = SUIT_TRACE(SUIT_TRACE_PLAT_FETCH_INTEGRATED, suit_plat_fetch_integrated(component_params->component_handle, &integrated_payload,
+						 &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 	}
 
 	return ret;
 }
+#endif /* SUIT_PRUNE_FETCH */
 
 int suit_directive_copy(struct suit_processor_state *state, struct suit_manifest_params *component_params)
 {
-	struct suit_encryption_info enc_info_struct = {0};
-	struct suit_encryption_info *enc_info = NULL;
+	struct suit_encryption_info *enc_info = get_encryption_info(component_params);
+	struct suit_compression_info *comp_info = get_compression_info(component_params);
 	struct suit_seq_exec_state *seq_exec_state;
 	suit_component_t dst_handle;
 	suit_component_t src_handle;
@@ -682,47 +1099,48 @@ int suit_directive_copy(struct suit_processor_state *state, struct suit_manifest
 
 	dst_handle = component_params->component_handle;
 
-	if (!component_params->source_component_set) {
+	if (!suit_param_is_set(component_params, SUIT_PARAM_SOURCE_COMPONENT)) {
 		return SUIT_ERR_UNAVAILABLE_PARAMETER;
 	}
 
-	if (component_params->encryption_info_set) {
-		int ret = decode_encryption_info(component_params->encryption_info, &enc_info_struct);
-
-		if (ret != SUIT_SUCCESS) {
-			return ret;
-		}
-
-		enc_info = &enc_info_struct;
-	}
-
 	ret = suit_exec_component_handle_from_idx(seq_exec_state, component_params->source_component, &src_handle);
 	if (ret != SUIT_SUCCESS) {
 		return ret;
 	}
 
+#ifdef SUIT_SKIP_MATCHING_PAYLOADS
+	if (destination_matches(state, component_params)) {
+		return SUIT_SUCCESS;
+	}
+#endif /* SUIT_SKIP_MATCHING_PAYLOADS */
+
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 	if (state->dry_run != suit_bool_false) {
-		return suit_plat_check_copy(dst_handle, src_handle,
+		ret = SUIT_TRACE(SUIT_TRACE_PLAT_DRY_RUN, suit_plat_check_copy(dst_handle, src_handle,
 					    &seq_exec_state->manifest->manifest_component_id,
-					    enc_info);
+					    enc_info, comp_info));
+		if (ret == SUIT_SUCCESS) {
+			ret = plan_record(state, SUIT_PLAN_OP_COPY, component_params, src_handle, 0);
+		}
+
+		return ret;
 	} else {
-		component_modified(component_params);
-		return suit_plat_copy(dst_handle, src_handle,
+		component_modified(state, component_params);
+		return SUIT_TRACE(SUIT_TRACE_PLAT_COPY, suit_plat_copy(dst_handle, src_handle,
 				      &seq_exec_state->manifest->manifest_component_id,
-				      enc_info);
+				      enc_info, comp_info));
 	}
 #else /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
-	component_modified(component_params);
-	return suit_plat_copy(dst_handle, src_handle,
-			      &seq_exec_state->manifest->manifest_component_id, enc_info);
+	component_modified(state, component_params);
+	return SUIT_TRACE(SUIT_TRACE_PLAT_COPY, suit_plat_copy(dst_handle, src_handle,
+			      &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 }
 
 int suit_directive_write(struct suit_processor_state *state, struct suit_manifest_params *component_params)
 {
-	struct suit_encryption_info enc_info_struct = {0};
-	struct suit_encryption_info *enc_info = NULL;
+	struct suit_encryption_info *enc_info = get_encryption_info(component_params);
+	struct suit_compression_info *comp_info = get_compression_info(component_params);
 	struct suit_seq_exec_state *seq_exec_state;
 	int ret = SUIT_SUCCESS;
 
@@ -731,20 +1149,10 @@ int suit_directive_write(struct suit_processor_state *state, struct suit_manifes
 		return SUIT_ERR_DECODING;
 	}
 
-	if (!component_params->content_set) {
+	if (!suit_param_is_set(component_params, SUIT_PARAM_CONTENT)) {
 		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
 	}
 
-	if (component_params->encryption_info_set) {
-		ret = decode_encryption_info(component_params->encryption_info, &enc_info_struct);
-
-		if (ret != SUIT_SUCCESS) {
-			return ret;
-		}
-
-		enc_info = &enc_info_struct;
-	}
-
 	ret = suit_seq_exec_state_get(state, &seq_exec_state);
 	if (ret != SUIT_SUCCESS) {
 		return ret;
@@ -752,28 +1160,163 @@ int suit_directive_write(struct suit_processor_state *state, struct suit_manifes
 
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 		if (state->dry_run != suit_bool_false) {
-			return suit_plat_check_write(component_params->component_handle, &component_params->content,
-						     &seq_exec_state->manifest->manifest_component_id, enc_info);
+			ret = SUIT_TRACE(SUIT_TRACE_PLAT_DRY_RUN, suit_plat_check_write(component_params->component_handle, &component_params->content,
+						     &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
+			if (ret == SUIT_SUCCESS) {
+				ret = plan_record(state, SUIT_PLAN_OP_WRITE, component_params, 0,
+						  component_params->content.len);
+			}
+
+			return ret;
 		} else {
-			component_modified(component_params);
-			return suit_plat_write(component_params->component_handle, &component_params->content,
-					       &seq_exec_state->manifest->manifest_component_id, enc_info);
+			component_modified(state, component_params);
+			return SUIT_TRACE(SUIT_TRACE_PLAT_WRITE, suit_plat_write(component_params->component_handle, &component_params->content,
+					       &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
 		}
 #else /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
-		component_modified(component_params);
-		return suit_plat_write(component_params->component_handle, &component_params->content,
-				       &seq_exec_state->manifest->manifest_component_id, enc_info);
+		component_modified(state, component_params);
+		return SUIT_TRACE(SUIT_TRACE_PLAT_WRITE, suit_plat_write(component_params->component_handle, &component_params->content,
+				       &seq_exec_state->manifest->manifest_component_id, enc_info, comp_info));
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 }
 
 int suit_directive_swap(struct suit_processor_state *state, struct suit_manifest_params *component_params)
 {
+	struct suit_encryption_info *enc_info = get_encryption_info(component_params);
+	struct suit_seq_exec_state *seq_exec_state;
+	struct suit_manifest_params *src_params;
+
 	if ((state == NULL) || (component_params == NULL)) {
 		SUIT_ERR("Unable to execute swap directive: invalid argument\r\n");
 		return SUIT_ERR_DECODING;
 	}
 
-	return SUIT_ERR_UNSUPPORTED_COMMAND;
+	int ret = suit_seq_exec_state_get(state, &seq_exec_state);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	if (!suit_param_is_set(component_params, SUIT_PARAM_SOURCE_COMPONENT)) {
+		return SUIT_ERR_UNAVAILABLE_PARAMETER;
+	}
+
+	ret = suit_manifest_get_component_params(seq_exec_state->manifest, component_params->source_component, &src_params);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+	if (state->dry_run != suit_bool_false) {
+		ret = SUIT_TRACE(SUIT_TRACE_PLAT_DRY_RUN, suit_plat_check_swap(component_params->component_handle, src_params->component_handle,
+					    &seq_exec_state->manifest->manifest_component_id,
+					    enc_info));
+		if (ret == SUIT_SUCCESS) {
+			ret = plan_record(state, SUIT_PLAN_OP_SWAP, component_params,
+					  src_params->component_handle, 0);
+		}
+
+		return ret;
+	}
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
+	/* The swap modifies both components. The platform may perform it in several steps,
+	 * returning SUIT_ERR_AGAIN, so mark the components only once, before the first step.
+	 */
+	if (seq_exec_state->cmd_exec_state == SUIT_SEQ_EXEC_DEFAULT_STATE) {
+		component_modified(state, component_params);
+		component_modified(state, src_params);
+		seq_exec_state->cmd_exec_state = 1;
+	} else {
+		SUIT_DBG("Continue swap (handle: 0x%lx)\r\n", component_params->component_handle);
+	}
+
+	return SUIT_TRACE(SUIT_TRACE_PLAT_SWAP, suit_plat_swap(component_params->component_handle, src_params->component_handle,
+			      &seq_exec_state->manifest->manifest_component_id, enc_info));
+}
+
+int suit_directive_apply_delta(struct suit_processor_state *state, struct suit_manifest_params *component_params)
+{
+	struct suit_seq_exec_state *seq_exec_state;
+	suit_component_t base_handle;
+	suit_component_t patch_handle;
+
+	if ((state == NULL) || (component_params == NULL)) {
+		SUIT_ERR("Unable to execute apply delta directive: invalid argument\r\n");
+		return SUIT_ERR_DECODING;
+	}
+
+	int ret = suit_seq_exec_state_get(state, &seq_exec_state);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	/* Both the base image and the result have to be verified, so all of the parameters are mandatory. */
+	if (!suit_param_is_set(component_params, SUIT_PARAM_SOURCE_COMPONENT) ||
+	    !suit_param_is_set(component_params, SUIT_PARAM_PATCH_COMPONENT) ||
+	    !suit_param_is_set(component_params, SUIT_PARAM_BASE_DIGEST) ||
+	    !suit_param_is_set(component_params, SUIT_PARAM_IMAGE_DIGEST)) {
+		return SUIT_ERR_UNAVAILABLE_PARAMETER;
+	}
+
+	ret = suit_exec_component_handle_from_idx(seq_exec_state, component_params->source_component, &base_handle);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	ret = suit_exec_component_handle_from_idx(seq_exec_state, component_params->patch_component, &patch_handle);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	/* The base image is read while the result is written, so the patch cannot be applied in place. */
+	if ((base_handle == component_params->component_handle) ||
+	    (patch_handle == component_params->component_handle)) {
+		SUIT_ERR("Unable to apply delta in place (handle: 0x%lx)\r\n", component_params->component_handle);
+		return SUIT_ERR_UNSUPPORTED_PARAMETER;
+	}
+
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+	if (state->dry_run != suit_bool_false) {
+		ret = SUIT_TRACE(SUIT_TRACE_PLAT_DRY_RUN, suit_plat_check_apply_delta(component_params->component_handle, base_handle, patch_handle,
+						   &seq_exec_state->manifest->manifest_component_id));
+		if (ret == SUIT_SUCCESS) {
+			ret = plan_record(state, SUIT_PLAN_OP_APPLY_DELTA, component_params, base_handle, 0);
+		}
+
+		return ret;
+	}
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
+	/* The platform may apply the patch in several steps, returning SUIT_ERR_AGAIN,
+	 * so verify the base image only once, before the destination component is modified.
+	 */
+	if (seq_exec_state->cmd_exec_state == SUIT_SEQ_EXEC_DEFAULT_STATE) {
+		ret = SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_IMAGE_MATCH, suit_plat_check_image_match(base_handle,
+			component_params->decoded.base_digest_alg, &component_params->decoded.base_digest_bytes));
+		if (ret != SUIT_SUCCESS) {
+			SUIT_ERR("Base image digest mismatch (handle: 0x%lx)\r\n", base_handle);
+			return ret;
+		}
+
+		component_modified(state, component_params);
+		seq_exec_state->cmd_exec_state = 1;
+	} else {
+		SUIT_DBG("Continue apply delta (handle: 0x%lx)\r\n", component_params->component_handle);
+	}
+
+	ret = SUIT_TRACE(SUIT_TRACE_PLAT_APPLY_DELTA, suit_plat_apply_delta(component_params->component_handle, base_handle, patch_handle,
+				    &seq_exec_state->manifest->manifest_component_id));
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	ret = SUIT_TRACE(SUIT_TRACE_PLAT_CHECK_IMAGE_MATCH, suit_plat_check_image_match(component_params->component_handle,
+		component_params->decoded.image_digest_alg, &component_params->decoded.image_digest_bytes));
+	if (ret != SUIT_SUCCESS) {
+		SUIT_ERR("Patched image digest mismatch (handle: 0x%lx)\r\n", component_params->component_handle);
+	}
+
+	return ret;
 }
 
 int suit_directive_invoke(struct suit_processor_state *state, struct suit_manifest_params *component_params)
@@ -788,17 +1331,23 @@ int suit_directive_invoke(struct suit_processor_state *state, struct suit_manife
 
 	image_handle = component_params->component_handle;
 
-	if (component_params->invoke_args_set) {
+	if (suit_param_is_set(component_params, SUIT_PARAM_INVOKE_ARGS)) {
 		invoke_args = &component_params->invoke_args;
 	}
 
 #ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
 	if (state->dry_run != suit_bool_false) {
-		return suit_plat_check_invoke(image_handle, invoke_args);
+		int ret = SUIT_TRACE(SUIT_TRACE_PLAT_DRY_RUN, suit_plat_check_invoke(image_handle, invoke_args));
+
+		if (ret == SUIT_SUCCESS) {
+			ret = plan_record(state, SUIT_PLAN_OP_INVOKE, component_params, 0, 0);
+		}
+
+		return ret;
 	} else {
-		return suit_plat_invoke(image_handle, invoke_args);
+		return SUIT_TRACE(SUIT_TRACE_PLAT_INVOKE, suit_plat_invoke(image_handle, invoke_args));
 	}
 #else /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
-	return suit_plat_invoke(image_handle, invoke_args);
+	return SUIT_TRACE(SUIT_TRACE_PLAT_INVOKE, suit_plat_invoke(image_handle, invoke_args));
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 }
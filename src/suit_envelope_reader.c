@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_envelope_reader.h>
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+#include <suit_platform.h>
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
+#define CBOR_MAJOR_TYPE_BSTR 2
+#define CBOR_MAJOR_TYPE_TSTR 3
+#define CBOR_MAJOR_TYPE_LIST 4
+#define CBOR_MAJOR_TYPE_MAP  5
+#define CBOR_MAJOR_TYPE_TAG  6
+
+#define SUIT_ENVELOPE_TAG 107
+
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+/** @brief The data, passed to the platform in chunks. */
+struct digest_ctx {
+	struct suit_envelope_reader *reader;
+	size_t offset;	     ///! The offset of the data inside the storage.
+	size_t len;
+	const uint8_t *copy; ///! The copy of the data, compared against each chunk.
+	bool modified;	     ///! The storage contents differ from the copy.
+};
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
+
+/** @brief Find the cached page or read it from the storage, replacing the least recently used page.
+ *
+ * @returns The pointer to the page, NULL if the page could not be read.
+ */
+static struct suit_envelope_page *get_page(struct suit_envelope_reader *reader, size_t page_offset, int *ret)
+{
+	struct suit_envelope_page *victim = &reader->pages[0];
+	size_t index = 0;
+
+	reader->access_count++;
+
+	for (size_t i = 0; i < reader->page_count; i++) {
+		struct suit_envelope_page *page = &reader->pages[i];
+
+		if ((page->len > 0) && (page->offset == page_offset)) {
+			page->used = reader->access_count;
+			return page;
+		}
+
+		if ((victim->len > 0) && ((page->len == 0) || (page->used < victim->used))) {
+			victim = page;
+			index = i;
+		}
+	}
+
+	victim->offset = page_offset;
+	victim->len = reader->size - page_offset;
+	if (victim->len > reader->page_size) {
+		victim->len = reader->page_size;
+	}
+
+	reader->miss_count++;
+	*ret = reader->read(reader->ctx, page_offset, &reader->buf[index * reader->page_size], victim->len);
+	if (*ret != SUIT_SUCCESS) {
+		victim->len = 0;
+		return NULL;
+	}
+
+	victim->used = reader->access_count;
+
+	return victim;
+}
+
+/** @brief Read the CBOR header of a single item.
+ *
+ * @details Indefinite-length items are not allowed in SUIT envelopes.
+ */
+static int read_header(struct suit_envelope_reader *reader, size_t *offset, uint8_t *major_type, uint64_t *arg)
+{
+	uint8_t bytes[8];
+	size_t arg_len;
+
+	int ret = suit_envelope_reader_read(reader, *offset, bytes, 1);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	*major_type = bytes[0] >> 5;
+	*arg = bytes[0] & 0x1f;
+	*offset += 1;
+
+	if (*arg < 24) {
+		return SUIT_SUCCESS;
+	} else if (*arg > 27) {
+		return SUIT_ERR_DECODING;
+	}
+
+	arg_len = (size_t)1 << (*arg - 24);
+	ret = suit_envelope_reader_read(reader, *offset, bytes, arg_len);
+	if (ret != SUIT_SUCCESS) {
+		return (ret == SUIT_ERR_OVERFLOW) ? SUIT_ERR_DECODING : ret;
+	}
+
+	*arg = 0;
+	for (size_t i = 0; i < arg_len; i++) {
+		*arg = (*arg << 8) | bytes[i];
+	}
+	*offset += arg_len;
+
+	return SUIT_SUCCESS;
+}
+
+int suit_envelope_reader_init(struct suit_envelope_reader *reader, suit_envelope_read_t read, void *ctx,
+			      size_t size, struct suit_envelope_page *pages, uint8_t *buf,
+			      size_t page_count, size_t page_size)
+{
+	if ((reader == NULL) || (read == NULL) || (pages == NULL) || (buf == NULL) ||
+	    (page_count == 0) || (page_size == 0)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	memset(reader, 0, sizeof(*reader));
+	reader->read = read;
+	reader->ctx = ctx;
+	reader->size = size;
+	reader->pages = pages;
+	reader->buf = buf;
+	reader->page_count = page_count;
+	reader->page_size = page_size;
+
+	suit_envelope_reader_invalidate(reader);
+
+	return SUIT_SUCCESS;
+}
+
+int suit_envelope_reader_read(struct suit_envelope_reader *reader, size_t offset, uint8_t *buf, size_t len)
+{
+	int ret = SUIT_SUCCESS;
+
+	if ((reader == NULL) || (reader->pages == NULL) || ((buf == NULL) && (len > 0))) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if ((offset > reader->size) || (len > reader->size - offset)) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	while (len > 0) {
+		size_t page_pos = offset % reader->page_size;
+		struct suit_envelope_page *page = get_page(reader, offset - page_pos, &ret);
+		size_t chunk = page_pos + len > reader->page_size ? reader->page_size - page_pos : len;
+
+		if (page == NULL) {
+			return ret;
+		}
+
+		memcpy(buf, &reader->buf[(size_t)(page - reader->pages) * reader->page_size + page_pos], chunk);
+		buf += chunk;
+		offset += chunk;
+		len -= chunk;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+void suit_envelope_reader_invalidate(struct suit_envelope_reader *reader)
+{
+	if ((reader == NULL) || (reader->pages == NULL)) {
+		return;
+	}
+
+	for (size_t i = 0; i < reader->page_count; i++) {
+		reader->pages[i].len = 0;
+		reader->pages[i].used = 0;
+	}
+}
+
+int suit_envelope_reader_get_len(struct suit_envelope_reader *reader, size_t *envelope_len)
+{
+	size_t offset = 0;
+	uint64_t remaining = 0;
+	uint8_t major_type;
+	uint64_t arg;
+
+	if ((reader == NULL) || (envelope_len == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	int ret = read_header(reader, &offset, &major_type, &arg);
+	if ((ret == SUIT_SUCCESS) && ((major_type != CBOR_MAJOR_TYPE_TAG) || (arg != SUIT_ENVELOPE_TAG))) {
+		ret = SUIT_ERR_DECODING;
+	}
+
+	if (ret == SUIT_SUCCESS) {
+		ret = read_header(reader, &offset, &major_type, &arg);
+	}
+
+	if (ret == SUIT_SUCCESS) {
+		if ((major_type != CBOR_MAJOR_TYPE_MAP) || (arg > reader->size)) {
+			ret = SUIT_ERR_DECODING;
+		} else {
+			remaining = arg * 2;
+		}
+	}
+
+	/* Skip the items without recursion: count the items, left to be read. Each item takes
+	 * at least one byte, so the count is limited by the size of the storage.
+	 */
+	while ((ret == SUIT_SUCCESS) && (remaining > 0)) {
+		uint64_t items = 0;
+
+		ret = read_header(reader, &offset, &major_type, &arg);
+		if (ret != SUIT_SUCCESS) {
+			break;
+		}
+
+		remaining--;
+
+		switch (major_type) {
+		case CBOR_MAJOR_TYPE_BSTR:
+		case CBOR_MAJOR_TYPE_TSTR:
+			if (arg > reader->size - offset) {
+				ret = SUIT_ERR_DECODING;
+			} else {
+				offset += (size_t)arg;
+			}
+			break;
+		case CBOR_MAJOR_TYPE_LIST:
+		case CBOR_MAJOR_TYPE_MAP:
+			if (arg > reader->size) {
+				ret = SUIT_ERR_DECODING;
+			} else {
+				items = (major_type == CBOR_MAJOR_TYPE_MAP) ? arg * 2 : arg;
+			}
+			break;
+		case CBOR_MAJOR_TYPE_TAG:
+			items = 1;
+			break;
+		default:
+			/* Integers, simple values and floats are fully encoded in the header. */
+			break;
+		}
+
+		if (ret != SUIT_SUCCESS) {
+			break;
+		}
+
+		if (remaining + items > reader->size - offset) {
+			ret = SUIT_ERR_DECODING;
+		} else {
+			remaining += items;
+		}
+	}
+
+	if (ret == SUIT_ERR_OVERFLOW) {
+		/* The envelope is truncated. */
+		ret = SUIT_ERR_DECODING;
+	}
+
+	if (ret == SUIT_SUCCESS) {
+		*envelope_len = offset;
+	}
+
+	return ret;
+}
+
+int suit_envelope_reader_load(struct suit_envelope_reader *reader, uint8_t *window, size_t window_size,
+			      size_t *envelope_len)
+{
+	size_t len = 0;
+
+	if ((window == NULL) || (envelope_len == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	int ret = suit_envelope_reader_get_len(reader, &len);
+	if ((ret == SUIT_SUCCESS) && (len > window_size)) {
+		ret = SUIT_ERR_OVERFLOW;
+	}
+
+	if (ret == SUIT_SUCCESS) {
+		ret = suit_envelope_reader_read(reader, 0, window, len);
+	}
+
+	if (ret == SUIT_SUCCESS) {
+		*envelope_len = len;
+	}
+
+	return ret;
+}
+
+#ifdef SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT
+/** @brief Return the rest of the cached page, that contains the given offset of the digested data. */
+static int get_digest_chunk(void *ctx, size_t offset, struct zcbor_string *chunk)
+{
+	struct digest_ctx *digest_ctx = (struct digest_ctx *)ctx;
+	struct suit_envelope_reader *reader = digest_ctx->reader;
+	int ret = SUIT_SUCCESS;
+
+	if ((chunk == NULL) || (offset >= digest_ctx->len)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	size_t storage_offset = digest_ctx->offset + offset;
+	size_t page_pos = storage_offset % reader->page_size;
+	struct suit_envelope_page *page = get_page(reader, storage_offset - page_pos, &ret);
+
+	if (page == NULL) {
+		return ret;
+	}
+
+	chunk->value = &reader->buf[(size_t)(page - reader->pages) * reader->page_size + page_pos];
+	chunk->len = page->len - page_pos;
+	if (chunk->len > digest_ctx->len - offset) {
+		chunk->len = digest_ctx->len - offset;
+	}
+
+	if ((digest_ctx->copy != NULL) && (memcmp(chunk->value, &digest_ctx->copy[offset], chunk->len) != 0)) {
+		digest_ctx->modified = true;
+		return SUIT_ERR_AUTHENTICATION;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+int suit_envelope_reader_check_digest(struct suit_envelope_reader *reader, size_t offset, size_t len,
+				      const uint8_t *copy, enum suit_cose_alg alg_id,
+				      struct zcbor_string *digest)
+{
+	if ((reader == NULL) || (reader->pages == NULL) || (digest == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if ((offset > reader->size) || (len > reader->size - offset)) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	struct digest_ctx ctx = {
+		.reader = reader,
+		.offset = offset,
+		.len = len,
+		.copy = copy,
+		.modified = false,
+	};
+
+	int ret = suit_plat_check_digest_chunked(alg_id, digest, len, get_digest_chunk, &ctx);
+
+	/* Do not let the platform mask the modification of the storage. */
+	if (ctx.modified) {
+		ret = SUIT_ERR_AUTHENTICATION;
+	}
+
+	return ret;
+}
+#endif /* SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT */
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_log.h>
+
+static struct suit_log_entry entries_buf[SUIT_LOG_BUF_SIZE];
+static size_t head;
+static size_t entries_count;
+static uint16_t next_seq;
+
+
+void suit_log_record(uint16_t id, const int32_t *args, size_t nargs)
+{
+	struct suit_log_entry *entry = &entries_buf[head];
+
+	entry->id = id;
+	entry->seq = next_seq++;
+	memset(entry->args, 0, sizeof(entry->args));
+
+	if (args != NULL) {
+		if (nargs > SUIT_LOG_MAX_ARGS) {
+			nargs = SUIT_LOG_MAX_ARGS;
+		}
+
+		memcpy(entry->args, args, nargs * sizeof(int32_t));
+	}
+
+	head = (head + 1) % SUIT_LOG_BUF_SIZE;
+
+	/* If the buffer is full, the oldest entry has just been overwritten. */
+	if (entries_count < SUIT_LOG_BUF_SIZE) {
+		entries_count++;
+	}
+}
+
+size_t suit_log_read(struct suit_log_entry *entries, size_t count)
+{
+	size_t read = 0;
+
+	if (entries == NULL) {
+		return 0;
+	}
+
+	while ((read < count) && (entries_count > 0)) {
+		size_t tail = (head + SUIT_LOG_BUF_SIZE - entries_count) % SUIT_LOG_BUF_SIZE;
+
+		entries[read++] = entries_buf[tail];
+		entries_count--;
+	}
+
+	return read;
+}
+
+void suit_log_reset(void)
+{
+	head = 0;
+	entries_count = 0;
+	next_seq = 0;
+}
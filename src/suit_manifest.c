@@ -7,6 +7,7 @@
 #include <suit_manifest.h>
 #include <suit_processor.h>
 #include <suit_platform.h>
+#include <suit_memo.h>
 
 static struct suit_manifest_params *components;
 static size_t components_count;
@@ -37,6 +38,8 @@ static int assign_component_index(struct zcbor_string *component_id, size_t *ass
 			ret = suit_plat_create_component_handle(component_id, dependency, &components[i].component_handle);
 
 			if (ret == SUIT_SUCCESS) {
+				/* The platform may reuse the handle value, so the results of the previous component are dropped. */
+				suit_memo_drop(components[i].component_handle);
 				components[*assigned_index].ref_count++;
 			}
 			break;
@@ -59,6 +62,7 @@ static int release_component_index(size_t assigned_index)
 		ret = suit_plat_release_component_handle(components[assigned_index].component_handle);
 		if (ret == SUIT_SUCCESS)
 		{
+			suit_memo_drop(components[assigned_index].component_handle);
 			components[assigned_index].is_dependency = 0;
 		}
 	}
@@ -129,7 +133,7 @@ int suit_manifest_append_dependency(struct suit_manifest_state *manifest, struct
 
 	if (ret == SUIT_SUCCESS) {
 		SUIT_DBG("Assigned index: %d for manifest component %d\r\n", index, manifest->components_count);
-		manifest->component_map[manifest->components_count] = index;
+		manifest->component_map[manifest->components_count] = (uint8_t)index;
 		/* Increase the number of valid component indexes / handles */
 		manifest->components_count++;
 	} else {
@@ -172,7 +176,7 @@ int suit_manifest_append_component(struct suit_manifest_state *manifest, struct
 
 	if (ret == SUIT_SUCCESS) {
 		SUIT_DBG("Assigned index: %d for manifest component %d\r\n", index, manifest->components_count);
-		manifest->component_map[manifest->components_count] = index;
+		manifest->component_map[manifest->components_count] = (uint8_t)index;
 		/* Increase the number of valid component indexes / handles */
 		manifest->components_count++;
 	} else {
@@ -237,69 +241,45 @@ int suit_manifest_get_component_params(struct suit_manifest_state *manifest, siz
 	return SUIT_SUCCESS;
 }
 
-int suit_manifest_get_command_seq(struct suit_manifest_state *manifest, enum suit_command_sequence seq_name, struct zcbor_string **sequence)
+void suit_manifest_params_copy_values(struct suit_manifest_params *dst,
+				      const struct suit_manifest_params *src)
 {
-	if (manifest == NULL || sequence == NULL) {
-		return SUIT_ERR_CRASH;
+	if ((dst == NULL) || (src == NULL)) {
+		return;
 	}
 
-	enum suit_seq_status sequence_status = UNAVAILABLE;
+	dst->vid = src->vid;
+	dst->cid = src->cid;
+	dst->image_digest = src->image_digest;
+	dst->image_size = src->image_size;
+	dst->content = src->content;
+	dst->component_slot = src->component_slot;
+	dst->uri = src->uri;
+	dst->source_component = src->source_component;
+	dst->invoke_args = src->invoke_args;
+	dst->did = src->did;
+	dst->version = src->version;
+	dst->encryption_info = src->encryption_info;
+	dst->compression_info = src->compression_info;
+	dst->base_digest = src->base_digest;
+	dst->patch_component = src->patch_component;
+	dst->decoded = src->decoded;
+	dst->set_mask = src->set_mask;
+}
 
-	switch (seq_name) {
-	case SUIT_SEQ_SHARED:
-		sequence_status = manifest->shared_sequence_status;
-		if (manifest->shared_sequence_status == AUTHENTICATED) {
-			*sequence = &manifest->shared_sequence;
-		}
-		break;
-	case SUIT_SEQ_DEP_RESOLUTION:
-		sequence_status = manifest->dependency_resolution_seq_status;
-		if (manifest->dependency_resolution_seq_status == AUTHENTICATED) {
-			*sequence = &manifest->dependency_resolution_seq;
-		}
-		break;
-	case SUIT_SEQ_PAYLOAD_FETCH:
-		sequence_status = manifest->payload_fetch_seq_status;
-		if (manifest->payload_fetch_seq_status == AUTHENTICATED) {
-			*sequence = &manifest->payload_fetch_seq;
-		}
-		break;
-	case SUIT_SEQ_CAND_VERIFICATION:
-		sequence_status = manifest->candidate_verification_seq_status;
-		if (manifest->candidate_verification_seq_status == AUTHENTICATED) {
-			*sequence = &manifest->candidate_verification_seq;
-		}
-		break;
-	case SUIT_SEQ_INSTALL:
-		sequence_status = manifest->install_seq_status;
-		if (manifest->install_seq_status == AUTHENTICATED) {
-			*sequence = &manifest->install_seq;
-		}
-		break;
-	case SUIT_SEQ_VALIDATE:
-		sequence_status = manifest->validate_seq_status;
-		if (manifest->validate_seq_status == AUTHENTICATED) {
-			*sequence = &manifest->validate_seq;
-		}
-		break;
-	case SUIT_SEQ_LOAD:
-		sequence_status = manifest->load_seq_status;
-		if (manifest->load_seq_status == AUTHENTICATED) {
-			*sequence = &manifest->load_seq;
-		}
-		break;
-	case SUIT_SEQ_INVOKE:
-		sequence_status = manifest->invoke_seq_status;
-		if (manifest->invoke_seq_status == AUTHENTICATED) {
-			*sequence = &manifest->invoke_seq;
-		}
-		break;
-	default:
+int suit_manifest_get_command_seq(struct suit_manifest_state *manifest, enum suit_command_sequence seq_name, struct zcbor_string *sequence)
+{
+	enum suit_seq_status sequence_status;
+
+	if ((manifest == NULL) || (sequence == NULL) ||
+	    (seq_name < SUIT_SEQ_SHARED) || (seq_name > SUIT_SEQ_INVOKE)) {
 		return SUIT_ERR_CRASH;
 	}
 
+	sequence_status = suit_manifest_get_seq_status(manifest, seq_name);
+
 	if (sequence_status == AUTHENTICATED) {
-		return SUIT_SUCCESS;
+		return suit_manifest_get_seq(manifest, seq_name, sequence);
 	} else if (sequence_status == UNAVAILABLE) {
 		return SUIT_ERR_UNAVAILABLE_COMMAND_SEQ;
 	}
@@ -315,8 +295,11 @@ int suit_manifest_get_integrated_payload(struct suit_manifest_state *manifest, s
 	}
 
 	for (int i = 0; i < manifest->integrated_payloads_count; i++) {
-		if (suit_compare_zcbor_strings(&manifest->integrated_payloads[i].key, uri)) {
-			*payload = manifest->integrated_payloads[i].payload;
+		struct zcbor_string key;
+
+		suit_manifest_ref_to_str(manifest, &manifest->integrated_payloads[i].key, &key);
+		if (suit_compare_zcbor_strings(&key, uri)) {
+			suit_manifest_ref_to_str(manifest, &manifest->integrated_payloads[i].payload, payload);
 			return SUIT_SUCCESS;
 		}
 	}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_memo.h>
+
+#ifdef SUIT_CONDITION_MEMO
+struct memo_entry {
+	suit_component_t component_handle;
+	bool used;
+	uint8_t id;
+	uint8_t len;
+	uint8_t value[SUIT_MEMO_VALUE_MAX_LEN];
+};
+
+static struct memo_entry entries[SUIT_MEMO_MAX_ENTRIES];
+static size_t next_entry;
+
+
+static bool entry_matches(const struct memo_entry *entry, enum suit_memo_id id, const struct zcbor_string *value)
+{
+	return (entry->used && (entry->id == id) && (entry->len == value->len) &&
+		(memcmp(entry->value, value->value, value->len) == 0));
+}
+
+bool suit_memo_passed(suit_component_t handle, enum suit_memo_id id, const struct zcbor_string *value)
+{
+	for (size_t i = 0; i < SUIT_MEMO_MAX_ENTRIES; i++) {
+		if ((entries[i].component_handle == handle) && entry_matches(&entries[i], id, value)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void suit_memo_store(suit_component_t handle, enum suit_memo_id id, const struct zcbor_string *value)
+{
+	struct memo_entry *entry = NULL;
+
+	if (value->len > SUIT_MEMO_VALUE_MAX_LEN) {
+		return;
+	}
+
+	/* Each component keeps a single result per condition. */
+	for (size_t i = 0; i < SUIT_MEMO_MAX_ENTRIES; i++) {
+		if (entries[i].used && (entries[i].component_handle == handle) && (entries[i].id == id)) {
+			entry = &entries[i];
+			break;
+		}
+	}
+
+	if (entry == NULL) {
+		for (size_t i = 0; i < SUIT_MEMO_MAX_ENTRIES; i++) {
+			if (!entries[i].used) {
+				entry = &entries[i];
+				break;
+			}
+		}
+	}
+
+	if (entry == NULL) {
+		entry = &entries[next_entry];
+		next_entry = (next_entry + 1) % SUIT_MEMO_MAX_ENTRIES;
+	}
+
+	entry->component_handle = handle;
+	entry->id = (uint8_t)id;
+	entry->len = (uint8_t)value->len;
+	memcpy(entry->value, value->value, value->len);
+	entry->used = true;
+}
+
+bool suit_memo_find(suit_component_t exclude, enum suit_memo_id id, const struct zcbor_string *value,
+		    suit_component_t *handle)
+{
+	for (size_t i = 0; i < SUIT_MEMO_MAX_ENTRIES; i++) {
+		if ((entries[i].component_handle != exclude) && entry_matches(&entries[i], id, value)) {
+			*handle = entries[i].component_handle;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void suit_memo_drop(suit_component_t handle)
+{
+	for (size_t i = 0; i < SUIT_MEMO_MAX_ENTRIES; i++) {
+		if (entries[i].component_handle == handle) {
+			entries[i].used = false;
+		}
+	}
+}
+
+void suit_memo_drop_all(void)
+{
+	memset(entries, 0, sizeof(entries));
+	next_entry = 0;
+}
+#endif /* SUIT_CONDITION_MEMO */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_plan.h>
+
+/** @brief Find the total of the storage area or reserve a new one.
+ *
+ * @returns The pointer to the total, NULL if the areas array is full.
+ */
+static struct suit_plan_area *find_area(struct suit_plan *plan, uint32_t id)
+{
+	for (size_t i = 0; i < plan->areas_count; i++) {
+		if (plan->areas[i].id == id) {
+			return &plan->areas[i];
+		}
+	}
+
+	if (plan->areas_count == plan->areas_max) {
+		return NULL;
+	}
+
+	plan->areas[plan->areas_count].id = id;
+	plan->areas[plan->areas_count].bytes = 0;
+	plan->areas_count++;
+
+	return &plan->areas[plan->areas_count - 1];
+}
+
+static int add_to_area(struct suit_plan *plan, suit_component_t handle, size_t size)
+{
+	struct suit_plan_area *area;
+	uint32_t id;
+
+	int ret = plan->get_area(plan->ctx, handle, &id);
+	if (ret != SUIT_SUCCESS) {
+		return ret;
+	}
+
+	area = find_area(plan, id);
+	if (area == NULL) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	area->bytes += size;
+
+	return SUIT_SUCCESS;
+}
+
+int suit_plan_init(struct suit_plan *plan, struct suit_plan_op *ops, size_t ops_max,
+		   struct suit_plan_area *areas, size_t areas_max,
+		   suit_plan_get_area_t get_area, void *ctx)
+{
+	if ((plan == NULL) || (ops == NULL) || ((get_area != NULL) && (areas == NULL))) {
+		return SUIT_ERR_CRASH;
+	}
+
+	memset(plan, 0, sizeof(*plan));
+	plan->ops = ops;
+	plan->ops_max = ops_max;
+	plan->get_area = get_area;
+	plan->ctx = ctx;
+
+	if (get_area != NULL) {
+		plan->areas = areas;
+		plan->areas_max = areas_max;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+int suit_plan_record(struct suit_plan *plan, const struct suit_plan_op *op)
+{
+	int ret = SUIT_SUCCESS;
+
+	if ((plan == NULL) || (plan->ops == NULL) || (op == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if (plan->ops_count == plan->ops_max) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	if ((plan->get_area != NULL) && (op->size > 0) && (op->type != SUIT_PLAN_OP_INVOKE)) {
+		ret = add_to_area(plan, op->dst_handle, op->size);
+
+		if ((ret == SUIT_SUCCESS) && (op->type == SUIT_PLAN_OP_SWAP)) {
+			ret = add_to_area(plan, op->src_handle, op->size);
+		}
+	}
+
+	if (ret == SUIT_SUCCESS) {
+		plan->ops[plan->ops_count++] = *op;
+	}
+
+	return ret;
+}
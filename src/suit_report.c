@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <suit_report.h>
+#include <suit_platform.h>
+
+static struct suit_report_record records[SUIT_MAX_NUM_REPORT_RECORDS];
+static size_t records_count;
+
+
+static void add_bstr_arg(struct suit_report *report, bool is_set, struct zcbor_string *value)
+{
+	if (is_set && (report->nargs < SUIT_MAX_COMMAND_ARGS)) {
+		report->argv[report->nargs].arg.bstr = value;
+		report->argv[report->nargs].arg_type = bstr;
+		report->nargs++;
+	}
+}
+
+static void add_num_arg(struct suit_report *report, bool is_set, unsigned int value)
+{
+	if (is_set && (report->nargs < SUIT_MAX_COMMAND_ARGS)) {
+		report->argv[report->nargs].arg.num = value;
+		report->argv[report->nargs].arg_type = num;
+		report->nargs++;
+	}
+}
+
+int suit_construct_report(unsigned int command, int result, struct suit_manifest_params *parameters,
+			  struct suit_report *report)
+{
+	if (report == NULL) {
+		return SUIT_ERR_CRASH;
+	}
+
+	memset(report, 0, sizeof(*report));
+	report->command = command;
+	report->result = result;
+
+	if (parameters == NULL) {
+		return SUIT_SUCCESS;
+	}
+
+	report->component_handle = parameters->component_handle;
+
+	/* Attach the parameters, consumed by the command. */
+	switch (command) {
+	case SUIT_Condition_suit_condition_vendor_identifier_m_l_c:
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_VID), &parameters->vid);
+		break;
+	case SUIT_Condition_suit_condition_class_identifier_m_l_c:
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_CID), &parameters->cid);
+		break;
+	case SUIT_Condition_suit_condition_device_identifier_m_l_c:
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_DID), &parameters->did);
+		break;
+	case SUIT_Condition_suit_condition_image_match_m_l_c:
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_IMAGE_DIGEST), &parameters->image_digest);
+		add_num_arg(report, suit_param_is_set(parameters, SUIT_PARAM_IMAGE_SIZE), parameters->image_size);
+		break;
+	case SUIT_Condition_suit_condition_component_slot_m_l_c:
+		add_num_arg(report, suit_param_is_set(parameters, SUIT_PARAM_COMPONENT_SLOT), parameters->component_slot);
+		break;
+	case SUIT_Condition_suit_condition_check_content_m_l_c:
+	case SUIT_Directive_suit_directive_write_m_l_c:
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_CONTENT), &parameters->content);
+		break;
+	case SUIT_Condition_suit_condition_version_m_l_c:
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_VERSION), &parameters->version);
+		break;
+	case SUIT_Directive_suit_directive_fetch_m_l_c:
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_URI), &parameters->uri);
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_IMAGE_DIGEST), &parameters->image_digest);
+		break;
+	case SUIT_Directive_suit_directive_copy_m_l_c:
+	case SUIT_Directive_suit_directive_swap_m_l_c:
+		add_num_arg(report, suit_param_is_set(parameters, SUIT_PARAM_SOURCE_COMPONENT), parameters->source_component);
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_IMAGE_DIGEST), &parameters->image_digest);
+		break;
+	case SUIT_Directive_suit_directive_custom_apply_delta_m_l_c:
+		add_num_arg(report, suit_param_is_set(parameters, SUIT_PARAM_SOURCE_COMPONENT), parameters->source_component);
+		add_num_arg(report, suit_param_is_set(parameters, SUIT_PARAM_PATCH_COMPONENT), parameters->patch_component);
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_IMAGE_DIGEST), &parameters->image_digest);
+		break;
+	case SUIT_Directive_suit_directive_invoke_m_l_c:
+		add_bstr_arg(report, suit_param_is_set(parameters, SUIT_PARAM_INVOKE_ARGS), &parameters->invoke_args);
+		break;
+	default:
+		break;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+int suit_report_flush(void)
+{
+	struct suit_report report;
+	int retval = SUIT_SUCCESS;
+
+	for (size_t i = 0; i < records_count; i++) {
+		int ret = suit_construct_report((unsigned int)records[i].command, records[i].result,
+						NULL, &report);
+		if (ret == SUIT_SUCCESS) {
+			report.component_handle = records[i].component_handle;
+			ret = suit_plat_report(records[i].rep_policy, &report);
+		}
+
+		if (ret != SUIT_SUCCESS) {
+			retval = ret;
+		}
+	}
+
+	records_count = 0;
+
+	return retval;
+}
+
+void suit_report_record(const suit_command_t *command, int result,
+			struct suit_manifest_params *parameters)
+{
+	uint32_t record_bit = SUIT_REP_POLICY_RECORD_SUCCESS;
+	uint32_t sysinfo_bit = SUIT_REP_POLICY_SYSINFO_SUCCESS;
+	struct suit_report report;
+
+	if ((command == NULL) || (command->rep_policy == 0)) {
+		return;
+	}
+
+	if (result != SUIT_SUCCESS) {
+		record_bit = SUIT_REP_POLICY_RECORD_FAILURE;
+		sysinfo_bit = SUIT_REP_POLICY_SYSINFO_FAILURE;
+	}
+
+	if ((command->rep_policy & (record_bit | sysinfo_bit)) == 0) {
+		return;
+	}
+
+	unsigned int command_id = (command->type == SUIT_COMMAND_CONDITION ?
+		(unsigned int)command->condition.SUIT_Condition_choice :
+		(unsigned int)command->directive.SUIT_Directive_choice);
+
+	/* The parameters may change before the end of the sequence, so they have to be reported
+	 * right away. Flush the buffer first to keep the order of reports.
+	 */
+	if ((command->rep_policy & sysinfo_bit) != 0) {
+		(void)suit_report_flush();
+
+		if (suit_construct_report(command_id, result, parameters, &report) == SUIT_SUCCESS) {
+			(void)suit_plat_report(command->rep_policy, &report);
+		}
+
+		return;
+	}
+
+	if (records_count == SUIT_MAX_NUM_REPORT_RECORDS) {
+		(void)suit_report_flush();
+	}
+
+	records[records_count].component_handle =
+		(parameters != NULL) ? parameters->component_handle : 0;
+	records[records_count].command = (int16_t)command_id;
+	records[records_count].result = (int16_t)result;
+	records[records_count].rep_policy = (uint8_t)command->rep_policy;
+	records_count++;
+}
+
+void suit_report_reset(void)
+{
+	records_count = 0;
+}
@@ -16,14 +16,186 @@
 #include <suit_platform.h>
 #include <suit_seq_exec.h>
 #include <suit_manifest.h>
+#include <suit_log.h>
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+#include <suit_checkpoint.h>
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+#ifdef SUIT_PLATFORM_REPORT_SUPPORT
+#include <suit_report.h>
+#endif /* SUIT_PLATFORM_REPORT_SUPPORT */
 
 
+/** @brief Classify the side effects of a single command. */
+static enum suit_seq_effect suit_command_effect(suit_command_t *command)
+{
+	if (command->type != SUIT_COMMAND_DIRECTIVE) {
+		return SUIT_SEQ_EFFECT_PURE;
+	}
+
+	switch (command->directive.SUIT_Directive_choice) {
+	case SUIT_Directive_suit_directive_override_parameters_m_l_c:
+		for (size_t i = 0; i < command->directive.suit_directive_override_parameters_m_l_map_SUIT_Parameters_m_count; i++) {
+			if (command->directive.suit_directive_override_parameters_m_l_map_SUIT_Parameters_m[i]
+				    .suit_directive_override_parameters_m_l_map_SUIT_Parameters_m.SUIT_Parameters_choice ==
+			    SUIT_Parameters_suit_parameter_image_size_c) {
+				return SUIT_SEQ_EFFECT_LOCAL_WRITE;
+			}
+		}
+		return SUIT_SEQ_EFFECT_PURE;
+	case SUIT_Directive_suit_directive_set_parameters_m_l_c:
+		for (size_t i = 0; i < command->directive.suit_directive_set_parameters_m_l_map_SUIT_Parameters_m_count; i++) {
+			if (command->directive.suit_directive_set_parameters_m_l_map_SUIT_Parameters_m[i]
+				    .suit_directive_set_parameters_m_l_map_SUIT_Parameters_m.SUIT_Parameters_choice ==
+			    SUIT_Parameters_suit_parameter_image_size_c) {
+				return SUIT_SEQ_EFFECT_LOCAL_WRITE;
+			}
+		}
+		return SUIT_SEQ_EFFECT_PURE;
+	case SUIT_Directive_suit_directive_fetch_m_l_c:
+	case SUIT_Directive_suit_directive_copy_m_l_c:
+	case SUIT_Directive_suit_directive_swap_m_l_c:
+	case SUIT_Directive_suit_directive_custom_apply_delta_m_l_c:
+	case SUIT_Directive_suit_directive_write_m_l_c:
+	case SUIT_Directive_suit_directive_invoke_m_l_c:
+	case SUIT_Directive_suit_directive_process_dependency_m_l_c:
+		return SUIT_SEQ_EFFECT_EXTERNAL;
+	default:
+		return SUIT_SEQ_EFFECT_PURE;
+	}
+}
+
+/** @brief Find the manifest sequence, that contains the currently executed command sequence.
+ *
+ * @details The try-each and run-sequence bodies are located inside the sequence, that contains
+ *          the directive, so the top-level sequence is returned for the nested commands.
+ *
+ * @returns The sequence name, SUIT_SEQ_MAX if the command sequence is not a part of the manifest.
+ */
+static enum suit_command_sequence suit_top_level_seq(struct suit_seq_exec_state *seq_exec_state)
+{
+	for (enum suit_command_sequence seq = SUIT_SEQ_SHARED; seq < SUIT_SEQ_MAX; seq++) {
+		struct zcbor_string seq_str;
+
+		if ((suit_manifest_get_seq(seq_exec_state->manifest, seq, &seq_str) != SUIT_SUCCESS) ||
+		    (seq_str.value == NULL)) {
+			continue;
+		}
+
+		if ((seq_exec_state->cmd_seq_str.value >= seq_str.value) &&
+		    (seq_exec_state->cmd_seq_str.value + seq_exec_state->cmd_seq_str.len <= seq_str.value + seq_str.len)) {
+			return seq;
+		}
+	}
+
+	return SUIT_SEQ_MAX;
+}
+
+/** @brief Add the side effects of the validated command to the effect of the validated sequence.
+ *
+ * @details The effect is stored in the manifest state once the whole sequence is validated.
+ */
+static void suit_record_command_effect(struct suit_processor_state *state, suit_command_t *command)
+{
+	struct suit_seq_exec_state *seq_exec_state;
+	enum suit_seq_effect effect = suit_command_effect(command);
+
+	if ((effect == SUIT_SEQ_EFFECT_PURE) ||
+	    (suit_seq_exec_state_get(state, &seq_exec_state) != SUIT_SUCCESS)) {
+		return;
+	}
+
+	if (effect > seq_exec_state->manifest->seq_effect_pending) {
+		seq_exec_state->manifest->seq_effect_pending = (uint8_t)effect;
+	}
+}
+
+#ifdef SUIT_PLATFORM_PREFETCH_SUPPORT
+/** @brief Announce the dependency manifests of the root manifest in the order of the components.
+ *
+ * @details The dependency manifests are processed by the sequences of the root manifest, so they are
+ *          announced before its shared sequence is validated, unless the envelope is only parsed.
+ */
+static void suit_announce_dependencies(struct suit_processor_state *state, struct suit_manifest_state *manifest)
+{
+	if ((manifest != &state->manifest_stack[0]) || (state->current_seq <= SUIT_SEQ_PARSE)) {
+		return;
+	}
+
+	for (size_t i = 0; i < manifest->components_count; i++) {
+		struct suit_manifest_params *params;
+
+		if ((suit_manifest_get_component_params(manifest, i, &params) == SUIT_SUCCESS) &&
+		    (params->is_dependency == suit_bool_true)) {
+			(void)suit_plat_prefetch_manifest(params->component_handle);
+		}
+	}
+}
+
+/** @brief Announce the URI, if it is not an integrated payload. */
+static void suit_announce_uri(struct suit_manifest_state *manifest, struct SUIT_Parameters_r *param)
+{
+	struct zcbor_string payload;
+
+	if ((param->SUIT_Parameters_choice != SUIT_Parameters_suit_parameter_uri_c) ||
+	    (suit_manifest_get_integrated_payload(manifest, &param->SUIT_Parameters_suit_parameter_uri,
+						  &payload) == SUIT_SUCCESS)) {
+		return;
+	}
+
+	(void)suit_plat_prefetch_uri(&param->SUIT_Parameters_suit_parameter_uri,
+				     &manifest->manifest_component_id);
+}
+
+/** @brief Announce the URIs, set by the validated command within the sequences, that will be executed
+ *         by this or the following calls to the suit_process_sequence.
+ */
+static void suit_announce_command_uris(struct suit_processor_state *state, suit_command_t *command)
+{
+	struct suit_seq_exec_state *seq_exec_state;
+	enum suit_command_sequence seq;
+
+	if ((command->type != SUIT_COMMAND_DIRECTIVE) ||
+	    (suit_seq_exec_state_get(state, &seq_exec_state) != SUIT_SUCCESS)) {
+		return;
+	}
+
+	seq = suit_top_level_seq(seq_exec_state);
+	if ((seq == SUIT_SEQ_MAX) || ((seq != SUIT_SEQ_SHARED) && (seq < state->current_seq))) {
+		return;
+	}
+
+	switch (command->directive.SUIT_Directive_choice) {
+	case SUIT_Directive_suit_directive_override_parameters_m_l_c:
+		for (size_t i = 0; i < command->directive.suit_directive_override_parameters_m_l_map_SUIT_Parameters_m_count; i++) {
+			suit_announce_uri(seq_exec_state->manifest,
+				&command->directive.suit_directive_override_parameters_m_l_map_SUIT_Parameters_m[i]
+					 .suit_directive_override_parameters_m_l_map_SUIT_Parameters_m);
+		}
+		break;
+	case SUIT_Directive_suit_directive_set_parameters_m_l_c:
+		for (size_t i = 0; i < command->directive.suit_directive_set_parameters_m_l_map_SUIT_Parameters_m_count; i++) {
+			suit_announce_uri(seq_exec_state->manifest,
+				&command->directive.suit_directive_set_parameters_m_l_map_SUIT_Parameters_m[i]
+					 .suit_directive_set_parameters_m_l_map_SUIT_Parameters_m);
+		}
+		break;
+	default:
+		break;
+	}
+}
+#endif /* SUIT_PLATFORM_PREFETCH_SUPPORT */
+
 static int suit_validate_single_command(struct suit_processor_state *state, suit_command_t *command, bool is_shared_sequence)
 {
 	struct suit_seq_exec_state *seq_exec_state;
 	size_t component_idx;
 	int retval = SUIT_ERR_DECODING;
 
+	suit_record_command_effect(state, command);
+#ifdef SUIT_PLATFORM_PREFETCH_SUPPORT
+	suit_announce_command_uris(state, command);
+#endif /* SUIT_PLATFORM_PREFETCH_SUPPORT */
+
 	if ((command->type == SUIT_COMMAND_DIRECTIVE) &&
 	    ((command->directive.SUIT_Directive_choice == SUIT_Directive_suit_directive_set_component_index_m_l_c) ||
 	     (command->directive.SUIT_Directive_choice == SUIT_Directive_suit_directive_override_parameters_m_l_c))) {
@@ -36,7 +208,7 @@ static int suit_validate_single_command(struct suit_processor_state *state, suit
 			}
 			break;
 		case SUIT_Directive_suit_directive_override_parameters_m_l_c:
-			SUIT_DBG("Found valid directive: %d\r\n", command->directive.SUIT_Directive_choice);
+			SUIT_LOG_DBG(VALID_DIRECTIVE, command->directive.SUIT_Directive_choice);
 			retval = SUIT_SUCCESS;
 			break;
 		default:
@@ -45,7 +217,7 @@ static int suit_validate_single_command(struct suit_processor_state *state, suit
 			break;
 		}
 
-		SUIT_DBG("Single command validated (status: %d)\r\n", retval);
+		SUIT_LOG_DBG(COMMAND_VALIDATED, retval);
 
 		return retval;
 	}
@@ -73,14 +245,16 @@ static int suit_validate_single_command(struct suit_processor_state *state, suit
 			case SUIT_Condition_suit_condition_check_content_m_l_c:
 			case SUIT_Condition_suit_condition_abort_m_l_c:
 			case SUIT_Condition_suit_condition_version_m_l_c:
-				SUIT_DBG("Found valid condition: %d\r\n", command->condition.SUIT_Condition_choice);
+				SUIT_LOG_DBG(VALID_CONDITION, command->condition.SUIT_Condition_choice);
 				retval = SUIT_SUCCESS;
 				break;
+#ifndef SUIT_PRUNE_DEPENDENCIES
 			case SUIT_Condition_suit_condition_dependency_integrity_m_l_c:
 			case SUIT_Condition_suit_condition_is_dependency_m_l_c:
 				SUIT_DBG("Found valid dependency condition: %d\r\n", command->condition.SUIT_Condition_choice);
 				retval = SUIT_SUCCESS;
 				break;
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 			default:
 				SUIT_ERR("Found invalid condition: %d\r\n", command->condition.SUIT_Condition_choice);
 				retval = SUIT_ERR_MANIFEST_VALIDATION;
@@ -94,7 +268,7 @@ static int suit_validate_single_command(struct suit_processor_state *state, suit
 			 * because they only parses the command string and populates the execution stack.
 			 */
 			case SUIT_Directive_suit_directive_try_each_m_l_c:
-				SUIT_DBG("Found valid directive: %d\r\n", command->directive.SUIT_Directive_choice);
+				SUIT_LOG_DBG(VALID_DIRECTIVE, command->directive.SUIT_Directive_choice);
 				retval = suit_directive_try_each(state, &command->directive.SUIT_Directive_suit_directive_try_each_m_l_SUIT_Directive_Try_Each_Argument_m, true);
 				break;
 			case SUIT_Directive_suit_directive_run_sequence_m_l_c:
@@ -102,7 +276,9 @@ static int suit_validate_single_command(struct suit_processor_state *state, suit
 				retval = suit_directive_run_sequence(state,
 					&command->directive.SUIT_Directive_suit_directive_run_sequence_m_l_SUIT_Command_Sequence_bstr);
 				break;
+#ifndef SUIT_PRUNE_DEPENDENCIES
 			case SUIT_Directive_suit_directive_process_dependency_m_l_c:
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 			case SUIT_Directive_suit_directive_set_parameters_m_l_c:
 				if (!is_shared_sequence) {
 					SUIT_DBG("Found valid dependency directive: %d\r\n", command->directive.SUIT_Directive_choice);
@@ -112,12 +288,16 @@ static int suit_validate_single_command(struct suit_processor_state *state, suit
 					retval = SUIT_ERR_MANIFEST_VALIDATION;
 				}
 				break;
+#ifndef SUIT_PRUNE_FETCH
 			case SUIT_Directive_suit_directive_fetch_m_l_c:
+#endif /* SUIT_PRUNE_FETCH */
 			case SUIT_Directive_suit_directive_copy_m_l_c:
+			case SUIT_Directive_suit_directive_swap_m_l_c:
+			case SUIT_Directive_suit_directive_custom_apply_delta_m_l_c:
 			case SUIT_Directive_suit_directive_write_m_l_c:
 			case SUIT_Directive_suit_directive_invoke_m_l_c:
 				if (!is_shared_sequence) {
-					SUIT_DBG("Found valid directive: %d\r\n", command->directive.SUIT_Directive_choice);
+					SUIT_LOG_DBG(VALID_DIRECTIVE, command->directive.SUIT_Directive_choice);
 					retval = SUIT_SUCCESS;
 					break;
 				}
@@ -143,7 +323,7 @@ static int suit_validate_single_command(struct suit_processor_state *state, suit
 		}
 	}
 
-	SUIT_DBG("Single command validated (status: %d)\r\n", retval);
+	SUIT_LOG_DBG(COMMAND_VALIDATED, retval);
 
 	return retval;
 }
@@ -158,6 +338,21 @@ static inline int suit_validate_single_common_command(struct suit_processor_stat
 	return suit_validate_single_command(state, command, false);
 }
 
+#ifdef SUIT_PLATFORM_REPORT_SUPPORT
+static void report_command(struct suit_processor_state *state, suit_command_t *command, int result,
+			   struct suit_manifest_params *params)
+{
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+	/* Commands are not executed during the dry run, so there is nothing to report. */
+	if (state->dry_run != suit_bool_false) {
+		return;
+	}
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
+
+	suit_report_record(command, result, params);
+}
+#endif /* SUIT_PLATFORM_REPORT_SUPPORT */
+
 static int suit_run_single_command(struct suit_processor_state *state, suit_command_t *command)
 {
 	struct suit_seq_exec_state *seq_exec_state;
@@ -183,7 +378,12 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 			break;
 		}
 
-		SUIT_ERR("Single command (%d) executed (status: %d)\r\n", command->directive.SUIT_Directive_choice, retval);
+		if (retval != SUIT_SUCCESS) {
+			SUIT_ERR("Single directive (%d) failed (status: %d)\r\n",
+				command->directive.SUIT_Directive_choice, retval);
+		} else {
+			SUIT_LOG_DBG(DIRECTIVE_EXECUTED, command->directive.SUIT_Directive_choice, retval);
+		}
 
 		return retval;
 	}
@@ -207,9 +407,9 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 		}
 
 		if (command->type == SUIT_COMMAND_CONDITION) {
-			SUIT_DBG("Execute condition %d for component idx: %d (manifest: %p, handle: 0x%lx)\r\n",
+			SUIT_LOG_DBG(CONDITION_EXECUTE,
 				command->condition.SUIT_Condition_choice, component_idx,
-				seq_exec_state->manifest, params->component_handle);
+				(unsigned int)params->component_handle);
 
 			switch (command->condition.SUIT_Condition_choice) {
 			case SUIT_Condition_suit_condition_vendor_identifier_m_l_c:
@@ -233,12 +433,14 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 			case SUIT_Condition_suit_condition_abort_m_l_c:
 				retval = suit_condition_abort(state, params);
 				break;
+#ifndef SUIT_PRUNE_DEPENDENCIES
 			case SUIT_Condition_suit_condition_dependency_integrity_m_l_c:
 				retval = suit_condition_dependency_integrity(state, params);
 				break;
 			case SUIT_Condition_suit_condition_is_dependency_m_l_c:
 				retval = suit_condition_is_dependency(state, params);
 				break;
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 			case SUIT_Condition_suit_condition_version_m_l_c:
 				retval = suit_condition_version(state, params);
 				break;
@@ -249,9 +451,9 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 		}
 
 		else if (command->type == SUIT_COMMAND_DIRECTIVE) {
-			SUIT_DBG("Execute directive %d for component idx: %d (manifest: %p, handle: 0x%lx)\r\n",
+			SUIT_LOG_DBG(DIRECTIVE_EXECUTE,
 				command->directive.SUIT_Directive_choice, component_idx,
-				seq_exec_state->manifest, params->component_handle);
+				(unsigned int)params->component_handle);
 
 			switch (command->directive.SUIT_Directive_choice) {
 			case SUIT_Directive_suit_directive_run_sequence_m_l_c:
@@ -261,9 +463,11 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 			case SUIT_Directive_suit_directive_try_each_m_l_c:
 				retval = suit_directive_try_each(state, &command->directive.SUIT_Directive_suit_directive_try_each_m_l_SUIT_Directive_Try_Each_Argument_m, false);
 				break;
+#ifndef SUIT_PRUNE_DEPENDENCIES
 			case SUIT_Directive_suit_directive_process_dependency_m_l_c:
 				retval = suit_directive_process_dependency(state, params);
 				break;
+#endif /* SUIT_PRUNE_DEPENDENCIES */
 			case SUIT_Directive_suit_directive_set_parameters_m_l_c:
 				retval = suit_directive_set_parameters(state,
 					command->directive.suit_directive_set_parameters_m_l_map_SUIT_Parameters_m,
@@ -273,15 +477,23 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 			case SUIT_Directive_suit_directive_copy_m_l_c:
 				retval = suit_directive_copy(state, params);
 				break;
+			case SUIT_Directive_suit_directive_swap_m_l_c:
+				retval = suit_directive_swap(state, params);
+				break;
+			case SUIT_Directive_suit_directive_custom_apply_delta_m_l_c:
+				retval = suit_directive_apply_delta(state, params);
+				break;
 			case SUIT_Directive_suit_directive_write_m_l_c:
 				retval = suit_directive_write(state, params);
 				break;
 			case SUIT_Directive_suit_directive_invoke_m_l_c:
 				retval = suit_directive_invoke(state, params);
 				break;
+#ifndef SUIT_PRUNE_FETCH
 			case SUIT_Directive_suit_directive_fetch_m_l_c:
 				retval = suit_directive_fetch(state, params);
 				break;
+#endif /* SUIT_PRUNE_FETCH */
 			default:
 				retval = SUIT_ERR_DECODING;
 				break;
@@ -292,6 +504,10 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 
 		/* Command finished - execute it for the next component. */
 		if (retval != SUIT_ERR_AGAIN) {
+#ifdef SUIT_PLATFORM_REPORT_SUPPORT
+			report_command(state, command, retval, params);
+#endif /* SUIT_PLATFORM_REPORT_SUPPORT */
+
 			int ret = suit_seq_exec_component_idx_next(seq_exec_state, &component_idx);
 			if (ret != SUIT_SUCCESS) {
 				retval = ret;
@@ -302,10 +518,21 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 		}
 	}
 
+	/* Only report failures as errors, so the logs do not slow down the regular execution. */
+	bool failed = ((retval != SUIT_SUCCESS) && (retval != SUIT_ERR_AGAIN));
+
 	if (command->type == SUIT_COMMAND_CONDITION) {
-		SUIT_ERR("Single condition (%d) executed (status: %d)\r\n", command->condition.SUIT_Condition_choice, retval);
+		if (failed) {
+			SUIT_ERR("Single condition (%d) failed (status: %d)\r\n",
+				command->condition.SUIT_Condition_choice, retval);
+		} else {
+			SUIT_LOG_DBG(CONDITION_EXECUTED, command->condition.SUIT_Condition_choice, retval);
+		}
+	} else if (failed) {
+		SUIT_ERR("Single directive (%d) failed (status: %d)\r\n",
+			command->directive.SUIT_Directive_choice, retval);
 	} else {
-		SUIT_ERR("Single directive (%d) executed (status: %d)\r\n", command->directive.SUIT_Directive_choice, retval);
+		SUIT_LOG_DBG(DIRECTIVE_EXECUTED, command->directive.SUIT_Directive_choice, retval);
 	}
 
 	return retval;
@@ -315,7 +542,7 @@ static int suit_run_single_command(struct suit_processor_state *state, suit_comm
 int suit_schedule_execution(struct suit_processor_state *state, struct suit_manifest_state *manifest, enum suit_command_sequence seq_name)
 {
 	int ret;
-	struct zcbor_string *cmd_seq_str = NULL;
+	struct zcbor_string cmd_seq_str;
 
 	if (manifest == NULL) {
 		return SUIT_ERR_CRASH;
@@ -327,30 +554,80 @@ int suit_schedule_execution(struct suit_processor_state *state, struct suit_mani
 	}
 
 	SUIT_DBG("Command sequence (%d) scheduled for execution\r\n", seq_name);
-	return suit_seq_exec_schedule(state, manifest, cmd_seq_str, suit_bool_false, suit_run_single_command);
+	return suit_seq_exec_schedule(state, manifest, &cmd_seq_str, suit_bool_false, suit_run_single_command);
 }
 
 int suit_schedule_validation(struct suit_processor_state *state, struct suit_manifest_state *manifest, enum suit_command_sequence seq_name)
 {
 	int ret;
-	struct zcbor_string *cmd_seq_str = NULL;
+	struct zcbor_string cmd_seq_str;
 
 	if (manifest == NULL) {
 		return SUIT_ERR_ORDER;
 	}
 
+#ifdef SUIT_PLATFORM_PREFETCH_SUPPORT
+	if (seq_name == SUIT_SEQ_SHARED) {
+		suit_announce_dependencies(state, manifest);
+	}
+#endif /* SUIT_PLATFORM_PREFETCH_SUPPORT */
+
 	ret = suit_manifest_get_command_seq(manifest, seq_name, &cmd_seq_str);
 	if (ret != SUIT_SUCCESS) {
 		return ret;
 	}
 
+	/* The side effects are collected while the commands are validated and stored only if
+	 * the whole sequence is successfully validated.
+	 */
+	(void)suit_manifest_set_seq_effect(manifest, seq_name, SUIT_SEQ_EFFECT_EXTERNAL);
+	manifest->seq_effect_pending = SUIT_SEQ_EFFECT_PURE;
+
 	if (seq_name == SUIT_SEQ_SHARED) {
 		SUIT_DBG("Shared sequence scheduled for validation\r\n");
-		return suit_seq_exec_schedule(state, manifest, cmd_seq_str, suit_bool_false, suit_validate_single_shared_command);
+		return suit_seq_exec_schedule(state, manifest, &cmd_seq_str, suit_bool_false, suit_validate_single_shared_command);
 	} else {
 		SUIT_DBG("Command sequence (%d) scheduled for validation\r\n", seq_name);
-		return suit_seq_exec_schedule(state, manifest, cmd_seq_str, suit_bool_false, suit_validate_single_common_command);
+		return suit_seq_exec_schedule(state, manifest, &cmd_seq_str, suit_bool_false, suit_validate_single_common_command);
+	}
+}
+
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+int suit_schedule_resumed_execution(struct suit_processor_state *state, struct suit_manifest_state *manifest)
+{
+	if (manifest == NULL) {
+		return SUIT_ERR_CRASH;
 	}
+
+	SUIT_DBG("Command sequence (%d) scheduled for resumed execution\r\n", state->current_seq);
+	return suit_checkpoint_resume(state, manifest, suit_run_single_command);
+}
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
+
+/** @brief Store the side effects of the sequence, if its validation has just finished. */
+static void suit_store_seq_effect(struct suit_processor_state *state)
+{
+	struct suit_seq_exec_state *seq_exec_state;
+	struct zcbor_string seq_str;
+	enum suit_command_sequence seq;
+
+	if ((suit_seq_exec_state_get(state, &seq_exec_state) != SUIT_SUCCESS) ||
+	    ((seq_exec_state->cmd_processor != suit_validate_single_shared_command) &&
+	     (seq_exec_state->cmd_processor != suit_validate_single_common_command))) {
+		return;
+	}
+
+	/* The nested try-each and run-sequence bodies are a part of the top-level sequence. */
+	seq = suit_top_level_seq(seq_exec_state);
+	if ((seq == SUIT_SEQ_MAX) ||
+	    (suit_manifest_get_seq(seq_exec_state->manifest, seq, &seq_str) != SUIT_SUCCESS) ||
+	    (seq_str.value != seq_exec_state->cmd_seq_str.value) ||
+	    (seq_str.len != seq_exec_state->cmd_seq_str.len)) {
+		return;
+	}
+
+	(void)suit_manifest_set_seq_effect(seq_exec_state->manifest, seq,
+					   (enum suit_seq_effect)seq_exec_state->manifest->seq_effect_pending);
 }
 
 int suit_process_scheduled(struct suit_processor_state *state)
@@ -360,6 +637,10 @@ int suit_process_scheduled(struct suit_processor_state *state)
 	while (retval == SUIT_ERR_AGAIN) {
 		retval = suit_seq_exec_step(state);
 		if (retval != SUIT_ERR_AGAIN) {
+			if (retval == SUIT_SUCCESS) {
+				suit_store_seq_effect(state);
+			}
+
 			/* Drop a single element and pass the returned value through the execution stack.
 			 * If the last element on the stack is dropped, this API will return the error code
 			 * passed as an argument.
@@ -6,11 +6,35 @@
 
 #include <suit_seq_exec.h>
 #include <manifest_decode.h>
+#include <suit_trace.h>
+#include <suit_arena.h>
+#include <suit_log.h>
 #include <suit_platform.h>
 #include <suit_manifest.h>
 #include <zcbor_decode.h>
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+#include <suit_checkpoint.h>
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
 
 
+#ifdef SUIT_PLATFORM_REPORT_SUPPORT
+/* Read the SUIT_Rep_Policy, passed as the argument of the encoded command. */
+static uint32_t rep_policy_get(const uint8_t *command_str, size_t command_len)
+{
+	int32_t command_id;
+	uint32_t rep_policy = 0;
+
+	ZCBOR_STATE_D(d_state, 0, command_str, command_len, 2, 0);
+
+	if (!zcbor_int32_decode(d_state, &command_id) ||
+	    !zcbor_uint32_decode(d_state, &rep_policy)) {
+		return 0;
+	}
+
+	return rep_policy;
+}
+#endif /* SUIT_PLATFORM_REPORT_SUPPORT */
+
 static int backup_and_reset_components(struct suit_seq_exec_state *seq_exec_state)
 {
 	if (seq_exec_state == NULL) {
@@ -43,13 +67,14 @@ static int recover_components(struct suit_seq_exec_state *seq_exec_state)
 		&seq_exec_state->current_components_backup,
 		SUIT_MAX_NUM_COMPONENTS * sizeof(bool));
 
-	SUIT_DBG("%p: Selected components: ", seq_exec_state->cmd_seq_str.value);
+	unsigned int selected_mask = 0;
+
 	for (size_t i = 0; i < SUIT_MAX_NUM_COMPONENTS; i++) {
 		if (seq_exec_state->current_components[i]) {
-			SUIT_DBG_RAW("%d ", i);
+			selected_mask |= (1U << i);
 		}
 	}
-	SUIT_DBG_RAW("\r\n");
+	SUIT_LOG_DBG(COMPONENTS_RECOVERED, selected_mask);
 
 	return SUIT_SUCCESS;
 }
@@ -185,9 +210,8 @@ int suit_seq_exec_schedule(struct suit_processor_state *state, struct suit_manif
 	return SUIT_ERR_OVERFLOW;
 }
 
-int suit_seq_exec_step(struct suit_processor_state *state)
+static int seq_exec_step(struct suit_processor_state *state, suit_command_t *command)
 {
-	suit_command_t command = {0};
 	size_t decoded_len = 0;
 	struct suit_seq_exec_state *seq_exec_state = NULL;
 
@@ -238,10 +262,10 @@ int suit_seq_exec_step(struct suit_processor_state *state)
 	while (seq_exec_state->current_command < seq_exec_state->n_commands) {
 		if (cbor_decode_SUIT_Condition(
 			d_state->payload, d_state->payload_end - d_state->payload,
-			&command.condition, &decoded_len) == ZCBOR_SUCCESS) {
-			SUIT_DBG("%d: Condition %d found\r\n",
+			&command->condition, &decoded_len) == ZCBOR_SUCCESS) {
+			SUIT_LOG_DBG(CONDITION_FOUND,
 				seq_exec_state->current_command,
-				command.condition.SUIT_Condition_choice);
+				command->condition.SUIT_Condition_choice);
 
 			if (seq_exec_state->current_command == 0) {
 				/* If there is only one component, or the internal sequence is executed,
@@ -253,16 +277,19 @@ int suit_seq_exec_step(struct suit_processor_state *state)
 				}
 			}
 
-			command.type = SUIT_COMMAND_CONDITION;
+			command->type = SUIT_COMMAND_CONDITION;
+#ifdef SUIT_PLATFORM_REPORT_SUPPORT
+			command->rep_policy = rep_policy_get(d_state->payload, decoded_len);
+#endif /* SUIT_PLATFORM_REPORT_SUPPORT */
 			d_state->payload += decoded_len;
 		}
 
 		else if (cbor_decode_SUIT_Directive(
 			d_state->payload, d_state->payload_end - d_state->payload,
-			&command.directive, &decoded_len) == ZCBOR_SUCCESS) {
-			SUIT_DBG("%d: Directive %d found\r\n",
+			&command->directive, &decoded_len) == ZCBOR_SUCCESS) {
+			SUIT_LOG_DBG(DIRECTIVE_FOUND,
 				seq_exec_state->current_command,
-				command.directive.SUIT_Directive_choice);
+				command->directive.SUIT_Directive_choice);
 
 			if (seq_exec_state->current_command == 0) {
 				/* If there is only one component, or the internal sequence is executed,
@@ -270,25 +297,41 @@ int suit_seq_exec_step(struct suit_processor_state *state)
 				 */
 				if ((seq_exec_state->manifest->components_count != 1) &&
 				    (state->seq_stack_height < 2) &&
-				    (command.directive.SUIT_Directive_choice
+				    (command->directive.SUIT_Directive_choice
 					!= SUIT_Directive_suit_directive_set_component_index_m_l_c)) {
 					SUIT_ERR("Each sequence should begin with a set-component-index command\r\n");
 					return SUIT_ERR_MANIFEST_VALIDATION;
 				}
 			}
 
-			command.type = SUIT_COMMAND_DIRECTIVE;
+			command->type = SUIT_COMMAND_DIRECTIVE;
+#ifdef SUIT_PLATFORM_REPORT_SUPPORT
+			/* The set-component-index is the only directive with an integer argument,
+			 * that is not a reporting policy.
+			 */
+			if (command->directive.SUIT_Directive_choice
+			    != SUIT_Directive_suit_directive_set_component_index_m_l_c) {
+				command->rep_policy = rep_policy_get(d_state->payload, decoded_len);
+			}
+#endif /* SUIT_PLATFORM_REPORT_SUPPORT */
 			d_state->payload += decoded_len;
 		} else {
 			SUIT_DBG("%d: Unknown command found!\r\n", seq_exec_state->current_command);
 			return SUIT_ERR_DECODING;
 		}
 
-		int retval = seq_exec_state->cmd_processor(state, &command);
+		int retval = SUIT_TRACE(suit_trace_command_event(command),
+					seq_exec_state->cmd_processor(state, command));
 		if (retval == SUIT_SUCCESS) {
 			seq_exec_state->exec_ptr = d_state->payload;
 			seq_exec_state->current_command++;
 			seq_exec_state->cmd_exec_state = SUIT_SEQ_EXEC_DEFAULT_STATE;
+#ifdef SUIT_PLATFORM_CHECKPOINT_SUPPORT
+			if (command->type == SUIT_COMMAND_DIRECTIVE) {
+				/* A failure to store the checkpoint should not break the update. */
+				(void)suit_checkpoint_commit(state);
+			}
+#endif /* SUIT_PLATFORM_CHECKPOINT_SUPPORT */
 			continue;
 		}
 		else if (retval == SUIT_ERR_AGAIN) {
@@ -307,6 +350,25 @@ int suit_seq_exec_step(struct suit_processor_state *state)
 	return SUIT_ERR_DECODING;
 }
 
+int suit_seq_exec_step(struct suit_processor_state *state)
+{
+	/* The decoded command is allocated from the scratch region, so it does not occupy the stack
+	 * while the nested calls (i.e. dependency manifest decoding) are executed.
+	 */
+	size_t arena_mark = suit_arena_mark();
+	suit_command_t *command = suit_arena_alloc(sizeof(*command));
+	int ret;
+
+	if (command == NULL) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	ret = seq_exec_step(state, command);
+	suit_arena_release(arena_mark);
+
+	return ret;
+}
+
 int suit_seq_exec_state_get(struct suit_processor_state *state, struct suit_seq_exec_state **seq_exec_state)
 {
 	if (seq_exec_state == NULL) {
@@ -405,9 +467,7 @@ int suit_seq_exec_component_idx_next(struct suit_seq_exec_state *seq_exec_state,
 
 	if (*component_idx != SUIT_MAX_NUM_COMPONENTS) {
 		seq_exec_state->current_component_idx = *component_idx;
-		SUIT_DBG("%p: Select component %d\r\n",
-			seq_exec_state->cmd_seq_str.value,
-			*component_idx);
+		SUIT_LOG_DBG(COMPONENT_SELECTED, *component_idx);
 		seq_exec_state->current_components[*component_idx] = true;
 	} else {
 		/* If executed for the last time - restore components from the backup. */
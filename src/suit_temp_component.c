@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zcbor_decode.h>
+#include <suit_platform.h>
+#include <suit_temp_component.h>
+
+#define PREFIX_LEN (sizeof(SUIT_TEMP_COMPONENT_PREFIX) - 1)
+
+
+/* Decode the bstr-wrapped unsigned integer. */
+static bool wrapped_uint_decode(zcbor_state_t *state, size_t *value)
+{
+	struct zcbor_string bstr;
+	uint32_t result;
+
+	if (!zcbor_bstr_decode(state, &bstr)) {
+		return false;
+	}
+
+	ZCBOR_STATE_D(inner_state, 0, bstr.value, bstr.len, 1, 0);
+
+	if (!zcbor_uint32_decode(inner_state, &result) ||
+	    (inner_state->payload != inner_state->payload_end)) {
+		return false;
+	}
+
+	*value = result;
+
+	return true;
+}
+
+int suit_temp_component_id_decode(struct zcbor_string *component_id,
+				  struct suit_temp_component_id *temp_id)
+{
+	struct zcbor_string prefix;
+	size_t elem_count;
+
+	if ((component_id == NULL) || (component_id->value == NULL) || (temp_id == NULL)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	ZCBOR_STATE_D(d_state, 1, component_id->value, component_id->len, 1, 0);
+
+	if (!zcbor_list_start_decode(d_state) || d_state->decode_state.indefinite_length_array) {
+		return SUIT_ERR_UNSUPPORTED_COMPONENT_ID;
+	}
+
+	elem_count = d_state->elem_count;
+
+	if (!zcbor_bstr_decode(d_state, &prefix) || (prefix.len != PREFIX_LEN) ||
+	    (memcmp(prefix.value, SUIT_TEMP_COMPONENT_PREFIX, PREFIX_LEN) != 0)) {
+		return SUIT_ERR_UNSUPPORTED_COMPONENT_ID;
+	}
+
+	if ((elem_count != 4) && (elem_count != 5)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	memset(temp_id, 0, sizeof(*temp_id));
+
+	if (!zcbor_bstr_decode(d_state, &temp_id->uid) ||
+	    !wrapped_uint_decode(d_state, &temp_id->size) ||
+	    !wrapped_uint_decode(d_state, &temp_id->align)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	if (temp_id->uid.len > SUIT_TEMP_UID_MAX_LEN) {
+		return SUIT_ERR_DECODING;
+	}
+
+	if ((elem_count == 5) && !zcbor_bstr_decode(d_state, &temp_id->context)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	if (!zcbor_list_end_decode(d_state) || (d_state->payload != d_state->payload_end)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	/* Zero alignment means that there are no requirements. */
+	if (temp_id->align == 0) {
+		temp_id->align = 1;
+	}
+
+	if ((temp_id->size == 0) || ((temp_id->align & (temp_id->align - 1)) != 0)) {
+		return SUIT_ERR_DECODING;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+int suit_temp_allocator_init(struct suit_temp_allocator *alloc, uintptr_t address, size_t size,
+			     struct suit_temp_region *regions, size_t regions_max)
+{
+	if ((alloc == NULL) || (regions == NULL) || (regions_max == 0) || (size == 0) ||
+	    (address > (UINTPTR_MAX - size))) {
+		return SUIT_ERR_CRASH;
+	}
+
+	memset(alloc, 0, sizeof(*alloc));
+	alloc->area_address = address;
+	alloc->area_size = size;
+	alloc->regions = regions;
+	alloc->regions_max = regions_max;
+
+	return SUIT_SUCCESS;
+}
+
+/* Return the offset of the first address, aligned to the align, at or above the offset. */
+static bool align_offset(const struct suit_temp_allocator *alloc, size_t offset, size_t align,
+			 size_t *aligned)
+{
+	uintptr_t address = alloc->area_address + offset;
+	uintptr_t misalignment = address & (align - 1);
+
+	*aligned = offset;
+
+	if (misalignment != 0) {
+		if ((align - misalignment) > (alloc->area_size - offset)) {
+			return false;
+		}
+
+		*aligned += align - misalignment;
+	}
+
+	return true;
+}
+
+static void region_insert(struct suit_temp_allocator *alloc, size_t idx, size_t offset, size_t size,
+			  bool used)
+{
+	memmove(&alloc->regions[idx + 1], &alloc->regions[idx],
+		(alloc->regions_count - idx) * sizeof(struct suit_temp_region));
+	memset(&alloc->regions[idx], 0, sizeof(struct suit_temp_region));
+
+	alloc->regions[idx].offset = offset;
+	alloc->regions[idx].size = size;
+	alloc->regions[idx].used = used;
+	alloc->regions_count++;
+}
+
+static void region_set_uid(struct suit_temp_region *region, const struct zcbor_string *uid)
+{
+	memcpy(region->uid, uid->value, uid->len);
+	region->uid_len = (uint8_t)uid->len;
+}
+
+static void region_remove(struct suit_temp_allocator *alloc, size_t idx)
+{
+	alloc->regions_count--;
+	memmove(&alloc->regions[idx], &alloc->regions[idx + 1],
+		(alloc->regions_count - idx) * sizeof(struct suit_temp_region));
+}
+
+/* Try to place the component inside the free region, splitting off the unused parts. */
+static bool first_fit(struct suit_temp_allocator *alloc, size_t idx,
+		      const struct suit_temp_component_id *temp_id)
+{
+	struct suit_temp_region *region = &alloc->regions[idx];
+	size_t start;
+
+	if (!align_offset(alloc, region->offset, temp_id->align, &start) ||
+	    ((start - region->offset) > region->size) ||
+	    (temp_id->size > (region->size - (start - region->offset)))) {
+		return false;
+	}
+
+	size_t head = start - region->offset;
+	size_t tail = region->size - head - temp_id->size;
+
+	if ((alloc->regions_count + (head != 0) + (tail != 0)) > alloc->regions_max) {
+		return false;
+	}
+
+	if (tail != 0) {
+		region_insert(alloc, idx + 1, start + temp_id->size, tail, false);
+	}
+
+	if (head != 0) {
+		alloc->regions[idx].size = head;
+		idx++;
+		region_insert(alloc, idx, start, temp_id->size, true);
+	} else {
+		alloc->regions[idx].size = temp_id->size;
+		alloc->regions[idx].used = true;
+	}
+
+	region_set_uid(&alloc->regions[idx], &temp_id->uid);
+
+	return true;
+}
+
+/* Place the component above the top, extending the last free region with the alignment padding. */
+static bool bump(struct suit_temp_allocator *alloc, const struct suit_temp_component_id *temp_id)
+{
+	size_t start;
+	bool merge_head = false;
+
+	if (!align_offset(alloc, alloc->top, temp_id->align, &start) ||
+	    (temp_id->size > (alloc->area_size - start))) {
+		return false;
+	}
+
+	if ((start != alloc->top) && (alloc->regions_count > 0)) {
+		merge_head = !alloc->regions[alloc->regions_count - 1].used;
+	}
+
+	if ((alloc->regions_count + 1 + ((start != alloc->top) && !merge_head)) > alloc->regions_max) {
+		return false;
+	}
+
+	if (merge_head) {
+		alloc->regions[alloc->regions_count - 1].size += start - alloc->top;
+	} else if (start != alloc->top) {
+		region_insert(alloc, alloc->regions_count, alloc->top, start - alloc->top, false);
+	}
+
+	region_insert(alloc, alloc->regions_count, start, temp_id->size, true);
+	region_set_uid(&alloc->regions[alloc->regions_count - 1], &temp_id->uid);
+	alloc->top = start + temp_id->size;
+
+	return true;
+}
+
+int suit_temp_alloc(struct suit_temp_allocator *alloc, const struct suit_temp_component_id *temp_id,
+		    uintptr_t *address)
+{
+	if ((alloc == NULL) || (alloc->regions == NULL) || (temp_id == NULL) || (address == NULL) ||
+	    (temp_id->size == 0) || (temp_id->align == 0) ||
+	    ((temp_id->align & (temp_id->align - 1)) != 0)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if ((temp_id->uid.len > SUIT_TEMP_UID_MAX_LEN) ||
+	    ((temp_id->uid.len > 0) && (temp_id->uid.value == NULL))) {
+		SUIT_ERR("Temporary component UID too long (len: %u)\r\n", (unsigned int)temp_id->uid.len);
+		return SUIT_ERR_UNSUPPORTED_COMPONENT_ID;
+	}
+
+	for (size_t i = 0; i < alloc->regions_count; i++) {
+		struct suit_temp_region *region = &alloc->regions[i];
+
+		if (!region->used || (region->uid_len != temp_id->uid.len) ||
+		    (memcmp(region->uid, temp_id->uid.value, temp_id->uid.len) != 0)) {
+			continue;
+		}
+
+		if ((region->size != temp_id->size) ||
+		    (((alloc->area_address + region->offset) & (temp_id->align - 1)) != 0)) {
+			SUIT_ERR("Temporary component with the same UID, but different size or alignment\r\n");
+			return SUIT_ERR_UNSUPPORTED_COMPONENT_ID;
+		}
+
+		*address = alloc->area_address + region->offset;
+		return SUIT_SUCCESS;
+	}
+
+	for (size_t i = 0; i < alloc->regions_count; i++) {
+		if (!alloc->regions[i].used && first_fit(alloc, i, temp_id)) {
+			/* The allocated region is either at the same index or right after the head. */
+			size_t idx = alloc->regions[i].used ? i : i + 1;
+
+			*address = alloc->area_address + alloc->regions[idx].offset;
+			return SUIT_SUCCESS;
+		}
+	}
+
+	if (bump(alloc, temp_id)) {
+		*address = alloc->area_address + alloc->regions[alloc->regions_count - 1].offset;
+		return SUIT_SUCCESS;
+	}
+
+	SUIT_ERR("Unable to allocate temporary component (size: %u)\r\n", (unsigned int)temp_id->size);
+
+	return SUIT_ERR_OVERFLOW;
+}
+
+int suit_temp_free(struct suit_temp_allocator *alloc, uintptr_t address)
+{
+	size_t idx;
+
+	if ((alloc == NULL) || (alloc->regions == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	for (idx = 0; idx < alloc->regions_count; idx++) {
+		if (alloc->regions[idx].used &&
+		    ((alloc->area_address + alloc->regions[idx].offset) == address)) {
+			break;
+		}
+	}
+
+	if (idx == alloc->regions_count) {
+		return SUIT_ERR_MISSING_COMPONENT;
+	}
+
+	alloc->regions[idx].used = false;
+	alloc->regions[idx].uid_len = 0;
+
+	/* Merge with the following free region. */
+	if (((idx + 1) < alloc->regions_count) && !alloc->regions[idx + 1].used) {
+		alloc->regions[idx].size += alloc->regions[idx + 1].size;
+		region_remove(alloc, idx + 1);
+	}
+
+	/* Merge with the preceding free region. */
+	if ((idx > 0) && !alloc->regions[idx - 1].used) {
+		alloc->regions[idx - 1].size += alloc->regions[idx].size;
+		region_remove(alloc, idx);
+		idx--;
+	}
+
+	/* The free region at the end returns to the bump allocator. */
+	if ((idx + 1) == alloc->regions_count) {
+		alloc->top = alloc->regions[idx].offset;
+		region_remove(alloc, idx);
+	}
+
+	return SUIT_SUCCESS;
+}
+
+int suit_temp_free_all(struct suit_temp_allocator *alloc)
+{
+	if ((alloc == NULL) || (alloc->regions == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	alloc->regions_count = 0;
+	alloc->top = 0;
+
+	return SUIT_SUCCESS;
+}
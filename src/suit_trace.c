@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <suit_trace.h>
+#include <suit_platform.h>
+
+static struct suit_trace_stats stats[SUIT_TRACE_EVENT_MAX];
+#ifdef SUIT_PLATFORM_TRACE_SUPPORT
+static uint32_t start_timestamps[SUIT_TRACE_MAX_DEPTH];
+static size_t depth;
+#endif /* SUIT_PLATFORM_TRACE_SUPPORT */
+
+
+void suit_trace_record(enum suit_trace_event event, uint32_t duration)
+{
+	if (event >= SUIT_TRACE_EVENT_MAX) {
+		return;
+	}
+
+	struct suit_trace_stats *event_stats = &stats[event];
+
+	if ((event_stats->count == 0) || (duration < event_stats->min)) {
+		event_stats->min = duration;
+	}
+
+	if (duration > event_stats->max) {
+		event_stats->max = duration;
+	}
+
+	event_stats->count++;
+	event_stats->total += duration;
+}
+
+#ifdef SUIT_PLATFORM_TRACE_SUPPORT
+void suit_trace_begin(void)
+{
+	if (depth < SUIT_TRACE_MAX_DEPTH) {
+		start_timestamps[depth] = suit_plat_trace_timestamp();
+	}
+
+	depth++;
+}
+
+int suit_trace_end(enum suit_trace_event event, int result)
+{
+	if (depth == 0) {
+		return result;
+	}
+
+	depth--;
+
+	if (depth < SUIT_TRACE_MAX_DEPTH) {
+		/* The unsigned subtraction handles a single wrap of the timestamp. */
+		suit_trace_record(event, suit_plat_trace_timestamp() - start_timestamps[depth]);
+	}
+
+	return result;
+}
+#endif /* SUIT_PLATFORM_TRACE_SUPPORT */
+
+enum suit_trace_event suit_trace_command_event(const suit_command_t *command)
+{
+	if (command == NULL) {
+		return SUIT_TRACE_CMD_OTHER;
+	}
+
+	if (command->type == SUIT_COMMAND_CONDITION) {
+		switch (command->condition.SUIT_Condition_choice) {
+		case SUIT_Condition_suit_condition_vendor_identifier_m_l_c:
+			return SUIT_TRACE_CMD_VENDOR_IDENTIFIER;
+		case SUIT_Condition_suit_condition_class_identifier_m_l_c:
+			return SUIT_TRACE_CMD_CLASS_IDENTIFIER;
+		case SUIT_Condition_suit_condition_device_identifier_m_l_c:
+			return SUIT_TRACE_CMD_DEVICE_IDENTIFIER;
+		case SUIT_Condition_suit_condition_image_match_m_l_c:
+			return SUIT_TRACE_CMD_IMAGE_MATCH;
+		case SUIT_Condition_suit_condition_component_slot_m_l_c:
+			return SUIT_TRACE_CMD_COMPONENT_SLOT;
+		case SUIT_Condition_suit_condition_check_content_m_l_c:
+			return SUIT_TRACE_CMD_CHECK_CONTENT;
+		case SUIT_Condition_suit_condition_dependency_integrity_m_l_c:
+			return SUIT_TRACE_CMD_DEPENDENCY_INTEGRITY;
+		case SUIT_Condition_suit_condition_is_dependency_m_l_c:
+			return SUIT_TRACE_CMD_IS_DEPENDENCY;
+		case SUIT_Condition_suit_condition_abort_m_l_c:
+			return SUIT_TRACE_CMD_ABORT;
+		case SUIT_Condition_suit_condition_version_m_l_c:
+			return SUIT_TRACE_CMD_VERSION;
+		default:
+			return SUIT_TRACE_CMD_OTHER;
+		}
+	} else if (command->type == SUIT_COMMAND_DIRECTIVE) {
+		switch (command->directive.SUIT_Directive_choice) {
+		case SUIT_Directive_suit_directive_set_component_index_m_l_c:
+			return SUIT_TRACE_CMD_SET_COMPONENT_INDEX;
+		case SUIT_Directive_suit_directive_override_parameters_m_l_c:
+			return SUIT_TRACE_CMD_OVERRIDE_PARAMETERS;
+		case SUIT_Directive_suit_directive_set_parameters_m_l_c:
+			return SUIT_TRACE_CMD_SET_PARAMETERS;
+		case SUIT_Directive_suit_directive_try_each_m_l_c:
+			return SUIT_TRACE_CMD_TRY_EACH;
+		case SUIT_Directive_suit_directive_run_sequence_m_l_c:
+			return SUIT_TRACE_CMD_RUN_SEQUENCE;
+		case SUIT_Directive_suit_directive_process_dependency_m_l_c:
+			return SUIT_TRACE_CMD_PROCESS_DEPENDENCY;
+		case SUIT_Directive_suit_directive_fetch_m_l_c:
+			return SUIT_TRACE_CMD_FETCH;
+		case SUIT_Directive_suit_directive_copy_m_l_c:
+			return SUIT_TRACE_CMD_COPY;
+		case SUIT_Directive_suit_directive_swap_m_l_c:
+			return SUIT_TRACE_CMD_SWAP;
+		case SUIT_Directive_suit_directive_write_m_l_c:
+			return SUIT_TRACE_CMD_WRITE;
+		case SUIT_Directive_suit_directive_invoke_m_l_c:
+			return SUIT_TRACE_CMD_INVOKE;
+		case SUIT_Directive_suit_directive_custom_apply_delta_m_l_c:
+			return SUIT_TRACE_CMD_APPLY_DELTA;
+		default:
+			return SUIT_TRACE_CMD_OTHER;
+		}
+	}
+
+	return SUIT_TRACE_CMD_OTHER;
+}
+
+int suit_trace_snapshot(struct suit_trace_stats *stats_out, size_t count)
+{
+	if (stats_out == NULL) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if (count > SUIT_TRACE_EVENT_MAX) {
+		count = SUIT_TRACE_EVENT_MAX;
+	}
+
+	memcpy(stats_out, stats, count * sizeof(struct suit_trace_stats));
+
+	return SUIT_SUCCESS;
+}
+
+void suit_trace_reset(void)
+{
+	memset(stats, 0, sizeof(stats));
+#ifdef SUIT_PLATFORM_TRACE_SUPPORT
+	depth = 0;
+#endif /* SUIT_PLATFORM_TRACE_SUPPORT */
+}
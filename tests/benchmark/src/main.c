@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit.h>
+#include <suit_decoder.h>
+#include <suit_manifest.h>
+#include <suit_schedule_seq.h>
+#include <suit_arena.h>
+#include <bootstrap_envelope.h>
+#include <bootstrap_seq.h>
+#include <platform_stub.h>
+
+/* The number of measurements of each benchmark. */
+#define BENCH_ITERATIONS 16
+
+/* The maximum number of commands in the generated sequences. */
+#define BENCH_MAX_SEQ_LEN 64
+
+/* The sample envelope with two integrated dependency manifests. */
+extern uint8_t manifest_buf[];
+extern const size_t manifest_len;
+
+struct bench_result {
+	uint64_t min;
+	uint64_t total;
+	uint32_t count;
+	int status;
+};
+
+static struct suit_processor_state state;
+static struct suit_decoder_state decoder_state;
+static struct suit_manifest_state decoder_manifest;
+static uint8_t cmd_buf[BENCH_MAX_SEQ_LEN * 2 + 32];
+
+static uint8_t vid_override_cmd[] = {
+	0x14, /* uint(suit-directive-override-parameters) */
+		0xa1, /* map (1 element) */
+		0x01, /* uint(suit-parameter-vendor-identifier) */
+		0x50, /* bytes (16) */
+			0x76, 0x17, 0xda, 0xa5, 0x71, 0xfd, 0x5a, 0x85, /* RFC4122_UUID(nordicsemi.com) */
+			0x8f, 0x94, 0xe2, 0x8d, 0x73, 0x5c, 0xe9, 0xf4,
+};
+
+static uint8_t vid_check_cmd[] = {
+	0x01, /* uint(suit-condition-vendor-identifier) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
+
+static uint8_t invoke_cmd[] = {
+	0x82, /* list (2 elements - 1 command) */
+	0x17, /* uint(suit-directive-invoke) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
+
+#ifndef SUIT_PRUNE_DEPENDENCIES
+static uint8_t process_dependency_cmd[] = {
+	0x82, /* list (2 elements - 1 command) */
+	0x18, 0x0b, /* uint(suit-directive-process-dependency) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
+#endif /* SUIT_PRUNE_DEPENDENCIES */
+
+
+static inline uint64_t bench_timestamp(void)
+{
+#if defined(CONFIG_ARCH_POSIX) && (defined(__x86_64__) || defined(__i386__))
+	/* The simulated time does not advance while the code executes, so use the host TSC. */
+	return __builtin_ia32_rdtsc();
+#else
+	return k_cycle_get_32();
+#endif
+}
+
+static void bench_record(struct bench_result *result, uint64_t start, int status)
+{
+#if defined(CONFIG_ARCH_POSIX) && (defined(__x86_64__) || defined(__i386__))
+	uint64_t elapsed = bench_timestamp() - start;
+#else
+	/* The 32-bit cycle counter may wrap once between the measurements. */
+	uint64_t elapsed = (uint32_t)(bench_timestamp() - start);
+#endif
+
+	if ((result->count == 0) || (elapsed < result->min)) {
+		result->min = elapsed;
+	}
+
+	result->total += elapsed;
+	result->count++;
+
+	if ((status != SUIT_SUCCESS) && (result->status == SUIT_SUCCESS)) {
+		result->status = status;
+	}
+}
+
+/** @brief Print the result as a single JSON object, prefixed with SUIT_BENCH. */
+static void bench_report(const char *name, const char *param_name, unsigned int param,
+			 const struct bench_result *result)
+{
+	uint64_t avg = (result->count > 0) ? (result->total / result->count) : 0;
+
+	printk("SUIT_BENCH {\"name\":\"%s\",\"%s\":%u,\"iterations\":%u,"
+	       "\"cycles_min\":%llu,\"cycles_avg\":%llu",
+	       name, param_name, param, result->count, (unsigned long long)result->min,
+	       (unsigned long long)avg);
+#ifdef CONFIG_QEMU_ICOUNT
+	/* With icount, the virtual clock advances by 2^shift ns per executed instruction. */
+	printk(",\"insns_min\":%llu,\"insns_avg\":%llu",
+	       (unsigned long long)(k_cyc_to_ns_floor64(result->min) >> CONFIG_QEMU_ICOUNT_SHIFT),
+	       (unsigned long long)(k_cyc_to_ns_floor64(avg) >> CONFIG_QEMU_ICOUNT_SHIFT));
+#endif /* CONFIG_QEMU_ICOUNT */
+	printk(",\"status\":%d}\n", result->status);
+}
+
+/** @brief Print the size of the structure, that is statically allocated by the SUIT processor. */
+static void bench_report_size(const char *name, size_t size)
+{
+	printk("SUIT_BENCH {\"name\":\"sizeof\",\"struct\":\"%s\",\"bytes\":%u,\"status\":0}\n",
+	       name, (unsigned int)size);
+}
+
+static void bench_footprint(void)
+{
+	bench_report_size("suit_processor_state", sizeof(struct suit_processor_state));
+	bench_report_size("suit_manifest_state", sizeof(struct suit_manifest_state));
+	bench_report_size("suit_manifest_params", sizeof(struct suit_manifest_params));
+	bench_report_size("suit_seq_exec_state", sizeof(struct suit_seq_exec_state));
+	bench_report_size("suit_arena", SUIT_ARENA_MIN_SIZE);
+}
+
+static void bench_state_reset(size_t num_components)
+{
+	memset(&state, 0, sizeof(state));
+	platform_stub_reset();
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, num_components);
+}
+
+static int bench_process_scheduled(int ret)
+{
+	if (ret == SUIT_ERR_AGAIN) {
+		ret = suit_process_scheduled(&state);
+	}
+
+	return ret;
+}
+
+/** @brief Measure validation and execution of the sequence, set as suit-invoke. */
+static void bench_sequence(const char *name, const char *param_name, unsigned int param,
+			   size_t num_components, struct zcbor_string *seq)
+{
+	struct bench_result validation = {0};
+	struct bench_result execution = {0};
+	char name_buf[48];
+
+	for (size_t i = 0; i < BENCH_ITERATIONS; i++) {
+		bench_state_reset(num_components);
+		bootstrap_envelope_sequence(&state, SUIT_SEQ_INVOKE, seq);
+
+		uint64_t start = bench_timestamp();
+		int ret = bench_process_scheduled(
+			suit_schedule_validation(&state, &state.manifest_stack[0], SUIT_SEQ_INVOKE));
+		bench_record(&validation, start, ret);
+
+		start = bench_timestamp();
+		ret = bench_process_scheduled(
+			suit_schedule_execution(&state, &state.manifest_stack[0], SUIT_SEQ_INVOKE));
+		bench_record(&execution, start, ret);
+	}
+
+	snprintk(name_buf, sizeof(name_buf), "%s_validation", name);
+	bench_report(name_buf, param_name, param, &validation);
+	snprintk(name_buf, sizeof(name_buf), "%s_execution", name);
+	bench_report(name_buf, param_name, param, &execution);
+}
+
+/** @brief Construct a sequence of the given commands, prefixed by the vendor ID override.
+ *
+ * @param[in]  all_components  Select all components before executing the commands.
+ * @param[in]  cmd             Encoded commands, together with their arguments.
+ * @param[in]  cmd_len         Length of the encoded commands.
+ * @param[in]  cmd_elements    Number of CBOR elements inside the encoded commands.
+ * @param[in]  count           Number of repetitions of the commands.
+ *
+ * @returns Length of the constructed sequence.
+ */
+static size_t bench_seq_construct(bool all_components, const uint8_t *cmd, size_t cmd_len,
+				  size_t cmd_elements, size_t count)
+{
+	size_t elements = (count * cmd_elements) + 2 + (all_components ? 2 : 0);
+	size_t len = 0;
+
+	if (elements < 24) {
+		cmd_buf[len++] = 0x80 + elements;
+	} else {
+		cmd_buf[len++] = 0x98;
+		cmd_buf[len++] = elements;
+	}
+
+	if (all_components) {
+		cmd_buf[len++] = 0x0c; /* uint(suit-directive-set-component-index) */
+		cmd_buf[len++] = 0xf5; /* true */
+	}
+
+	memcpy(&cmd_buf[len], vid_override_cmd, sizeof(vid_override_cmd));
+	len += sizeof(vid_override_cmd);
+
+	for (size_t i = 0; i < count; i++) {
+		memcpy(&cmd_buf[len], cmd, cmd_len);
+		len += cmd_len;
+	}
+
+	return len;
+}
+
+static void bench_decoder(void)
+{
+	static const char *names[] = {
+		"decode_envelope",
+		"check_manifest_digest",
+		"decode_manifest",
+		"authenticate_manifest",
+		"authorize_manifest",
+		"decode_sequences",
+	};
+	struct bench_result results[ZCBOR_ARRAY_SIZE(names)] = {0};
+
+	for (size_t i = 0; i < BENCH_ITERATIONS; i++) {
+		int ret = SUIT_SUCCESS;
+		uint64_t start;
+
+		memset(&decoder_manifest, 0, sizeof(decoder_manifest));
+		(void)suit_decoder_init(&decoder_state, &decoder_manifest);
+
+		for (size_t step = 0; (step < ZCBOR_ARRAY_SIZE(names)) && (ret == SUIT_SUCCESS); step++) {
+			start = bench_timestamp();
+			switch (step) {
+			case 0:
+				ret = suit_decoder_decode_envelope(&decoder_state, manifest_buf, manifest_len);
+				break;
+			case 1:
+				ret = suit_decoder_check_manifest_digest(&decoder_state);
+				break;
+			case 2:
+				ret = suit_decoder_decode_manifest(&decoder_state);
+				break;
+			case 3:
+				ret = suit_decoder_authenticate_manifest(&decoder_state);
+				break;
+			case 4:
+				ret = suit_decoder_authorize_manifest(&decoder_state);
+				break;
+			default:
+				ret = suit_decoder_decode_sequences(&decoder_state);
+				break;
+			}
+			bench_record(&results[step], start, ret);
+		}
+	}
+
+	for (size_t step = 0; step < ZCBOR_ARRAY_SIZE(names); step++) {
+		bench_report(names[step], "envelope_len", manifest_len, &results[step]);
+	}
+}
+
+static void bench_manifest_metadata(void)
+{
+	struct bench_result result = {0};
+	struct zcbor_string manifest_component_id;
+	struct zcbor_string digest;
+	enum suit_cose_alg alg;
+	unsigned int seq_num;
+
+	for (size_t i = 0; i < BENCH_ITERATIONS; i++) {
+		uint64_t start = bench_timestamp();
+		int ret = suit_processor_get_manifest_metadata(manifest_buf, manifest_len, true,
+			&manifest_component_id, NULL, NULL, &digest, &alg, &seq_num);
+		bench_record(&result, start, ret);
+	}
+
+	bench_report("get_manifest_metadata", "envelope_len", manifest_len, &result);
+}
+
+static void bench_process_sequence(void)
+{
+	const enum suit_command_sequence seqs[] = {
+		SUIT_SEQ_PARSE,
+		SUIT_SEQ_DEP_RESOLUTION,
+		SUIT_SEQ_PAYLOAD_FETCH,
+		SUIT_SEQ_INSTALL,
+		SUIT_SEQ_VALIDATE,
+		SUIT_SEQ_LOAD,
+		SUIT_SEQ_INVOKE,
+	};
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(seqs); i++) {
+		struct bench_result result = {0};
+
+		for (size_t j = 0; j < BENCH_ITERATIONS; j++) {
+			platform_stub_reset();
+
+			uint64_t start = bench_timestamp();
+			int ret = suit_process_sequence(manifest_buf, manifest_len, seqs[i]);
+			bench_record(&result, start, ret);
+		}
+
+		bench_report("process_sequence", "seq", seqs[i], &result);
+	}
+}
+
+#ifndef SUIT_PRUNE_DEPENDENCIES
+static void bench_dependency_depth(void)
+{
+	struct zcbor_string seq = {
+		.value = process_dependency_cmd,
+		.len = sizeof(process_dependency_cmd),
+	};
+	struct bench_result result = {0};
+
+	/* A single level of dependencies is processed by the sample envelope itself. */
+	for (size_t i = 0; i < BENCH_ITERATIONS; i++) {
+		platform_stub_reset();
+
+		uint64_t start = bench_timestamp();
+		int ret = suit_process_sequence(manifest_buf, manifest_len, SUIT_SEQ_INSTALL);
+		bench_record(&result, start, ret);
+	}
+	bench_report("dependency_install", "depth", 1, &result);
+
+	/* Add one more level by processing the sample envelope as a dependency. */
+	memset(&result, 0, sizeof(result));
+	for (size_t i = 0; i < BENCH_ITERATIONS; i++) {
+		struct suit_manifest_params *params = &state.components[0];
+		struct zcbor_string payload = {
+			.value = manifest_buf,
+			.len = manifest_len,
+		};
+
+		bench_state_reset(0);
+		bootstrap_envelope_dependency_components(&state, 1);
+		bootstrap_envelope_sequence(&state, SUIT_SEQ_INSTALL, &seq);
+		state.current_seq = SUIT_SEQ_INSTALL;
+
+		/* Store the envelope inside the dependency component of the stub platform. */
+		(void)suit_plat_create_component_handle(&payload, true, &params->component_handle);
+		(void)suit_plat_write(params->component_handle, &payload, NULL, NULL, NULL);
+		params->integrity_checked = true;
+
+		uint64_t start = bench_timestamp();
+		int ret = bench_process_scheduled(
+			suit_schedule_execution(&state, &state.manifest_stack[0], SUIT_SEQ_INSTALL));
+		bench_record(&result, start, ret);
+
+		/* Release the components of the dependency manifests. */
+		while (state.manifest_stack_height > 1) {
+			state.manifest_stack_height--;
+			(void)suit_manifest_release(&state.manifest_stack[state.manifest_stack_height]);
+		}
+	}
+	bench_report("dependency_install", "depth", 2, &result);
+}
+#endif /* SUIT_PRUNE_DEPENDENCIES */
+
+static void bench_component_count(void)
+{
+	size_t counts[] = {1, 2, 4, 8, SUIT_MAX_NUM_COMPONENTS};
+	const uint8_t cmd[] = {
+		0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+		0x17, /* uint(suit-directive-invoke) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(counts); i++) {
+		struct zcbor_string seq = {
+			.value = cmd_buf,
+			.len = bench_seq_construct(true, cmd, sizeof(cmd), 4, 1),
+		};
+
+		bench_sequence("components", "components", counts[i], counts[i], &seq);
+	}
+}
+
+static void bench_sequence_length(void)
+{
+	size_t lengths[] = {1, 4, 16, BENCH_MAX_SEQ_LEN};
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(lengths); i++) {
+		struct zcbor_string seq = {
+			.value = cmd_buf,
+			.len = bench_seq_construct(false, vid_check_cmd, sizeof(vid_check_cmd), 2,
+						   lengths[i]),
+		};
+
+		bench_sequence("sequence_length", "commands", lengths[i], 1, &seq);
+	}
+}
+
+static void bench_nesting(const char *name, bootsrap_seq_hdr_generator_t hdr_generator)
+{
+	size_t content_size = sizeof(invoke_cmd);
+
+	memcpy(cmd_buf, invoke_cmd, sizeof(invoke_cmd));
+
+	for (size_t depth = 0; depth < SUIT_MAX_SEQ_DEPTH; depth++) {
+		struct zcbor_string seq = {
+			.value = cmd_buf,
+			.len = content_size,
+		};
+
+		bench_sequence(name, "depth", depth, 1, &seq);
+		content_size = hdr_generator(cmd_buf, sizeof(cmd_buf), content_size);
+	}
+}
+
+int main(void)
+{
+	/* Share the component parameters between the bootstrapped and loaded manifests. */
+	(void)suit_manifest_params_init(state.components, ZCBOR_ARRAY_SIZE(state.components));
+	(void)suit_processor_init();
+
+	printk("SUIT_BENCH_START {\"board\":\"%s\",\"iterations\":%u,"
+	       "\"prune_encryption\":%d,\"prune_fetch\":%d,\"prune_dependencies\":%d}\n",
+	       CONFIG_BOARD, BENCH_ITERATIONS, IS_ENABLED(CONFIG_SUIT_PRUNE_ENCRYPTION),
+	       IS_ENABLED(CONFIG_SUIT_PRUNE_FETCH), IS_ENABLED(CONFIG_SUIT_PRUNE_DEPENDENCIES));
+
+	bench_footprint();
+	bench_decoder();
+	bench_manifest_metadata();
+
+	bench_state_reset(0);
+	bench_process_sequence();
+#ifndef SUIT_PRUNE_DEPENDENCIES
+	bench_dependency_depth();
+#endif /* SUIT_PRUNE_DEPENDENCIES */
+
+	bench_component_count();
+	bench_sequence_length();
+	bench_nesting("try_each_nesting", bootsrap_seq_hdr_try_each);
+	bench_nesting("run_sequence_nesting", bootsrap_seq_hdr_run_sequence);
+
+	/* The scratch region usage, reached by all of the scenarios above. */
+	bench_report_size("suit_arena_peak", suit_arena_peak());
+
+	printk("SUIT_BENCH_DONE\n");
+
+	return 0;
+}
@@ -36,3 +36,17 @@ target_link_libraries(cose PRIVATE zephyr_interface)
 target_link_libraries(app PRIVATE suit)
 
 zephyr_compile_definitions_ifdef(CONFIG_SUIT_PLATFORM_DRY_RUN_SUPPORT SUIT_PLATFORM_DRY_RUN_SUPPORT)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_PLATFORM_CHECKPOINT_SUPPORT SUIT_PLATFORM_CHECKPOINT_SUPPORT)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_PLATFORM_REPORT_SUPPORT SUIT_PLATFORM_REPORT_SUPPORT)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_PLATFORM_TRACE_SUPPORT SUIT_PLATFORM_TRACE_SUPPORT)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_PLATFORM_PREFETCH_SUPPORT SUIT_PLATFORM_PREFETCH_SUPPORT)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT SUIT_PLATFORM_CHUNKED_DIGEST_SUPPORT)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_LOG_BINARY SUIT_LOG_BINARY)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_ENVELOPE_16BIT_OFFSETS SUIT_ENVELOPE_16BIT_OFFSETS)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_ARENA_EXTERNAL SUIT_ARENA_EXTERNAL)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_PRUNE_ENCRYPTION SUIT_PRUNE_ENCRYPTION)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_PRUNE_FETCH SUIT_PRUNE_FETCH)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_PRUNE_DEPENDENCIES SUIT_PRUNE_DEPENDENCIES)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_CONDITION_MEMO SUIT_CONDITION_MEMO)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_SKIP_MATCHING_PAYLOADS SUIT_SKIP_MATCHING_PAYLOADS)
+zephyr_compile_definitions_ifdef(CONFIG_SUIT_DEDUP_PAYLOADS SUIT_DEDUP_PAYLOADS)
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <suit_manifest.h>
+#include <suit_schedule_seq.h>
+#include <suit_seq_exec.h>
+#include <suit_checkpoint.h>
+#include <bootstrap_envelope.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+#define SEQ_OFFSET 4
+#define VID_OFFSET (SEQ_OFFSET + 5)
+
+static struct suit_processor_state state;
+static struct suit_checkpoint checkpoint;
+
+static uint8_t envelope[] = {
+	0xd8, 0x6b, /* tag(107) : SUIT_Envelope_Tagged */
+	0xa2, /* map (2 elements) - not decoded by the test */
+	0x03, /* uint(suit-install) */
+
+	0x86, /* list (6 elements - 3 commands) */
+	0x14, /* uint(suit-directive-override-parameters) */
+		0xa1, /* map (1 element) */
+		0x01, /* uint(suit-parameter-vendor-identifier) */
+		0x50, /* bytes (16) */
+			0x76, 0x17, 0xda, 0xa5, 0x71, 0xfd, 0x5a, 0x85, /* RFC4122_UUID(nordicsemi.com) */
+			0x8f, 0x94, 0xe2, 0x8d, 0x73, 0x5c, 0xe9, 0xf4,
+	0x17, /* uint(suit-directive-invoke) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+	0x01, /* uint(suit-condition-vendor-identifier) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
+
+static uint8_t manifest_digest_bytes[] = {
+	0x82, /* array: 2 elements */
+		0x2f, /* int: cose-alg-sha-256 */
+		0x48, /* bytes(8) - shortened for test purposes */
+			0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+};
+
+static struct zcbor_string manifest_digest = {
+	.value = manifest_digest_bytes,
+	.len = sizeof(manifest_digest_bytes),
+};
+
+
+/* Execute the override-parameters directive and interrupt the execution of the invoke directive. */
+static seq_exec_processor_t interrupt_sequence(void)
+{
+	__cmock_suit_plat_invoke_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, NULL, SUIT_ERR_AGAIN);
+
+	int retval = suit_schedule_execution(&state, &state.manifest_stack[0], SUIT_SEQ_INSTALL);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+
+	retval = suit_seq_exec_step(&state);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+	TEST_ASSERT_EQUAL(1, state.seq_stack[0].current_command);
+
+	retval = suit_checkpoint_save(&state, &manifest_digest, &checkpoint);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+
+	return state.seq_stack[0].cmd_processor;
+}
+
+/* Drop all information, that is not recreated by loading the envelope. */
+static void simulate_reboot(void)
+{
+	memset(&state.seq_stack, 0, sizeof(state.seq_stack));
+	state.seq_stack_height = 0;
+	state.components[0].vid.value = NULL;
+	state.components[0].vid.len = 0;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_VID, false);
+}
+
+void setUp(void)
+{
+	memset(&state, 0, sizeof(state));
+	memset(&checkpoint, 0, sizeof(checkpoint));
+
+	int err = suit_manifest_params_init(state.components, ZCBOR_ARRAY_SIZE(state.components));
+	if (err == SUIT_ERR_ORDER) {
+		/* Allow to call init even if the manifest module is already initialized. */
+		err = SUIT_SUCCESS;
+	}
+
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, err, "Unable to initialize SUIT processor");
+
+	struct zcbor_string install_seq = {
+		.value = &envelope[SEQ_OFFSET],
+		.len = sizeof(envelope) - SEQ_OFFSET,
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+	state.manifest_stack[0].envelope_str.value = envelope;
+	state.manifest_stack[0].envelope_str.len = sizeof(envelope);
+	bootstrap_envelope_sequence(&state, SUIT_SEQ_INSTALL, &install_seq);
+	state.current_seq = SUIT_SEQ_INSTALL;
+}
+
+void test_checkpoint_save_offsets(void)
+{
+	(void)interrupt_sequence();
+
+	TEST_ASSERT_EQUAL(SUIT_CHECKPOINT_MAGIC, checkpoint.magic);
+	TEST_ASSERT_EQUAL(SUIT_SEQ_INSTALL, checkpoint.seq_name);
+	TEST_ASSERT_EQUAL(sizeof(manifest_digest_bytes), checkpoint.manifest_digest_len);
+	TEST_ASSERT_EQUAL_MEMORY(manifest_digest_bytes, checkpoint.manifest_digest, sizeof(manifest_digest_bytes));
+	TEST_ASSERT_EQUAL(1, checkpoint.components_count);
+	TEST_ASSERT_EQUAL(VID_OFFSET, checkpoint.params[0].vid.offset);
+	TEST_ASSERT_EQUAL(16, checkpoint.params[0].vid.len);
+	TEST_ASSERT_EQUAL(1, checkpoint.seq_stack_height);
+	TEST_ASSERT_EQUAL(SEQ_OFFSET, checkpoint.seq_stack[0].cmd_seq.offset);
+	TEST_ASSERT_EQUAL(sizeof(envelope) - SEQ_OFFSET, checkpoint.seq_stack[0].cmd_seq.len);
+	TEST_ASSERT_EQUAL(VID_OFFSET + 16, checkpoint.seq_stack[0].exec_offset);
+	TEST_ASSERT_EQUAL(3, checkpoint.seq_stack[0].n_commands);
+	TEST_ASSERT_EQUAL(1, checkpoint.seq_stack[0].current_command);
+	TEST_ASSERT_EQUAL(0, checkpoint.seq_stack[0].current_component_idx);
+	TEST_ASSERT_EQUAL(0x1, checkpoint.seq_stack[0].current_components);
+}
+
+void test_checkpoint_resume(void)
+{
+	struct zcbor_string exp_vid = {
+		.value = &envelope[VID_OFFSET],
+		.len = 16,
+	};
+	seq_exec_processor_t cmd_processor = interrupt_sequence();
+
+	simulate_reboot();
+
+	int retval = suit_checkpoint_restore(&state, &state.manifest_stack[0], &manifest_digest,
+					     &checkpoint, cmd_processor);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+	TEST_ASSERT_EQUAL(1, state.seq_stack_height);
+	TEST_ASSERT_TRUE(suit_param_is_set(&state.components[0], SUIT_PARAM_VID));
+
+	/* The execution continues from the interrupted invoke directive. */
+	__cmock_suit_plat_invoke_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_vid_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_vid, SUIT_SUCCESS);
+
+	retval = suit_process_scheduled(&state);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(0, state.seq_stack_height);
+}
+
+void test_checkpoint_resume_image_size(void)
+{
+	state.components[0].image_size = 0x1000;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_IMAGE_SIZE, true);
+
+	seq_exec_processor_t cmd_processor = interrupt_sequence();
+
+	simulate_reboot();
+	state.components[0].image_size = 0;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_IMAGE_SIZE, false);
+
+	/* The platform does not keep the image size after the reset. */
+	__cmock_suit_plat_override_image_size_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, 0x1000, NULL,
+							      SUIT_SUCCESS);
+	__cmock_suit_plat_override_image_size_IgnoreArg_manifest_component_id();
+
+	int retval = suit_checkpoint_restore(&state, &state.manifest_stack[0], &manifest_digest,
+					     &checkpoint, cmd_processor);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+	TEST_ASSERT_TRUE(suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE));
+	TEST_ASSERT_EQUAL(0x1000, state.components[0].image_size);
+}
+
+void test_checkpoint_restore_different_manifest(void)
+{
+	uint8_t other_digest_bytes[sizeof(manifest_digest_bytes)];
+	struct zcbor_string other_digest = {
+		.value = other_digest_bytes,
+		.len = sizeof(other_digest_bytes),
+	};
+	seq_exec_processor_t cmd_processor = interrupt_sequence();
+
+	memcpy(other_digest_bytes, manifest_digest_bytes, sizeof(other_digest_bytes));
+	other_digest_bytes[sizeof(other_digest_bytes) - 1] ^= 0xFF;
+	simulate_reboot();
+
+	int retval = suit_checkpoint_restore(&state, &state.manifest_stack[0], &other_digest,
+					     &checkpoint, cmd_processor);
+	TEST_ASSERT_EQUAL(SUIT_ERR_MANIFEST_VERIFICATION, retval);
+	TEST_ASSERT_EQUAL(0, state.seq_stack_height);
+	TEST_ASSERT_FALSE(suit_param_is_set(&state.components[0], SUIT_PARAM_VID));
+}
+
+void test_checkpoint_restore_different_sequence(void)
+{
+	seq_exec_processor_t cmd_processor = interrupt_sequence();
+
+	simulate_reboot();
+	state.current_seq = SUIT_SEQ_INVOKE;
+
+	int retval = suit_checkpoint_restore(&state, &state.manifest_stack[0], &manifest_digest,
+					     &checkpoint, cmd_processor);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+	TEST_ASSERT_EQUAL(0, state.seq_stack_height);
+}
+
+void test_checkpoint_restore_invalid_offsets(void)
+{
+	seq_exec_processor_t cmd_processor = interrupt_sequence();
+
+	simulate_reboot();
+	checkpoint.seq_stack[0].exec_offset = sizeof(envelope) + 1;
+
+	int retval = suit_checkpoint_restore(&state, &state.manifest_stack[0], &manifest_digest,
+					     &checkpoint, cmd_processor);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+	TEST_ASSERT_EQUAL(0, state.seq_stack_height);
+
+	checkpoint.seq_stack[0].exec_offset = VID_OFFSET + 16;
+	checkpoint.params[0].vid.offset = sizeof(envelope) - 8;
+
+	retval = suit_checkpoint_restore(&state, &state.manifest_stack[0], &manifest_digest,
+					 &checkpoint, cmd_processor);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+	TEST_ASSERT_EQUAL(0, state.seq_stack_height);
+	TEST_ASSERT_FALSE(suit_param_is_set(&state.components[0], SUIT_PARAM_VID));
+}
+
+void test_checkpoint_save_dependency_manifest(void)
+{
+	(void)interrupt_sequence();
+
+	/* Pretend that the dependency manifest is being processed. */
+	state.manifest_stack_height = 2;
+
+	int retval = suit_checkpoint_save(&state, &manifest_digest, &checkpoint);
+	TEST_ASSERT_EQUAL(SUIT_ERR_WAIT, retval);
+}
+
+void test_checkpoint_save_external_parameter(void)
+{
+	uint8_t external_vid[16] = {0};
+
+	(void)interrupt_sequence();
+
+	state.components[0].vid.value = external_vid;
+
+	int retval = suit_checkpoint_save(&state, &manifest_digest, &checkpoint);
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_PARAMETER, retval);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <suit_manifest.h>
+#include <suit_schedule_seq.h>
+#include <suit_seq_exec.h>
+#include <suit_checkpoint.h>
+#include <bootstrap_envelope.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+#define SEQ_OFFSET 4
+#define VID_OFFSET (SEQ_OFFSET + 5)
+
+static struct suit_processor_state state;
+
+/* The checkpoint, kept by the platform in a non-volatile memory. */
+static struct suit_checkpoint stored_checkpoint;
+static size_t stored_checkpoint_len;
+
+static uint8_t envelope[] = {
+	0xd8, 0x6b, /* tag(107) : SUIT_Envelope_Tagged */
+	0xa2, /* map (2 elements) - not decoded by the test */
+	0x03, /* uint(suit-install) */
+
+	0x86, /* list (6 elements - 3 commands) */
+	0x14, /* uint(suit-directive-override-parameters) */
+		0xa1, /* map (1 element) */
+		0x01, /* uint(suit-parameter-vendor-identifier) */
+		0x50, /* bytes (16) */
+			0x76, 0x17, 0xda, 0xa5, 0x71, 0xfd, 0x5a, 0x85, /* RFC4122_UUID(nordicsemi.com) */
+			0x8f, 0x94, 0xe2, 0x8d, 0x73, 0x5c, 0xe9, 0xf4,
+	0x17, /* uint(suit-directive-invoke) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+	0x01, /* uint(suit-condition-vendor-identifier) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
+
+static uint8_t manifest_digest_bytes[] = {
+	0x82, /* array: 2 elements */
+		0x2f, /* int: cose-alg-sha-256 */
+		0x48, /* bytes(8) - shortened for test purposes */
+			0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+};
+
+
+static int checkpoint_store_stub(enum suit_command_sequence seq_name,
+				 struct zcbor_string *manifest_component_id,
+				 const uint8_t *checkpoint, size_t checkpoint_len, int cmock_num_calls)
+{
+	TEST_ASSERT_EQUAL(SUIT_SEQ_INSTALL, seq_name);
+	TEST_ASSERT_EQUAL(sizeof(stored_checkpoint), checkpoint_len);
+
+	memcpy(&stored_checkpoint, checkpoint, checkpoint_len);
+	stored_checkpoint_len = checkpoint_len;
+
+	return SUIT_SUCCESS;
+}
+
+static int checkpoint_load_stub(enum suit_command_sequence seq_name,
+				struct zcbor_string *manifest_component_id,
+				uint8_t *checkpoint, size_t *checkpoint_len, int cmock_num_calls)
+{
+	TEST_ASSERT_EQUAL(SUIT_SEQ_INSTALL, seq_name);
+
+	if (stored_checkpoint_len == 0) {
+		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	}
+
+	TEST_ASSERT_LESS_OR_EQUAL(*checkpoint_len, stored_checkpoint_len);
+	memcpy(checkpoint, &stored_checkpoint, stored_checkpoint_len);
+	*checkpoint_len = stored_checkpoint_len;
+
+	return SUIT_SUCCESS;
+}
+
+/* Recreate the state of the processor, that has just loaded the envelope. */
+static void load_envelope(void)
+{
+	memset(&state, 0, sizeof(state));
+
+	int err = suit_manifest_params_init(state.components, ZCBOR_ARRAY_SIZE(state.components));
+	if (err == SUIT_ERR_ORDER) {
+		/* Allow to call init even if the manifest module is already initialized. */
+		err = SUIT_SUCCESS;
+	}
+
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, err, "Unable to initialize SUIT processor");
+
+	struct zcbor_string install_seq = {
+		.value = &envelope[SEQ_OFFSET],
+		.len = sizeof(envelope) - SEQ_OFFSET,
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+	state.manifest_stack[0].envelope_str.value = envelope;
+	state.manifest_stack[0].envelope_str.len = sizeof(envelope);
+	bootstrap_envelope_sequence(&state, SUIT_SEQ_INSTALL, &install_seq);
+	state.current_seq = SUIT_SEQ_INSTALL;
+	state.checkpoint_enabled = suit_bool_true;
+	state.checkpoint_manifest_digest.value = manifest_digest_bytes;
+	state.checkpoint_manifest_digest.len = sizeof(manifest_digest_bytes);
+}
+
+/* Execute the override-parameters directive and reset the device while the invoke directive is executed. */
+static void interrupt_sequence(void)
+{
+	__cmock_suit_plat_checkpoint_store_Stub(checkpoint_store_stub);
+	__cmock_suit_plat_invoke_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, NULL, SUIT_ERR_AGAIN);
+
+	int retval = suit_schedule_execution(&state, &state.manifest_stack[0], SUIT_SEQ_INSTALL);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+
+	retval = suit_seq_exec_step(&state);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+	TEST_ASSERT_EQUAL_MESSAGE(sizeof(stored_checkpoint), stored_checkpoint_len,
+				  "Checkpoint not stored after the override-parameters directive");
+
+	load_envelope();
+}
+
+/* Resume from the stored checkpoint and verify that it was rejected and removed. */
+static void expect_checkpoint_rejected(void)
+{
+	__cmock_suit_plat_checkpoint_load_Stub(checkpoint_load_stub);
+	__cmock_suit_plat_checkpoint_clear_ExpectAndReturn(SUIT_SEQ_INSTALL, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_checkpoint_clear_IgnoreArg_manifest_component_id();
+
+	int retval = suit_schedule_resumed_execution(&state, &state.manifest_stack[0]);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+	TEST_ASSERT_EQUAL(0, state.seq_stack_height);
+	TEST_ASSERT_FALSE(suit_param_is_set(&state.components[0], SUIT_PARAM_VID));
+}
+
+void setUp(void)
+{
+	memset(&stored_checkpoint, 0, sizeof(stored_checkpoint));
+	stored_checkpoint_len = 0;
+
+	load_envelope();
+}
+
+void test_checkpoint_resume_after_reset(void)
+{
+	struct zcbor_string exp_vid = {
+		.value = &envelope[VID_OFFSET],
+		.len = 16,
+	};
+
+	interrupt_sequence();
+
+	__cmock_suit_plat_checkpoint_load_Stub(checkpoint_load_stub);
+
+	int retval = suit_schedule_resumed_execution(&state, &state.manifest_stack[0]);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+	TEST_ASSERT_EQUAL(1, state.seq_stack_height);
+	TEST_ASSERT_EQUAL(1, state.seq_stack[0].current_command);
+	TEST_ASSERT_TRUE(suit_param_is_set(&state.components[0], SUIT_PARAM_VID));
+
+	/* The execution continues from the interrupted invoke directive. */
+	__cmock_suit_plat_invoke_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_vid_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_vid, SUIT_SUCCESS);
+
+	retval = suit_process_scheduled(&state);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(0, state.seq_stack_height);
+
+	/* The checkpoint was updated after the invoke directive. */
+	TEST_ASSERT_EQUAL(2, stored_checkpoint.seq_stack[0].current_command);
+}
+
+void test_checkpoint_resume_no_checkpoint(void)
+{
+	__cmock_suit_plat_checkpoint_load_ExpectAndReturn(SUIT_SEQ_INSTALL, NULL, NULL, NULL,
+							  SUIT_ERR_UNAVAILABLE_PAYLOAD);
+	__cmock_suit_plat_checkpoint_load_IgnoreArg_manifest_component_id();
+	__cmock_suit_plat_checkpoint_load_IgnoreArg_checkpoint();
+	__cmock_suit_plat_checkpoint_load_IgnoreArg_checkpoint_len();
+
+	int retval = suit_schedule_resumed_execution(&state, &state.manifest_stack[0]);
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_PAYLOAD, retval);
+	TEST_ASSERT_EQUAL(0, state.seq_stack_height);
+}
+
+void test_checkpoint_resume_corrupted_length(void)
+{
+	interrupt_sequence();
+
+	stored_checkpoint_len = sizeof(stored_checkpoint) - 1;
+
+	expect_checkpoint_rejected();
+}
+
+void test_checkpoint_resume_corrupted_magic(void)
+{
+	interrupt_sequence();
+
+	stored_checkpoint.magic ^= 0xFF;
+
+	expect_checkpoint_rejected();
+}
+
+void test_checkpoint_resume_corrupted_exec_state(void)
+{
+	interrupt_sequence();
+
+	stored_checkpoint.seq_stack[0].cmd_exec_state = -1;
+	expect_checkpoint_rejected();
+
+	stored_checkpoint.seq_stack[0].cmd_exec_state = INT32_MAX;
+	expect_checkpoint_rejected();
+}
+
+void test_checkpoint_resume_corrupted_retval(void)
+{
+	interrupt_sequence();
+
+	stored_checkpoint.seq_stack[0].retval = -1;
+	expect_checkpoint_rejected();
+
+	stored_checkpoint.seq_stack[0].retval = SUIT_ERR_UNAUTHORIZED_COMMAND_SEQ + 1;
+	expect_checkpoint_rejected();
+
+	stored_checkpoint.seq_stack[0].retval = INT32_MAX;
+	expect_checkpoint_rejected();
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
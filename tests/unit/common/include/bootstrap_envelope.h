@@ -12,6 +12,17 @@
 
 #define ASSIGNED_COMPONENT_HANDLE 0x1E054000
 
+/** @brief Clear the manifest processor state and configure it with an empty envelope
+ *
+ * @note The component parameters are kept by the manifest module between the test cases,
+ *       so the module is initialized only once.
+ *
+ * @param  state  Manifest processor state to be modified.
+ *
+ * @returns SUIT_SUCCESS if the state was initialized, error code otherwise.
+ */
+int bootstrap_envelope_init(struct suit_processor_state *state);
+
 /** @brief Configure the manifest processor state with empty, validated and decoded envelope
  *
  * @param  state  Manifest processor state to be modified.
@@ -27,6 +38,10 @@ void bootstrap_envelope_empty(struct suit_processor_state *state);
 void bootstrap_envelope_reset_step(struct suit_processor_state *state);
 
 /** @brief Specify the command sequence inside the envelope
+ *
+ * @note If the sequence is not located inside the envelope, set in the manifest state,
+ *       the sequence is used as the envelope. In such case, only a single command sequence
+ *       can be specified at a time.
  *
  * @param  state  Manifest processor state to be modified.
  * @param  step   Step number, in which the command sequence should be executed.
@@ -35,6 +50,18 @@ void bootstrap_envelope_reset_step(struct suit_processor_state *state);
  */
 void bootstrap_envelope_sequence(struct suit_processor_state *state, enum suit_command_sequence seq, struct zcbor_string *seq_name);
 
+/** @brief Specify the command sequence inside the envelope and execute it
+ *
+ * @param  state     Manifest processor state to be modified.
+ * @param  seq_name  Name of the command sequence to execute.
+ * @param  cmd       Command sequence, encoded as CBOR list.
+ * @param  cmd_len   Length of the command sequence.
+ *
+ * @returns The result of the command sequence execution.
+ */
+int bootstrap_envelope_execute(struct suit_processor_state *state, enum suit_command_sequence seq_name,
+			       uint8_t *cmd, size_t cmd_len);
+
 /** @brief Preconfigure components inside the SUIT processor state.
  *
  * @param  state           Manifest processor state to be modified.
@@ -49,4 +76,22 @@ void bootstrap_envelope_components(struct suit_processor_state *state, size_t nu
  */
 void bootstrap_envelope_dependency_components(struct suit_processor_state *state, size_t num_components);
 
+/** @brief Build the envelope with the command sequence and a single integrated payload.
+ *
+ * @note Only a single integrated payload can be configured, because the envelope is rebuilt
+ *       on each call.
+ *
+ * @param  state     Manifest processor state to be modified.
+ * @param  buf       Buffer to store the envelope.
+ * @param  buf_size  Size of the buffer.
+ * @param  seq       Command sequence to be copied into the envelope. Updated to point to the copy.
+ * @param  key       Key of the integrated payload.
+ * @param  payload   Integrated payload value.
+ *
+ * @returns SUIT_SUCCESS if the envelope was built, error code otherwise.
+ */
+int bootstrap_envelope_integrated_payload(struct suit_processor_state *state, uint8_t *buf, size_t buf_size,
+					  struct zcbor_string *seq, const struct zcbor_string *key,
+					  const struct zcbor_string *payload);
+
 #endif /* BOOTSTRAP_ENVELOPE_H__ */
\ No newline at end of file
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BOOTSTRAP_PARAMS_H__
+#define BOOTSTRAP_PARAMS_H__
+
+/** Encoded suit-parameter-vendor-identifier entry of the SUIT_Parameters map. */
+#define VID_PARAMETER                                                                              \
+	0x01, /* uint(suit-parameter-vendor-identifier) */                                         \
+	0x50, /* bytes (16) */                                                                     \
+		/* RFC4122 uuid5(uuid.NAMESPACE_DNS, 'nordicsemi.com') */                          \
+		0x76, 0x17, 0xda, 0xa5, 0x71, 0xfd, 0x5a, 0x85,                                    \
+		0x8f, 0x94, 0xe2, 0x8d, 0x73, 0x5c, 0xe9, 0xf4
+
+/** Encoded suit-parameter-image-digest entry of the SUIT_Parameters map. */
+#define IMAGE_DIGEST_PARAMETER                                                                     \
+	0x03, /* uint(suit-parameter-image-digest) */                                              \
+	0x58, 0x24, /* bytes(36) */                                                                \
+	0x82, /* array (2 elements) */                                                             \
+		0x2f, /* suit-digest-algorithm-id: cose-alg-sha-256 */                             \
+		0x58, 0x20, /* suit-digest-bytes: bytes(32) */                                     \
+		0x66, 0x58, 0xea, 0x56, 0x02, 0x62, 0x69, 0x6d,                                    \
+		0xd1, 0xf1, 0x3b, 0x78, 0x22, 0x39, 0xa0, 0x64,                                    \
+		0xda, 0x7c, 0x6c, 0x5c, 0xba, 0xf5, 0x2f, 0xde,                                    \
+		0xd4, 0x28, 0xa6, 0xfc, 0x83, 0xc7, 0xe5, 0xaf
+
+/** Encoded suit-parameter-uri entry of the SUIT_Parameters map. */
+#define URI_PARAMETER                                                                              \
+	0x15, /* uint(suit-parameter-uri) */                                                       \
+	0x78, 0x1A, /* text (26 characters) */                                                     \
+		'h', 't', 't', 'p', ':', '/', '/',                                                 \
+		'e', 'x', 'a', 'm', 'p', 'l', 'e', '.', 'c', 'o', 'm',                             \
+		'/', 'a', 'p', 'p', '.', 'b', 'i', 'n'
+
+#endif /* BOOTSTRAP_PARAMS_H__ */
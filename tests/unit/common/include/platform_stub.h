@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef PLATFORM_STUB_H__
+#define PLATFORM_STUB_H__
+
+#include <suit_platform.h>
+
+/** @file platform_stub.h
+ * @brief Memory-backed implementation of the SUIT platform API.
+ *
+ * The stub accepts all digests and signatures, so it allows to measure the time spent
+ * in the core, without the cost of the cryptographic operations.
+ * The components keep only the reference to the last written payload, so integrated
+ * dependency manifests can be fetched into a component and processed.
+ */
+
+/** The value of the first component handle, assigned by the stub. */
+#define PLATFORM_STUB_HANDLE_BASE 0x5000
+
+/** @brief Release all component handles and drop the stored payloads. */
+void platform_stub_reset(void);
+
+#endif /* PLATFORM_STUB_H__ */
@@ -4,7 +4,31 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <bootstrap_envelope.h>
+#include <suit_manifest.h>
+#include <suit_schedule_seq.h>
+
+int bootstrap_envelope_init(struct suit_processor_state *state)
+{
+	if (state == NULL) {
+		return SUIT_ERR_CRASH;
+	}
+
+	memset(state, 0, sizeof(*state));
+
+	int err = suit_manifest_params_init(state->components, ZCBOR_ARRAY_SIZE(state->components));
+	if (err == SUIT_ERR_ORDER) {
+		/* Allow to call init even if the manifest module is already initialized. */
+		err = SUIT_SUCCESS;
+	}
+
+	if (err == SUIT_SUCCESS) {
+		bootstrap_envelope_empty(state);
+	}
+
+	return err;
+}
 
 void bootstrap_envelope_empty(struct suit_processor_state *state)
 {
@@ -25,15 +49,8 @@ void bootstrap_envelope_empty(struct suit_processor_state *state)
 	state->dry_run = suit_bool_false;
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
-	manifest_state->shared_sequence_status = UNAVAILABLE;
-	manifest_state->dependency_resolution_seq_status = UNAVAILABLE;
-	manifest_state->payload_fetch_seq_status = UNAVAILABLE;
-	manifest_state->install_seq_status = UNAVAILABLE;
-	manifest_state->candidate_verification_seq_status = UNAVAILABLE;
-	manifest_state->validate_seq_status = UNAVAILABLE;
-	manifest_state->load_seq_status = UNAVAILABLE;
-	manifest_state->invoke_seq_status = UNAVAILABLE;
-	manifest_state->text_status = UNAVAILABLE;
+	/* All sequences and the text are unavailable. */
+	manifest_state->seq_status = 0;
 
 	/* Clear execution stack. */
 	state->seq_stack_height = 0;
@@ -60,34 +77,47 @@ void bootstrap_envelope_sequence(struct suit_processor_state *state, enum suit_c
 
 	switch (seq_name) {
 		case SUIT_SEQ_SHARED:
-			manifest->shared_sequence = *seq;
-			manifest->shared_sequence_status = AUTHENTICATED;
-			break;
 		case SUIT_SEQ_PAYLOAD_FETCH:
-			manifest->payload_fetch_seq = *seq;
-			manifest->payload_fetch_seq_status = AUTHENTICATED;
-			break;
 		case SUIT_SEQ_INSTALL:
-			manifest->install_seq = *seq;
-			manifest->install_seq_status = AUTHENTICATED;
-			break;
 		case SUIT_SEQ_VALIDATE:
-			manifest->validate_seq = *seq;
-			manifest->validate_seq_status = AUTHENTICATED;
-			break;
 		case SUIT_SEQ_LOAD:
-			manifest->load_seq = *seq;
-			manifest->load_seq_status = AUTHENTICATED;
-			break;
 		case SUIT_SEQ_INVOKE:
-			manifest->invoke_seq = *seq;
-			manifest->invoke_seq_status = AUTHENTICATED;
+			/* The sequences are stored relative to the envelope. If the sequence is not
+			 * a part of the configured envelope, treat the sequence as the whole envelope.
+			 */
+			if (suit_manifest_set_seq(manifest, seq_name, seq) != SUIT_SUCCESS) {
+				manifest->envelope_str = *seq;
+				(void)suit_manifest_set_seq(manifest, seq_name, seq);
+			}
+			(void)suit_manifest_set_seq_status(manifest, seq_name, AUTHENTICATED);
 			break;
 		default:
 			break;
 	}
 }
 
+int bootstrap_envelope_execute(struct suit_processor_state *state, enum suit_command_sequence seq_name,
+			       uint8_t *cmd, size_t cmd_len)
+{
+	struct zcbor_string seq = {
+		.value = cmd,
+		.len = cmd_len,
+	};
+
+	if (state == NULL) {
+		return SUIT_ERR_CRASH;
+	}
+
+	bootstrap_envelope_sequence(state, seq_name, &seq);
+
+	int ret = suit_schedule_execution(state, &state->manifest_stack[0], seq_name);
+	if (ret == SUIT_ERR_AGAIN) {
+		ret = suit_process_scheduled(state);
+	}
+
+	return ret;
+}
+
 void bootstrap_envelope_components(struct suit_processor_state *state, size_t num_components)
 {
 	struct suit_manifest_state *manifest;
@@ -125,3 +155,47 @@ void bootstrap_envelope_dependency_components(struct suit_processor_state *state
 		manifest->component_map[i] = i;
 	}
 }
+
+int bootstrap_envelope_integrated_payload(struct suit_processor_state *state, uint8_t *buf, size_t buf_size,
+					  struct zcbor_string *seq, const struct zcbor_string *key,
+					  const struct zcbor_string *payload)
+{
+	struct suit_manifest_state *manifest;
+	struct zcbor_string envelope_key;
+	struct zcbor_string envelope_payload;
+	int ret;
+
+	if ((state == NULL) || (state->manifest_stack_height != 1)) {
+		return SUIT_ERR_ORDER;
+	}
+
+	manifest = &state->manifest_stack[0];
+	if (seq->len + key->len + payload->len > buf_size) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	/* The integrated payloads are stored relative to the envelope, so build an envelope with
+	 * the command sequence, followed by the key and the payload.
+	 */
+	memcpy(buf, seq->value, seq->len);
+	memcpy(&buf[seq->len], key->value, key->len);
+	memcpy(&buf[seq->len + key->len], payload->value, payload->len);
+
+	manifest->envelope_str.value = buf;
+	manifest->envelope_str.len = seq->len + key->len + payload->len;
+	seq->value = buf;
+	envelope_key.value = &buf[seq->len];
+	envelope_key.len = key->len;
+	envelope_payload.value = &buf[seq->len + key->len];
+	envelope_payload.len = payload->len;
+
+	ret = suit_manifest_str_to_ref(manifest, &envelope_key, &manifest->integrated_payloads[0].key);
+	if (ret == SUIT_SUCCESS) {
+		ret = suit_manifest_str_to_ref(manifest, &envelope_payload,
+					       &manifest->integrated_payloads[0].payload);
+	}
+
+	manifest->integrated_payloads_count = ((ret == SUIT_SUCCESS) ? 1 : 0);
+
+	return ret;
+}
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#ifdef SUIT_PLATFORM_TRACE_SUPPORT
+#include <zephyr/kernel.h>
+#endif /* SUIT_PLATFORM_TRACE_SUPPORT */
+#include <platform_stub.h>
+#include <suit_types.h>
+
+struct platform_stub_component {
+	bool in_use;
+	bool dependency;
+	struct zcbor_string component_id;
+	const uint8_t *payload;
+	size_t payload_len;
+};
+
+static struct platform_stub_component stub_components[SUIT_MAX_NUM_COMPONENT_PARAMS];
+
+
+static struct platform_stub_component *component_get(suit_component_t handle)
+{
+	if ((handle < PLATFORM_STUB_HANDLE_BASE) ||
+	    (handle >= PLATFORM_STUB_HANDLE_BASE + ZCBOR_ARRAY_SIZE(stub_components))) {
+		return NULL;
+	}
+
+	struct platform_stub_component *component = &stub_components[handle - PLATFORM_STUB_HANDLE_BASE];
+
+	return (component->in_use ? component : NULL);
+}
+
+static int component_store(suit_component_t handle, const uint8_t *payload, size_t payload_len)
+{
+	struct platform_stub_component *component = component_get(handle);
+
+	/* Handles, created outside of the stub (i.e. by the bootstrap helpers) do not store data. */
+	if (component != NULL) {
+		component->payload = payload;
+		component->payload_len = payload_len;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+void platform_stub_reset(void)
+{
+	memset(stub_components, 0, sizeof(stub_components));
+}
+
+int suit_plat_check_digest(enum suit_cose_alg alg_id, struct zcbor_string *digest,
+			   struct zcbor_string *payload)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_authenticate_manifest(struct zcbor_string *manifest_component_id,
+				    enum suit_cose_alg alg_id, struct zcbor_string *key_id,
+				    struct zcbor_string *signature, struct zcbor_string *data)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_authorize_unsigned_manifest(struct zcbor_string *manifest_component_id)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_create_component_handle(struct zcbor_string *component_id, bool dependency,
+				      suit_component_t *handle)
+{
+	if ((component_id == NULL) || (handle == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(stub_components); i++) {
+		if (!stub_components[i].in_use) {
+			memset(&stub_components[i], 0, sizeof(stub_components[i]));
+			stub_components[i].in_use = true;
+			stub_components[i].dependency = dependency;
+			stub_components[i].component_id = *component_id;
+			*handle = PLATFORM_STUB_HANDLE_BASE + i;
+
+			return SUIT_SUCCESS;
+		}
+	}
+
+	return SUIT_ERR_OVERFLOW;
+}
+
+int suit_plat_release_component_handle(suit_component_t handle)
+{
+	struct platform_stub_component *component = component_get(handle);
+
+	if (component != NULL) {
+		component->in_use = false;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_image_match(suit_component_t handle, enum suit_cose_alg alg_id,
+				struct zcbor_string *digest)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_content(suit_component_t handle, struct zcbor_string *content)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_slot(suit_component_t handle, unsigned int slot)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_vid(suit_component_t handle, struct zcbor_string *vid_uuid)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_cid(suit_component_t handle, struct zcbor_string *cid_uuid)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_did(suit_component_t handle, struct zcbor_string *did_uuid)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_authorize_sequence_num(enum suit_command_sequence seq_name,
+				     struct zcbor_string *manifest_component_id,
+				     unsigned int seq_num)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_authorize_component_id(struct zcbor_string *manifest_component_id,
+				     struct zcbor_string *component_id)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_fetch(suit_component_t dst_handle, struct zcbor_string *uri,
+		    struct zcbor_string *manifest_component_id,
+		    struct suit_encryption_info *enc_info,
+		    struct suit_compression_info *comp_info)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_fetch_integrated(suit_component_t dst_handle, struct zcbor_string *payload,
+			       struct zcbor_string *manifest_component_id,
+			       struct suit_encryption_info *enc_info,
+			       struct suit_compression_info *comp_info)
+{
+	if (payload == NULL) {
+		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	}
+
+	return component_store(dst_handle, payload->value, payload->len);
+}
+
+int suit_plat_copy(suit_component_t dst_handle, suit_component_t src_handle,
+		   struct zcbor_string *manifest_component_id,
+		   struct suit_encryption_info *enc_info,
+		   struct suit_compression_info *comp_info)
+{
+	struct platform_stub_component *src = component_get(src_handle);
+
+	if (src == NULL) {
+		return SUIT_SUCCESS;
+	}
+
+	return component_store(dst_handle, src->payload, src->payload_len);
+}
+
+int suit_plat_swap(suit_component_t dst_handle, suit_component_t src_handle,
+		   struct zcbor_string *manifest_component_id,
+		   struct suit_encryption_info *enc_info)
+{
+	struct platform_stub_component *dst = component_get(dst_handle);
+	struct platform_stub_component *src = component_get(src_handle);
+
+	if ((dst != NULL) && (src != NULL)) {
+		const uint8_t *payload = dst->payload;
+		size_t payload_len = dst->payload_len;
+
+		dst->payload = src->payload;
+		dst->payload_len = src->payload_len;
+		src->payload = payload;
+		src->payload_len = payload_len;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_apply_delta(suit_component_t dst_handle, suit_component_t base_handle,
+			  suit_component_t patch_handle,
+			  struct zcbor_string *manifest_component_id)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_write(suit_component_t dst_handle, struct zcbor_string *content,
+		    struct zcbor_string *manifest_component_id,
+		    struct suit_encryption_info *enc_info,
+		    struct suit_compression_info *comp_info)
+{
+	if (content == NULL) {
+		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	}
+
+	return component_store(dst_handle, content->value, content->len);
+}
+
+int suit_plat_invoke(suit_component_t image_handle, struct zcbor_string *invoke_args)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_report(unsigned int rep_policy, struct suit_report *report)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_sequence_completed(enum suit_command_sequence seq_name,
+				 struct zcbor_string *manifest_component_id,
+				 const uint8_t *envelope_str, size_t envelope_len)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_retrieve_manifest(suit_component_t component_handle, const uint8_t **envelope_str,
+				size_t *envelope_len)
+{
+	struct platform_stub_component *component = component_get(component_handle);
+
+	if ((envelope_str == NULL) || (envelope_len == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if ((component == NULL) || (component->payload == NULL)) {
+		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	}
+
+	*envelope_str = component->payload;
+	*envelope_len = component->payload_len;
+
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_override_image_size(suit_component_t handle, size_t size,
+				  struct zcbor_string *manifest_component_id)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_authorize_process_dependency(struct zcbor_string *parent_component_id,
+					   struct zcbor_string *child_component_id,
+					   enum suit_command_sequence seq_name)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_component_version_get(suit_component_t handle, int *version, size_t *version_len)
+{
+	if ((version == NULL) || (version_len == NULL) || (*version_len < 1)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	version[0] = 1;
+	*version_len = 1;
+
+	return SUIT_SUCCESS;
+}
+
+#ifdef SUIT_PLATFORM_TRACE_SUPPORT
+uint32_t suit_plat_trace_timestamp(void)
+{
+	return k_cycle_get_32();
+}
+#endif /* SUIT_PLATFORM_TRACE_SUPPORT */
+
+#ifdef SUIT_PLATFORM_DRY_RUN_SUPPORT
+int suit_plat_check_fetch(suit_component_t dst_handle, struct zcbor_string *uri,
+			  struct zcbor_string *manifest_component_id,
+			  struct suit_encryption_info *enc_info,
+			  struct suit_compression_info *comp_info)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_fetch_integrated(suit_component_t dst_handle, struct zcbor_string *payload,
+				     struct zcbor_string *manifest_component_id,
+				     struct suit_encryption_info *enc_info,
+				     struct suit_compression_info *comp_info)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_copy(suit_component_t dst_handle, suit_component_t src_handle,
+			 struct zcbor_string *manifest_component_id,
+			 struct suit_encryption_info *enc_info,
+			 struct suit_compression_info *comp_info)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_swap(suit_component_t dst_handle, suit_component_t src_handle,
+			 struct zcbor_string *manifest_component_id,
+			 struct suit_encryption_info *enc_info)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_apply_delta(suit_component_t dst_handle, suit_component_t base_handle,
+				suit_component_t patch_handle,
+				struct zcbor_string *manifest_component_id)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_write(suit_component_t dst_handle, struct zcbor_string *content,
+			  struct zcbor_string *manifest_component_id,
+			  struct suit_encryption_info *enc_info,
+			  struct suit_compression_info *comp_info)
+{
+	return SUIT_SUCCESS;
+}
+
+int suit_plat_check_invoke(suit_component_t image_handle, struct zcbor_string *invoke_args)
+{
+	return SUIT_SUCCESS;
+}
+#endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <bootstrap_envelope.h>
+#include <bootstrap_params.h>
+#include <suit_manifest.h>
+#include <suit_memo.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+#define FIRST_COMPONENT_HANDLE	(ASSIGNED_COMPONENT_HANDLE)
+#define SECOND_COMPONENT_HANDLE (ASSIGNED_COMPONENT_HANDLE + 1)
+
+struct suit_processor_state state;
+
+static void expect_check_vid(suit_component_t handle, int result)
+{
+	__cmock_suit_plat_check_vid_ExpectAndReturn(handle, NULL, result);
+	__cmock_suit_plat_check_vid_IgnoreArg_vid_uuid();
+}
+
+static void expect_check_image_match(suit_component_t handle, int result)
+{
+	__cmock_suit_plat_check_image_match_ExpectAndReturn(handle, suit_cose_sha256, NULL, result);
+	__cmock_suit_plat_check_image_match_IgnoreArg_digest();
+}
+
+static void expect_fetch(suit_component_t handle)
+{
+	__cmock_suit_plat_fetch_ExpectAndReturn(handle, NULL, NULL, NULL, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_IgnoreArg_uri();
+	__cmock_suit_plat_fetch_IgnoreArg_manifest_component_id();
+}
+
+void setUp(void)
+{
+	int err = bootstrap_envelope_init(&state);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, err, "Unable to initialize SUIT processor");
+
+	/* The results are kept by the processor between the test cases. */
+	suit_memo_drop_all();
+
+	bootstrap_envelope_components(&state, 2);
+}
+
+void test_vendor_identifier_memoized(void)
+{
+	uint8_t seq_cmd[] = {
+		0x8a, /* list (10 elements - 5 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				VID_PARAMETER,
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				0x05, /* uint(suit-parameter-component-slot) */
+				0x01, /* uint(1) */
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	/* The second check reuses the result, the slot override invalidates it. */
+	expect_check_vid(FIRST_COMPONENT_HANDLE, SUIT_SUCCESS);
+	expect_check_vid(FIRST_COMPONENT_HANDLE, SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_vendor_identifier_failure_not_memoized(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				VID_PARAMETER,
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	uint8_t check_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	expect_check_vid(FIRST_COMPONENT_HANDLE, SUIT_FAIL_CONDITION);
+
+	TEST_ASSERT_EQUAL(SUIT_FAIL_CONDITION,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+
+	/* The failed check is repeated, the passed one is reused. */
+	expect_check_vid(FIRST_COMPONENT_HANDLE, SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, check_cmd, sizeof(check_cmd)));
+}
+
+void test_vendor_identifier_memo_value_changed(void)
+{
+	uint8_t seq_cmd[] = {
+		0x88, /* list (8 elements - 4 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				VID_PARAMETER,
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				0x01, /* uint(suit-parameter-vendor-identifier) */
+				0x50, /* bytes (16) */
+				0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+				0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	expect_check_vid(FIRST_COMPONENT_HANDLE, SUIT_SUCCESS);
+	expect_check_vid(FIRST_COMPONENT_HANDLE, SUIT_FAIL_CONDITION);
+
+	TEST_ASSERT_EQUAL(SUIT_FAIL_CONDITION,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_vendor_identifier_memo_value_overwritten(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				VID_PARAMETER,
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	uint8_t check_cmd[] = {
+		0x82, /* list (2 elements - 1 command) */
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	expect_check_vid(FIRST_COMPONENT_HANDLE, SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+
+	/* The parameter still points to the same memory, but its contents have changed. */
+	seq_cmd[5] ^= 0xff;
+	expect_check_vid(FIRST_COMPONENT_HANDLE, SUIT_FAIL_CONDITION);
+
+	TEST_ASSERT_EQUAL(SUIT_FAIL_CONDITION,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, check_cmd, sizeof(check_cmd)));
+}
+
+void test_vendor_identifier_memo_dependency_modified(void)
+{
+	uint8_t seq_cmd[] = {
+		0x90, /* list (16 elements - 8 commands) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x01, /* uint(1) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				VID_PARAMETER,
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x00, /* uint(0) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x01, /* uint(1) */
+			0x01, /* uint(suit-condition-vendor-identifier) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	state.components[0].is_dependency = suit_bool_true;
+
+	/* Fetching the dependency manifest drops the results of the other components. */
+	expect_check_vid(SECOND_COMPONENT_HANDLE, SUIT_SUCCESS);
+	expect_fetch(FIRST_COMPONENT_HANDLE);
+	expect_check_vid(SECOND_COMPONENT_HANDLE, SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_image_match_memoized_until_fetch(void)
+{
+	uint8_t seq_cmd[] = {
+		0x8a, /* list (10 elements - 5 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				IMAGE_DIGEST_PARAMETER,
+				URI_PARAMETER,
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	/* The second check reuses the result, the fetch invalidates it. */
+	expect_check_image_match(FIRST_COMPONENT_HANDLE, SUIT_SUCCESS);
+	expect_fetch(FIRST_COMPONENT_HANDLE);
+	expect_check_image_match(FIRST_COMPONENT_HANDLE, SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_image_match_memoized_per_component(void)
+{
+	uint8_t seq_cmd[] = {
+		0x8c, /* list (12 elements - 6 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				IMAGE_DIGEST_PARAMETER,
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x01, /* uint(1) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				IMAGE_DIGEST_PARAMETER,
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	/* The same digest is checked against the contents of each component. */
+	expect_check_image_match(FIRST_COMPONENT_HANDLE, SUIT_SUCCESS);
+	expect_check_image_match(SECOND_COMPONENT_HANDLE, SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
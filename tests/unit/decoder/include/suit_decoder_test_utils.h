@@ -9,6 +9,7 @@
 
 #include <unity.h>
 #include <suit_decoder.h>
+#include <suit_arena.h>
 
 /** @brief Helper structure for constructing series of negative test cases
  */
@@ -62,4 +63,12 @@ void init_decode_manifest(uint8_t *envelope, size_t envelope_size);
  */
 void init_decode_manifest_with_text(uint8_t *envelope, size_t envelope_size);
 
+/** @brief Returns the manifest member, stored inside the manifest state declared inside the main.c file.
+ */
+struct zcbor_string decoded_seq(enum suit_command_sequence seq_name);
+
+/** @brief Returns the byte string, located inside the envelope of the manifest state declared inside the main.c file.
+ */
+struct zcbor_string decoded_str(const struct suit_envelope_ref *ref);
+
 #endif /* _SUIT_DECODER_TEST_UTILS_H */
@@ -8,6 +8,7 @@
 #include <stdint.h>
 #include <suit_processor.h>
 #include <suit_decoder.h>
+#include <suit_arena.h>
 #include "suit_platform/cmock_suit_platform.h"
 
 
@@ -98,6 +99,8 @@ uint8_t sample_signed_envelope[] = {
 void setUp(void)
 {
 	memset(&state, 0, sizeof(state));
+	/* The state is cleared without releasing the scratch memory. */
+	suit_arena_release(0);
 	memset(&manifest, 0, sizeof(manifest));
 
 	TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
@@ -169,6 +172,8 @@ void test_manifest_digest_minimal(void);
 void test_manifest_digest_minimal_sha512(void);
 void test_manifest_digest_invalid_input_bytes(void);
 void test_manifest_digest_minimal_platform_fail(void);
+void test_manifest_digest_minimal_reader(void);
+void test_manifest_digest_minimal_reader_modified(void);
 
 /* Decode manifest tests */
 void test_decode_manifest_invalid_input(void);
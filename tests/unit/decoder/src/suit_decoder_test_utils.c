@@ -11,6 +11,7 @@ void init_static_mem_input(void)
 	int ret = SUIT_SUCCESS;
 
 	memset(&state, 0, sizeof(state));
+	suit_arena_release(0);
 	memset(&manifest, 0, sizeof(manifest));
 
 	ret = suit_decoder_init(&state, &manifest);
@@ -39,13 +40,13 @@ static void init_decode_envelope_common(uint8_t *envelope, size_t envelope_size)
 void init_decode_envelope_with_text(uint8_t *envelope, size_t envelope_size)
 {
 	init_decode_envelope_common(envelope, envelope_size);
-	TEST_ASSERT_EQUAL_MESSAGE(SEVERED, state.decoded_manifest->text_status, "Decoding the severable text field failed (not present)");
+	TEST_ASSERT_EQUAL_MESSAGE(SEVERED, suit_manifest_get_seq_status(state.decoded_manifest, SUIT_MANIFEST_TEXT), "Decoding the severable text field failed (not present)");
 }
 
 void init_decode_envelope(uint8_t *envelope, size_t envelope_size)
 {
 	init_decode_envelope_common(envelope, envelope_size);
-	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, state.decoded_manifest->text_status, "Decoding the severable text field failed (not unavailable)");
+	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, suit_manifest_get_seq_status(state.decoded_manifest, SUIT_MANIFEST_TEXT), "Decoding the severable text field failed (not unavailable)");
 }
 
 void init_decode_signed_envelope(uint8_t *envelope, size_t envelope_size, size_t auth_count)
@@ -59,7 +60,7 @@ void init_decode_signed_envelope(uint8_t *envelope, size_t envelope_size, size_t
 	TEST_ASSERT_EQUAL_MESSAGE(ENVELOPE_DECODED, state.step, "Invalid state transition after envelope decoding");
 
 	TEST_ASSERT_EQUAL_MESSAGE(auth_count, state.authentication_bstr_count, "Decoding authentication block count failed");
-	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, state.decoded_manifest->text_status, "Decoding the severable text field failed");
+	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, suit_manifest_get_seq_status(state.decoded_manifest, SUIT_MANIFEST_TEXT), "Decoding the severable text field failed");
 
 	TEST_ASSERT_EQUAL_PTR_MESSAGE(envelope, state.decoded_manifest->envelope_str.value, "Invalid reference to the decoded envelope");
 	TEST_ASSERT_EQUAL_MESSAGE(envelope_size, state.decoded_manifest->envelope_str.len, "Invalid length of the decoded envelope");
@@ -87,3 +88,23 @@ void init_decode_manifest(uint8_t *envelope, size_t envelope_size)
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "The manifest decoding failed");
 	TEST_ASSERT_EQUAL_MESSAGE(MANIFEST_DECODED, state.step, "Invalid state transition after manifest decoding");
 }
+
+struct zcbor_string decoded_seq(enum suit_command_sequence seq_name)
+{
+	struct zcbor_string sequence = {0};
+
+	int ret = suit_manifest_get_seq(&manifest, seq_name, &sequence);
+
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to read the decoded manifest member");
+
+	return sequence;
+}
+
+struct zcbor_string decoded_str(const struct suit_envelope_ref *ref)
+{
+	struct zcbor_string str;
+
+	suit_manifest_ref_to_str(&manifest, ref, &str);
+
+	return str;
+}
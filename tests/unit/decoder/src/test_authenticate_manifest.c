@@ -962,6 +962,7 @@ void test_authenticate_signed_manifest_invalid_input_bytes(void)
 	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(envelopes); i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
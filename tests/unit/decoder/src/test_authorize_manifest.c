@@ -339,7 +339,7 @@ void test_authorize_manifest_minimal_without_common(void)
 
 	init_decode_manifest(minimal_decodable_manifest, sizeof(minimal_decodable_manifest));
 	state.step = MANIFEST_AUTHENTICATED;
-	state.manifest.SUIT_Manifest_suit_common_cbor.SUIT_Common_suit_components_present = false;
+	state.decoded->manifest.SUIT_Manifest_suit_common_cbor.SUIT_Common_suit_components_present = false;
 
 	ret = suit_decoder_authorize_manifest(&state);
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_MANIFEST_VALIDATION, ret, "The manifest without components authorization did not fail");
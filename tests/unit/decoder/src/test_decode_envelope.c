@@ -329,7 +329,7 @@ void test_decode_envelope_minimal(void)
 	TEST_ASSERT_EQUAL_MESSAGE(0, state.authentication_bstr_count, "Decoding authentication block count failed");
 
 	TEST_ASSERT_EQUAL_MESSAGE(0, state.manifest_digest_bytes.len, "Decoding the manifest digest length failed");
-	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, state.decoded_manifest->text_status, "Decoding the severable text field failed");
+	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, suit_manifest_get_seq_status(state.decoded_manifest, SUIT_MANIFEST_TEXT), "Decoding the severable text field failed");
 
 	TEST_ASSERT_EQUAL_PTR_MESSAGE(minimal_decodable_envelope, state.decoded_manifest->envelope_str.value, "Invalid reference to the decoded envelope");
 	TEST_ASSERT_EQUAL_MESSAGE(sizeof(minimal_decodable_envelope), state.decoded_manifest->envelope_str.len, "Invalid length of the decoded envelope");
@@ -435,6 +435,7 @@ void test_decode_envelope_invalid_input_bytes(void)
 	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(envelopes); i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
 		init_static_mem_input();
@@ -470,6 +471,7 @@ void test_deocde_envelope_several_auth_bstrs(void)
 	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(envelopes); i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
 
@@ -509,9 +511,9 @@ void test_deocde_envelope_severed_text_field(void)
 	TEST_ASSERT_EQUAL_MESSAGE(sizeof(envelope_with_severable_text), state.decoded_manifest->envelope_str.len, "Invalid length of the decoded envelope");
 	TEST_ASSERT_EQUAL_MESSAGE(0, state.decoded_manifest->integrated_payloads_count, "Decoding the number of integrated payloads failed");
 
-	TEST_ASSERT_EQUAL_MESSAGE(SEVERED, state.decoded_manifest->text_status, "Decoding the severable text field failed");
-	TEST_ASSERT_EQUAL_MESSAGE(1, state.decoded_manifest->text.len, "Decoding the severable text field payload length failed");
-	TEST_ASSERT_EQUAL_MESSAGE(0x0A, state.decoded_manifest->text.value[0], "Decoding the severable text field payload value failed");
+	TEST_ASSERT_EQUAL_MESSAGE(SEVERED, suit_manifest_get_seq_status(state.decoded_manifest, SUIT_MANIFEST_TEXT), "Decoding the severable text field failed");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_MANIFEST_TEXT).len, "Decoding the severable text field payload length failed");
+	TEST_ASSERT_EQUAL_MESSAGE(0x0A, decoded_seq(SUIT_MANIFEST_TEXT).value[0], "Decoding the severable text field payload value failed");
 }
 
 void test_deocde_envelope_empty_text_field(void)
@@ -544,13 +546,13 @@ void test_deocde_envelope_integrated_payload(void)
 	TEST_ASSERT_EQUAL_MESSAGE(0, state.manifest_digest_bytes.len, "Decoding the manifest digest length failed");
 	TEST_ASSERT_EQUAL_PTR_MESSAGE(envelope_with_integrated_payload, state.decoded_manifest->envelope_str.value, "Invalid reference to the decoded envelope");
 	TEST_ASSERT_EQUAL_MESSAGE(sizeof(envelope_with_integrated_payload), state.decoded_manifest->envelope_str.len, "Invalid length of the decoded envelope");
-	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, state.decoded_manifest->text_status, "Decoding the severable text field failed");
+	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, suit_manifest_get_seq_status(state.decoded_manifest, SUIT_MANIFEST_TEXT), "Decoding the severable text field failed");
 
 	TEST_ASSERT_EQUAL_MESSAGE(1, state.decoded_manifest->integrated_payloads_count, "Decoding the number of integrated payloads failed");
 	TEST_ASSERT_EQUAL_MESSAGE(4, state.decoded_manifest->integrated_payloads[0].key.len, "Decoding the integrated payload key length failed");
-	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(key, state.decoded_manifest->integrated_payloads[0].key.value, state.decoded_manifest->integrated_payloads[0].key.len, "Decoding the integrated payload key value failed");
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(key, decoded_str(&state.decoded_manifest->integrated_payloads[0].key).value, state.decoded_manifest->integrated_payloads[0].key.len, "Decoding the integrated payload key value failed");
 	TEST_ASSERT_EQUAL_MESSAGE(1, state.decoded_manifest->integrated_payloads[0].payload.len, "Decoding the integrated payload length failed");
-	TEST_ASSERT_EQUAL_MESSAGE(0x0B, state.decoded_manifest->integrated_payloads[0].payload.value[0], "Decoding the integrated payload value failed");
+	TEST_ASSERT_EQUAL_MESSAGE(0x0B, decoded_str(&state.decoded_manifest->integrated_payloads[0].payload).value[0], "Decoding the integrated payload value failed");
 }
 
 void test_deocde_envelope_integrated_payloads(void)
@@ -563,6 +565,7 @@ void test_deocde_envelope_integrated_payloads(void)
 	for (size_t i = 1; i < SUIT_MAX_NUM_INTEGRATED_PAYLOADS; i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
 
@@ -578,15 +581,15 @@ void test_deocde_envelope_integrated_payloads(void)
 		TEST_ASSERT_EQUAL_MESSAGE(0, state.manifest_digest_bytes.len, "Decoding the manifest digest length failed");
 		TEST_ASSERT_EQUAL_PTR_MESSAGE(envelope, state.decoded_manifest->envelope_str.value, "Invalid reference to the decoded envelope");
 		TEST_ASSERT_EQUAL_MESSAGE(envelope_size, state.decoded_manifest->envelope_str.len, "Invalid length of the decoded envelope");
-		TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, state.decoded_manifest->text_status, "Decoding the severable text field failed");
+		TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, suit_manifest_get_seq_status(state.decoded_manifest, SUIT_MANIFEST_TEXT), "Decoding the severable text field failed");
 
 		TEST_ASSERT_EQUAL_MESSAGE(i, state.decoded_manifest->integrated_payloads_count, "Decoding the number of integrated payloads failed");
 		for (size_t p_i = 0; p_i < i; p_i++) {
 			key[3] = '0' + p_i;
 			TEST_ASSERT_EQUAL_MESSAGE(4, state.decoded_manifest->integrated_payloads[p_i].key.len, "Decoding the integrated payload key length failed");
-			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(key, state.decoded_manifest->integrated_payloads[p_i].key.value, state.decoded_manifest->integrated_payloads[0].key.len, "Decoding the integrated payload key value failed");
+			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(key, decoded_str(&state.decoded_manifest->integrated_payloads[p_i].key).value, state.decoded_manifest->integrated_payloads[0].key.len, "Decoding the integrated payload key value failed");
 			TEST_ASSERT_EQUAL_MESSAGE(1, state.decoded_manifest->integrated_payloads[p_i].payload.len, "Decoding the integrated payload length failed");
-			TEST_ASSERT_EQUAL_MESSAGE(p_i, state.decoded_manifest->integrated_payloads[p_i].payload.value[0], "Decoding the integrated payload value failed");
+			TEST_ASSERT_EQUAL_MESSAGE(p_i, decoded_str(&state.decoded_manifest->integrated_payloads[p_i].payload).value[0], "Decoding the integrated payload value failed");
 		}
 	}
 }
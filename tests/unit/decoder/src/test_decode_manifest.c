@@ -854,6 +854,7 @@ void test_decode_manifest_invalid_input_bytes(void)
 	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(envelopes); i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
 		init_decode_envelope(envelopes[i].envelope, envelopes[i].envelope_size);
@@ -884,7 +885,7 @@ void test_decode_manifest_with_component_id(void)
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(manifest_component_id, state.decoded_manifest->manifest_component_id.value, sizeof(manifest_component_id), "Invalid value of the manifest component ID");
 	TEST_ASSERT_EQUAL_MESSAGE(0x12, state.decoded_manifest->sequence_number, "Incorrect manifest sequence number value");
 	TEST_ASSERT_EQUAL_MESSAGE(0, state.decoded_manifest->current_version.len, "Invalid length of the manifest semantic version");
-	TEST_ASSERT_NULL_MESSAGE(state.decoded_manifest->current_version.value, "Invalid value of the manifest semantic version");
+	TEST_ASSERT_NULL_MESSAGE(decoded_str(&state.decoded_manifest->current_version).value, "Invalid value of the manifest semantic version");
 }
 
 void test_decode_manifest_with_empty_sem_ver(void)
@@ -902,7 +903,7 @@ void test_decode_manifest_with_empty_sem_ver(void)
 	TEST_ASSERT_EQUAL_MESSAGE(MANIFEST_DECODED, state.step, "Invalid state transition after manifest decoding");
 
 	TEST_ASSERT_EQUAL_MESSAGE(sizeof(empty_version), state.decoded_manifest->current_version.len, "Invalid length of the manifest semantic version");
-	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(empty_version, state.decoded_manifest->current_version.value, sizeof(empty_version), "Invalid value of the manifest semantic version");
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(empty_version, decoded_str(&state.decoded_manifest->current_version).value, sizeof(empty_version), "Invalid value of the manifest semantic version");
 	TEST_ASSERT_EQUAL_MESSAGE(0x11, state.decoded_manifest->sequence_number, "Incorrect manifest sequence number value");
 }
 
@@ -921,6 +922,6 @@ void test_decode_manifest_with_valid_sem_ver(void)
 	TEST_ASSERT_EQUAL_MESSAGE(MANIFEST_DECODED, state.step, "Invalid state transition after manifest decoding");
 
 	TEST_ASSERT_EQUAL_MESSAGE(sizeof(valid_version), state.decoded_manifest->current_version.len, "Invalid length of the manifest semantic version");
-	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(valid_version, state.decoded_manifest->current_version.value, sizeof(valid_version), "Invalid value of the manifest semantic version");
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(valid_version, decoded_str(&state.decoded_manifest->current_version).value, sizeof(valid_version), "Invalid value of the manifest semantic version");
 	TEST_ASSERT_EQUAL_MESSAGE(0x11, state.decoded_manifest->sequence_number, "Incorrect manifest sequence number value");
 }
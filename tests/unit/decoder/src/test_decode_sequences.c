@@ -514,25 +514,26 @@ void test_decode_sequences_invalid_sequence_state(void)
 		},
 	};
 
-	enum suit_seq_status *seq_status[] = {
-		&manifest.shared_sequence_status,
-		&manifest.validate_seq_status,
-		&manifest.load_seq_status,
-		&manifest.invoke_seq_status,
-		&manifest.payload_fetch_seq_status,
-		&manifest.install_seq_status,
-		&manifest.dependency_resolution_seq_status,
-		&manifest.candidate_verification_seq_status,
+	enum suit_command_sequence seq_names[] = {
+		SUIT_SEQ_SHARED,
+		SUIT_SEQ_VALIDATE,
+		SUIT_SEQ_LOAD,
+		SUIT_SEQ_INVOKE,
+		SUIT_SEQ_PAYLOAD_FETCH,
+		SUIT_SEQ_INSTALL,
+		SUIT_SEQ_DEP_RESOLUTION,
+		SUIT_SEQ_CAND_VERIFICATION,
 	};
 
 	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(envelopes); i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
 		init_decode_manifest(envelopes[i].envelope, envelopes[i].envelope_size);
 		state.step = MANIFEST_AUTHORIZED;
-		*seq_status[i] = SEVERED;
+		(void)suit_manifest_set_seq_status(&manifest, seq_names[i], SEVERED);
 
 		ret = suit_decoder_decode_sequences(&state);
 		TEST_ASSERT_EQUAL_MESSAGE(envelopes[i].exp_ret, ret, "The manifest sequence decoding did not fail");
@@ -543,11 +544,12 @@ void test_decode_sequences_invalid_sequence_state(void)
 	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(envelopes); i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
 		init_decode_manifest(envelopes[i].envelope, envelopes[i].envelope_size);
 		state.step = MANIFEST_AUTHORIZED;
-		*seq_status[i] = AUTHENTICATED;
+		(void)suit_manifest_set_seq_status(&manifest, seq_names[i], AUTHENTICATED);
 
 		ret = suit_decoder_decode_sequences(&state);
 		TEST_ASSERT_EQUAL_MESSAGE(envelopes[i].exp_ret, ret, "The manifest sequences decoding did not fail");
@@ -598,19 +600,20 @@ void test_decode_sequences_shared_and_one_sequence(void)
 		},
 	};
 
-	enum suit_seq_status *seq_status[] = {
-		&manifest.validate_seq_status,
-		&manifest.load_seq_status,
-		&manifest.invoke_seq_status,
-		&manifest.payload_fetch_seq_status,
-		&manifest.install_seq_status,
-		&manifest.dependency_resolution_seq_status,
-		&manifest.candidate_verification_seq_status,
+	enum suit_command_sequence seq_names[] = {
+		SUIT_SEQ_VALIDATE,
+		SUIT_SEQ_LOAD,
+		SUIT_SEQ_INVOKE,
+		SUIT_SEQ_PAYLOAD_FETCH,
+		SUIT_SEQ_INSTALL,
+		SUIT_SEQ_DEP_RESOLUTION,
+		SUIT_SEQ_CAND_VERIFICATION,
 	};
 
 	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(envelopes); i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
 		init_decode_manifest(envelopes[i].envelope, envelopes[i].envelope_size);
@@ -622,10 +625,10 @@ void test_decode_sequences_shared_and_one_sequence(void)
 
 		for (size_t seq_i = 0; seq_i < ZCBOR_ARRAY_SIZE(envelopes); seq_i++) {
 			if (seq_i == i) {
-				TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, *seq_status[seq_i], "Unsevered sequence decoded but not marked as authenticated");
-				TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.shared_sequence_status, "Shared sequence decoded but not marked as authenticated");
+				TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, seq_names[seq_i]), "Unsevered sequence decoded but not marked as authenticated");
+				TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_SHARED), "Shared sequence decoded but not marked as authenticated");
 			} else {
-				TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, *seq_status[seq_i], "Unsevered sequence not decoded but not marked as unavailable");
+				TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, suit_manifest_get_seq_status(&manifest, seq_names[seq_i]), "Unsevered sequence not decoded but not marked as unavailable");
 			}
 		}
 	}
@@ -635,20 +638,20 @@ void test_decode_sequences_text_invalid_state(void)
 {
 	init_decode_manifest_with_text(minimal_with_shared_and_text, sizeof(minimal_with_shared_and_text));
 	state.step = MANIFEST_AUTHORIZED;
-	manifest.text_status = AUTHENTICATED;
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_MANIFEST_TEXT, AUTHENTICATED);
 
 	int ret = suit_decoder_decode_sequences(&state);
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "The manifest severed text field decoding failed");
 	TEST_ASSERT_EQUAL_MESSAGE(SEQUENCES_DECODED, state.step, "Invalid state transition after manifest sequence decoding");
-	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, manifest.text_status, "The text field status is still valid, but the payload is not present");
+	TEST_ASSERT_EQUAL_MESSAGE(UNAVAILABLE, suit_manifest_get_seq_status(&manifest, SUIT_MANIFEST_TEXT), "The text field status is still valid, but the payload is not present");
 }
 
 void test_decode_sequences_text_without_digest(void)
 {
 	init_decode_manifest_with_text(minimal_with_shared_and_text_without_digest, sizeof(minimal_with_shared_and_text_without_digest));
 	state.step = MANIFEST_AUTHORIZED;
-	manifest.text_status = AUTHENTICATED;
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_MANIFEST_TEXT, AUTHENTICATED);
 
 	int ret = suit_decoder_decode_sequences(&state);
 
@@ -763,39 +766,39 @@ void test_decode_sequences_all(void)
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "The manifest sequence decoding failed");
 	TEST_ASSERT_EQUAL_MESSAGE(SEQUENCES_DECODED, state.step, "Invalid state transition after manifest sequence decoding");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.shared_sequence_status, "Shared sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_SHARED), "Shared sequence decoded but not marked as authenticated");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.validate_seq_status, "Validate sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.validate_seq.len, "Validate sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('V', manifest.validate_seq.value[0], "Validate sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_VALIDATE), "Validate sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_VALIDATE).len, "Validate sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('V', decoded_seq(SUIT_SEQ_VALIDATE).value[0], "Validate sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.load_seq_status, "Load sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.load_seq.len, "Load sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('L', manifest.load_seq.value[0], "Load sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_LOAD), "Load sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_LOAD).len, "Load sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('L', decoded_seq(SUIT_SEQ_LOAD).value[0], "Load sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.invoke_seq_status, "Invoke sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.invoke_seq.len, "Invoke sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('R', manifest.invoke_seq.value[0], "Invoke sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_INVOKE), "Invoke sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_INVOKE).len, "Invoke sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('R', decoded_seq(SUIT_SEQ_INVOKE).value[0], "Invoke sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.payload_fetch_seq_status, "Payload-fetch sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.payload_fetch_seq.len, "Payload-fetch sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('P', manifest.payload_fetch_seq.value[0], "Payload-fetch sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_PAYLOAD_FETCH), "Payload-fetch sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_PAYLOAD_FETCH).len, "Payload-fetch sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('P', decoded_seq(SUIT_SEQ_PAYLOAD_FETCH).value[0], "Payload-fetch sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.install_seq_status, "Install sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.install_seq.len, "Install sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('I', manifest.install_seq.value[0], "Install sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_INSTALL), "Install sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_INSTALL).len, "Install sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('I', decoded_seq(SUIT_SEQ_INSTALL).value[0], "Install sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.text_status, "Severed text sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.text.len, "Severed text sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('T', manifest.text.value[0], "Severed text sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_MANIFEST_TEXT), "Severed text sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_MANIFEST_TEXT).len, "Severed text sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('T', decoded_seq(SUIT_MANIFEST_TEXT).value[0], "Severed text sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.dependency_resolution_seq_status, "Dependency-resolution sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.dependency_resolution_seq.len, "Dependency-resolution sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('D', manifest.dependency_resolution_seq.value[0], "Dependency-resolution sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_DEP_RESOLUTION), "Dependency-resolution sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_DEP_RESOLUTION).len, "Dependency-resolution sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('D', decoded_seq(SUIT_SEQ_DEP_RESOLUTION).value[0], "Dependency-resolution sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.candidate_verification_seq_status, "Candidate-verification sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.candidate_verification_seq.len, "Candidate-verification sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('C', manifest.candidate_verification_seq.value[0], "Candidate-verification sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_CAND_VERIFICATION), "Candidate-verification sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_CAND_VERIFICATION).len, "Candidate-verification sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('C', decoded_seq(SUIT_SEQ_CAND_VERIFICATION).value[0], "Candidate-verification sequence value does not match");
 }
 
 void test_decode_sequences_all_severed(void)
@@ -925,37 +928,37 @@ void test_decode_sequences_all_severed(void)
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "The manifest sequence decoding failed");
 	TEST_ASSERT_EQUAL_MESSAGE(SEQUENCES_DECODED, state.step, "Invalid state transition after manifest sequence decoding");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.shared_sequence_status, "Shared sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_SHARED), "Shared sequence decoded but not marked as authenticated");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.validate_seq_status, "Validate sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.validate_seq.len, "Validate sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('V', manifest.validate_seq.value[0], "Validate sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_VALIDATE), "Validate sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_VALIDATE).len, "Validate sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('V', decoded_seq(SUIT_SEQ_VALIDATE).value[0], "Validate sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.load_seq_status, "Load sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.load_seq.len, "Load sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('L', manifest.load_seq.value[0], "Load sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_LOAD), "Load sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_LOAD).len, "Load sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('L', decoded_seq(SUIT_SEQ_LOAD).value[0], "Load sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.invoke_seq_status, "Invoke sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.invoke_seq.len, "Invoke sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('R', manifest.invoke_seq.value[0], "Invoke sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_INVOKE), "Invoke sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_INVOKE).len, "Invoke sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('R', decoded_seq(SUIT_SEQ_INVOKE).value[0], "Invoke sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.payload_fetch_seq_status, "Payload-fetch sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.payload_fetch_seq.len, "Payload-fetch sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('P', manifest.payload_fetch_seq.value[0], "Payload-fetch sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_PAYLOAD_FETCH), "Payload-fetch sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_PAYLOAD_FETCH).len, "Payload-fetch sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('P', decoded_seq(SUIT_SEQ_PAYLOAD_FETCH).value[0], "Payload-fetch sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.install_seq_status, "Install sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.install_seq.len, "Install sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('I', manifest.install_seq.value[0], "Install sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_INSTALL), "Install sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_INSTALL).len, "Install sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('I', decoded_seq(SUIT_SEQ_INSTALL).value[0], "Install sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.text_status, "Severed text sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.text.len, "Severed text sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('T', manifest.text.value[0], "Severed text sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_MANIFEST_TEXT), "Severed text sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_MANIFEST_TEXT).len, "Severed text sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('T', decoded_seq(SUIT_MANIFEST_TEXT).value[0], "Severed text sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.dependency_resolution_seq_status, "Dependency-resolution sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.dependency_resolution_seq.len, "Dependency-resolution sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('D', manifest.dependency_resolution_seq.value[0], "Dependency-resolution sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_DEP_RESOLUTION), "Dependency-resolution sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_DEP_RESOLUTION).len, "Dependency-resolution sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('D', decoded_seq(SUIT_SEQ_DEP_RESOLUTION).value[0], "Dependency-resolution sequence value does not match");
 
-	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, manifest.candidate_verification_seq_status, "Candidate-verification sequence decoded but not marked as authenticated");
-	TEST_ASSERT_EQUAL_MESSAGE(1, manifest.candidate_verification_seq.len, "Candidate-verification sequence length does not match");
-	TEST_ASSERT_EQUAL_MESSAGE('C', manifest.candidate_verification_seq.value[0], "Candidate-verification sequence value does not match");
+	TEST_ASSERT_EQUAL_MESSAGE(AUTHENTICATED, suit_manifest_get_seq_status(&manifest, SUIT_SEQ_CAND_VERIFICATION), "Candidate-verification sequence decoded but not marked as authenticated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, decoded_seq(SUIT_SEQ_CAND_VERIFICATION).len, "Candidate-verification sequence length does not match");
+	TEST_ASSERT_EQUAL_MESSAGE('C', decoded_seq(SUIT_SEQ_CAND_VERIFICATION).value[0], "Candidate-verification sequence value does not match");
 }
\ No newline at end of file
@@ -130,6 +130,51 @@ static uint8_t minimal_checkable_envelope[] = {
 		'M', 'a', 'n', 'i', 'f', 'e', 's', 't',
 };
 
+#define READER_PAGE_SIZE  8
+#define READER_PAGE_COUNT 2
+
+static struct suit_envelope_reader reader;
+static struct suit_envelope_page reader_pages[READER_PAGE_COUNT];
+static uint8_t reader_buf[READER_PAGE_COUNT * READER_PAGE_SIZE];
+static uint8_t chunked_payload[16];
+static size_t chunked_payload_len;
+static size_t chunk_count;
+
+/* The minimal checkable envelope is used as the contents of the storage. */
+static int read_storage(void *ctx, size_t offset, uint8_t *buf, size_t len)
+{
+	memcpy(buf, &minimal_checkable_envelope[offset], len);
+
+	return SUIT_SUCCESS;
+}
+
+static int check_digest_chunked_stub(enum suit_cose_alg alg_id, struct zcbor_string *digest, size_t len,
+				     suit_plat_digest_chunk_t get_chunk, void *ctx, int cmock_num_calls)
+{
+	TEST_ASSERT_EQUAL(suit_cose_sha256, alg_id);
+	TEST_ASSERT_EQUAL(32, digest->len);
+	TEST_ASSERT_LESS_OR_EQUAL(sizeof(chunked_payload), len);
+
+	chunked_payload_len = 0;
+	chunk_count = 0;
+
+	while (chunked_payload_len < len) {
+		struct zcbor_string chunk;
+		int ret = get_chunk(ctx, chunked_payload_len, &chunk);
+
+		if (ret != SUIT_SUCCESS) {
+			return ret;
+		}
+
+		TEST_ASSERT_LESS_OR_EQUAL(len - chunked_payload_len, chunk.len);
+		memcpy(&chunked_payload[chunked_payload_len], chunk.value, chunk.len);
+		chunked_payload_len += chunk.len;
+		chunk_count++;
+	}
+
+	return SUIT_SUCCESS;
+}
+
 static uint8_t minimal_checkable_envelope_sha512[] = {
 	0xd8, 0x6b, /* tag(107) : SUIT_Envelope */
 	0xa2, /* map (2 elements) */
@@ -284,6 +329,7 @@ void test_manifest_digest_invalid_input_bytes(void)
 	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(envelopes); i++) {
 		/* Reset state. */
 		memset(&state, 0, sizeof(state));
+		suit_arena_release(0);
 		memset(&manifest, 0, sizeof(manifest));
 		TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "SUIT decoder has a valid state before the test starts");
 		init_decode_envelope(envelopes[i].envelope, envelopes[i].envelope_size);
@@ -326,3 +372,50 @@ void test_manifest_digest_minimal_platform_fail(void)
 	TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "Invalid state transition after failed manifest digest check");
 	TEST_ASSERT_NULL_MESSAGE(state.decoded_manifest, "Manifest structure not freed after manifest digest check failure");
 }
+
+void test_manifest_digest_minimal_reader(void)
+{
+	uint8_t window[sizeof(minimal_checkable_envelope)];
+	int ret = SUIT_SUCCESS;
+
+	ret = suit_envelope_reader_init(&reader, read_storage, NULL, sizeof(minimal_checkable_envelope),
+					reader_pages, reader_buf, READER_PAGE_COUNT, READER_PAGE_SIZE);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to initialize reader");
+	memcpy(window, minimal_checkable_envelope, sizeof(window));
+
+	init_decode_envelope(window, sizeof(window));
+	state.envelope_reader = &reader;
+
+	/* The digest is checked by reading the storage, not the window. */
+	__cmock_suit_plat_check_digest_chunked_Stub(check_digest_chunked_stub);
+	ret = suit_decoder_check_manifest_digest(&state);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "The manifest digest check failed");
+	TEST_ASSERT_EQUAL_MESSAGE(MANIFEST_DIGEST_VERIFIED, state.step, "Invalid state transition after manifest digest check");
+
+	/* The bstr header and the manifest are split by the page boundary. */
+	TEST_ASSERT_EQUAL_MESSAGE(9, chunked_payload_len, "Invalid length of the digested manifest");
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE("HManifest", chunked_payload, 9, "Invalid digested manifest");
+	TEST_ASSERT_EQUAL_MESSAGE(2, chunk_count, "The manifest was not digested in page-sized chunks");
+}
+
+void test_manifest_digest_minimal_reader_modified(void)
+{
+	uint8_t window[sizeof(minimal_checkable_envelope)];
+	int ret = SUIT_SUCCESS;
+
+	ret = suit_envelope_reader_init(&reader, read_storage, NULL, sizeof(minimal_checkable_envelope),
+					reader_pages, reader_buf, READER_PAGE_COUNT, READER_PAGE_SIZE);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to initialize reader");
+	memcpy(window, minimal_checkable_envelope, sizeof(window));
+
+	/* The decoded manifest differs from the digested one. */
+	window[sizeof(window) - 1] = 'T';
+
+	init_decode_envelope(window, sizeof(window));
+	state.envelope_reader = &reader;
+
+	__cmock_suit_plat_check_digest_chunked_Stub(check_digest_chunked_stub);
+	ret = suit_decoder_check_manifest_digest(&state);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_AUTHENTICATION, ret, "The manifest digest check did not fail on modified window");
+	TEST_ASSERT_EQUAL_MESSAGE(INVALID, state.step, "Invalid state transition after failed manifest digest check");
+}
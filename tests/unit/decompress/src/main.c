@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit_decompress.h>
+
+/* The payloads were generated with:
+ *   lzma.compress(plain_payload, format=lzma.FORMAT_RAW, filters=[
+ *     {"id": lzma.FILTER_ARMTHUMB},  (lzma2_thumb_payload only)
+ *     {"id": lzma.FILTER_LZMA2, "dict_size": 4096, "lc": 3, "lp": 0, "pb": 2}])
+ * The plain payload contains two Thumb BL instructions, so the filter output differs from its input.
+ */
+static const uint8_t plain_payload[] = {
+	0x53, 0x55, 0x49, 0x54, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73,
+	0x73, 0x65, 0x64, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x2e,
+	0x20, 0x53, 0x55, 0x49, 0x54, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65,
+	0x73, 0x73, 0x65, 0x64, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64,
+	0x2e, 0x20, 0x53, 0x55, 0x49, 0x54, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x72,
+	0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61,
+	0x64, 0x2e, 0x20, 0x53, 0x55, 0x49, 0x54, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+	0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f,
+	0x61, 0x64, 0x2e, 0x20, 0x00, 0xf0, 0x10, 0xf8, 0x70, 0x47, 0x00, 0xbf,
+	0x01, 0xf0, 0x20, 0xf8, 0x53, 0x55, 0x49, 0x54, 0x20, 0x63, 0x6f, 0x6d,
+	0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x70, 0x61, 0x79, 0x6c,
+	0x6f, 0x61, 0x64, 0x2e, 0x20, 0x53, 0x55, 0x49, 0x54, 0x20, 0x63, 0x6f,
+	0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x70, 0x61, 0x79,
+	0x6c, 0x6f, 0x61, 0x64, 0x2e, 0x20,
+};
+
+static const uint8_t lzma2_payload[] = {
+	0xe0, 0x00, 0xa1, 0x00, 0x30, 0x5d, 0x00, 0x29, 0x95, 0x45, 0x35, 0xca,
+	0xf0, 0x4b, 0x94, 0x30, 0xd0, 0xcf, 0x50, 0x33, 0x2a, 0x58, 0xf9, 0x8d,
+	0x92, 0xa3, 0x81, 0x52, 0xcc, 0x62, 0xa3, 0x7e, 0xfb, 0xbe, 0xbb, 0x1e,
+	0xdc, 0x2e, 0xbf, 0x0f, 0x5a, 0xfb, 0x8f, 0x19, 0x07, 0x54, 0xbc, 0x0e,
+	0x95, 0xa2, 0xe3, 0x38, 0xfd, 0x08, 0x00, 0x00,
+};
+
+static const uint8_t lzma2_thumb_payload[] = {
+	0xe0, 0x00, 0xa1, 0x00, 0x30, 0x5d, 0x00, 0x29, 0x95, 0x45, 0x35, 0xca,
+	0xf0, 0x4b, 0x94, 0x30, 0xd0, 0xcf, 0x50, 0x33, 0x2a, 0x58, 0xf9, 0x8d,
+	0x92, 0xa3, 0x81, 0x52, 0xcc, 0x62, 0xa3, 0x7e, 0xfb, 0xbe, 0xbb, 0x1e,
+	0xdc, 0x2e, 0xd1, 0x5c, 0x1b, 0xec, 0x8f, 0x9a, 0x68, 0x48, 0xaa, 0x1a,
+	0xaa, 0x72, 0x91, 0xf3, 0xf9, 0x5a, 0x80, 0x00,
+};
+
+static struct suit_decompress_state decompress_state;
+static uint8_t dict[SUIT_LZMA2_DICT_SIZE_MIN];
+static uint8_t output[sizeof(plain_payload) + 16];
+
+/* Pass the payload in chunks of in_chunk bytes, providing out_chunk bytes of output space. */
+static int decompress_chunked(const uint8_t *in, size_t in_size, size_t in_chunk,
+			      size_t out_chunk, size_t *out_size)
+{
+	size_t in_pos = 0;
+	size_t out_pos = 0;
+	int ret = SUIT_ERR_AGAIN;
+
+	while (ret == SUIT_ERR_AGAIN) {
+		size_t in_len = in_size - in_pos;
+		size_t out_len = sizeof(output) - out_pos;
+
+		if (in_len > in_chunk) {
+			in_len = in_chunk;
+		}
+
+		if (out_len > out_chunk) {
+			out_len = out_chunk;
+		}
+
+		ret = suit_decompress(&decompress_state, &in[in_pos], &in_len, &output[out_pos], &out_len);
+		in_pos += in_len;
+		out_pos += out_len;
+
+		if ((ret == SUIT_ERR_AGAIN) && (in_len == 0) && (out_len == 0) && (in_pos == in_size)) {
+			/* The input is exhausted, but the decoder did not reach the end of the stream. */
+			break;
+		}
+	}
+
+	*out_size = out_pos;
+
+	return ret;
+}
+
+void setUp(void)
+{
+	memset(&decompress_state, 0, sizeof(decompress_state));
+	memset(dict, 0, sizeof(dict));
+	memset(output, 0, sizeof(output));
+}
+
+void test_decompress_init_invalid_args(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+	};
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_decompress_init(NULL, &info, dict, sizeof(dict)));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_decompress_init(&decompress_state, NULL, dict, sizeof(dict)));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_decompress_init(&decompress_state, &info, NULL, sizeof(dict)));
+}
+
+void test_decompress_init_unsupported_alg(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2 + 1,
+	};
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_ALG,
+			  suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+}
+
+void test_decompress_init_dict_too_small(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+	};
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_PARAMETER,
+			  suit_decompress_init(&decompress_state, &info, dict, sizeof(dict) - 1));
+}
+
+void test_decompress_lzma2(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+		.arm_thumb_filter = false,
+		.decompressed_image_size = sizeof(plain_payload),
+	};
+	size_t out_size = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+
+	int retval = decompress_chunked(lzma2_payload, sizeof(lzma2_payload), sizeof(lzma2_payload),
+					sizeof(output), &out_size);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(sizeof(plain_payload), out_size);
+	TEST_ASSERT_EQUAL_MEMORY(plain_payload, output, sizeof(plain_payload));
+}
+
+void test_decompress_lzma2_chunked(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+	};
+
+	for (size_t in_chunk = 1; in_chunk <= 7; in_chunk++) {
+		for (size_t out_chunk = 1; out_chunk <= 5; out_chunk++) {
+			size_t out_size = 0;
+
+			TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+					  suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+
+			int retval = decompress_chunked(lzma2_payload, sizeof(lzma2_payload), in_chunk,
+							out_chunk, &out_size);
+
+			TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+			TEST_ASSERT_EQUAL(sizeof(plain_payload), out_size);
+			TEST_ASSERT_EQUAL_MEMORY(plain_payload, output, sizeof(plain_payload));
+		}
+	}
+}
+
+void test_decompress_lzma2_arm_thumb_chunked(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+		.arm_thumb_filter = true,
+		.decompressed_image_size = sizeof(plain_payload),
+	};
+
+	for (size_t in_chunk = 1; in_chunk <= 7; in_chunk++) {
+		for (size_t out_chunk = sizeof(decompress_state.filter_buf) + 1; out_chunk <= 9; out_chunk++) {
+			size_t out_size = 0;
+
+			TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+					  suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+
+			int retval = decompress_chunked(lzma2_thumb_payload, sizeof(lzma2_thumb_payload),
+							in_chunk, out_chunk, &out_size);
+
+			TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+			TEST_ASSERT_EQUAL(sizeof(plain_payload), out_size);
+			TEST_ASSERT_EQUAL_MEMORY(plain_payload, output, sizeof(plain_payload));
+		}
+	}
+}
+
+void test_decompress_arm_thumb_output_too_small(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+		.arm_thumb_filter = true,
+	};
+	size_t in_len = sizeof(lzma2_thumb_payload);
+	size_t out_len = sizeof(decompress_state.filter_buf);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW,
+			  suit_decompress(&decompress_state, lzma2_thumb_payload, &in_len, output, &out_len));
+}
+
+void test_decompress_invalid_size(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+		.decompressed_image_size = sizeof(plain_payload) - 1,
+	};
+	size_t out_size = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+
+	int retval = decompress_chunked(lzma2_payload, sizeof(lzma2_payload), sizeof(lzma2_payload),
+					sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+
+	info.decompressed_image_size = sizeof(plain_payload) + 1;
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+
+	retval = decompress_chunked(lzma2_payload, sizeof(lzma2_payload), sizeof(lzma2_payload),
+				    sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+}
+
+void test_decompress_invalid_control_byte(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+	};
+	uint8_t corrupted[sizeof(lzma2_payload)];
+	size_t out_size = 0;
+
+	memcpy(corrupted, lzma2_payload, sizeof(corrupted));
+	/* 0x03 - 0x7F are reserved LZMA2 control bytes. */
+	corrupted[0] = 0x03;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+
+	int retval = decompress_chunked(corrupted, sizeof(corrupted), sizeof(corrupted),
+					sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+}
+
+void test_decompress_truncated(void)
+{
+	struct suit_compression_info info = {
+		.compression_alg_id = suit_lzma2,
+	};
+	size_t out_size = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_decompress_init(&decompress_state, &info, dict, sizeof(dict)));
+
+	/* Skip the end of stream marker. */
+	int retval = decompress_chunked(lzma2_payload, sizeof(lzma2_payload) - 1, sizeof(lzma2_payload),
+					sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <bootstrap_envelope.h>
+#include <bootstrap_params.h>
+#include <suit_manifest.h>
+#include <suit_memo.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+#define FIRST_COMPONENT_HANDLE	(ASSIGNED_COMPONENT_HANDLE)
+#define SECOND_COMPONENT_HANDLE (ASSIGNED_COMPONENT_HANDLE + 1)
+
+struct suit_processor_state state;
+
+static void expect_fetch(suit_component_t handle)
+{
+	__cmock_suit_plat_fetch_ExpectAndReturn(handle, NULL, NULL, NULL, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_IgnoreArg_uri();
+	__cmock_suit_plat_fetch_IgnoreArg_manifest_component_id();
+}
+
+void setUp(void)
+{
+	int err = bootstrap_envelope_init(&state);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, err, "Unable to initialize SUIT processor");
+
+	/* The results are kept by the processor between the test cases. */
+	suit_memo_drop_all();
+
+	bootstrap_envelope_components(&state, 2);
+}
+
+void test_fetch_copied_from_verified_component(void)
+{
+	uint8_t seq_cmd[] = {
+		0x8c, /* list (12 elements - 6 commands) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x00, /* uint(0) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				IMAGE_DIGEST_PARAMETER,
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x01, /* uint(1) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				IMAGE_DIGEST_PARAMETER,
+				URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	__cmock_suit_plat_check_image_match_ExpectAndReturn(FIRST_COMPONENT_HANDLE,
+							    suit_cose_sha256, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_image_match_IgnoreArg_digest();
+	__cmock_suit_plat_copy_ExpectAndReturn(SECOND_COMPONENT_HANDLE, FIRST_COMPONENT_HANDLE,
+					       NULL, NULL, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_copy_IgnoreArg_manifest_component_id();
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_fetch_executed_if_copy_fails(void)
+{
+	uint8_t seq_cmd[] = {
+		0x8c, /* list (12 elements - 6 commands) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x00, /* uint(0) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				IMAGE_DIGEST_PARAMETER,
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x01, /* uint(1) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				IMAGE_DIGEST_PARAMETER,
+				URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	__cmock_suit_plat_check_image_match_ExpectAndReturn(FIRST_COMPONENT_HANDLE,
+							    suit_cose_sha256, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_image_match_IgnoreArg_digest();
+	__cmock_suit_plat_copy_ExpectAndReturn(SECOND_COMPONENT_HANDLE, FIRST_COMPONENT_HANDLE,
+					       NULL, NULL, NULL, SUIT_ERR_UNSUPPORTED_COMPONENT_ID);
+	__cmock_suit_plat_copy_IgnoreArg_manifest_component_id();
+	/* Only the fetch was checked by the dry run, so it is used instead of the failed copy. */
+	expect_fetch(SECOND_COMPONENT_HANDLE);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_fetch_executed_without_verified_component(void)
+{
+	uint8_t seq_cmd[] = {
+		0x88, /* list (8 elements - 4 commands) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x00, /* uint(0) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				IMAGE_DIGEST_PARAMETER,
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x01, /* uint(1) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				IMAGE_DIGEST_PARAMETER,
+				URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	/* The first component has the same digest, but its contents were not checked. */
+	expect_fetch(SECOND_COMPONENT_HANDLE);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_fetch_executed_if_verified_component_modified(void)
+{
+	uint8_t seq_cmd[] = {
+		0x8e, /* list (14 elements - 7 commands) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x00, /* uint(0) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				IMAGE_DIGEST_PARAMETER,
+				URI_PARAMETER,
+			0x03, /* uint(suit-condition-image-match) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x01, /* uint(1) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				IMAGE_DIGEST_PARAMETER,
+				URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	__cmock_suit_plat_check_image_match_ExpectAndReturn(FIRST_COMPONENT_HANDLE,
+							    suit_cose_sha256, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_image_match_IgnoreArg_digest();
+	/* The verified component is never used as its own source. */
+	expect_fetch(FIRST_COMPONENT_HANDLE);
+	/* The first component was modified after the image match. */
+	expect_fetch(SECOND_COMPONENT_HANDLE);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_PAYLOAD_FETCH, seq_cmd, sizeof(seq_cmd)));
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
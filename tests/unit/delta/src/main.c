@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit_delta.h>
+
+#define OFFSET_FIELD_OFFSET 55
+
+static const uint8_t base_image[] = "The quick brown fox jumps over the lazy dog";
+static const uint8_t target_image[] = "The quick brown cat jumps over the lazy Dog. quick!";
+
+static const uint8_t patch[] = {
+	'S', 'D', 'L', 'T', /* magic */
+	0x33, /* target_size: 51 */
+	/* Record 1: "The quick brown " + "cat", skip "fox" */
+	0x10, /* diff_len: 16 */
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, /* extra_len: 3 */
+		'c', 'a', 't',
+	0x06, /* offset: +3 */
+	/* Record 2: " jumps over the lazy dog", with 'd' changed into 'D' + ". " */
+	0x18, /* diff_len: 24 */
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00,
+	0x02, /* extra_len: 2 */
+		'.', ' ',
+	0x4d, /* offset: -39 */
+	/* Record 3: "quick" + "!", without the offset */
+	0x05, /* diff_len: 5 */
+		0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, /* extra_len: 1 */
+		'!',
+};
+
+static struct suit_delta_state delta_state;
+static uint8_t output[sizeof(target_image) + 16];
+static int read_base_retval;
+
+static int read_base(void *ctx, size_t offset, uint8_t *buf, size_t len)
+{
+	TEST_ASSERT_EQUAL_PTR(base_image, ctx);
+	TEST_ASSERT_LESS_OR_EQUAL(sizeof(base_image) - 1, offset + len);
+
+	memcpy(buf, &base_image[offset], len);
+
+	return read_base_retval;
+}
+
+/* Pass the patch in chunks of in_chunk bytes, providing out_chunk bytes of output space. */
+static int apply_chunked(const uint8_t *in, size_t in_size, size_t in_chunk, size_t out_chunk,
+			 size_t *out_size)
+{
+	size_t in_pos = 0;
+	size_t out_pos = 0;
+	int ret = SUIT_ERR_AGAIN;
+
+	while (ret == SUIT_ERR_AGAIN) {
+		size_t in_len = in_size - in_pos;
+		size_t out_len = sizeof(output) - out_pos;
+
+		if (in_len > in_chunk) {
+			in_len = in_chunk;
+		}
+
+		if (out_len > out_chunk) {
+			out_len = out_chunk;
+		}
+
+		ret = suit_delta_apply(&delta_state, &in[in_pos], &in_len, &output[out_pos], &out_len);
+		in_pos += in_len;
+		out_pos += out_len;
+
+		if ((ret == SUIT_ERR_AGAIN) && (in_len == 0) && (out_len == 0) && (in_pos == in_size)) {
+			/* The patch is exhausted, but the target image is not complete. */
+			break;
+		}
+	}
+
+	*out_size = out_pos;
+
+	return ret;
+}
+
+void setUp(void)
+{
+	memset(&delta_state, 0, sizeof(delta_state));
+	memset(output, 0, sizeof(output));
+	read_base_retval = SUIT_SUCCESS;
+}
+
+void test_delta_init_invalid_args(void)
+{
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_delta_init(NULL, read_base, (void *)base_image, 0));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_delta_init(&delta_state, NULL, (void *)base_image, 0));
+}
+
+void test_delta_apply(void)
+{
+	size_t out_size = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_delta_init(&delta_state, read_base, (void *)base_image,
+							sizeof(base_image) - 1));
+
+	int retval = apply_chunked(patch, sizeof(patch), sizeof(patch), sizeof(output), &out_size);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(sizeof(target_image) - 1, out_size);
+	TEST_ASSERT_EQUAL_MEMORY(target_image, output, sizeof(target_image) - 1);
+}
+
+void test_delta_apply_chunked(void)
+{
+	for (size_t in_chunk = 1; in_chunk <= 7; in_chunk++) {
+		for (size_t out_chunk = 1; out_chunk <= 5; out_chunk++) {
+			size_t out_size = 0;
+
+			TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+					  suit_delta_init(&delta_state, read_base, (void *)base_image,
+							  sizeof(base_image) - 1));
+
+			int retval = apply_chunked(patch, sizeof(patch), in_chunk, out_chunk, &out_size);
+
+			TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+			TEST_ASSERT_EQUAL(sizeof(target_image) - 1, out_size);
+			TEST_ASSERT_EQUAL_MEMORY(target_image, output, sizeof(target_image) - 1);
+		}
+	}
+}
+
+void test_delta_invalid_magic(void)
+{
+	uint8_t corrupted[sizeof(patch)];
+	size_t out_size = 0;
+
+	memcpy(corrupted, patch, sizeof(corrupted));
+	corrupted[3] = 'X';
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_delta_init(&delta_state, read_base, (void *)base_image,
+							sizeof(base_image) - 1));
+
+	int retval = apply_chunked(corrupted, sizeof(corrupted), sizeof(corrupted), sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+}
+
+void test_delta_base_too_small(void)
+{
+	size_t out_size = 0;
+
+	/* The first record requires 16 bytes of the base image. */
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_delta_init(&delta_state, read_base, (void *)base_image, 15));
+
+	int retval = apply_chunked(patch, sizeof(patch), sizeof(patch), sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+}
+
+void test_delta_invalid_offset(void)
+{
+	uint8_t corrupted[sizeof(patch)];
+	size_t out_size = 0;
+
+	memcpy(corrupted, patch, sizeof(corrupted));
+	/* Move before the beginning of the base image (-44). */
+	corrupted[OFFSET_FIELD_OFFSET] = 0x57;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_delta_init(&delta_state, read_base, (void *)base_image,
+							sizeof(base_image) - 1));
+
+	int retval = apply_chunked(corrupted, sizeof(corrupted), sizeof(corrupted), sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+}
+
+void test_delta_invalid_target_size(void)
+{
+	uint8_t corrupted[sizeof(patch)];
+	size_t out_size = 0;
+
+	memcpy(corrupted, patch, sizeof(corrupted));
+	/* The records produce more data than declared. */
+	corrupted[4] = 0x32;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_delta_init(&delta_state, read_base, (void *)base_image,
+							sizeof(base_image) - 1));
+
+	int retval = apply_chunked(corrupted, sizeof(corrupted), sizeof(corrupted), sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+}
+
+void test_delta_read_base_failed(void)
+{
+	size_t out_size = 0;
+
+	read_base_retval = SUIT_ERR_UNAVAILABLE_PAYLOAD;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_delta_init(&delta_state, read_base, (void *)base_image,
+							sizeof(base_image) - 1));
+
+	int retval = apply_chunked(patch, sizeof(patch), sizeof(patch), sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_PAYLOAD, retval);
+}
+
+void test_delta_truncated(void)
+{
+	size_t out_size = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_delta_init(&delta_state, read_base, (void *)base_image,
+							sizeof(base_image) - 1));
+
+	int retval = apply_chunked(patch, sizeof(patch) - 1, sizeof(patch), sizeof(output), &out_size);
+	TEST_ASSERT_EQUAL(SUIT_ERR_AGAIN, retval);
+	TEST_ASSERT_EQUAL(sizeof(target_image) - 2, out_size);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
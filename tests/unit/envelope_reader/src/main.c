@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit_envelope_reader.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+#define PAGE_SIZE    8
+#define PAGE_COUNT   2
+#define ENVELOPE_LEN 45
+
+static uint8_t storage[64] = {
+	0xd8, 0x6b, /* tag(107) : SUIT_Envelope */
+	0xa3, /* map (3) */
+		0x02, /* suit-authentication-wrapper */
+		0x43, /* bytes (3) */
+			0x01, 0x02, 0x03,
+		0x03, /* suit-manifest */
+		0x58, 0x18, /* bytes (24) */
+			0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+			0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+			0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+		0x64, /* text (4 characters) */
+			'#', 'a', 'p', 'p',
+		0x44, /* bytes (4) */
+			0xaa, 0xbb, 0xcc, 0xdd,
+	/* The remaining part of the storage is erased. */
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static struct suit_envelope_reader reader;
+static struct suit_envelope_page pages[PAGE_COUNT];
+static uint8_t page_buf[PAGE_COUNT * PAGE_SIZE];
+static int read_retval;
+static size_t read_count;
+
+static uint8_t digested[ENVELOPE_LEN];
+static size_t digested_len;
+static size_t chunk_count;
+static bool mask_chunk_errors;
+
+static int check_digest_chunked_stub(enum suit_cose_alg alg_id, struct zcbor_string *digest, size_t len,
+				     suit_plat_digest_chunk_t get_chunk, void *ctx, int cmock_num_calls)
+{
+	TEST_ASSERT_EQUAL(suit_cose_sha256, alg_id);
+	TEST_ASSERT_NOT_NULL(digest);
+	TEST_ASSERT_LESS_OR_EQUAL(sizeof(digested), len);
+
+	while (digested_len < len) {
+		struct zcbor_string chunk;
+		int ret = get_chunk(ctx, digested_len, &chunk);
+
+		if (ret != SUIT_SUCCESS) {
+			return mask_chunk_errors ? SUIT_SUCCESS : ret;
+		}
+
+		TEST_ASSERT_LESS_OR_EQUAL(PAGE_SIZE, chunk.len);
+		TEST_ASSERT_LESS_OR_EQUAL(len - digested_len, chunk.len);
+		memcpy(&digested[digested_len], chunk.value, chunk.len);
+		digested_len += chunk.len;
+		chunk_count++;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+static int read_storage(void *ctx, size_t offset, uint8_t *buf, size_t len)
+{
+	TEST_ASSERT_EQUAL_PTR(storage, ctx);
+	TEST_ASSERT_LESS_OR_EQUAL(sizeof(storage), offset + len);
+
+	memcpy(buf, &storage[offset], len);
+	read_count++;
+
+	return read_retval;
+}
+
+static void read_page(size_t page)
+{
+	uint8_t buf[PAGE_SIZE];
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_envelope_reader_read(&reader, page * PAGE_SIZE, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_MEMORY(&storage[page * PAGE_SIZE], buf, sizeof(buf));
+}
+
+void setUp(void)
+{
+	read_retval = SUIT_SUCCESS;
+	read_count = 0;
+	digested_len = 0;
+	chunk_count = 0;
+	mask_chunk_errors = false;
+
+	int ret = suit_envelope_reader_init(&reader, read_storage, storage, sizeof(storage), pages, page_buf,
+					    PAGE_COUNT, PAGE_SIZE);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to initialize reader");
+}
+
+void test_init_invalid_args(void)
+{
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_envelope_reader_init(NULL, read_storage, NULL, 1, pages, page_buf, 1, 1));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_envelope_reader_init(&reader, NULL, NULL, 1, pages, page_buf, 1, 1));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_envelope_reader_init(&reader, read_storage, NULL, 1, NULL, page_buf, 1, 1));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_envelope_reader_init(&reader, read_storage, NULL, 1, pages, NULL, 1, 1));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_envelope_reader_init(&reader, read_storage, NULL, 1, pages, page_buf, 0, 1));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_envelope_reader_init(&reader, read_storage, NULL, 1, pages, page_buf, 1, 0));
+}
+
+void test_read_across_pages(void)
+{
+	uint8_t buf[4];
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_envelope_reader_read(&reader, PAGE_SIZE - 2, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_MEMORY(&storage[PAGE_SIZE - 2], buf, sizeof(buf));
+	TEST_ASSERT_EQUAL(2, read_count);
+
+	/* Both pages are cached. */
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_envelope_reader_read(&reader, PAGE_SIZE - 2, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL(2, read_count);
+	TEST_ASSERT_EQUAL(2, reader.miss_count);
+}
+
+void test_read_least_recently_used_page_replaced(void)
+{
+	read_page(0);
+	read_page(1);
+	read_page(0);
+	read_page(2);
+	TEST_ASSERT_EQUAL(3, read_count);
+
+	/* The second page was replaced by the third one. */
+	read_page(0);
+	TEST_ASSERT_EQUAL(3, read_count);
+	read_page(1);
+	TEST_ASSERT_EQUAL(4, read_count);
+}
+
+void test_read_out_of_range(void)
+{
+	uint8_t buf[4];
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_envelope_reader_read(&reader, sizeof(storage) - 2, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_envelope_reader_read(&reader, sizeof(storage) + 1, buf, 0));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_envelope_reader_read(&reader, 0, NULL, sizeof(buf)));
+	TEST_ASSERT_EQUAL(0, read_count);
+}
+
+void test_read_error_not_cached(void)
+{
+	uint8_t buf[4];
+
+	read_retval = SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_PAYLOAD, suit_envelope_reader_read(&reader, 0, buf, sizeof(buf)));
+
+	read_retval = SUIT_SUCCESS;
+	read_page(0);
+	TEST_ASSERT_EQUAL(2, read_count);
+}
+
+void test_invalidate(void)
+{
+	read_page(0);
+	suit_envelope_reader_invalidate(&reader);
+	read_page(0);
+
+	TEST_ASSERT_EQUAL(2, read_count);
+}
+
+void test_get_len(void)
+{
+	size_t envelope_len = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_envelope_reader_get_len(&reader, &envelope_len));
+	TEST_ASSERT_EQUAL(ENVELOPE_LEN, envelope_len);
+
+	/* The contents of the byte strings are skipped. */
+	TEST_ASSERT_LESS_THAN(ENVELOPE_LEN / PAGE_SIZE + 1, read_count);
+}
+
+void test_get_len_not_an_envelope(void)
+{
+	size_t envelope_len = 0;
+
+	storage[1] = 0x6c;
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, suit_envelope_reader_get_len(&reader, &envelope_len));
+	storage[1] = 0x6b;
+
+	storage[2] = 0x83;
+	suit_envelope_reader_invalidate(&reader);
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, suit_envelope_reader_get_len(&reader, &envelope_len));
+	storage[2] = 0xa3;
+}
+
+void test_get_len_truncated(void)
+{
+	size_t envelope_len = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_envelope_reader_init(&reader, read_storage, storage, ENVELOPE_LEN - 1,
+								  pages, page_buf, PAGE_COUNT, PAGE_SIZE));
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, suit_envelope_reader_get_len(&reader, &envelope_len));
+}
+
+void test_load(void)
+{
+	uint8_t window[ENVELOPE_LEN];
+	size_t envelope_len = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_envelope_reader_load(&reader, window, sizeof(window), &envelope_len));
+	TEST_ASSERT_EQUAL(ENVELOPE_LEN, envelope_len);
+	TEST_ASSERT_EQUAL_MEMORY(storage, window, ENVELOPE_LEN);
+}
+
+void test_load_window_too_small(void)
+{
+	uint8_t window[ENVELOPE_LEN - 1];
+	size_t envelope_len = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_envelope_reader_load(&reader, window, sizeof(window), &envelope_len));
+	TEST_ASSERT_EQUAL(0, envelope_len);
+}
+
+void test_check_digest_chunks(void)
+{
+	uint8_t window[ENVELOPE_LEN];
+	struct zcbor_string digest = {
+		.value = (const uint8_t *)"digest",
+		.len = 6,
+	};
+
+	memcpy(window, storage, sizeof(window));
+	__cmock_suit_plat_check_digest_chunked_Stub(check_digest_chunked_stub);
+
+	/* Check the manifest, including the bstr header. */
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_envelope_reader_check_digest(&reader, 9, 26, &window[9],
+									  suit_cose_sha256, &digest));
+	TEST_ASSERT_EQUAL(26, digested_len);
+	TEST_ASSERT_EQUAL_MEMORY(&storage[9], digested, 26);
+
+	/* The chunks end at the page boundaries. */
+	TEST_ASSERT_EQUAL(4, chunk_count);
+	TEST_ASSERT_EQUAL(4, read_count);
+}
+
+void test_check_digest_copy_modified(void)
+{
+	uint8_t window[ENVELOPE_LEN];
+	struct zcbor_string digest = {
+		.value = (const uint8_t *)"digest",
+		.len = 6,
+	};
+
+	memcpy(window, storage, sizeof(window));
+	window[20] ^= 0xff;
+	__cmock_suit_plat_check_digest_chunked_Stub(check_digest_chunked_stub);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_AUTHENTICATION, suit_envelope_reader_check_digest(&reader, 9, 26, &window[9],
+										     suit_cose_sha256, &digest));
+	TEST_ASSERT_EQUAL(1, chunk_count);
+
+	/* The error is returned, even if the platform ignores it. */
+	digested_len = 0;
+	chunk_count = 0;
+	mask_chunk_errors = true;
+	TEST_ASSERT_EQUAL(SUIT_ERR_AUTHENTICATION, suit_envelope_reader_check_digest(&reader, 9, 26, &window[9],
+										     suit_cose_sha256, &digest));
+}
+
+void test_check_digest_read_error(void)
+{
+	struct zcbor_string digest = {
+		.value = (const uint8_t *)"digest",
+		.len = 6,
+	};
+
+	read_retval = SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	__cmock_suit_plat_check_digest_chunked_Stub(check_digest_chunked_stub);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_PAYLOAD, suit_envelope_reader_check_digest(&reader, 9, 26, NULL,
+											  suit_cose_sha256, &digest));
+	TEST_ASSERT_EQUAL(0, digested_len);
+}
+
+void test_check_digest_out_of_range(void)
+{
+	struct zcbor_string digest = {
+		.value = (const uint8_t *)"digest",
+		.len = 6,
+	};
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_envelope_reader_check_digest(&reader, sizeof(storage) - 2, 4, NULL,
+									       suit_cose_sha256, &digest));
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_envelope_reader_check_digest(&reader, sizeof(storage) + 1, 0, NULL,
+									       suit_cose_sha256, &digest));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_envelope_reader_check_digest(&reader, 0, 4, NULL, suit_cose_sha256,
+									    NULL));
+	TEST_ASSERT_EQUAL(0, read_count);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -157,38 +157,6 @@ void app_assert_envelope_integrity(bool installed)
 	__cmock_suit_plat_create_component_handle_ExpectComplexArgsAndReturn(&exp_fw_memptr_id, false, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
 	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&app_fw_memptr_component_handle);
-
-	/* component deletion */
-	__cmock_suit_plat_release_component_handle_ExpectAndReturn(app_fw_component_handle, SUIT_SUCCESS);
-	__cmock_suit_plat_release_component_handle_ExpectAndReturn(app_fw_memptr_component_handle, SUIT_SUCCESS);
-}
-
-void app_assert_envelope_authorization(bool installed)
-{
-	suit_component_t checked_component = installed ? app_component_handle : candidate_component_handle;
-
-	/* read manifest from the candidate component data */
-	__cmock_suit_plat_retrieve_manifest_ExpectAndReturn(checked_component, NULL, NULL, SUIT_SUCCESS);
-	__cmock_suit_plat_retrieve_manifest_IgnoreArg_envelope_str();
-	__cmock_suit_plat_retrieve_manifest_ReturnThruPtr_envelope_str(&exp_app_envelope_payload.value);
-	__cmock_suit_plat_retrieve_manifest_IgnoreArg_envelope_len();
-	__cmock_suit_plat_retrieve_manifest_ReturnThruPtr_envelope_len(&exp_app_envelope_payload.len);
-
-	__cmock_suit_plat_check_digest_ExpectComplexArgsAndReturn(suit_cose_sha256, &exp_app_manifest_digest, &exp_app_manifest_payload, SUIT_SUCCESS);
-	__cmock_suit_plat_authenticate_manifest_ExpectComplexArgsAndReturn(&exp_app_manifest_id, suit_cose_es256, NULL, &signature, &exp_signature, SUIT_SUCCESS);
-}
-
-void app_assert_component_creation(void)
-{
-	__cmock_suit_plat_authorize_component_id_ExpectComplexArgsAndReturn(&exp_app_manifest_id, &exp_app_fw_id, SUIT_SUCCESS);
-	__cmock_suit_plat_create_component_handle_ExpectComplexArgsAndReturn(&exp_app_fw_id, false, NULL, SUIT_SUCCESS);
-	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
-	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&app_fw_component_handle);
-
-	__cmock_suit_plat_authorize_component_id_ExpectComplexArgsAndReturn(&exp_app_manifest_id, &exp_fw_memptr_id, SUIT_SUCCESS);
-	__cmock_suit_plat_create_component_handle_ExpectComplexArgsAndReturn(&exp_fw_memptr_id, false, NULL, SUIT_SUCCESS);
-	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
-	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&app_fw_memptr_component_handle);
 }
 
 void app_assert_component_deletion(void)
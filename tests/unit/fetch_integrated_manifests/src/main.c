@@ -36,8 +36,6 @@ extern struct zcbor_string exp_radio_manifest_id;
 extern suit_component_t radio_fw_component_handle;
 extern suit_component_t radio_fw_memptr_component_handle;
 void radio_assert_envelope_integrity(bool installed);
-void radio_assert_envelope_authorization(bool installed);
-void radio_assert_component_creation(void);
 void radio_assert_component_deletion(void);
 
 /* Definitions from app.c */
@@ -52,8 +50,6 @@ extern struct zcbor_string exp_app_manifest_id;
 extern suit_component_t app_fw_component_handle;
 extern suit_component_t app_fw_memptr_component_handle;
 void app_assert_envelope_integrity(bool installed);
-void app_assert_envelope_authorization(bool installed);
-void app_assert_component_creation(void);
 void app_assert_component_deletion(void);
 
 
@@ -62,15 +58,15 @@ static void root_assert_dry_run_execution(void)
 {
 	/* SUIT_PLATFORM_FETCH dry-run */
 	/* Fetch the dependency manifest (radio) */
-	__cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, NULL, NULL, SUIT_SUCCESS);
 	/* Fetch the dependency manifest (application) */
-	__cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, NULL, NULL, SUIT_SUCCESS);
 
 	/* SUIT_INSTALL dry-run */
 	/* Fetch the dependency manifest (radio) */
-	__cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, NULL, NULL, SUIT_SUCCESS);
 	/* Fetch the dependency manifest (application) */
-	__cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, NULL, NULL, SUIT_SUCCESS);
 }
 #endif /* SUIT_PLATFORM_DRY_RUN_SUPPORT */
 
@@ -145,15 +141,12 @@ void test_suit_process_seq_dependency_resolution(void)
 	__cmock_suit_plat_check_cid_ExpectComplexArgsAndReturn(app_component_handle, &exp_app_cid_uuid, SUIT_SUCCESS);
 
 	/* Fetch the dependency manifest (radio) */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, &exp_root_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, &exp_root_manifest_id, NULL, NULL, SUIT_SUCCESS);
 
 	/* Execute radio manifest */
 	radio_assert_envelope_integrity(false);
 	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_manifest_id, &exp_radio_manifest_id, SUIT_SEQ_DEP_RESOLUTION, SUIT_SUCCESS);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_DEP_RESOLUTION, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
-	radio_assert_envelope_authorization(false);
-	radio_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_DEP_RESOLUTION, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the radio manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
@@ -163,15 +156,12 @@ void test_suit_process_seq_dependency_resolution(void)
 	radio_assert_component_deletion();
 
 	/* Fetch the dependency manifest (application) */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, &exp_root_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, &exp_root_manifest_id, NULL, NULL, SUIT_SUCCESS);
 
 	/* Execute application manifest */
 	app_assert_envelope_integrity(false);
 	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_manifest_id, &exp_app_manifest_id, SUIT_SEQ_DEP_RESOLUTION, SUIT_SUCCESS);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_DEP_RESOLUTION, &exp_app_manifest_id, 1, SUIT_SUCCESS);
-	app_assert_envelope_authorization(false);
-	app_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_DEP_RESOLUTION, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the application manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
@@ -206,15 +196,12 @@ void test_suit_process_seq_payload_fetch(void)
 	__cmock_suit_plat_check_cid_ExpectComplexArgsAndReturn(app_component_handle, &exp_app_cid_uuid, SUIT_SUCCESS);
 
 	/* Fetch the dependency manifest (radio) */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, &exp_root_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, &exp_root_manifest_id, NULL, NULL, SUIT_SUCCESS);
 
 	/* Execute radio manifest */
 	radio_assert_envelope_integrity(false);
 	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_manifest_id, &exp_radio_manifest_id, SUIT_SEQ_PAYLOAD_FETCH, SUIT_SUCCESS);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
-	radio_assert_envelope_authorization(false);
-	radio_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the radio manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
@@ -224,15 +211,12 @@ void test_suit_process_seq_payload_fetch(void)
 	radio_assert_component_deletion();
 
 	/* Fetch the dependency manifest (application) */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, &exp_root_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, &exp_root_manifest_id, NULL, NULL, SUIT_SUCCESS);
 
 	/* Execute application manifest */
 	app_assert_envelope_integrity(false);
 	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_manifest_id, &exp_app_manifest_id, SUIT_SEQ_PAYLOAD_FETCH, SUIT_SUCCESS);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &exp_app_manifest_id, 1, SUIT_SUCCESS);
-	app_assert_envelope_authorization(false);
-	app_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the application manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
@@ -269,15 +253,12 @@ void test_suit_process_seq_candidate_verification(void)
 	__cmock_suit_plat_check_cid_ExpectComplexArgsAndReturn(app_component_handle, &exp_app_cid_uuid, SUIT_SUCCESS);
 
 	/* Fetch the dependency manifest (radio) */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, &exp_root_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, &exp_root_manifest_id, NULL, NULL, SUIT_SUCCESS);
 
 	/* Execute radio manifest */
 	radio_assert_envelope_integrity(false);
 	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_manifest_id, &exp_radio_manifest_id, SUIT_SEQ_CAND_VERIFICATION, SUIT_SUCCESS);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_CAND_VERIFICATION, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
-	radio_assert_envelope_authorization(false);
-	radio_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_CAND_VERIFICATION, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the radio manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
@@ -287,15 +268,12 @@ void test_suit_process_seq_candidate_verification(void)
 	radio_assert_component_deletion();
 
 	/* Fetch the dependency manifest (application) */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, &exp_root_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, &exp_root_manifest_id, NULL, NULL, SUIT_SUCCESS);
 
 	/* Execute application manifest */
 	app_assert_envelope_integrity(false);
 	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_manifest_id, &exp_app_manifest_id, SUIT_SEQ_CAND_VERIFICATION, SUIT_SUCCESS);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_CAND_VERIFICATION, &exp_app_manifest_id, 1, SUIT_SUCCESS);
-	app_assert_envelope_authorization(false);
-	app_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_CAND_VERIFICATION, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the application manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
@@ -330,47 +308,41 @@ void test_suit_process_seq_install(void)
 	__cmock_suit_plat_check_cid_ExpectComplexArgsAndReturn(app_component_handle, &exp_app_cid_uuid, SUIT_SUCCESS);
 
 	/* Fetch the dependency manifest (radio) */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, &exp_root_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_radio_envelope_payload, &exp_root_manifest_id, NULL, NULL, SUIT_SUCCESS);
 
 	/* Execute radio manifest */
 	radio_assert_envelope_integrity(false);
 	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_manifest_id, &exp_radio_manifest_id, SUIT_SEQ_INSTALL, SUIT_SUCCESS);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_INSTALL, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
-	radio_assert_envelope_authorization(false);
-	radio_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_INSTALL, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the radio manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_check_vid_ExpectComplexArgsAndReturn(radio_fw_component_handle, &exp_radio_vid_uuid, SUIT_SUCCESS);
 	__cmock_suit_plat_check_cid_ExpectComplexArgsAndReturn(radio_fw_component_handle, &exp_radio_cid_uuid, SUIT_SUCCESS);
 	/* SUIT_INSTALL sequence from the radio manifest */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, &exp_radio_fw_payload, &exp_radio_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, &exp_radio_fw_payload, &exp_radio_manifest_id, NULL, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, suit_cose_sha256, &exp_radio_image_digest, SUIT_SUCCESS);
-	__cmock_suit_plat_copy_ExpectComplexArgsAndReturn(radio_fw_component_handle, radio_fw_memptr_component_handle, &exp_radio_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_copy_ExpectComplexArgsAndReturn(radio_fw_component_handle, radio_fw_memptr_component_handle, &exp_radio_manifest_id, NULL, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(radio_fw_component_handle, suit_cose_sha256, &exp_radio_image_digest, SUIT_SUCCESS);
 	__cmock_suit_plat_sequence_completed_ExpectComplexArgsAndReturn(SUIT_SEQ_INSTALL, &exp_radio_manifest_id, exp_radio_envelope_payload.value, exp_radio_envelope_payload.len, SUIT_SUCCESS);
 	radio_assert_component_deletion();
 
 	/* Fetch the dependency manifest (application) */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, &exp_root_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(candidate_component_handle, &exp_app_envelope_payload, &exp_root_manifest_id, NULL, NULL, SUIT_SUCCESS);
 
 	/* Execute application manifest */
 	app_assert_envelope_integrity(false);
 	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_manifest_id, &exp_app_manifest_id, SUIT_SEQ_INSTALL, SUIT_SUCCESS);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_INSTALL, &exp_app_manifest_id, 1, SUIT_SUCCESS);
-	app_assert_envelope_authorization(false);
-	app_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_INSTALL, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the application manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_check_vid_ExpectComplexArgsAndReturn(app_fw_component_handle, &exp_app_vid_uuid, SUIT_SUCCESS);
 	__cmock_suit_plat_check_cid_ExpectComplexArgsAndReturn(app_fw_component_handle, &exp_app_cid_uuid, SUIT_SUCCESS);
 	/* SUIT_INSTALL sequence from the application manifest */
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, &exp_app_fw_payload, &exp_app_manifest_id,  NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, &exp_app_fw_payload, &exp_app_manifest_id,  NULL, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, suit_cose_sha256, &exp_app_image_digest, SUIT_SUCCESS);
-	__cmock_suit_plat_copy_ExpectComplexArgsAndReturn(app_fw_component_handle, app_fw_memptr_component_handle, &exp_app_manifest_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_copy_ExpectComplexArgsAndReturn(app_fw_component_handle, app_fw_memptr_component_handle, &exp_app_manifest_id, NULL, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(app_fw_component_handle, suit_cose_sha256, &exp_app_image_digest, SUIT_SUCCESS);
 	__cmock_suit_plat_sequence_completed_ExpectComplexArgsAndReturn(SUIT_SEQ_INSTALL, &exp_app_manifest_id, exp_app_envelope_payload.value, exp_app_envelope_payload.len, SUIT_SUCCESS);
 	app_assert_component_deletion();
@@ -411,9 +383,6 @@ void test_suit_process_seq_validate(void)
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_VALIDATE, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 
 	/* Process radio manifest */
-	radio_assert_envelope_authorization(true);
-	radio_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_VALIDATE, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the radio manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
@@ -425,9 +394,6 @@ void test_suit_process_seq_validate(void)
 	radio_assert_component_deletion();
 
 	/* Process application manifest */
-	app_assert_envelope_authorization(true);
-	app_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_VALIDATE, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the application manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
@@ -472,9 +438,6 @@ void test_suit_process_seq_load(void)
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_LOAD, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 
 	/* Process radio manifest */
-	radio_assert_envelope_authorization(true);
-	radio_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_LOAD, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the radio manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
@@ -484,9 +447,6 @@ void test_suit_process_seq_load(void)
 	radio_assert_component_deletion();
 
 	/* Process application manifest */
-	app_assert_envelope_authorization(true);
-	app_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_LOAD, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the application manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
@@ -529,9 +489,6 @@ void test_suit_process_seq_invoke(void)
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_INVOKE, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 
 	/* Process radio manifest */
-	radio_assert_envelope_authorization(true);
-	radio_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_INVOKE, &exp_radio_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the radio manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(radio_fw_memptr_component_handle, exp_radio_fw_payload.len, &exp_radio_manifest_id, SUIT_SUCCESS);
@@ -543,9 +500,6 @@ void test_suit_process_seq_invoke(void)
 	radio_assert_component_deletion();
 
 	/* Process application manifest */
-	app_assert_envelope_authorization(true);
-	app_assert_component_creation();
-	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_INVOKE, &exp_app_manifest_id, 1, SUIT_SUCCESS);
 	/* SUIT_COMMON sequence from the application manifest */
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
 	__cmock_suit_plat_override_image_size_ExpectComplexArgsAndReturn(app_fw_memptr_component_handle, exp_app_fw_payload.len, &exp_app_manifest_id, SUIT_SUCCESS);
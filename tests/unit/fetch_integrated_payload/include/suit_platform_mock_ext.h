@@ -170,73 +170,73 @@ int __authorize_sequence_num_callback(enum suit_command_sequence seq_name, struc
 }
 int __authorize_component_id_callback(struct zcbor_string *manifest_component_id, struct zcbor_string *component_id, int cmock_num_calls);
 
-#define __cmock_suit_plat_check_fetch_ExpectComplexArgsAndReturn(dst_handle, uri, manifest_component_id, enc_info, cmock_retval) { \
+#define __cmock_suit_plat_check_fetch_ExpectComplexArgsAndReturn(dst_handle, uri, manifest_component_id, enc_info, comp_info, cmock_retval) { \
 	extern complex_arg_q_t __check_fetch_callback_queue; \
 	push_complex_arg(uri, assert_zcbor_string, __check_fetch_callback_queue); \
 	push_complex_arg(manifest_component_id, assert_zcbor_string, __check_fetch_callback_queue); \
 	push_retval_arg(cmock_retval, __check_fetch_callback_queue); \
 	__cmock_suit_plat_check_fetch_AddCallback(__check_fetch_callback); \
-	__cmock_suit_plat_check_fetch_ExpectAndReturn(dst_handle, uri, manifest_component_id, enc_info, cmock_retval); \
+	__cmock_suit_plat_check_fetch_ExpectAndReturn(dst_handle, uri, manifest_component_id, enc_info, comp_info, cmock_retval); \
 	__cmock_suit_plat_check_fetch_IgnoreArg_uri(); \
 	__cmock_suit_plat_check_fetch_IgnoreArg_manifest_component_id(); \
 }
-int __check_fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls);
+int __check_fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls);
 
-#define __cmock_suit_plat_fetch_ExpectComplexArgsAndReturn(dst_handle, uri, manifest_component_id, enc_info, cmock_retval) { \
+#define __cmock_suit_plat_fetch_ExpectComplexArgsAndReturn(dst_handle, uri, manifest_component_id, enc_info, comp_info, cmock_retval) { \
 	extern complex_arg_q_t __fetch_callback_queue; \
 	push_complex_arg(uri, assert_zcbor_string, __fetch_callback_queue); \
 	push_complex_arg(manifest_component_id, assert_zcbor_string, __fetch_callback_queue); \
 	push_retval_arg(cmock_retval, __fetch_callback_queue); \
 	__cmock_suit_plat_fetch_AddCallback(__fetch_callback); \
-	__cmock_suit_plat_fetch_ExpectAndReturn(dst_handle, uri, manifest_component_id, enc_info, cmock_retval); \
+	__cmock_suit_plat_fetch_ExpectAndReturn(dst_handle, uri, manifest_component_id, enc_info, comp_info, cmock_retval); \
 	__cmock_suit_plat_fetch_IgnoreArg_uri(); \
 	__cmock_suit_plat_fetch_IgnoreArg_manifest_component_id(); \
 }
-int __fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls);
+int __fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls);
 
-#define __cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(dst_handle, payload, manifest_component_id, enc_info, cmock_retval) { \
+#define __cmock_suit_plat_check_fetch_integrated_ExpectComplexArgsAndReturn(dst_handle, payload, manifest_component_id, enc_info, comp_info, cmock_retval) { \
 	extern complex_arg_q_t __check_fetch_integrated_callback_queue; \
 	push_complex_arg(payload, assert_zcbor_string, __check_fetch_integrated_callback_queue); \
 	push_complex_arg(manifest_component_id, assert_zcbor_string, __check_fetch_integrated_callback_queue); \
 	push_retval_arg(cmock_retval, __check_fetch_integrated_callback_queue); \
 	__cmock_suit_plat_check_fetch_integrated_AddCallback(__check_fetch_integrated_callback); \
-	__cmock_suit_plat_check_fetch_integrated_ExpectAndReturn(dst_handle, payload, manifest_component_id, enc_info, cmock_retval); \
+	__cmock_suit_plat_check_fetch_integrated_ExpectAndReturn(dst_handle, payload, manifest_component_id, enc_info, comp_info, cmock_retval); \
 	__cmock_suit_plat_check_fetch_integrated_IgnoreArg_payload(); \
 	__cmock_suit_plat_check_fetch_integrated_IgnoreArg_manifest_component_id(); \
 }
-int __check_fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string *payload, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls);
+int __check_fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string *payload, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls);
 
-#define __cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(dst_handle, payload, manifest_component_id, enc_info, cmock_retval) { \
+#define __cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(dst_handle, payload, manifest_component_id, enc_info, comp_info, cmock_retval) { \
 	extern complex_arg_q_t __fetch_integrated_callback_queue; \
 	push_complex_arg(payload, assert_zcbor_string, __fetch_integrated_callback_queue); \
 	push_complex_arg(manifest_component_id, assert_zcbor_string, __fetch_integrated_callback_queue); \
 	push_retval_arg(cmock_retval, __fetch_integrated_callback_queue); \
 	__cmock_suit_plat_fetch_integrated_AddCallback(__fetch_integrated_callback); \
-	__cmock_suit_plat_fetch_integrated_ExpectAndReturn(dst_handle, payload, manifest_component_id, enc_info, cmock_retval); \
+	__cmock_suit_plat_fetch_integrated_ExpectAndReturn(dst_handle, payload, manifest_component_id, enc_info, comp_info, cmock_retval); \
 	__cmock_suit_plat_fetch_integrated_IgnoreArg_payload(); \
 	__cmock_suit_plat_fetch_integrated_IgnoreArg_manifest_component_id(); \
 }
-int __fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string *payload, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls);
+int __fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string *payload, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls);
 
-#define __cmock_suit_plat_check_copy_ExpectComplexArgsAndReturn(dst_handle, src_handle, manifest_component_id, enc_info, cmock_retval) { \
+#define __cmock_suit_plat_check_copy_ExpectComplexArgsAndReturn(dst_handle, src_handle, manifest_component_id, enc_info, comp_info, cmock_retval) { \
 	extern complex_arg_q_t __check_copy_callback_queue; \
 	push_complex_arg(manifest_component_id, assert_zcbor_string, __check_copy_callback_queue); \
 	push_retval_arg(cmock_retval, __check_copy_callback_queue); \
 	__cmock_suit_plat_check_copy_AddCallback(__check_copy_callback); \
-	__cmock_suit_plat_check_copy_ExpectAndReturn(dst_handle, src_handle, manifest_component_id, enc_info, cmock_retval); \
+	__cmock_suit_plat_check_copy_ExpectAndReturn(dst_handle, src_handle, manifest_component_id, enc_info, comp_info, cmock_retval); \
 	__cmock_suit_plat_check_copy_IgnoreArg_manifest_component_id(); \
 }
-int __check_copy_callback(suit_component_t dst_handle, suit_component_t src_handle, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls);
+int __check_copy_callback(suit_component_t dst_handle, suit_component_t src_handle, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls);
 
-#define __cmock_suit_plat_copy_ExpectComplexArgsAndReturn(dst_handle, src_handle, manifest_component_id, enc_info, cmock_retval) { \
+#define __cmock_suit_plat_copy_ExpectComplexArgsAndReturn(dst_handle, src_handle, manifest_component_id, enc_info, comp_info, cmock_retval) { \
 	extern complex_arg_q_t __copy_callback_queue; \
 	push_complex_arg(manifest_component_id, assert_zcbor_string, __copy_callback_queue); \
 	push_retval_arg(cmock_retval, __copy_callback_queue); \
 	__cmock_suit_plat_copy_AddCallback(__copy_callback); \
-	__cmock_suit_plat_copy_ExpectAndReturn(dst_handle, src_handle, manifest_component_id, enc_info, cmock_retval); \
+	__cmock_suit_plat_copy_ExpectAndReturn(dst_handle, src_handle, manifest_component_id, enc_info, comp_info, cmock_retval); \
 	__cmock_suit_plat_copy_IgnoreArg_manifest_component_id(); \
 }
-int __copy_callback(suit_component_t dst_handle, suit_component_t src_handle, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls);
+int __copy_callback(suit_component_t dst_handle, suit_component_t src_handle, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls);
 
 #define __cmock_suit_plat_sequence_completed_ExpectComplexArgsAndReturn(seq_name, manifest_component_id, envelope_str, envelope_len, cmock_retval) { \
 	extern complex_arg_q_t __sequence_completed_callback_queue; \
@@ -248,29 +248,29 @@ int __copy_callback(suit_component_t dst_handle, suit_component_t src_handle, st
 }
 int __sequence_completed_callback(enum suit_command_sequence seq_name, struct zcbor_string *manifest_component_id, const uint8_t *envelope_str, size_t envelope_len, int cmock_num_calls);
 
-#define __cmock_suit_plat_check_write_ExpectComplexArgsAndReturn(dst_handle, content, manifest_component_id, enc_info, cmock_retval) { \
+#define __cmock_suit_plat_check_write_ExpectComplexArgsAndReturn(dst_handle, content, manifest_component_id, enc_info, comp_info, cmock_retval) { \
 	extern complex_arg_q_t __check_write_callback_queue; \
 	push_complex_arg(content, assert_zcbor_string, __check_write_callback_queue); \
 	push_complex_arg(manifest_component_id, assert_zcbor_string, __check_write_callback_queue); \
 	push_retval_arg(cmock_retval, __check_write_callback_queue); \
 	__cmock_suit_plat_check_write_AddCallback(__check_write_callback); \
-	__cmock_suit_plat_check_write_ExpectAndReturn(dst_handle, content, manifest_component_id, enc_info, cmock_retval); \
+	__cmock_suit_plat_check_write_ExpectAndReturn(dst_handle, content, manifest_component_id, enc_info, comp_info, cmock_retval); \
 	__cmock_suit_plat_check_write_IgnoreArg_content(); \
 	__cmock_suit_plat_check_write_IgnoreArg_manifest_component_id(); \
 }
-int __check_write_callback(suit_component_t dst_handle, struct zcbor_string *content, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls);
+int __check_write_callback(suit_component_t dst_handle, struct zcbor_string *content, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls);
 
-#define __cmock_suit_plat_write_ExpectComplexArgsAndReturn(dst_handle, content, manifest_component_id, enc_info, cmock_retval) { \
+#define __cmock_suit_plat_write_ExpectComplexArgsAndReturn(dst_handle, content, manifest_component_id, enc_info, comp_info, cmock_retval) { \
 	extern complex_arg_q_t __write_callback_queue; \
 	push_complex_arg(content, assert_zcbor_string, __write_callback_queue); \
 	push_complex_arg(manifest_component_id, assert_zcbor_string, __write_callback_queue); \
 	push_retval_arg(cmock_retval, __write_callback_queue); \
 	__cmock_suit_plat_write_AddCallback(__write_callback); \
-	__cmock_suit_plat_write_ExpectAndReturn(dst_handle, content, manifest_component_id, enc_info, cmock_retval); \
+	__cmock_suit_plat_write_ExpectAndReturn(dst_handle, content, manifest_component_id, enc_info, comp_info, cmock_retval); \
 	__cmock_suit_plat_write_IgnoreArg_content(); \
 	__cmock_suit_plat_write_IgnoreArg_manifest_component_id(); \
 }
-int __write_callback(suit_component_t dst_handle, struct zcbor_string *content, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls);
+int __write_callback(suit_component_t dst_handle, struct zcbor_string *content, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls);
 
 #define __cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(parent_component_id, child_component_id, seq_name, cmock_retval) { \
 	extern complex_arg_q_t __dependency_seq_authorize_callback_queue; \
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit_log.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+static struct suit_log_entry entries[SUIT_LOG_BUF_SIZE + 1];
+
+void setUp(void)
+{
+	suit_log_reset();
+	memset(entries, 0, sizeof(entries));
+}
+
+void test_read_empty(void)
+{
+	TEST_ASSERT_EQUAL(0, suit_log_read(entries, SUIT_LOG_BUF_SIZE));
+}
+
+void test_read_invalid_args(void)
+{
+	SUIT_LOG_DBG(COMPONENT_SELECTED, 1);
+
+	TEST_ASSERT_EQUAL(0, suit_log_read(NULL, SUIT_LOG_BUF_SIZE));
+	/* The message is not consumed. */
+	TEST_ASSERT_EQUAL(1, suit_log_read(entries, SUIT_LOG_BUF_SIZE));
+}
+
+void test_record_args(void)
+{
+	SUIT_LOG_DBG(COMPONENT_SELECTED, 3);
+	SUIT_LOG_DBG(DIRECTIVE_EXECUTED, 21, -1);
+	SUIT_LOG_DBG(CONDITION_EXECUTE, 3, 1, (unsigned int)0x80000001);
+
+	TEST_ASSERT_EQUAL(3, suit_log_read(entries, SUIT_LOG_BUF_SIZE));
+
+	TEST_ASSERT_EQUAL(SUIT_LOG_MSG_COMPONENT_SELECTED, entries[0].id);
+	TEST_ASSERT_EQUAL(0, entries[0].seq);
+	TEST_ASSERT_EQUAL(3, entries[0].args[0]);
+	/* Unused arguments are cleared. */
+	TEST_ASSERT_EQUAL(0, entries[0].args[1]);
+	TEST_ASSERT_EQUAL(0, entries[0].args[2]);
+
+	TEST_ASSERT_EQUAL(SUIT_LOG_MSG_DIRECTIVE_EXECUTED, entries[1].id);
+	TEST_ASSERT_EQUAL(1, entries[1].seq);
+	TEST_ASSERT_EQUAL(21, entries[1].args[0]);
+	TEST_ASSERT_EQUAL(-1, entries[1].args[1]);
+
+	TEST_ASSERT_EQUAL(SUIT_LOG_MSG_CONDITION_EXECUTE, entries[2].id);
+	TEST_ASSERT_EQUAL(2, entries[2].seq);
+	TEST_ASSERT_EQUAL(0x80000001, (uint32_t)entries[2].args[2]);
+}
+
+void test_record_too_many_args(void)
+{
+	const int32_t args[] = {1, 2, 3, 4};
+
+	suit_log_record(SUIT_LOG_MSG_CONDITION_FOUND, args, sizeof(args) / sizeof(args[0]));
+
+	TEST_ASSERT_EQUAL(1, suit_log_read(entries, SUIT_LOG_BUF_SIZE));
+	TEST_ASSERT_EQUAL(3, entries[0].args[SUIT_LOG_MAX_ARGS - 1]);
+}
+
+void test_read_partial(void)
+{
+	SUIT_LOG_DBG(COMPONENT_SELECTED, 0);
+	SUIT_LOG_DBG(COMPONENT_SELECTED, 1);
+	SUIT_LOG_DBG(COMPONENT_SELECTED, 2);
+
+	TEST_ASSERT_EQUAL(2, suit_log_read(entries, 2));
+	TEST_ASSERT_EQUAL(0, entries[0].args[0]);
+	TEST_ASSERT_EQUAL(1, entries[1].args[0]);
+
+	TEST_ASSERT_EQUAL(1, suit_log_read(entries, 2));
+	TEST_ASSERT_EQUAL(2, entries[0].args[0]);
+
+	TEST_ASSERT_EQUAL(0, suit_log_read(entries, 2));
+}
+
+void test_overwrite_oldest(void)
+{
+	for (size_t i = 0; i < SUIT_LOG_BUF_SIZE + 2; i++) {
+		SUIT_LOG_DBG(COMPONENT_SELECTED, i);
+	}
+
+	TEST_ASSERT_EQUAL(SUIT_LOG_BUF_SIZE, suit_log_read(entries, SUIT_LOG_BUF_SIZE + 1));
+
+	/* The gap in the running number shows that two messages were lost. */
+	TEST_ASSERT_EQUAL(2, entries[0].seq);
+	TEST_ASSERT_EQUAL(2, entries[0].args[0]);
+	TEST_ASSERT_EQUAL(SUIT_LOG_BUF_SIZE + 1, entries[SUIT_LOG_BUF_SIZE - 1].seq);
+	TEST_ASSERT_EQUAL(SUIT_LOG_BUF_SIZE + 1, entries[SUIT_LOG_BUF_SIZE - 1].args[0]);
+}
+
+void test_reset(void)
+{
+	SUIT_LOG_DBG(COMPONENT_SELECTED, 0);
+	suit_log_reset();
+
+	TEST_ASSERT_EQUAL(0, suit_log_read(entries, SUIT_LOG_BUF_SIZE));
+
+	SUIT_LOG_DBG(COMPONENT_SELECTED, 0);
+	TEST_ASSERT_EQUAL(1, suit_log_read(entries, SUIT_LOG_BUF_SIZE));
+	TEST_ASSERT_EQUAL(0, entries[0].seq);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
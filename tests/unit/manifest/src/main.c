@@ -762,10 +762,45 @@ void test_get_component_params(void)
 	TEST_ASSERT_EQUAL_PTR_MESSAGE(params, &components[0], "Invalid reference to component parameters returned");
 }
 
+void test_params_copy_values_rollback(void)
+{
+	uint8_t caller_uri[] = "http://example.com/app.bin";
+	uint8_t dependency_uri[] = "http://example.com/dep.bin";
+	struct suit_manifest_params snapshot;
+
+	/* The caller sets the URI of the shared component. */
+	components[0].component_handle = 123;
+	components[0].ref_count = 1;
+	components[0].uri.value = caller_uri;
+	components[0].uri.len = sizeof(caller_uri) - 1;
+	suit_param_set_flag(&components[0], SUIT_PARAM_URI, true);
+
+	memset(&snapshot, 0, sizeof(snapshot));
+	suit_manifest_params_copy_values(&snapshot, &components[0]);
+	TEST_ASSERT_EQUAL_MESSAGE(0, snapshot.ref_count, "Reference counter copied with the parameter values");
+
+	/* The dependency manifest references the same component and modifies its parameters. */
+	components[0].ref_count++;
+	components[0].integrity_checked = true;
+	components[0].uri.value = dependency_uri;
+	components[0].image_size = 0x1000;
+	suit_param_set_flag(&components[0], SUIT_PARAM_IMAGE_SIZE, true);
+
+	suit_manifest_params_copy_values(&components[0], &snapshot);
+
+	TEST_ASSERT_EQUAL_PTR_MESSAGE(caller_uri, components[0].uri.value, "The caller URI was not restored");
+	TEST_ASSERT_TRUE_MESSAGE(suit_param_is_set(&components[0], SUIT_PARAM_URI), "The caller URI was not restored");
+	TEST_ASSERT_FALSE_MESSAGE(suit_param_is_set(&components[0], SUIT_PARAM_IMAGE_SIZE), "The dependency image size was not rolled back");
+	TEST_ASSERT_EQUAL_MESSAGE(0, components[0].image_size, "The dependency image size was not rolled back");
+	TEST_ASSERT_EQUAL_MESSAGE(123, components[0].component_handle, "The component handle was modified");
+	TEST_ASSERT_EQUAL_MESSAGE(2, components[0].ref_count, "The reference counter was modified");
+	TEST_ASSERT_TRUE_MESSAGE(components[0].integrity_checked, "The integrity flag was modified");
+}
+
 void test_get_command_seq_invalid_input(void)
 {
 	int ret;
-	struct zcbor_string *seq;
+	struct zcbor_string seq;
 
 	enum suit_command_sequence seq_name;
 
@@ -779,7 +814,7 @@ void test_get_command_seq_empty_manifest(void)
 {
 	int ret;
 	struct suit_manifest_state manifest;
-	struct zcbor_string *seq;
+	struct zcbor_string seq;
 
 	/* Initialize the manifest structure. */
 	memset(&manifest, 0, sizeof(manifest));
@@ -797,16 +832,16 @@ void test_get_command_seq_unavailable(void)
 {
 	int ret;
 	struct suit_manifest_state manifest;
-	struct zcbor_string *seq;
+	struct zcbor_string seq;
 
 	/* Initialize the manifest structure. */
 	memset(&manifest, 0, sizeof(manifest));
-	manifest.shared_sequence_status = UNAVAILABLE;
-	manifest.payload_fetch_seq_status = UNAVAILABLE;
-	manifest.install_seq_status = UNAVAILABLE;
-	manifest.validate_seq_status = UNAVAILABLE;
-	manifest.load_seq_status = UNAVAILABLE;
-	manifest.invoke_seq_status = UNAVAILABLE;
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_SHARED, UNAVAILABLE);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_PAYLOAD_FETCH, UNAVAILABLE);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_INSTALL, UNAVAILABLE);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_VALIDATE, UNAVAILABLE);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_LOAD, UNAVAILABLE);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_INVOKE, UNAVAILABLE);
 
 	enum suit_command_sequence seq_name;
 
@@ -820,18 +855,18 @@ void test_get_command_seq_severed(void)
 {
 	int ret;
 	struct suit_manifest_state manifest;
-	struct zcbor_string *seq;
+	struct zcbor_string seq;
 
 	/* Initialize the manifest structure. */
 	memset(&manifest, 0, sizeof(manifest));
-	manifest.shared_sequence_status = SEVERED;
-	manifest.payload_fetch_seq_status = SEVERED;
-	manifest.install_seq_status = SEVERED;
-	manifest.validate_seq_status = SEVERED;
-	manifest.load_seq_status = SEVERED;
-	manifest.invoke_seq_status = SEVERED;
-	manifest.dependency_resolution_seq_status = SEVERED;
-	manifest.candidate_verification_seq_status = SEVERED;
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_SHARED, SEVERED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_PAYLOAD_FETCH, SEVERED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_INSTALL, SEVERED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_VALIDATE, SEVERED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_LOAD, SEVERED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_INVOKE, SEVERED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_DEP_RESOLUTION, SEVERED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_CAND_VERIFICATION, SEVERED);
 
 	enum suit_command_sequence seq_name;
 
@@ -858,41 +893,47 @@ void test_get_command_seq_authenticated(void)
 {
 	int ret;
 	struct suit_manifest_state manifest;
-	struct zcbor_string *seq;
+	struct zcbor_string seq;
+	/* Each sequence is stored as a single byte of the envelope, at the offset equal to its name. */
+	uint8_t envelope[SUIT_SEQ_MAX];
 
 	/* Initialize the manifest structure. */
 	memset(&manifest, 0, sizeof(manifest));
-	manifest.shared_sequence_status = AUTHENTICATED;
-	manifest.payload_fetch_seq_status = AUTHENTICATED;
-	manifest.install_seq_status = AUTHENTICATED;
-	manifest.validate_seq_status = AUTHENTICATED;
-	manifest.load_seq_status = AUTHENTICATED;
-	manifest.invoke_seq_status = AUTHENTICATED;
+	manifest.envelope_str.value = envelope;
+	manifest.envelope_str.len = sizeof(envelope);
 
 	enum suit_command_sequence seq_name;
 
+	for (seq_name = SUIT_SEQ_SHARED; seq_name < SUIT_SEQ_MAX; seq_name++) {
+		struct zcbor_string sequence = {
+			.value = &envelope[seq_name],
+			.len = 1,
+		};
+
+		ret = suit_manifest_set_seq(&manifest, seq_name, &sequence);
+		TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to store the sequence location");
+	}
+
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_SHARED, AUTHENTICATED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_PAYLOAD_FETCH, AUTHENTICATED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_INSTALL, AUTHENTICATED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_VALIDATE, AUTHENTICATED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_LOAD, AUTHENTICATED);
+	(void)suit_manifest_set_seq_status(&manifest, SUIT_SEQ_INVOKE, AUTHENTICATED);
+
 	for (seq_name = SUIT_SEQ_INVALID; seq_name <= SUIT_SEQ_MAX; seq_name++) {
-		struct zcbor_string *exp_seq = NULL;
-		seq = NULL;
+		const uint8_t *exp_seq = NULL;
+		seq.value = NULL;
+		seq.len = 0;
 
 		switch (seq_name) {
 		case SUIT_SEQ_SHARED:
-			exp_seq = &manifest.shared_sequence;
-			break;
 		case SUIT_SEQ_PAYLOAD_FETCH:
-			exp_seq = &manifest.payload_fetch_seq;
-			break;
 		case SUIT_SEQ_INSTALL:
-			exp_seq = &manifest.install_seq;
-			break;
 		case SUIT_SEQ_VALIDATE:
-			exp_seq = &manifest.validate_seq;
-			break;
 		case SUIT_SEQ_LOAD:
-			exp_seq = &manifest.load_seq;
-			break;
 		case SUIT_SEQ_INVOKE:
-			exp_seq = &manifest.invoke_seq;
+			exp_seq = &envelope[seq_name];
 			break;
 		default:
 			break;
@@ -902,10 +943,11 @@ void test_get_command_seq_authenticated(void)
 
 		if (exp_seq != NULL) {
 			TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Getting an available sequence failed");
-			TEST_ASSERT_EQUAL_PTR_MESSAGE(exp_seq, seq, "Invalid sequence returned");
+			TEST_ASSERT_EQUAL_PTR_MESSAGE(exp_seq, seq.value, "Invalid sequence returned");
+			TEST_ASSERT_EQUAL_MESSAGE(1, seq.len, "Invalid sequence length returned");
 		} else {
 			TEST_ASSERT_NOT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Getting unavailable sequence succeeded");
-			TEST_ASSERT_NULL_MESSAGE(seq, "Invalid sequence returned");
+			TEST_ASSERT_NULL_MESSAGE(seq.value, "Invalid sequence returned");
 		}
 	}
 }
@@ -940,28 +982,31 @@ void test_get_integrated_payload_invalid_input(void)
 void test_get_integrated_payload_nonempty_uri(void)
 {
 	struct suit_manifest_state manifest;
+	/* The integrated payloads are referenced by their location inside the envelope. */
+	const uint8_t envelope[] = "http://example.com" "http://sample.com" "#app.bin"
+				   "CAFECAFE\0" "ABCD\0" "This is a sample FW file";
 	struct zcbor_string uri_0 = {
-		.value = "http://example.com",
+		.value = &envelope[0],
 		.len = strlen("http://example.com"),
 	};
 	struct zcbor_string uri_1 = {
-		.value = "http://sample.com",
+		.value = &envelope[18],
 		.len = strlen("http://sample.com"),
 	};
 	struct zcbor_string uri_2 = {
-		.value = "#app.bin",
+		.value = &envelope[35],
 		.len = strlen("#app.bin"),
 	};
 	struct zcbor_string payload_0 = {
-		.value = "CAFECAFE",
+		.value = &envelope[43],
 		.len = sizeof("CAFECAFE"),
 	};
 	struct zcbor_string payload_1 = {
-		.value = "ABCD",
+		.value = &envelope[52],
 		.len = sizeof("ABCD"),
 	};
 	struct zcbor_string payload_2 = {
-		.value = "This is a sample FW file",
+		.value = &envelope[57],
 		.len = sizeof("This is a sample FW file"),
 	};
 	struct zcbor_string payload;
@@ -969,12 +1014,14 @@ void test_get_integrated_payload_nonempty_uri(void)
 
 	/* Initialize the manifest structure. */
 	memset(&manifest, 0, sizeof(manifest));
-	manifest.integrated_payloads[0].key = uri_0;
-	manifest.integrated_payloads[1].key = uri_1;
-	manifest.integrated_payloads[2].key = uri_2;
-	manifest.integrated_payloads[0].payload = payload_0;
-	manifest.integrated_payloads[1].payload = payload_1;
-	manifest.integrated_payloads[2].payload = payload_2;
+	manifest.envelope_str.value = envelope;
+	manifest.envelope_str.len = sizeof(envelope);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_manifest_str_to_ref(&manifest, &uri_0, &manifest.integrated_payloads[0].key));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_manifest_str_to_ref(&manifest, &uri_1, &manifest.integrated_payloads[1].key));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_manifest_str_to_ref(&manifest, &uri_2, &manifest.integrated_payloads[2].key));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_manifest_str_to_ref(&manifest, &payload_0, &manifest.integrated_payloads[0].payload));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_manifest_str_to_ref(&manifest, &payload_1, &manifest.integrated_payloads[1].payload));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_manifest_str_to_ref(&manifest, &payload_2, &manifest.integrated_payloads[2].payload));
 	manifest.integrated_payloads_count = 2;
 
 	ret = suit_manifest_get_integrated_payload(&manifest, &uri_0, &payload);
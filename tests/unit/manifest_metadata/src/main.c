@@ -74,6 +74,15 @@ static const struct zcbor_string exp_manifest_component_id = {
 
 static const uint32_t exp_seq_num = 1234;
 
+/* The current version is stored relative to the envelope, so use the version as the envelope. */
+static void set_current_version(struct suit_manifest_state *manifest, const uint8_t *version_cbor,
+				size_t version_len)
+{
+	manifest->envelope_str.value = version_cbor;
+	manifest->envelope_str.len = version_len;
+	manifest->current_version.offset = 0;
+	manifest->current_version.len = version_len;
+}
 
 static int mock_manifest_invalid_digest_bstr(struct suit_decoder_state* decoder_state, int cmock_num_calls)
 {
@@ -140,8 +149,7 @@ static int mock_valid_manifest(struct suit_decoder_state* decoder_state, int cmo
 	decoder_state->decoded_manifest->sequence_number = exp_seq_num;
 	decoder_state->decoded_manifest->manifest_component_id = exp_manifest_component_id;
 
-	decoder_state->decoded_manifest->current_version.value = valid_version_cbor;
-	decoder_state->decoded_manifest->current_version.len = sizeof(valid_version_cbor);
+	set_current_version(decoder_state->decoded_manifest, valid_version_cbor, sizeof(valid_version_cbor));
 
 	return SUIT_SUCCESS;
 }
@@ -155,8 +163,7 @@ static int mock_manifest_no_version(struct suit_decoder_state* decoder_state, in
 	decoder_state->decoded_manifest->sequence_number = exp_seq_num;
 	decoder_state->decoded_manifest->manifest_component_id = exp_manifest_component_id;
 
-	decoder_state->decoded_manifest->current_version.value = NULL;
-	decoder_state->decoded_manifest->current_version.len = 0;
+	set_current_version(decoder_state->decoded_manifest, NULL, 0);
 
 	return SUIT_SUCCESS;
 }
@@ -174,8 +181,7 @@ static int mock_manifest_empty_version(struct suit_decoder_state* decoder_state,
 	decoder_state->decoded_manifest->sequence_number = exp_seq_num;
 	decoder_state->decoded_manifest->manifest_component_id = exp_manifest_component_id;
 
-	decoder_state->decoded_manifest->current_version.value = empty_version_cbor;
-	decoder_state->decoded_manifest->current_version.len = sizeof(empty_version_cbor);
+	set_current_version(decoder_state->decoded_manifest, empty_version_cbor, sizeof(empty_version_cbor));
 
 	return SUIT_SUCCESS;
 }
@@ -194,8 +200,7 @@ static int mock_manifest_too_long_version(struct suit_decoder_state* decoder_sta
 	decoder_state->decoded_manifest->sequence_number = exp_seq_num;
 	decoder_state->decoded_manifest->manifest_component_id = exp_manifest_component_id;
 
-	decoder_state->decoded_manifest->current_version.value = invalid_version_cbor;
-	decoder_state->decoded_manifest->current_version.len = sizeof(invalid_version_cbor);
+	set_current_version(decoder_state->decoded_manifest, invalid_version_cbor, sizeof(invalid_version_cbor));
 
 	return SUIT_SUCCESS;
 }
@@ -216,8 +221,7 @@ static int mock_manifest_invalid_version(struct suit_decoder_state* decoder_stat
 	decoder_state->decoded_manifest->sequence_number = exp_seq_num;
 	decoder_state->decoded_manifest->manifest_component_id = exp_manifest_component_id;
 
-	decoder_state->decoded_manifest->current_version.value = invalid_version_cbor;
-	decoder_state->decoded_manifest->current_version.len = sizeof(invalid_version_cbor);
+	set_current_version(decoder_state->decoded_manifest, invalid_version_cbor, sizeof(invalid_version_cbor));
 
 	return SUIT_SUCCESS;
 }
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit.h>
+#include <suit_plan.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+#define ASSIGNED_COMPONENT_HANDLE 0x1E054000
+
+/* The size of the integrated payload, set by the sample manifest. */
+#define IMAGE_SIZE 256
+
+extern uint8_t manifest_buf[];
+extern const size_t manifest_len;
+
+static struct suit_plan plan;
+static struct suit_plan_op ops[8];
+
+/* The results of the plans, requested while the envelope is loaded. */
+static int nested_results[SUIT_MAX_MANIFEST_DEPTH];
+static size_t nested_count;
+
+
+static int create_component_handle_stub(struct zcbor_string *component_id, bool dependency,
+					suit_component_t *handle, int cmock_num_calls)
+{
+	*handle = ASSIGNED_COMPONENT_HANDLE;
+
+	return SUIT_SUCCESS;
+}
+
+/* Request another plan while the envelope is loaded, until the manifest stack is full. */
+static int authorize_sequence_num_stub(enum suit_command_sequence seq_name,
+				       struct zcbor_string *manifest_component_id,
+				       unsigned int seq_num, int cmock_num_calls)
+{
+	size_t depth = nested_count++;
+
+	TEST_ASSERT_LESS_THAN(SUIT_MAX_MANIFEST_DEPTH, depth);
+	nested_results[depth] = suit_processor_get_operation_plan(manifest_buf, manifest_len,
+								   SUIT_SEQ_INSTALL, &plan);
+
+	return SUIT_SUCCESS;
+}
+
+/* Accept the envelope and all operations, checked by the dry run of the sample manifest. */
+static void expect_dry_run(void)
+{
+	__cmock_suit_plat_check_digest_IgnoreAndReturn(SUIT_SUCCESS);
+	__cmock_suit_plat_authenticate_manifest_IgnoreAndReturn(SUIT_SUCCESS);
+	__cmock_suit_plat_authorize_component_id_IgnoreAndReturn(SUIT_SUCCESS);
+	__cmock_suit_plat_create_component_handle_Stub(create_component_handle_stub);
+	__cmock_suit_plat_release_component_handle_IgnoreAndReturn(SUIT_SUCCESS);
+	__cmock_suit_plat_override_image_size_IgnoreAndReturn(SUIT_SUCCESS);
+	__cmock_suit_plat_check_fetch_integrated_IgnoreAndReturn(SUIT_SUCCESS);
+	__cmock_suit_plat_check_invoke_IgnoreAndReturn(SUIT_SUCCESS);
+}
+
+static void assert_op(struct suit_plan_op *op, enum suit_plan_op_type type,
+		      enum suit_command_sequence seq, size_t size)
+{
+	TEST_ASSERT_EQUAL(type, op->type);
+	TEST_ASSERT_EQUAL(seq, op->seq);
+	TEST_ASSERT_EQUAL(ASSIGNED_COMPONENT_HANDLE, op->dst_handle);
+	TEST_ASSERT_EQUAL(size, op->size);
+}
+
+void setUp(void)
+{
+	int ret = suit_processor_init();
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to initialize SUIT processor");
+
+	ret = suit_plan_init(&plan, ops, ZCBOR_ARRAY_SIZE(ops), NULL, 0, NULL, NULL);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to initialize the plan");
+
+	memset(nested_results, 0, sizeof(nested_results));
+	nested_count = 0;
+}
+
+void test_get_operation_plan_invalid_args(void)
+{
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_COMMAND_SEQ,
+			  suit_processor_get_operation_plan(manifest_buf, manifest_len, SUIT_SEQ_INSTALL, NULL));
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_COMMAND_SEQ,
+			  suit_processor_get_operation_plan(manifest_buf, manifest_len, SUIT_SEQ_SHARED, &plan));
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_COMMAND_SEQ,
+			  suit_processor_get_operation_plan(manifest_buf, manifest_len, SUIT_SEQ_MAX, &plan));
+	TEST_ASSERT_EQUAL(0, plan.ops_count);
+}
+
+void test_get_operation_plan_install(void)
+{
+	expect_dry_run();
+	__cmock_suit_plat_authorize_sequence_num_IgnoreAndReturn(SUIT_SUCCESS);
+
+	int ret = suit_processor_get_operation_plan(manifest_buf, manifest_len, SUIT_SEQ_INSTALL, &plan);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, ret);
+
+	TEST_ASSERT_EQUAL(2, plan.ops_count);
+	assert_op(&ops[0], SUIT_PLAN_OP_FETCH_INTEGRATED, SUIT_SEQ_INSTALL, IMAGE_SIZE);
+	assert_op(&ops[1], SUIT_PLAN_OP_INVOKE, SUIT_SEQ_INVOKE, 0);
+
+	/* The manifest is released, so the plan may be requested again. */
+	ret = suit_processor_get_operation_plan(manifest_buf, manifest_len, SUIT_SEQ_INVOKE, &plan);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, ret);
+
+	TEST_ASSERT_EQUAL(3, plan.ops_count);
+	assert_op(&ops[2], SUIT_PLAN_OP_INVOKE, SUIT_SEQ_INVOKE, 0);
+}
+
+void test_get_operation_plan_stack_full(void)
+{
+	expect_dry_run();
+	__cmock_suit_plat_authorize_sequence_num_Stub(authorize_sequence_num_stub);
+
+	int ret = suit_processor_get_operation_plan(manifest_buf, manifest_len, SUIT_SEQ_INSTALL, &plan);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, ret);
+
+	/* Each plan loads the envelope on top of the manifest stack. */
+	TEST_ASSERT_EQUAL(SUIT_MAX_MANIFEST_DEPTH, nested_count);
+	for (size_t i = 0; i < SUIT_MAX_MANIFEST_DEPTH - 1; i++) {
+		TEST_ASSERT_EQUAL(SUIT_SUCCESS, nested_results[i]);
+	}
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, nested_results[SUIT_MAX_MANIFEST_DEPTH - 1]);
+
+	/* The operations are listed once per loaded envelope. */
+	TEST_ASSERT_EQUAL(2 * SUIT_MAX_MANIFEST_DEPTH, plan.ops_count);
+
+	/* All loaded manifests were released from the stack. */
+	__cmock_suit_plat_authorize_sequence_num_IgnoreAndReturn(SUIT_SUCCESS);
+	ret = suit_processor_get_operation_plan(manifest_buf, manifest_len, SUIT_SEQ_INVOKE, &plan);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, ret);
+	TEST_ASSERT_EQUAL(2 * SUIT_MAX_MANIFEST_DEPTH + 1, plan.ops_count);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <suit_plan.h>
+
+#define APP_COMPONENT_HANDLE   0x1E054000
+#define RADIO_COMPONENT_HANDLE 0x1E054010
+#define CACHE_COMPONENT_HANDLE 0x1E055000
+#define UNKNOWN_HANDLE	       0x1E056000
+
+#define MRAM_AREA  1
+#define CACHE_AREA 2
+
+static uint8_t uri[] = "#app";
+
+static struct suit_plan plan;
+static struct suit_plan_op ops[4];
+static struct suit_plan_area areas[2];
+
+static int get_area(void *ctx, suit_component_t handle, uint32_t *area)
+{
+	TEST_ASSERT_EQUAL_PTR(&plan, ctx);
+
+	switch (handle) {
+	case APP_COMPONENT_HANDLE:
+	case RADIO_COMPONENT_HANDLE:
+		*area = MRAM_AREA;
+		return SUIT_SUCCESS;
+	case CACHE_COMPONENT_HANDLE:
+		*area = CACHE_AREA;
+		return SUIT_SUCCESS;
+	default:
+		return SUIT_ERR_UNSUPPORTED_COMPONENT_ID;
+	}
+}
+
+static struct suit_plan_op op(enum suit_plan_op_type type, suit_component_t dst_handle,
+			      suit_component_t src_handle, size_t size)
+{
+	struct suit_plan_op op = {
+		.type = type,
+		.seq = SUIT_SEQ_INSTALL,
+		.dst_handle = dst_handle,
+		.src_handle = src_handle,
+		.size = size,
+	};
+
+	return op;
+}
+
+void setUp(void)
+{
+	memset(ops, 0, sizeof(ops));
+	memset(areas, 0, sizeof(areas));
+
+	int ret = suit_plan_init(&plan, ops, ZCBOR_ARRAY_SIZE(ops), areas,
+				 ZCBOR_ARRAY_SIZE(areas), get_area, &plan);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to initialize plan");
+}
+
+void test_init_invalid_args(void)
+{
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_plan_init(NULL, ops, 1, areas, 1, get_area, NULL));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_plan_init(&plan, NULL, 1, areas, 1, get_area, NULL));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_plan_init(&plan, ops, 1, NULL, 1, get_area, NULL));
+}
+
+void test_record_invalid_args(void)
+{
+	struct suit_plan_op fetch = op(SUIT_PLAN_OP_FETCH, CACHE_COMPONENT_HANDLE, 0, 256);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_plan_record(NULL, &fetch));
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_plan_record(&plan, NULL));
+}
+
+void test_record_operations(void)
+{
+	struct suit_plan_op fetch = op(SUIT_PLAN_OP_FETCH, CACHE_COMPONENT_HANDLE, 0, 256);
+	struct suit_plan_op copy = op(SUIT_PLAN_OP_COPY, APP_COMPONENT_HANDLE, CACHE_COMPONENT_HANDLE, 256);
+	struct suit_plan_op write = op(SUIT_PLAN_OP_WRITE, RADIO_COMPONENT_HANDLE, 0, 16);
+
+	fetch.seq = SUIT_SEQ_PAYLOAD_FETCH;
+	fetch.uri.value = uri;
+	fetch.uri.len = sizeof(uri) - 1;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &fetch));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &copy));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &write));
+
+	TEST_ASSERT_EQUAL(3, plan.ops_count);
+	TEST_ASSERT_EQUAL(SUIT_PLAN_OP_FETCH, ops[0].type);
+	TEST_ASSERT_EQUAL(SUIT_SEQ_PAYLOAD_FETCH, ops[0].seq);
+	TEST_ASSERT_EQUAL_PTR(uri, ops[0].uri.value);
+	TEST_ASSERT_EQUAL(SUIT_PLAN_OP_COPY, ops[1].type);
+	TEST_ASSERT_EQUAL(CACHE_COMPONENT_HANDLE, ops[1].src_handle);
+	TEST_ASSERT_EQUAL(SUIT_PLAN_OP_WRITE, ops[2].type);
+
+	/* The areas are listed in the order of the first use. */
+	TEST_ASSERT_EQUAL(2, plan.areas_count);
+	TEST_ASSERT_EQUAL(CACHE_AREA, areas[0].id);
+	TEST_ASSERT_EQUAL(256, areas[0].bytes);
+	TEST_ASSERT_EQUAL(MRAM_AREA, areas[1].id);
+	TEST_ASSERT_EQUAL(256 + 16, areas[1].bytes);
+}
+
+void test_record_swap(void)
+{
+	struct suit_plan_op swap = op(SUIT_PLAN_OP_SWAP, APP_COMPONENT_HANDLE, CACHE_COMPONENT_HANDLE, 128);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &swap));
+
+	/* Both components are rewritten. */
+	TEST_ASSERT_EQUAL(2, plan.areas_count);
+	TEST_ASSERT_EQUAL(MRAM_AREA, areas[0].id);
+	TEST_ASSERT_EQUAL(128, areas[0].bytes);
+	TEST_ASSERT_EQUAL(CACHE_AREA, areas[1].id);
+	TEST_ASSERT_EQUAL(128, areas[1].bytes);
+}
+
+void test_record_without_size(void)
+{
+	struct suit_plan_op invoke = op(SUIT_PLAN_OP_INVOKE, APP_COMPONENT_HANDLE, 0, 0);
+	struct suit_plan_op fetch = op(SUIT_PLAN_OP_FETCH, UNKNOWN_HANDLE, 0, 0);
+
+	/* The area is not looked up if nothing is written. */
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &invoke));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &fetch));
+
+	TEST_ASSERT_EQUAL(2, plan.ops_count);
+	TEST_ASSERT_EQUAL(0, plan.areas_count);
+}
+
+void test_record_without_areas(void)
+{
+	struct suit_plan_op fetch = op(SUIT_PLAN_OP_FETCH, UNKNOWN_HANDLE, 0, 256);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_init(&plan, ops, ZCBOR_ARRAY_SIZE(ops), NULL, 0, NULL, NULL));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &fetch));
+
+	TEST_ASSERT_EQUAL(1, plan.ops_count);
+	TEST_ASSERT_EQUAL(0, plan.areas_count);
+}
+
+void test_record_unknown_area(void)
+{
+	struct suit_plan_op fetch = op(SUIT_PLAN_OP_FETCH, UNKNOWN_HANDLE, 0, 256);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_COMPONENT_ID, suit_plan_record(&plan, &fetch));
+	TEST_ASSERT_EQUAL(0, plan.ops_count);
+}
+
+void test_record_ops_overflow(void)
+{
+	struct suit_plan_op write = op(SUIT_PLAN_OP_WRITE, APP_COMPONENT_HANDLE, 0, 16);
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(ops); i++) {
+		TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &write));
+	}
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_plan_record(&plan, &write));
+	TEST_ASSERT_EQUAL(ZCBOR_ARRAY_SIZE(ops), plan.ops_count);
+	TEST_ASSERT_EQUAL(16 * ZCBOR_ARRAY_SIZE(ops), areas[0].bytes);
+}
+
+void test_record_areas_overflow(void)
+{
+	struct suit_plan_op copy = op(SUIT_PLAN_OP_COPY, APP_COMPONENT_HANDLE, CACHE_COMPONENT_HANDLE, 256);
+	struct suit_plan_op fetch = op(SUIT_PLAN_OP_FETCH, CACHE_COMPONENT_HANDLE, 0, 256);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_init(&plan, ops, ZCBOR_ARRAY_SIZE(ops), areas, 1, get_area, &plan));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_plan_record(&plan, &copy));
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_plan_record(&plan, &fetch));
+
+	TEST_ASSERT_EQUAL(1, plan.ops_count);
+	TEST_ASSERT_EQUAL(1, plan.areas_count);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BUDGETS_H__
+#define BUDGETS_H__
+
+#include <platform_budget.h>
+
+/** @file budgets.h
+ * @brief Checked-in platform call budgets.
+ *
+ * The values are compared for equality, so any change in the number of platform calls
+ * (an increase as well as a decrease) fails the test. If the change is intended,
+ * update the budget within the same commit.
+ */
+
+/** @brief Decode the envelope with the integrated payload, without authentication. */
+static const struct platform_budget budget_payload_metadata = {
+	.calls = {
+		[BUDGET_CHECK_DIGEST] = 1,
+	},
+	.bytes_hashed = 176,
+};
+
+/** @brief Decode the envelope with the integrated dependencies, without authentication. */
+static const struct platform_budget budget_dependency_metadata = {
+	.calls = {
+		[BUDGET_CHECK_DIGEST] = 1,
+	},
+	.bytes_hashed = 493,
+};
+
+/** @brief Update with the integrated payload: payload fetch and install sequences. */
+static const struct platform_budget budget_payload_update = {
+	.calls = {
+		[BUDGET_CHECK_DIGEST] = 4,
+		[BUDGET_AUTHENTICATE_MANIFEST] = 2,
+		[BUDGET_AUTHORIZE_COMPONENT_ID] = 2,
+		[BUDGET_CREATE_COMPONENT_HANDLE] = 2,
+		[BUDGET_RELEASE_COMPONENT_HANDLE] = 2,
+		[BUDGET_AUTHORIZE_SEQUENCE_NUM] = 2,
+		[BUDGET_OVERRIDE_IMAGE_SIZE] = 1,
+		[BUDGET_CHECK_VID] = 1,
+		[BUDGET_CHECK_CID] = 1,
+		[BUDGET_FETCH_INTEGRATED] = 1,
+		[BUDGET_CHECK_IMAGE_MATCH] = 1,
+		[BUDGET_SEQUENCE_COMPLETED] = 1,
+	},
+	.bytes_hashed = 742,
+};
+
+/** @brief Boot with the integrated payload: validate, load and invoke sequences. */
+static const struct platform_budget budget_payload_boot = {
+	.calls = {
+		[BUDGET_CHECK_DIGEST] = 6,
+		[BUDGET_AUTHENTICATE_MANIFEST] = 3,
+		[BUDGET_AUTHORIZE_COMPONENT_ID] = 3,
+		[BUDGET_CREATE_COMPONENT_HANDLE] = 3,
+		[BUDGET_RELEASE_COMPONENT_HANDLE] = 3,
+		[BUDGET_AUTHORIZE_SEQUENCE_NUM] = 3,
+		[BUDGET_OVERRIDE_IMAGE_SIZE] = 2,
+		[BUDGET_CHECK_VID] = 2,
+		[BUDGET_CHECK_CID] = 2,
+		[BUDGET_CHECK_IMAGE_MATCH] = 1,
+		[BUDGET_INVOKE] = 1,
+		[BUDGET_SEQUENCE_COMPLETED] = 2,
+	},
+	.bytes_hashed = 1113,
+};
+
+/** @brief Update with two integrated dependency manifests: dependency resolution,
+ *         payload fetch and install sequences.
+ */
+static const struct platform_budget budget_dependency_update = {
+	.calls = {
+		[BUDGET_CHECK_DIGEST] = 9,
+		[BUDGET_AUTHENTICATE_MANIFEST] = 9,
+		[BUDGET_AUTHORIZE_COMPONENT_ID] = 21,
+		[BUDGET_CREATE_COMPONENT_HANDLE] = 21,
+		[BUDGET_RELEASE_COMPONENT_HANDLE] = 21,
+		[BUDGET_AUTHORIZE_SEQUENCE_NUM] = 9,
+		[BUDGET_OVERRIDE_IMAGE_SIZE] = 18,
+		[BUDGET_CHECK_VID] = 12,
+		[BUDGET_CHECK_CID] = 12,
+		[BUDGET_FETCH_INTEGRATED] = 8,
+		[BUDGET_RETRIEVE_MANIFEST] = 6,
+		[BUDGET_AUTHORIZE_PROCESS_DEPENDENCY] = 6,
+		[BUDGET_CHECK_IMAGE_MATCH] = 4,
+		[BUDGET_COPY] = 2,
+		[BUDGET_SEQUENCE_COMPLETED] = 9,
+	},
+	.bytes_hashed = 3036,
+};
+
+/** @brief Boot with two installed dependency manifests: validate, load and invoke sequences. */
+static const struct platform_budget budget_dependency_boot = {
+	.calls = {
+		[BUDGET_CHECK_DIGEST] = 9,
+		[BUDGET_AUTHENTICATE_MANIFEST] = 9,
+		[BUDGET_AUTHORIZE_COMPONENT_ID] = 21,
+		[BUDGET_CREATE_COMPONENT_HANDLE] = 21,
+		[BUDGET_RELEASE_COMPONENT_HANDLE] = 21,
+		[BUDGET_AUTHORIZE_SEQUENCE_NUM] = 9,
+		[BUDGET_OVERRIDE_IMAGE_SIZE] = 18,
+		[BUDGET_CHECK_VID] = 12,
+		[BUDGET_CHECK_CID] = 12,
+		[BUDGET_CHECK_IMAGE_MATCH] = 4,
+		[BUDGET_RETRIEVE_MANIFEST] = 6,
+		[BUDGET_AUTHORIZE_PROCESS_DEPENDENCY] = 6,
+		[BUDGET_INVOKE] = 2,
+		[BUDGET_SEQUENCE_COMPLETED] = 9,
+	},
+	.bytes_hashed = 3036,
+};
+
+#endif /* BUDGETS_H__ */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef PLATFORM_BUDGET_H__
+#define PLATFORM_BUDGET_H__
+
+#include <stddef.h>
+#include <suit_platform.h>
+
+/** @file platform_budget.h
+ * @brief Counting implementation of the SUIT platform API.
+ *
+ * The platform functions are implemented as CMock stubs, that accept all digests and
+ * signatures, count the number of calls and the number of bytes passed for hashing.
+ * The component contents are stored per component ID, so they are kept between
+ * subsequent calls to the SUIT processor.
+ */
+
+/** The value of the first component handle, assigned by the counting platform. */
+#define PLATFORM_BUDGET_HANDLE_BASE 0x6000
+
+enum platform_budget_call {
+	BUDGET_CHECK_DIGEST,
+	BUDGET_AUTHENTICATE_MANIFEST,
+	BUDGET_AUTHORIZE_UNSIGNED_MANIFEST,
+	BUDGET_CREATE_COMPONENT_HANDLE,
+	BUDGET_RELEASE_COMPONENT_HANDLE,
+	BUDGET_CHECK_IMAGE_MATCH,
+	BUDGET_CHECK_CONTENT,
+	BUDGET_CHECK_SLOT,
+	BUDGET_CHECK_VID,
+	BUDGET_CHECK_CID,
+	BUDGET_CHECK_DID,
+	BUDGET_AUTHORIZE_SEQUENCE_NUM,
+	BUDGET_AUTHORIZE_COMPONENT_ID,
+	BUDGET_FETCH,
+	BUDGET_FETCH_INTEGRATED,
+	BUDGET_COPY,
+	BUDGET_SWAP,
+	BUDGET_APPLY_DELTA,
+	BUDGET_WRITE,
+	BUDGET_INVOKE,
+	BUDGET_REPORT,
+	BUDGET_SEQUENCE_COMPLETED,
+	BUDGET_RETRIEVE_MANIFEST,
+	BUDGET_OVERRIDE_IMAGE_SIZE,
+	BUDGET_AUTHORIZE_PROCESS_DEPENDENCY,
+	BUDGET_COMPONENT_VERSION_GET,
+	BUDGET_CALL_MAX,
+};
+
+/** @brief The cost of processing, expressed as the platform calls. */
+struct platform_budget {
+	/** The number of calls to each of the platform functions. */
+	unsigned int calls[BUDGET_CALL_MAX];
+	/** The total number of bytes passed to the digest and signature verification. */
+	size_t bytes_hashed;
+};
+
+/** @brief Register the counting stubs, drop stored component contents and reset counters. */
+void platform_budget_init(void);
+
+/** @brief Reset the call counters, keeping the stored component contents. */
+void platform_budget_reset(void);
+
+/** @brief Store the content inside the component, i.e. to simulate an installed manifest.
+ *
+ * @param[in]  component_id  The component ID, as passed to the suit_plat_create_component_handle.
+ * @param[in]  content       The content to store. The data is not copied.
+ */
+void platform_budget_component_store(const struct zcbor_string *component_id,
+				     const struct zcbor_string *content);
+
+/** @brief Return the cost, accumulated since the last reset. */
+const struct platform_budget *platform_budget_get(void);
+
+/** @brief Return the name of the platform function. */
+const char *platform_budget_call_name(enum platform_budget_call call);
+
+/** @brief Assert that the accumulated cost is equal to the checked-in budget.
+ *
+ * @param[in]  expected  The checked-in budget.
+ * @param[in]  scenario  The name of the scenario, printed in case of failure.
+ */
+void platform_budget_assert(const struct platform_budget *expected, const char *scenario);
+
+#endif /* PLATFORM_BUDGET_H__ */
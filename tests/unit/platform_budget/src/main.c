@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include "suit.h"
+#include <platform_budget.h>
+#include <budgets.h>
+
+/* The sample envelope with the integrated payload, reused from the fetch_integrated_payload test suite. */
+extern uint8_t payload_envelope_buf[];
+extern const size_t payload_envelope_len;
+
+/* The sample envelope with integrated radio and application manifests, reused from the
+ * fetch_integrated_manifests test suite.
+ */
+extern uint8_t dependency_envelope_buf[];
+extern const size_t dependency_envelope_len;
+
+struct budget_step {
+	enum suit_command_sequence seq;
+	int status;
+};
+
+static const struct budget_step payload_update_steps[] = {
+	{SUIT_SEQ_PAYLOAD_FETCH, SUIT_ERR_UNAVAILABLE_COMMAND_SEQ},
+	{SUIT_SEQ_INSTALL, SUIT_SUCCESS},
+};
+
+static const struct budget_step payload_boot_steps[] = {
+	{SUIT_SEQ_VALIDATE, SUIT_SUCCESS},
+	{SUIT_SEQ_LOAD, SUIT_ERR_UNAVAILABLE_COMMAND_SEQ},
+	{SUIT_SEQ_INVOKE, SUIT_SUCCESS},
+};
+
+static const struct budget_step dependency_update_steps[] = {
+	{SUIT_SEQ_DEP_RESOLUTION, SUIT_SUCCESS},
+	{SUIT_SEQ_PAYLOAD_FETCH, SUIT_SUCCESS},
+	{SUIT_SEQ_INSTALL, SUIT_SUCCESS},
+};
+
+static const struct budget_step dependency_boot_steps[] = {
+	{SUIT_SEQ_VALIDATE, SUIT_SUCCESS},
+	{SUIT_SEQ_LOAD, SUIT_SUCCESS},
+	{SUIT_SEQ_INVOKE, SUIT_SUCCESS},
+};
+
+
+static void run_steps(const uint8_t *envelope_str, size_t envelope_len,
+		      const struct budget_step *steps, size_t steps_len)
+{
+	for (size_t i = 0; i < steps_len; i++) {
+		int err = suit_process_sequence(envelope_str, envelope_len, steps[i].seq);
+
+		TEST_ASSERT_EQUAL_MESSAGE(steps[i].status, err, "Unexpected sequence processing result");
+	}
+}
+
+/* Store the radio and application manifests, as if they were installed by the previous update. */
+static void install_dependency_manifests(void)
+{
+	static uint8_t radio_manifest_id[] = {
+		0x82, // SUIT_Component_Identifier: array(2)
+			0x41, // bstr: bytes(1)
+				'I',
+			0x50, // bstr: bytes(16)
+				0x81, 0x6A, 0xA0, 0xA0, 0xAF, 0x11, 0x5E, 0xF2,
+				0x85, 0x8A, 0xFE, 0xB6, 0x68, 0xB2, 0xE9, 0xC9,
+	};
+	static uint8_t app_manifest_id[] = {
+		0x82, // SUIT_Component_Identifier: array(2)
+			0x41, // bstr: bytes(1)
+				'I',
+			0x50, // bstr: bytes(16)
+				0x08, 0xC1, 0xB5, 0x99, 0x55, 0xE8, 0x5F, 0xBC,
+				0x9E, 0x76, 0x7B, 0xC2, 0x9C, 0xE1, 0xB0, 0x4D,
+	};
+	struct zcbor_string radio_id = {
+		.value = radio_manifest_id,
+		.len = sizeof(radio_manifest_id),
+	};
+	struct zcbor_string app_id = {
+		.value = app_manifest_id,
+		.len = sizeof(app_manifest_id),
+	};
+	struct zcbor_string radio_envelope = {
+		.value = &dependency_envelope_buf[630],
+		.len = 568,
+	};
+	struct zcbor_string app_envelope = {
+		.value = &dependency_envelope_buf[1211],
+		.len = 568,
+	};
+
+	platform_budget_component_store(&radio_id, &radio_envelope);
+	platform_budget_component_store(&app_id, &app_envelope);
+}
+
+void setUp(void)
+{
+	int ret = suit_processor_init();
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to initialize SUIT processor");
+
+	platform_budget_init();
+}
+
+void test_payload_metadata(void)
+{
+	struct zcbor_string manifest_component_id;
+	struct zcbor_string digest;
+	enum suit_cose_alg alg;
+	unsigned int seq_num;
+
+	int ret = suit_processor_get_manifest_metadata(
+		payload_envelope_buf, payload_envelope_len, false,
+		&manifest_component_id, NULL, NULL, &digest, &alg, &seq_num);
+
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to decode input manifest");
+	platform_budget_assert(&budget_payload_metadata, "payload metadata");
+}
+
+void test_dependency_metadata(void)
+{
+	struct zcbor_string manifest_component_id;
+	struct zcbor_string digest;
+	enum suit_cose_alg alg;
+	unsigned int seq_num;
+
+	int ret = suit_processor_get_manifest_metadata(
+		dependency_envelope_buf, dependency_envelope_len, false,
+		&manifest_component_id, NULL, NULL, &digest, &alg, &seq_num);
+
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, ret, "Unable to decode input manifest");
+	platform_budget_assert(&budget_dependency_metadata, "dependency metadata");
+}
+
+void test_payload_update(void)
+{
+	run_steps(payload_envelope_buf, payload_envelope_len,
+		  payload_update_steps, ZCBOR_ARRAY_SIZE(payload_update_steps));
+	platform_budget_assert(&budget_payload_update, "payload update");
+}
+
+void test_payload_boot(void)
+{
+	run_steps(payload_envelope_buf, payload_envelope_len,
+		  payload_boot_steps, ZCBOR_ARRAY_SIZE(payload_boot_steps));
+	platform_budget_assert(&budget_payload_boot, "payload boot");
+}
+
+void test_dependency_update(void)
+{
+	run_steps(dependency_envelope_buf, dependency_envelope_len,
+		  dependency_update_steps, ZCBOR_ARRAY_SIZE(dependency_update_steps));
+	platform_budget_assert(&budget_dependency_update, "dependency update");
+}
+
+void test_dependency_boot(void)
+{
+	install_dependency_manifests();
+
+	run_steps(dependency_envelope_buf, dependency_envelope_len,
+		  dependency_boot_steps, ZCBOR_ARRAY_SIZE(dependency_boot_steps));
+	platform_budget_assert(&budget_dependency_boot, "dependency boot");
+}
+
+void test_dependency_boot_after_update(void)
+{
+	/* The update does not store the dependency manifests inside the dependency components
+	 * (it is done by the platform, outside of the SUIT processor), so provision them before
+	 * the boot, to check that the update does not leave any state, that affects the boot cost.
+	 */
+	run_steps(dependency_envelope_buf, dependency_envelope_len,
+		  dependency_update_steps, ZCBOR_ARRAY_SIZE(dependency_update_steps));
+	install_dependency_manifests();
+	platform_budget_reset();
+
+	run_steps(dependency_envelope_buf, dependency_envelope_len,
+		  dependency_boot_steps, ZCBOR_ARRAY_SIZE(dependency_boot_steps));
+	platform_budget_assert(&budget_dependency_boot, "dependency boot after update");
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "suit_platform/cmock_suit_platform.h"
+#include <platform_budget.h>
+
+/* The maximum number of distinct component IDs, used across all scenarios. */
+#define PLATFORM_BUDGET_MAX_COMPONENTS 16
+
+struct budget_component {
+	bool in_use;
+	struct zcbor_string component_id;
+	struct zcbor_string content;
+};
+
+static struct platform_budget budget;
+static struct budget_component components[PLATFORM_BUDGET_MAX_COMPONENTS];
+
+static const char *call_names[BUDGET_CALL_MAX] = {
+	[BUDGET_CHECK_DIGEST] = "suit_plat_check_digest",
+	[BUDGET_AUTHENTICATE_MANIFEST] = "suit_plat_authenticate_manifest",
+	[BUDGET_AUTHORIZE_UNSIGNED_MANIFEST] = "suit_plat_authorize_unsigned_manifest",
+	[BUDGET_CREATE_COMPONENT_HANDLE] = "suit_plat_create_component_handle",
+	[BUDGET_RELEASE_COMPONENT_HANDLE] = "suit_plat_release_component_handle",
+	[BUDGET_CHECK_IMAGE_MATCH] = "suit_plat_check_image_match",
+	[BUDGET_CHECK_CONTENT] = "suit_plat_check_content",
+	[BUDGET_CHECK_SLOT] = "suit_plat_check_slot",
+	[BUDGET_CHECK_VID] = "suit_plat_check_vid",
+	[BUDGET_CHECK_CID] = "suit_plat_check_cid",
+	[BUDGET_CHECK_DID] = "suit_plat_check_did",
+	[BUDGET_AUTHORIZE_SEQUENCE_NUM] = "suit_plat_authorize_sequence_num",
+	[BUDGET_AUTHORIZE_COMPONENT_ID] = "suit_plat_authorize_component_id",
+	[BUDGET_FETCH] = "suit_plat_fetch",
+	[BUDGET_FETCH_INTEGRATED] = "suit_plat_fetch_integrated",
+	[BUDGET_COPY] = "suit_plat_copy",
+	[BUDGET_SWAP] = "suit_plat_swap",
+	[BUDGET_APPLY_DELTA] = "suit_plat_apply_delta",
+	[BUDGET_WRITE] = "suit_plat_write",
+	[BUDGET_INVOKE] = "suit_plat_invoke",
+	[BUDGET_REPORT] = "suit_plat_report",
+	[BUDGET_SEQUENCE_COMPLETED] = "suit_plat_sequence_completed",
+	[BUDGET_RETRIEVE_MANIFEST] = "suit_plat_retrieve_manifest",
+	[BUDGET_OVERRIDE_IMAGE_SIZE] = "suit_plat_override_image_size",
+	[BUDGET_AUTHORIZE_PROCESS_DEPENDENCY] = "suit_plat_authorize_process_dependency",
+	[BUDGET_COMPONENT_VERSION_GET] = "suit_plat_component_version_get",
+};
+
+
+static struct budget_component *component_find(const struct zcbor_string *component_id, bool create)
+{
+	struct budget_component *empty = NULL;
+
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(components); i++) {
+		if (!components[i].in_use) {
+			if (empty == NULL) {
+				empty = &components[i];
+			}
+			continue;
+		}
+
+		if ((components[i].component_id.len == component_id->len) &&
+		    (memcmp(components[i].component_id.value, component_id->value, component_id->len) == 0)) {
+			return &components[i];
+		}
+	}
+
+	if (create && (empty != NULL)) {
+		memset(empty, 0, sizeof(*empty));
+		empty->in_use = true;
+		empty->component_id = *component_id;
+	}
+
+	return (create ? empty : NULL);
+}
+
+static struct budget_component *component_get(suit_component_t handle)
+{
+	if ((handle < PLATFORM_BUDGET_HANDLE_BASE) ||
+	    (handle >= PLATFORM_BUDGET_HANDLE_BASE + ZCBOR_ARRAY_SIZE(components))) {
+		return NULL;
+	}
+
+	struct budget_component *component = &components[handle - PLATFORM_BUDGET_HANDLE_BASE];
+
+	return (component->in_use ? component : NULL);
+}
+
+static int component_content_set(suit_component_t handle, const struct zcbor_string *content)
+{
+	struct budget_component *component = component_get(handle);
+
+	if (component == NULL) {
+		return SUIT_ERR_UNSUPPORTED_COMPONENT_ID;
+	}
+
+	if (content == NULL) {
+		component->content = (struct zcbor_string){NULL, 0};
+	} else {
+		component->content = *content;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+static int check_digest_stub(enum suit_cose_alg alg_id, struct zcbor_string *digest,
+			     struct zcbor_string *payload, int cmock_num_calls)
+{
+	budget.calls[BUDGET_CHECK_DIGEST]++;
+	if (payload != NULL) {
+		budget.bytes_hashed += payload->len;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+static int authenticate_manifest_stub(struct zcbor_string *manifest_component_id,
+				      enum suit_cose_alg alg_id, struct zcbor_string *key_id,
+				      struct zcbor_string *signature, struct zcbor_string *data,
+				      int cmock_num_calls)
+{
+	budget.calls[BUDGET_AUTHENTICATE_MANIFEST]++;
+	if (data != NULL) {
+		budget.bytes_hashed += data->len;
+	}
+
+	return SUIT_SUCCESS;
+}
+
+static int authorize_unsigned_manifest_stub(struct zcbor_string *manifest_component_id,
+					    int cmock_num_calls)
+{
+	budget.calls[BUDGET_AUTHORIZE_UNSIGNED_MANIFEST]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int create_component_handle_stub(struct zcbor_string *component_id, bool dependency,
+					suit_component_t *handle, int cmock_num_calls)
+{
+	struct budget_component *component;
+
+	budget.calls[BUDGET_CREATE_COMPONENT_HANDLE]++;
+
+	if ((component_id == NULL) || (handle == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	component = component_find(component_id, true);
+	if (component == NULL) {
+		return SUIT_ERR_OVERFLOW;
+	}
+
+	*handle = PLATFORM_BUDGET_HANDLE_BASE + (component - components);
+
+	return SUIT_SUCCESS;
+}
+
+static int release_component_handle_stub(suit_component_t handle, int cmock_num_calls)
+{
+	/* The component content outlives the handle, so it is not released here. */
+	budget.calls[BUDGET_RELEASE_COMPONENT_HANDLE]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int check_image_match_stub(suit_component_t handle, enum suit_cose_alg alg_id,
+				  struct zcbor_string *digest, int cmock_num_calls)
+{
+	budget.calls[BUDGET_CHECK_IMAGE_MATCH]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int check_content_stub(suit_component_t handle, struct zcbor_string *content,
+			      int cmock_num_calls)
+{
+	budget.calls[BUDGET_CHECK_CONTENT]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int check_slot_stub(suit_component_t handle, unsigned int slot, int cmock_num_calls)
+{
+	budget.calls[BUDGET_CHECK_SLOT]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int check_vid_stub(suit_component_t handle, struct zcbor_string *vid_uuid,
+			  int cmock_num_calls)
+{
+	budget.calls[BUDGET_CHECK_VID]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int check_cid_stub(suit_component_t handle, struct zcbor_string *cid_uuid,
+			  int cmock_num_calls)
+{
+	budget.calls[BUDGET_CHECK_CID]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int check_did_stub(suit_component_t handle, struct zcbor_string *did_uuid,
+			  int cmock_num_calls)
+{
+	budget.calls[BUDGET_CHECK_DID]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int authorize_sequence_num_stub(enum suit_command_sequence seq_name,
+				       struct zcbor_string *manifest_component_id,
+				       unsigned int seq_num, int cmock_num_calls)
+{
+	budget.calls[BUDGET_AUTHORIZE_SEQUENCE_NUM]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int authorize_component_id_stub(struct zcbor_string *manifest_component_id,
+				       struct zcbor_string *component_id, int cmock_num_calls)
+{
+	budget.calls[BUDGET_AUTHORIZE_COMPONENT_ID]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int fetch_stub(suit_component_t dst_handle, struct zcbor_string *uri,
+		      struct zcbor_string *manifest_component_id,
+		      struct suit_encryption_info *enc_info,
+		      struct suit_compression_info *comp_info, int cmock_num_calls)
+{
+	/* There is no remote storage - the fetch succeeds, but the component stays empty. */
+	budget.calls[BUDGET_FETCH]++;
+
+	return component_content_set(dst_handle, NULL);
+}
+
+static int fetch_integrated_stub(suit_component_t dst_handle, struct zcbor_string *payload,
+				 struct zcbor_string *manifest_component_id,
+				 struct suit_encryption_info *enc_info,
+				 struct suit_compression_info *comp_info, int cmock_num_calls)
+{
+	budget.calls[BUDGET_FETCH_INTEGRATED]++;
+
+	if (payload == NULL) {
+		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	}
+
+	return component_content_set(dst_handle, payload);
+}
+
+static int copy_stub(suit_component_t dst_handle, suit_component_t src_handle,
+		     struct zcbor_string *manifest_component_id,
+		     struct suit_encryption_info *enc_info,
+		     struct suit_compression_info *comp_info, int cmock_num_calls)
+{
+	struct budget_component *src = component_get(src_handle);
+
+	budget.calls[BUDGET_COPY]++;
+
+	if (src == NULL) {
+		return SUIT_ERR_UNSUPPORTED_COMPONENT_ID;
+	}
+
+	return component_content_set(dst_handle, &src->content);
+}
+
+static int swap_stub(suit_component_t dst_handle, suit_component_t src_handle,
+		     struct zcbor_string *manifest_component_id,
+		     struct suit_encryption_info *enc_info, int cmock_num_calls)
+{
+	struct budget_component *dst = component_get(dst_handle);
+	struct budget_component *src = component_get(src_handle);
+
+	budget.calls[BUDGET_SWAP]++;
+
+	if ((dst == NULL) || (src == NULL)) {
+		return SUIT_ERR_UNSUPPORTED_COMPONENT_ID;
+	}
+
+	struct zcbor_string content = dst->content;
+
+	dst->content = src->content;
+	src->content = content;
+
+	return SUIT_SUCCESS;
+}
+
+static int apply_delta_stub(suit_component_t dst_handle, suit_component_t base_handle,
+			    suit_component_t patch_handle,
+			    struct zcbor_string *manifest_component_id, int cmock_num_calls)
+{
+	budget.calls[BUDGET_APPLY_DELTA]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int write_stub(suit_component_t dst_handle, struct zcbor_string *content,
+		      struct zcbor_string *manifest_component_id,
+		      struct suit_encryption_info *enc_info,
+		      struct suit_compression_info *comp_info, int cmock_num_calls)
+{
+	budget.calls[BUDGET_WRITE]++;
+
+	if (content == NULL) {
+		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	}
+
+	return component_content_set(dst_handle, content);
+}
+
+static int invoke_stub(suit_component_t image_handle, struct zcbor_string *invoke_args,
+		       int cmock_num_calls)
+{
+	budget.calls[BUDGET_INVOKE]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int report_stub(unsigned int rep_policy, struct suit_report *report, int cmock_num_calls)
+{
+	budget.calls[BUDGET_REPORT]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int sequence_completed_stub(enum suit_command_sequence seq_name,
+				   struct zcbor_string *manifest_component_id,
+				   const uint8_t *envelope_str, size_t envelope_len,
+				   int cmock_num_calls)
+{
+	budget.calls[BUDGET_SEQUENCE_COMPLETED]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int retrieve_manifest_stub(suit_component_t component_handle, const uint8_t **envelope_str,
+				  size_t *envelope_len, int cmock_num_calls)
+{
+	struct budget_component *component = component_get(component_handle);
+
+	budget.calls[BUDGET_RETRIEVE_MANIFEST]++;
+
+	if ((envelope_str == NULL) || (envelope_len == NULL)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	if ((component == NULL) || (component->content.value == NULL)) {
+		return SUIT_ERR_UNAVAILABLE_PAYLOAD;
+	}
+
+	*envelope_str = component->content.value;
+	*envelope_len = component->content.len;
+
+	return SUIT_SUCCESS;
+}
+
+static int override_image_size_stub(suit_component_t handle, size_t size,
+				    struct zcbor_string *manifest_component_id,
+				    int cmock_num_calls)
+{
+	budget.calls[BUDGET_OVERRIDE_IMAGE_SIZE]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int authorize_process_dependency_stub(struct zcbor_string *parent_component_id,
+					     struct zcbor_string *child_component_id,
+					     enum suit_command_sequence seq_name,
+					     int cmock_num_calls)
+{
+	budget.calls[BUDGET_AUTHORIZE_PROCESS_DEPENDENCY]++;
+
+	return SUIT_SUCCESS;
+}
+
+static int component_version_get_stub(suit_component_t handle, int *version, size_t *version_len,
+				      int cmock_num_calls)
+{
+	budget.calls[BUDGET_COMPONENT_VERSION_GET]++;
+
+	if ((version == NULL) || (version_len == NULL) || (*version_len < 1)) {
+		return SUIT_ERR_CRASH;
+	}
+
+	version[0] = 1;
+	*version_len = 1;
+
+	return SUIT_SUCCESS;
+}
+
+void platform_budget_init(void)
+{
+	memset(components, 0, sizeof(components));
+	platform_budget_reset();
+
+	__cmock_suit_plat_check_digest_Stub(check_digest_stub);
+	__cmock_suit_plat_authenticate_manifest_Stub(authenticate_manifest_stub);
+	__cmock_suit_plat_authorize_unsigned_manifest_Stub(authorize_unsigned_manifest_stub);
+	__cmock_suit_plat_create_component_handle_Stub(create_component_handle_stub);
+	__cmock_suit_plat_release_component_handle_Stub(release_component_handle_stub);
+	__cmock_suit_plat_check_image_match_Stub(check_image_match_stub);
+	__cmock_suit_plat_check_content_Stub(check_content_stub);
+	__cmock_suit_plat_check_slot_Stub(check_slot_stub);
+	__cmock_suit_plat_check_vid_Stub(check_vid_stub);
+	__cmock_suit_plat_check_cid_Stub(check_cid_stub);
+	__cmock_suit_plat_check_did_Stub(check_did_stub);
+	__cmock_suit_plat_authorize_sequence_num_Stub(authorize_sequence_num_stub);
+	__cmock_suit_plat_authorize_component_id_Stub(authorize_component_id_stub);
+	__cmock_suit_plat_fetch_Stub(fetch_stub);
+	__cmock_suit_plat_fetch_integrated_Stub(fetch_integrated_stub);
+	__cmock_suit_plat_copy_Stub(copy_stub);
+	__cmock_suit_plat_swap_Stub(swap_stub);
+	__cmock_suit_plat_apply_delta_Stub(apply_delta_stub);
+	__cmock_suit_plat_write_Stub(write_stub);
+	__cmock_suit_plat_invoke_Stub(invoke_stub);
+	__cmock_suit_plat_report_Stub(report_stub);
+	__cmock_suit_plat_sequence_completed_Stub(sequence_completed_stub);
+	__cmock_suit_plat_retrieve_manifest_Stub(retrieve_manifest_stub);
+	__cmock_suit_plat_override_image_size_Stub(override_image_size_stub);
+	__cmock_suit_plat_authorize_process_dependency_Stub(authorize_process_dependency_stub);
+	__cmock_suit_plat_component_version_get_Stub(component_version_get_stub);
+}
+
+void platform_budget_reset(void)
+{
+	memset(&budget, 0, sizeof(budget));
+}
+
+void platform_budget_component_store(const struct zcbor_string *component_id,
+				     const struct zcbor_string *content)
+{
+	struct budget_component *component = component_find(component_id, true);
+
+	TEST_ASSERT_NOT_NULL_MESSAGE(component, "Please fix the test: too many components");
+	component->content = *content;
+}
+
+const struct platform_budget *platform_budget_get(void)
+{
+	return &budget;
+}
+
+const char *platform_budget_call_name(enum platform_budget_call call)
+{
+	if (call >= BUDGET_CALL_MAX) {
+		return "unknown";
+	}
+
+	return call_names[call];
+}
+
+void platform_budget_assert(const struct platform_budget *expected, const char *scenario)
+{
+	char message[128];
+
+	for (size_t i = 0; i < BUDGET_CALL_MAX; i++) {
+		(void)snprintf(message, sizeof(message),
+			"%s: number of %s calls differs from budget (update budgets.h if intended)",
+			scenario, platform_budget_call_name(i));
+		TEST_ASSERT_EQUAL_MESSAGE(expected->calls[i], budget.calls[i], message);
+	}
+
+	(void)snprintf(message, sizeof(message),
+		"%s: number of hashed bytes differs from budget (update budgets.h if intended)",
+		scenario);
+	TEST_ASSERT_EQUAL_MESSAGE(expected->bytes_hashed, budget.bytes_hashed, message);
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <bootstrap_envelope.h>
+#include <suit_manifest.h>
+#include <suit_schedule_seq.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+#define APP_URI_PARAMETER                                                                          \
+	0x15, /* uint(suit-parameter-uri) */                                                       \
+	0x78, 0x1A, /* text (26 characters) */                                                     \
+		'h', 't', 't', 'p', ':', '/', '/',                                                 \
+		'e', 'x', 'a', 'm', 'p', 'l', 'e', '.', 'c', 'o', 'm',                             \
+		'/', 'a', 'p', 'p', '.', 'b', 'i', 'n'
+
+#define RADIO_URI_PARAMETER                                                                        \
+	0x15, /* uint(suit-parameter-uri) */                                                       \
+	0x78, 0x1C, /* text (28 characters) */                                                     \
+		'h', 't', 't', 'p', ':', '/', '/',                                                 \
+		'e', 'x', 'a', 'm', 'p', 'l', 'e', '.', 'c', 'o', 'm',                             \
+		'/', 'r', 'a', 'd', 'i', 'o', '.', 'b', 'i', 'n'
+
+#define INTEGRATED_URI_PARAMETER                                                                   \
+	0x15, /* uint(suit-parameter-uri) */                                                       \
+	0x68, /* text (8 characters) */                                                            \
+		'#', 'a', 'p', 'p', '.', 'b', 'i', 'n'
+
+#define PREFETCH_LOG_MAX 8
+
+struct prefetch_call {
+	suit_component_t component_handle; ///! The announced manifest component, 0 for the URIs.
+	struct zcbor_string uri;
+};
+
+static struct suit_processor_state state;
+static struct prefetch_call prefetch_log[PREFETCH_LOG_MAX];
+static size_t prefetch_log_len;
+
+static const struct zcbor_string app_uri = {
+	.value = "http://example.com/app.bin",
+	.len = sizeof("http://example.com/app.bin") - 1,
+};
+static const struct zcbor_string radio_uri = {
+	.value = "http://example.com/radio.bin",
+	.len = sizeof("http://example.com/radio.bin") - 1,
+};
+
+static int prefetch_manifest_stub(suit_component_t component_handle, int cmock_num_calls)
+{
+	TEST_ASSERT_LESS_THAN(PREFETCH_LOG_MAX, prefetch_log_len);
+
+	prefetch_log[prefetch_log_len].component_handle = component_handle;
+	prefetch_log[prefetch_log_len].uri.value = NULL;
+	prefetch_log[prefetch_log_len].uri.len = 0;
+	prefetch_log_len++;
+
+	return SUIT_SUCCESS;
+}
+
+static int prefetch_uri_stub(struct zcbor_string *uri, struct zcbor_string *manifest_component_id,
+			     int cmock_num_calls)
+{
+	TEST_ASSERT_NOT_NULL(uri);
+	TEST_ASSERT_LESS_THAN(PREFETCH_LOG_MAX, prefetch_log_len);
+
+	prefetch_log[prefetch_log_len].component_handle = 0;
+	prefetch_log[prefetch_log_len].uri = *uri;
+	prefetch_log_len++;
+
+	return SUIT_SUCCESS;
+}
+
+static void assert_manifest_announced(size_t idx, suit_component_t component_handle)
+{
+	TEST_ASSERT_LESS_THAN_MESSAGE(prefetch_log_len, idx, "Manifest not announced");
+	TEST_ASSERT_EQUAL_MESSAGE(component_handle, prefetch_log[idx].component_handle, "Unexpected manifest announced");
+}
+
+static void assert_uri_announced(size_t idx, const struct zcbor_string *uri)
+{
+	TEST_ASSERT_LESS_THAN_MESSAGE(prefetch_log_len, idx, "URI not announced");
+	TEST_ASSERT_EQUAL_MESSAGE(0, prefetch_log[idx].component_handle, "Manifest announced instead of the URI");
+	TEST_ASSERT_EQUAL_MESSAGE(uri->len, prefetch_log[idx].uri.len, "Unexpected URI length");
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(uri->value, prefetch_log[idx].uri.value, uri->len, "Unexpected URI announced");
+}
+
+static int validate_sequence(enum suit_command_sequence seq_name, struct zcbor_string *cmd_seq_str)
+{
+	struct suit_manifest_state *manifest_state = &state.manifest_stack[0];
+
+	bootstrap_envelope_sequence(&state, seq_name, cmd_seq_str);
+
+	int ret = suit_schedule_validation(&state, manifest_state, seq_name);
+	if (ret == SUIT_ERR_AGAIN) {
+		ret = suit_process_scheduled(&state);
+	}
+
+	return ret;
+}
+
+void setUp(void)
+{
+	memset(&state, 0, sizeof(state));
+	memset(prefetch_log, 0, sizeof(prefetch_log));
+	prefetch_log_len = 0;
+
+	int err = suit_manifest_params_init(state.components, ZCBOR_ARRAY_SIZE(state.components));
+	if (err == SUIT_ERR_ORDER) {
+		/* Allow to call init even if the manifest module is already initialized. */
+		err = SUIT_SUCCESS;
+	}
+
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, err, "Unable to initialize SUIT processor");
+
+	__cmock_suit_plat_prefetch_manifest_Stub(prefetch_manifest_stub);
+	__cmock_suit_plat_prefetch_uri_Stub(prefetch_uri_stub);
+}
+
+void test_prefetch_dependencies_announced_before_uris(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x01, /* uint(1) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				APP_URI_PARAMETER,
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 3);
+	state.components[0].is_dependency = suit_bool_true;
+	state.components[2].is_dependency = suit_bool_true;
+	state.current_seq = SUIT_SEQ_PAYLOAD_FETCH;
+
+	int retval = validate_sequence(SUIT_SEQ_SHARED, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(3, prefetch_log_len);
+	assert_manifest_announced(0, ASSIGNED_COMPONENT_HANDLE);
+	assert_manifest_announced(1, ASSIGNED_COMPONENT_HANDLE + 2);
+	assert_uri_announced(2, &app_uri);
+}
+
+void test_prefetch_dependencies_not_announced_while_parsing(void)
+{
+	uint8_t seq_cmd[] = {
+		0x82, /* list (2 elements - 1 command) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x00, /* uint(0) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_dependency_components(&state, 2);
+	state.current_seq = SUIT_SEQ_PARSE;
+
+	int retval = validate_sequence(SUIT_SEQ_SHARED, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(0, prefetch_log_len);
+}
+
+void test_prefetch_uris_announced_in_order(void)
+{
+	uint8_t seq_cmd[] = {
+		0x88, /* list (8 elements - 4 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				RADIO_URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				APP_URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+	state.current_seq = SUIT_SEQ_PAYLOAD_FETCH;
+
+	int retval = validate_sequence(SUIT_SEQ_PAYLOAD_FETCH, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(2, prefetch_log_len);
+	assert_uri_announced(0, &radio_uri);
+	assert_uri_announced(1, &app_uri);
+}
+
+void test_prefetch_integrated_uri_not_announced(void)
+{
+	uint8_t seq_cmd[] = {
+		0x88, /* list (8 elements - 4 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				INTEGRATED_URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				APP_URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+	struct zcbor_string integrated_uri = {
+		.value = "#app.bin",
+		.len = sizeof("#app.bin") - 1,
+	};
+	struct zcbor_string integrated_payload = {
+		.value = "My application",
+		.len = sizeof("My application"),
+	};
+	uint8_t envelope_buf[128];
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+	state.current_seq = SUIT_SEQ_PAYLOAD_FETCH;
+
+	int ret = bootstrap_envelope_integrated_payload(&state, envelope_buf, sizeof(envelope_buf),
+						       &seq, &integrated_uri, &integrated_payload);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, ret);
+
+	int retval = validate_sequence(SUIT_SEQ_PAYLOAD_FETCH, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(1, prefetch_log_len);
+	assert_uri_announced(0, &app_uri);
+}
+
+void test_prefetch_executed_sequence_not_announced(void)
+{
+	uint8_t fetch_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				RADIO_URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	uint8_t install_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				APP_URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string fetch_seq = {
+		.value = fetch_cmd,
+		.len = sizeof(fetch_cmd),
+	};
+	struct zcbor_string install_seq = {
+		.value = install_cmd,
+		.len = sizeof(install_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+	state.current_seq = SUIT_SEQ_INSTALL;
+
+	/* The payload fetch sequence was executed by the previous call. */
+	int retval = validate_sequence(SUIT_SEQ_PAYLOAD_FETCH, &fetch_seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(0, prefetch_log_len);
+
+	retval = validate_sequence(SUIT_SEQ_INSTALL, &install_seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(1, prefetch_log_len);
+	assert_uri_announced(0, &app_uri);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
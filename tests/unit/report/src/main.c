@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <suit_report.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+#define ASSIGNED_COMPONENT_HANDLE 0x1E054000
+
+static uint8_t image_digest[32] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+	0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff,
+	0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+	0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
+};
+
+static struct suit_manifest_params params;
+static struct suit_report reports[SUIT_MAX_NUM_REPORT_RECORDS + 1];
+static size_t reports_count;
+
+static int report_callback(unsigned int rep_policy, struct suit_report *report, int cmock_num_calls)
+{
+	TEST_ASSERT_LESS_THAN(sizeof(reports) / sizeof(reports[0]), reports_count);
+	reports[reports_count++] = *report;
+
+	return SUIT_SUCCESS;
+}
+
+static void expect_report(unsigned int rep_policy)
+{
+	__cmock_suit_plat_report_AddCallback(report_callback);
+	__cmock_suit_plat_report_ExpectAndReturn(rep_policy, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_report_IgnoreArg_report();
+}
+
+static suit_command_t condition(int choice, uint32_t rep_policy)
+{
+	suit_command_t command = {
+		.type = SUIT_COMMAND_CONDITION,
+		.rep_policy = rep_policy,
+	};
+
+	command.condition.SUIT_Condition_choice = choice;
+
+	return command;
+}
+
+static suit_command_t directive(int choice, uint32_t rep_policy)
+{
+	suit_command_t command = {
+		.type = SUIT_COMMAND_DIRECTIVE,
+		.rep_policy = rep_policy,
+	};
+
+	command.directive.SUIT_Directive_choice = choice;
+
+	return command;
+}
+
+void setUp(void)
+{
+	suit_report_reset();
+
+	memset(&params, 0, sizeof(params));
+	params.component_handle = ASSIGNED_COMPONENT_HANDLE;
+	params.image_digest.value = image_digest;
+	params.image_digest.len = sizeof(image_digest);
+	suit_param_set_flag(&params, SUIT_PARAM_IMAGE_DIGEST, true);
+	params.image_size = 1024;
+	suit_param_set_flag(&params, SUIT_PARAM_IMAGE_SIZE, true);
+
+	memset(reports, 0, sizeof(reports));
+	reports_count = 0;
+}
+
+void test_construct_report_invalid_args(void)
+{
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_construct_report(
+		SUIT_Condition_suit_condition_image_match_m_l_c, SUIT_SUCCESS, &params, NULL));
+}
+
+void test_construct_report_no_params(void)
+{
+	struct suit_report report;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_construct_report(
+		SUIT_Condition_suit_condition_image_match_m_l_c, SUIT_FAIL_CONDITION, NULL, &report));
+
+	TEST_ASSERT_EQUAL(SUIT_Condition_suit_condition_image_match_m_l_c, report.command);
+	TEST_ASSERT_EQUAL(SUIT_FAIL_CONDITION, report.result);
+	TEST_ASSERT_EQUAL(0, report.component_handle);
+	TEST_ASSERT_EQUAL(0, report.nargs);
+}
+
+void test_construct_report_image_match(void)
+{
+	struct suit_report report;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_construct_report(
+		SUIT_Condition_suit_condition_image_match_m_l_c, SUIT_SUCCESS, &params, &report));
+
+	TEST_ASSERT_EQUAL(ASSIGNED_COMPONENT_HANDLE, report.component_handle);
+	TEST_ASSERT_EQUAL(2, report.nargs);
+	TEST_ASSERT_EQUAL(bstr, report.argv[0].arg_type);
+	TEST_ASSERT_EQUAL_PTR(&params.image_digest, report.argv[0].arg.bstr);
+	TEST_ASSERT_EQUAL(num, report.argv[1].arg_type);
+	TEST_ASSERT_EQUAL(1024, report.argv[1].arg.num);
+}
+
+void test_construct_report_unset_params(void)
+{
+	struct suit_report report;
+
+	suit_param_set_flag(&params, SUIT_PARAM_URI, false);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_construct_report(
+		SUIT_Directive_suit_directive_fetch_m_l_c, SUIT_SUCCESS, &params, &report));
+
+	/* Only the image digest is attached. */
+	TEST_ASSERT_EQUAL(1, report.nargs);
+	TEST_ASSERT_EQUAL_PTR(&params.image_digest, report.argv[0].arg.bstr);
+}
+
+void test_record_no_policy(void)
+{
+	suit_command_t command = condition(SUIT_Condition_suit_condition_image_match_m_l_c, 0);
+
+	suit_report_record(&command, SUIT_SUCCESS, &params);
+	suit_report_record(&command, SUIT_FAIL_CONDITION, &params);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_report_flush());
+}
+
+void test_record_success(void)
+{
+	suit_command_t command = condition(SUIT_Condition_suit_condition_image_match_m_l_c,
+					   SUIT_REP_POLICY_RECORD_SUCCESS);
+
+	suit_report_record(&command, SUIT_FAIL_CONDITION, &params);
+	suit_report_record(&command, SUIT_SUCCESS, &params);
+
+	/* The records are passed to the platform only when the buffer is flushed. */
+	expect_report(SUIT_REP_POLICY_RECORD_SUCCESS);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_report_flush());
+
+	TEST_ASSERT_EQUAL(1, reports_count);
+	TEST_ASSERT_EQUAL(SUIT_Condition_suit_condition_image_match_m_l_c, reports[0].command);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, reports[0].result);
+	TEST_ASSERT_EQUAL(ASSIGNED_COMPONENT_HANDLE, reports[0].component_handle);
+	TEST_ASSERT_EQUAL(0, reports[0].nargs);
+
+	/* The buffer is empty after the flush. */
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_report_flush());
+}
+
+void test_record_failure(void)
+{
+	suit_command_t command = directive(SUIT_Directive_suit_directive_fetch_m_l_c,
+					   SUIT_REP_POLICY_RECORD_FAILURE);
+
+	suit_report_record(&command, SUIT_SUCCESS, &params);
+	suit_report_record(&command, SUIT_ERR_UNAVAILABLE_PAYLOAD, &params);
+
+	expect_report(SUIT_REP_POLICY_RECORD_FAILURE);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_report_flush());
+
+	TEST_ASSERT_EQUAL(1, reports_count);
+	TEST_ASSERT_EQUAL(SUIT_Directive_suit_directive_fetch_m_l_c, reports[0].command);
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_PAYLOAD, reports[0].result);
+}
+
+void test_record_sysinfo(void)
+{
+	suit_command_t first = condition(SUIT_Condition_suit_condition_vendor_identifier_m_l_c,
+					 SUIT_REP_POLICY_RECORD_SUCCESS);
+	suit_command_t second = condition(SUIT_Condition_suit_condition_image_match_m_l_c,
+					  SUIT_REP_POLICY_RECORD_SUCCESS | SUIT_REP_POLICY_SYSINFO_SUCCESS);
+
+	suit_report_record(&first, SUIT_SUCCESS, &params);
+
+	/* The system information is reported immediately, after the buffered records. */
+	expect_report(SUIT_REP_POLICY_RECORD_SUCCESS);
+	expect_report(SUIT_REP_POLICY_RECORD_SUCCESS | SUIT_REP_POLICY_SYSINFO_SUCCESS);
+	suit_report_record(&second, SUIT_SUCCESS, &params);
+
+	TEST_ASSERT_EQUAL(2, reports_count);
+	TEST_ASSERT_EQUAL(SUIT_Condition_suit_condition_vendor_identifier_m_l_c, reports[0].command);
+	TEST_ASSERT_EQUAL(0, reports[0].nargs);
+	TEST_ASSERT_EQUAL(SUIT_Condition_suit_condition_image_match_m_l_c, reports[1].command);
+	TEST_ASSERT_EQUAL(2, reports[1].nargs);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_report_flush());
+}
+
+void test_record_buffer_full(void)
+{
+	suit_command_t command = directive(SUIT_Directive_suit_directive_copy_m_l_c,
+					   SUIT_REP_POLICY_RECORD_SUCCESS);
+
+	for (size_t i = 0; i < SUIT_MAX_NUM_REPORT_RECORDS; i++) {
+		suit_report_record(&command, SUIT_SUCCESS, &params);
+	}
+
+	/* The full buffer is flushed before the next record is stored. */
+	for (size_t i = 0; i < SUIT_MAX_NUM_REPORT_RECORDS; i++) {
+		expect_report(SUIT_REP_POLICY_RECORD_SUCCESS);
+	}
+	suit_report_record(&command, SUIT_SUCCESS, &params);
+	TEST_ASSERT_EQUAL(SUIT_MAX_NUM_REPORT_RECORDS, reports_count);
+
+	expect_report(SUIT_REP_POLICY_RECORD_SUCCESS);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_report_flush());
+	TEST_ASSERT_EQUAL(SUIT_MAX_NUM_REPORT_RECORDS + 1, reports_count);
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -104,12 +104,15 @@ void test_seq_execution_process_dependency_seq_completion_failed(void);
 void test_seq_execution_process_dependency_corrupted_component_stack(void);
 void test_seq_execution_process_dependency_lazy_component_release(void);
 void test_seq_execution_process_dependency_valid_dependency(void);
+void test_seq_execution_process_dependency_pinned_manifest(void);
 
 /* suit-directive-override-parameters tests */
 void test_seq_execution_override_parameter_single_component_5params(void);
 void test_seq_execution_override_parameter_single_component_6params(void);
 void test_seq_execution_override_parameter_single_component_7params(void);
 void test_seq_execution_override_parameter_multiple_components_4params(void);
+void test_seq_execution_override_parameter_invalid_digest(void);
+void test_seq_execution_override_parameter_invalid_version(void);
 void test_seq_execution_override_parameter_soft_failure(void);
 void test_seq_execution_override_parameter_soft_failure_nested(void);
 
@@ -128,6 +131,8 @@ void test_seq_execution_set_parameter_lazy_platform_image_size_set(void);
 void test_seq_execution_fetch_no_uri(void);
 void test_seq_execution_fetch_external_uri(void);
 void test_seq_execution_fetch_internal_uri(void);
+void test_seq_execution_fetch_compressed(void);
+void test_seq_execution_fetch_compressed_unsupported_alg(void);
 
 /* suit-directive-copy tests */
 void test_seq_execution_copy_no_src(void);
@@ -140,7 +145,19 @@ void test_seq_execution_write_no_content(void);
 void test_seq_execution_write_content(void);
 
 /* suit-directive-swap tests */
-void test_seq_execution_swap(void);
+void test_seq_execution_swap_no_src(void);
+void test_seq_execution_swap_src_invalid(void);
+void test_seq_execution_swap_ok(void);
+void test_seq_execution_swap_resumed(void);
+
+/* suit-directive-custom-apply-delta tests */
+void test_seq_execution_apply_delta_no_params(void);
+void test_seq_execution_apply_delta_in_place(void);
+void test_seq_execution_apply_delta_ok(void);
+void test_seq_execution_apply_delta_invalid_base(void);
+void test_seq_execution_apply_delta_invalid_base_digest(void);
+void test_seq_execution_apply_delta_invalid_result(void);
+void test_seq_execution_apply_delta_resumed(void);
 
 /* suit-directive-invoke tests */
 void test_seq_execution_invoke_no_args(void);
@@ -157,6 +174,7 @@ void test_fetch_null_args(void);
 void test_copy_null_args(void);
 void test_write_null_args(void);
 void test_swap_null_args(void);
+void test_apply_delta_null_args(void);
 void test_invoke_null_args(void);
 
 
@@ -74,7 +74,7 @@ static uint8_t unsupported_envelope[] = {
 			0x04, /* suit-shared-sequence */
 			0x43, /* bytes(3) */
 			0x82, /* list (2 elements - 1 command) */
-				0x1f, /* uint(suit-directive-swap) */
+				0x21, /* uint(suit-directive-unlink) */
 				0x00, /* uint(SUIT_Rep_Policy::None) */
 };
 
@@ -345,7 +345,11 @@ void test_seq_execution_condition_dependency_integrity_corrupted_component_stack
 	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_ERR_UNSUPPORTED_COMPONENT_ID);
 
 	bootstrap_envelope_empty(&state);
-	bootstrap_envelope_dependency_components(&state, 1);
+	bootstrap_envelope_dependency_components(&state, 2);
+	/* Fill the pool, so the checked manifest is released instead of being pinned. */
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(state.pinned_owners); i++) {
+		state.pinned_owners[i] = &state.components[1];
+	}
 
 	int retval = execute_command_sequence(&state, &seq);
 
@@ -356,7 +360,9 @@ void test_seq_execution_condition_dependency_integrity_corrupted_component_stack
 void test_seq_execution_condition_dependency_integrity_lazy_component_release(void)
 {
 	uint8_t seq_cmd[] = {
-		0x82, /* list (2 elements - 1 command) */
+		0x84, /* list (4 elements - 2 commands) */
+			0x07, /* uint(suit-condition-dependency-integrity) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
 			0x07, /* uint(suit-condition-dependency-integrity) */
 			0x00, /* uint(SUIT_Rep_Policy::None) */
 	};
@@ -384,6 +390,7 @@ void test_seq_execution_condition_dependency_integrity_lazy_component_release(vo
 	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
 	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&exp_component_id_handle);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &unknown_manifest_component_id, 0x10, SUIT_SUCCESS);
+	/* The second check releases the manifest, pinned by the first one. */
 	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_ERR_AGAIN);
 
 	bootstrap_envelope_empty(&state);
@@ -426,7 +433,6 @@ void test_seq_execution_condition_dependency_integrity_valid_dependency(void)
 	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
 	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&exp_component_id_handle);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &unknown_manifest_component_id, 0x10, SUIT_SUCCESS);
-	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_SUCCESS);
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_dependency_components(&state, 1);
@@ -435,6 +441,17 @@ void test_seq_execution_condition_dependency_integrity_valid_dependency(void)
 
 	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
 	TEST_ASSERT_EQUAL(true, state.components[0].integrity_checked);
+
+	/* The checked manifest is kept loaded until the dependency is processed. */
+	TEST_ASSERT_EQUAL(1, state.manifest_stack_height);
+	TEST_ASSERT_EQUAL_PTR(&state.components[0], state.pinned_owners[0]);
+
+	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_SUCCESS);
+
+	retval = suit_processor_release_pinned_manifests(&state, NULL);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_NULL(state.pinned_owners[0]);
 }
 
 void test_seq_execution_condition_dependency_integrity_integrity_lost_fetch(void)
@@ -477,14 +494,13 @@ void test_seq_execution_condition_dependency_integrity_integrity_lost_fetch(void
 	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
 	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&exp_component_id_handle);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &unknown_manifest_component_id, 0x10, SUIT_SUCCESS);
-	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_SUCCESS);
 
 	struct zcbor_string exp_uri = {
 		.value = "http://example.com/app.bin",
 		.len = strlen("http://example.com/app.bin"),
 	};
 
-	__cmock_suit_plat_fetch_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_uri, &unknown_manifest_component_id,  NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_uri, &unknown_manifest_component_id,  NULL, NULL, SUIT_SUCCESS);
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_dependency_components(&state, 1);
@@ -535,7 +551,6 @@ void test_seq_execution_condition_dependency_integrity_integrity_lost_fetch_inte
 	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
 	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&exp_component_id_handle);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &unknown_manifest_component_id, 0x10, SUIT_SUCCESS);
-	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_SUCCESS);
 
 	struct zcbor_string exp_uri = {
 		.value = "http://example.com/app.bin",
@@ -545,15 +560,16 @@ void test_seq_execution_condition_dependency_integrity_integrity_lost_fetch_inte
 		.value = "My application",
 		.len = sizeof("My application"),
 	};
+	uint8_t envelope_buf[128];
 
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_payload, &unknown_manifest_component_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_payload, &unknown_manifest_component_id, NULL, NULL, SUIT_SUCCESS);
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_dependency_components(&state, 1);
 
-	state.manifest_stack[0].integrated_payloads_count = 1;
-	state.manifest_stack[0].integrated_payloads[0].key = exp_uri;
-	state.manifest_stack[0].integrated_payloads[0].payload = exp_payload;
+	int ret = bootstrap_envelope_integrated_payload(&state, envelope_buf, sizeof(envelope_buf),
+						       &seq, &exp_uri, &exp_payload);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, ret);
 
 	int retval = execute_command_sequence(&state, &seq);
 
@@ -600,10 +616,9 @@ void test_seq_execution_condition_dependency_integrity_integrity_lost_copy(void)
 	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
 	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&exp_component_id_handle);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &unknown_manifest_component_id, 0x10, SUIT_SUCCESS);
-	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_SUCCESS);
 
 	uint32_t exp_src_handle = ASSIGNED_COMPONENT_HANDLE + 1;
-	__cmock_suit_plat_copy_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_src_handle, &unknown_manifest_component_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_copy_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_src_handle, &unknown_manifest_component_id, NULL, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_copy_IgnoreArg_manifest_component_id();
 
 	bootstrap_envelope_empty(&state);
@@ -653,13 +668,12 @@ void test_seq_execution_condition_dependency_integrity_integrity_lost_write(void
 	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
 	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&exp_component_id_handle);
 	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &unknown_manifest_component_id, 0x10, SUIT_SUCCESS);
-	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_SUCCESS);
 
 	struct zcbor_string exp_content = {
 		.value = "test_data",
 		.len = strlen("test_data"),
 	};
-	__cmock_suit_plat_write_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_content, &unknown_manifest_component_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_write_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_content, &unknown_manifest_component_id, NULL, NULL, SUIT_SUCCESS);
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_dependency_components(&state, 1);
@@ -74,7 +74,7 @@ static uint8_t unsupported_envelope[] = {
 			0x04, /* suit-shared-sequence */
 			0x43, /* bytes(3) */
 			0x82, /* list (2 elements - 1 command) */
-				0x1f, /* uint(suit-directive-swap) */
+				0x21, /* uint(suit-directive-unlink) */
 				0x00, /* uint(SUIT_Rep_Policy::None) */
 };
 
@@ -670,3 +670,57 @@ void test_seq_execution_process_dependency_valid_dependency(void)
 
 	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
 }
+
+void test_seq_execution_process_dependency_pinned_manifest(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x07, /* uint(suit-condition-dependency-integrity) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x0b, /* uint(suit-directive-process-dependency) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	/* The manifest is retrieved and authenticated only once - by the integrity check. */
+	__cmock_suit_plat_retrieve_manifest_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, NULL, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_retrieve_manifest_IgnoreArg_envelope_str();
+	__cmock_suit_plat_retrieve_manifest_ReturnThruPtr_envelope_str(&exp_valid_envelope.value);
+	__cmock_suit_plat_retrieve_manifest_IgnoreArg_envelope_len();
+	__cmock_suit_plat_retrieve_manifest_ReturnThruPtr_envelope_len(&exp_valid_envelope.len);
+
+	__cmock_suit_plat_check_digest_ExpectComplexArgsAndReturn(
+		suit_cose_sha256,
+		&exp_envelope_digest,
+		&exp_valid_manifest,
+		SUIT_SUCCESS);
+
+	__cmock_suit_plat_authorize_unsigned_manifest_ExpectAndReturn(NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_authorize_unsigned_manifest_IgnoreArg_manifest_component_id();
+	__cmock_suit_plat_authorize_component_id_ExpectComplexArgsAndReturn(&unknown_manifest_component_id, &exp_component_id, SUIT_SUCCESS);
+	__cmock_suit_plat_create_component_handle_ExpectComplexArgsAndReturn(&exp_component_id, false, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_create_component_handle_IgnoreArg_handle();
+	__cmock_suit_plat_create_component_handle_ReturnThruPtr_handle(&exp_component_id_handle);
+	__cmock_suit_plat_authorize_sequence_num_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &unknown_manifest_component_id, 0x10, SUIT_SUCCESS);
+	__cmock_suit_plat_authorize_process_dependency_ExpectComplexArgsAndReturn(&exp_root_component_id, &unknown_manifest_component_id, SUIT_SEQ_PAYLOAD_FETCH, SUIT_SUCCESS);
+
+	__cmock_suit_plat_check_vid_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_vid, SUIT_SUCCESS);
+	__cmock_suit_plat_sequence_completed_ExpectComplexArgsAndReturn(SUIT_SEQ_PAYLOAD_FETCH, &unknown_manifest_component_id, exp_valid_envelope.value, exp_valid_envelope.len, SUIT_SUCCESS);
+
+	__cmock_suit_plat_release_component_handle_ExpectAndReturn(exp_component_id_handle, SUIT_SUCCESS);
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_dependency_components(&state, 1);
+	state.manifest_stack[0].manifest_component_id = exp_root_component_id;
+
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+	TEST_ASSERT_EQUAL(1, state.manifest_stack_height);
+	for (size_t i = 0; i < ZCBOR_ARRAY_SIZE(state.pinned_owners); i++) {
+		TEST_ASSERT_NULL(state.pinned_owners[i]);
+	}
+}
@@ -26,6 +26,22 @@ void assert_zcbor_string(void *p1, void *p2)
 	}
 }
 
+void assert_compression_info(void *p1, void *p2)
+{
+	struct suit_compression_info *a = (struct suit_compression_info *)p1;
+	struct suit_compression_info *b = (struct suit_compression_info *)p2;
+
+	/* Do not assert if both pointers are set to NULL */
+	if ((a != NULL) || (b != NULL)) {
+		TEST_ASSERT_NOT_NULL_MESSAGE((a), "Expected compression info pointer was NULL");
+		TEST_ASSERT_NOT_NULL_MESSAGE((b), "Compression info pointer was NULL");
+
+		TEST_ASSERT_EQUAL_MESSAGE((a)->compression_alg_id, (b)->compression_alg_id, "Compression algorithm does not match");
+		TEST_ASSERT_EQUAL_MESSAGE((a)->arm_thumb_filter, (b)->arm_thumb_filter, "ARM Thumb filter flag does not match");
+		TEST_ASSERT_EQUAL_MESSAGE((a)->decompressed_image_size, (b)->decompressed_image_size, "Decompressed image size does not match");
+	}
+}
+
 COMPLEX_ARG_Q_DEFINE(__check_digest_callback_queue);
 int __check_digest_callback(enum suit_cose_alg alg_id, struct zcbor_string *digest, struct zcbor_string *payload, int cmock_num_calls)
 {
@@ -102,7 +118,7 @@ int __authorize_component_id_callback(struct zcbor_string *manifest_component_id
 }
 
 COMPLEX_ARG_Q_DEFINE(__check_fetch_callback_queue);
-int __check_fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls)
+int __check_fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls)
 {
 	(void)assert_complex_arg(&__check_fetch_callback_queue, uri);
 	(void)assert_complex_arg(&__check_fetch_callback_queue, manifest_component_id);
@@ -110,15 +126,16 @@ int __check_fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri
 }
 
 COMPLEX_ARG_Q_DEFINE(__fetch_callback_queue);
-int __fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls)
+int __fetch_callback(suit_component_t dst_handle, struct zcbor_string *uri, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls)
 {
 	(void)assert_complex_arg(&__fetch_callback_queue, uri);
 	(void)assert_complex_arg(&__fetch_callback_queue, manifest_component_id);
+	(void)assert_complex_arg(&__fetch_callback_queue, comp_info);
 	return assert_complex_arg(&__fetch_callback_queue, NULL);
 }
 
 COMPLEX_ARG_Q_DEFINE(__check_fetch_integrated_callback_queue);
-int __check_fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string *payload, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls)
+int __check_fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string *payload, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls)
 {
 	(void)assert_complex_arg(&__check_fetch_integrated_callback_queue, payload);
 	(void)assert_complex_arg(&__check_fetch_integrated_callback_queue, manifest_component_id);
@@ -126,7 +143,7 @@ int __check_fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_
 }
 
 COMPLEX_ARG_Q_DEFINE(__fetch_integrated_callback_queue);
-int __fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string *payload, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls)
+int __fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string *payload, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls)
 {
 	(void)assert_complex_arg(&__fetch_integrated_callback_queue, payload);
 	(void)assert_complex_arg(&__fetch_integrated_callback_queue, manifest_component_id);
@@ -134,14 +151,14 @@ int __fetch_integrated_callback(suit_component_t dst_handle, struct zcbor_string
 }
 
 COMPLEX_ARG_Q_DEFINE(__check_copy_callback_queue);
-int __check_copy_callback(suit_component_t dst_handle, suit_component_t src_handle, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls)
+int __check_copy_callback(suit_component_t dst_handle, suit_component_t src_handle, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls)
 {
 	(void)assert_complex_arg(&__check_copy_callback_queue, manifest_component_id);
 	return assert_complex_arg(&__check_copy_callback_queue, NULL);
 }
 
 COMPLEX_ARG_Q_DEFINE(__copy_callback_queue);
-int __copy_callback(suit_component_t dst_handle, suit_component_t src_handle, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls)
+int __copy_callback(suit_component_t dst_handle, suit_component_t src_handle, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls)
 {
 	(void)assert_complex_arg(&__copy_callback_queue, manifest_component_id);
 	return assert_complex_arg(&__copy_callback_queue, NULL);
@@ -155,7 +172,7 @@ int __sequence_completed_callback(enum suit_command_sequence seq_name, struct zc
 }
 
 COMPLEX_ARG_Q_DEFINE(__check_write_callback_queue);
-int __check_write_callback(suit_component_t dst_handle, struct zcbor_string *content, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls)
+int __check_write_callback(suit_component_t dst_handle, struct zcbor_string *content, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls)
 {
 	(void)assert_complex_arg(&__check_write_callback_queue, content);
 	(void)assert_complex_arg(&__check_write_callback_queue, manifest_component_id);
@@ -163,7 +180,7 @@ int __check_write_callback(suit_component_t dst_handle, struct zcbor_string *con
 }
 
 COMPLEX_ARG_Q_DEFINE(__write_callback_queue);
-int __write_callback(suit_component_t dst_handle, struct zcbor_string *content, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, int cmock_num_calls)
+int __write_callback(suit_component_t dst_handle, struct zcbor_string *content, struct zcbor_string *manifest_component_id, struct suit_encryption_info *enc_info, struct suit_compression_info *comp_info, int cmock_num_calls)
 {
 	(void)assert_complex_arg(&__write_callback_queue, content);
 	(void)assert_complex_arg(&__write_callback_queue, manifest_component_id);
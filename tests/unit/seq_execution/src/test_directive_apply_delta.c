@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <bootstrap_envelope.h>
+#include <suit_schedule_seq.h>
+#include "suit_platform/cmock_suit_platform.h"
+#include "suit_platform_mock_ext.h"
+
+#define BASE_DIGEST_OFFSET 16
+#define IMAGE_DIGEST_OFFSET 55
+
+extern struct suit_processor_state state;
+
+static struct zcbor_string unknown_manifest_component_id = {
+	.value = NULL,
+	.len = 0,
+};
+
+static uint8_t apply_delta_cmd[] = {
+	0x86, /* list (6 elements - 3 commands) */
+		0x0c, /* uint(suit-directive-set-component-index) */
+		0x00, /* uint(0) */
+		0x14, /* uint(suit-directive-override-parameters) */
+		0xa4, /* map (4) */
+			0x16, /* uint(suit-parameter-source-component) */
+			0x01, /* uint (1) */
+			0x2c, /* int(suit-parameter-custom-patch-component) */
+			0x02, /* uint (2) */
+			0x2b, /* int(suit-parameter-custom-base-digest) */
+			0x58, 0x24, /* bytes(36) */
+			0x82, /* array (2 elements) */
+				0x2f, /* suit-digest-algorithm-id: cose-alg-sha-256 */
+				0x58, 0x20, /* suit-digest-bytes: bytes(32) */
+					0x5c, 0x09, 0x7e, 0xf6, 0x4b, 0xf3, 0xbb, 0x9b,
+					0x49, 0x4e, 0x71, 0xe1, 0xf2, 0x41, 0x8e, 0xef,
+					0x8d, 0x46, 0x6c, 0xc9, 0x02, 0xf6, 0x39, 0xa8,
+					0x55, 0xec, 0x9a, 0xf3, 0xe9, 0xed, 0xdb, 0x99,
+			0x03, /* uint(suit-parameter-image-digest) */
+			0x58, 0x24, /* bytes(36) */
+			0x82, /* array (2 elements) */
+				0x2f, /* suit-digest-algorithm-id: cose-alg-sha-256 */
+				0x58, 0x20, /* suit-digest-bytes: bytes(32) */
+					0xe4, 0x34, 0x4d, 0x65, 0x08, 0x4e, 0x2e, 0x2b,
+					0x62, 0x95, 0x6b, 0xb1, 0x3c, 0x8d, 0x8b, 0x7f,
+					0x0a, 0x22, 0xd4, 0x45, 0x54, 0x3a, 0x9a, 0x34,
+					0x2d, 0x05, 0x49, 0x8c, 0x3a, 0xb4, 0x1b, 0x39,
+		0x2a, /* int(suit-directive-custom-apply-delta) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
+
+static struct zcbor_string exp_base_digest = {
+	.value = &apply_delta_cmd[BASE_DIGEST_OFFSET],
+	.len = 32,
+};
+
+static struct zcbor_string exp_image_digest = {
+	.value = &apply_delta_cmd[IMAGE_DIGEST_OFFSET],
+	.len = 32,
+};
+
+static struct zcbor_string apply_delta_seq = {
+	.value = apply_delta_cmd,
+	.len = sizeof(apply_delta_cmd),
+};
+
+static const uint32_t exp_base_handle = ASSIGNED_COMPONENT_HANDLE + 1;
+static const uint32_t exp_patch_handle = ASSIGNED_COMPONENT_HANDLE + 2;
+
+static int execute_command_sequence(struct suit_processor_state *state, struct zcbor_string *cmd_seq_str)
+{
+	enum suit_command_sequence seq = SUIT_SEQ_INSTALL;
+	struct suit_manifest_state *manifest_state = &state->manifest_stack[0];
+
+	bootstrap_envelope_sequence(state, seq, cmd_seq_str);
+
+	int ret = suit_schedule_execution(state, manifest_state, seq);
+	if (ret == SUIT_ERR_AGAIN) {
+		ret = suit_process_scheduled(state);
+	}
+
+	return ret;
+}
+
+void test_seq_execution_apply_delta_no_params(void)
+{
+	uint8_t seq_cmd[] = {
+		0x82, /* list (2 elements - 1 command) */
+			0x2a, /* int(suit-directive-custom-apply-delta) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_PARAMETER, retval);
+}
+
+void test_seq_execution_apply_delta_in_place(void)
+{
+	uint8_t seq_cmd[sizeof(apply_delta_cmd)];
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	memcpy(seq_cmd, apply_delta_cmd, sizeof(seq_cmd));
+	/* Use the destination component as the base image. */
+	seq_cmd[6] = 0x00;
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 3);
+
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_PARAMETER, retval);
+}
+
+void test_seq_execution_apply_delta_ok(void)
+{
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 3);
+
+	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(exp_base_handle, suit_cose_sha256,
+								       &exp_base_digest, SUIT_SUCCESS);
+	__cmock_suit_plat_apply_delta_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_base_handle, exp_patch_handle,
+						      &unknown_manifest_component_id, SUIT_SUCCESS);
+	__cmock_suit_plat_apply_delta_IgnoreArg_manifest_component_id();
+	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, suit_cose_sha256,
+								       &exp_image_digest, SUIT_SUCCESS);
+
+	int retval = execute_command_sequence(&state, &apply_delta_seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+}
+
+void test_seq_execution_apply_delta_invalid_base(void)
+{
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 3);
+
+	/* The patch must not be applied if the base image does not match. */
+	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(exp_base_handle, suit_cose_sha256,
+								       &exp_base_digest, SUIT_FAIL_CONDITION);
+
+	int retval = execute_command_sequence(&state, &apply_delta_seq);
+
+	TEST_ASSERT_EQUAL(SUIT_FAIL_CONDITION, retval);
+}
+
+void test_seq_execution_apply_delta_invalid_base_digest(void)
+{
+	uint8_t seq_cmd[sizeof(apply_delta_cmd)];
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	memcpy(seq_cmd, apply_delta_cmd, sizeof(seq_cmd));
+	/* Use the unsupported digest algorithm: cose-alg-shake128. */
+	seq_cmd[BASE_DIGEST_OFFSET - 3] = 0x31;
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 3);
+
+	/* The base digest is rejected when the parameter is set, before the platform is called. */
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+	TEST_ASSERT_EQUAL(false, suit_param_is_set(&state.components[0], SUIT_PARAM_BASE_DIGEST));
+}
+
+void test_seq_execution_apply_delta_invalid_result(void)
+{
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 3);
+
+	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(exp_base_handle, suit_cose_sha256,
+								       &exp_base_digest, SUIT_SUCCESS);
+	__cmock_suit_plat_apply_delta_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_base_handle, exp_patch_handle,
+						      &unknown_manifest_component_id, SUIT_SUCCESS);
+	__cmock_suit_plat_apply_delta_IgnoreArg_manifest_component_id();
+	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, suit_cose_sha256,
+								       &exp_image_digest, SUIT_FAIL_CONDITION);
+
+	int retval = execute_command_sequence(&state, &apply_delta_seq);
+
+	TEST_ASSERT_EQUAL(SUIT_FAIL_CONDITION, retval);
+}
+
+void test_seq_execution_apply_delta_resumed(void)
+{
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 3);
+
+	/* The base image is verified only before the first step. */
+	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(exp_base_handle, suit_cose_sha256,
+								       &exp_base_digest, SUIT_SUCCESS);
+	for (size_t i = 0; i < 2; i++) {
+		__cmock_suit_plat_apply_delta_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_base_handle,
+							      exp_patch_handle, &unknown_manifest_component_id,
+							      SUIT_ERR_AGAIN);
+		__cmock_suit_plat_apply_delta_IgnoreArg_manifest_component_id();
+	}
+	__cmock_suit_plat_apply_delta_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_base_handle, exp_patch_handle,
+						      &unknown_manifest_component_id, SUIT_SUCCESS);
+	__cmock_suit_plat_apply_delta_IgnoreArg_manifest_component_id();
+	__cmock_suit_plat_check_image_match_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, suit_cose_sha256,
+								       &exp_image_digest, SUIT_SUCCESS);
+
+	int retval = execute_command_sequence(&state, &apply_delta_seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+}
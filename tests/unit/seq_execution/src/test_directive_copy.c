@@ -125,7 +125,7 @@ void test_seq_execution_copy_ok(void)
 	bootstrap_envelope_components(&state, 2);
 
 	__cmock_suit_plat_copy_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_src_handle,
-					       &unknown_manifest_component_id, NULL, SUIT_SUCCESS);
+					       &unknown_manifest_component_id, NULL, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_copy_IgnoreArg_manifest_component_id();
 
 	int retval = execute_command_sequence(&state, &seq);
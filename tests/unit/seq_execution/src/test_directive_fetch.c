@@ -78,7 +78,7 @@ void test_seq_execution_fetch_external_uri(void)
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_components(&state, 1);
 
-	__cmock_suit_plat_fetch_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_uri, &unknown_manifest_component_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_uri, &unknown_manifest_component_id, NULL, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_fetch_IgnoreArg_manifest_component_id();
 
 	int retval = execute_command_sequence(&state, &seq);
@@ -112,17 +112,98 @@ void test_seq_execution_fetch_internal_uri(void)
 		.value = "My application",
 		.len = sizeof("My application"),
 	};
+	uint8_t envelope_buf[128];
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_components(&state, 1);
 
-	state.manifest_stack[0].integrated_payloads_count = 1;
-	state.manifest_stack[0].integrated_payloads[0].key = exp_uri;
-	state.manifest_stack[0].integrated_payloads[0].payload = exp_payload;
+	int ret = bootstrap_envelope_integrated_payload(&state, envelope_buf, sizeof(envelope_buf),
+						       &seq, &exp_uri, &exp_payload);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, ret);
 
-	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_payload, &unknown_manifest_component_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_integrated_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_payload, &unknown_manifest_component_id, NULL, NULL, SUIT_SUCCESS);
 	__cmock_suit_plat_fetch_integrated_IgnoreArg_manifest_component_id();
 
 	int retval = execute_command_sequence(&state, &seq);
 
 	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
 }
+
+void test_seq_execution_fetch_compressed(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				0x15, /* uint(suit-parameter-uri) */
+				0x78, 0x1A, /* text (26 characters) */
+				'h', 't', 't', 'p', ':', '/', '/',
+				'e', 'x', 'a', 'm', 'p', 'l', 'e', '.', 'c', 'o', 'm',
+				'/', 'a', 'p', 'p', '.', 'b', 'i', 'n',
+				0x2a, /* int(suit-parameter-custom-compression-info) */
+				0x48, /* bytes (8) */
+					0xa3, /* map (3) */
+						0x01, /* uint(suit-compression-algorithm) */
+						0x01, /* uint(suit-lzma2) */
+						0x02, /* uint(suit-compression-arm-thumb-filter) */
+						0xf5, /* True */
+						0x03, /* uint(suit-compression-decompressed-size) */
+						0x19, 0x10, 0x00, /* uint(4096) */
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+	struct zcbor_string exp_uri = {
+		.value = "http://example.com/app.bin",
+		.len = strlen("http://example.com/app.bin"),
+	};
+	struct suit_compression_info exp_comp_info = {
+		.compression_alg_id = suit_lzma2,
+		.arm_thumb_filter = true,
+		.decompressed_image_size = 4096,
+	};
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+
+	__cmock_suit_plat_fetch_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_uri, &unknown_manifest_component_id, NULL, &exp_comp_info, SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_IgnoreArg_manifest_component_id();
+
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+}
+
+void test_seq_execution_fetch_compressed_unsupported_alg(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				0x15, /* uint(suit-parameter-uri) */
+				0x78, 0x1A, /* text (26 characters) */
+				'h', 't', 't', 'p', ':', '/', '/',
+				'e', 'x', 'a', 'm', 'p', 'l', 'e', '.', 'c', 'o', 'm',
+				'/', 'a', 'p', 'p', '.', 'b', 'i', 'n',
+				0x2a, /* int(suit-parameter-custom-compression-info) */
+				0x43, /* bytes (3) */
+					0xa1, /* map (1) */
+						0x01, /* uint(suit-compression-algorithm) */
+						0x02, /* uint(unknown algorithm) */
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+
+	/* The compression info is rejected when the parameter is set. */
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_ALG, retval);
+	TEST_ASSERT_EQUAL(false, suit_param_is_set(&state.components[0], SUIT_PARAM_COMPRESSION_INFO));
+}
@@ -63,29 +63,29 @@ void test_seq_execution_override_parameter_single_component_5params(void)
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, retval, "Failed to set parameters");
 
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].vid_set, "Vendor ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].cid_set, "Class ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].image_digest_set, "Image digest not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].component_slot_set, "Component slot not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].image_size_set, "Image size not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].uri_set, "URI not set, but flag was updated");
-
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].source_component_set, "Source component set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_URI), "URI not set, but flag was updated");
+
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT), "Source component set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_source_component, state.components[0].source_component, "Source component set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].invoke_args_set, "Invoke args set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_INVOKE_ARGS), "Invoke args set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_args.len, state.components[0].invoke_args.len, "Invoke args set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_args.value, state.components[0].invoke_args.value, exp_args.len, "Invoke args set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].did_set, "Device ID set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_DID), "Device ID set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_did.len, state.components[0].did.len, "Device ID set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_did.value, state.components[0].did.value, exp_did.len, "Device ID set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].content_set, "Content set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_CONTENT), "Content set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_content.len, state.components[0].content.len, "Content set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_content.value, state.components[0].content.value, exp_content.len, "Content set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].version_set, "Version set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_VERSION), "Version set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_version.len, state.components[0].version.len, "Version set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_version.value, state.components[0].version.value, exp_version.len, "Version set with invalid value");
 }
@@ -123,33 +123,33 @@ void test_seq_execution_override_parameter_single_component_6params(void)
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, retval, "Failed to set parameters");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].vid_set, "Vendor ID set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_VID), "Vendor ID set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_vid.len, state.components[0].vid.len, "Vendor ID set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_vid.value, state.components[0].vid.value, exp_vid.len, "Vendor ID set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].cid_set, "Class ID set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_CID), "Class ID set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_cid.len, state.components[0].cid.len, "Class ID set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_cid.value, state.components[0].cid.value, exp_cid.len, "Class ID set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].image_digest_set, "Image digest set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_DIGEST), "Image digest set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_digest.len, state.components[0].image_digest.len, "Image digest set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_digest.value, state.components[0].image_digest.value, exp_cid.len, "Image digest set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].component_slot_set, "Component slot set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_COMPONENT_SLOT), "Component slot set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_slot, state.components[0].component_slot, "Component slot set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].image_size_set, "Image size set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_image_size, state.components[0].image_size, "Image size set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].uri_set, "URI set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_URI), "URI set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_uri.len, state.components[0].uri.len, "URI set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_uri.value, state.components[0].uri.value, exp_uri.len, "URI set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].source_component_set, "Source component not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].invoke_args_set, "Invoke args not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].did_set, "Device ID set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].content_set, "Content not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].version_set, "Version not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT), "Source component not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_INVOKE_ARGS), "Invoke args not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_DID), "Device ID set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_VERSION), "Version not set, but flag was updated");
 }
 
 void test_seq_execution_override_parameter_single_component_7params(void)
@@ -184,17 +184,17 @@ void test_seq_execution_override_parameter_single_component_7params(void)
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "Failed to set parameters");
 
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].vid_set, "Vendor ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].cid_set, "Class ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].image_digest_set, "Image digest not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].component_slot_set, "Component slot not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].image_size_set, "Image size not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].content_set, "Content not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].uri_set, "URI not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].source_component_set, "Source component not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].invoke_args_set, "Invoke args not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].did_set, "Device ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].version_set, "Version not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_URI), "URI not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT), "Source component not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_INVOKE_ARGS), "Invoke args not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_DID), "Device ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_VERSION), "Version not set, but flag was updated");
 }
 
 void test_seq_execution_override_parameter_multiple_components_4params(void)
@@ -223,42 +223,110 @@ void test_seq_execution_override_parameter_multiple_components_4params(void)
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_components(&state, 4);
-	state.components[0].source_component_set = true;
-	state.components[1].invoke_args_set = true;
-	state.components[2].did_set = true;
-	state.components[3].encryption_info_set = true;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT, true);
+	suit_param_set_flag(&state.components[1], SUIT_PARAM_INVOKE_ARGS, true);
+	suit_param_set_flag(&state.components[2], SUIT_PARAM_DID, true);
+	suit_param_set_flag(&state.components[3], SUIT_PARAM_ENCRYPTION_INFO, true);
 
 	int retval = execute_command_sequence(&state, &seq);
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, retval, "Failed to set parameters");
 
 	for (size_t i = 0; i < 4; i++) {
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].vid_set, "Vendor ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].cid_set, "Class ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_digest_set, "Image digest not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].component_slot_set, "Component slot not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_size_set, "Image size not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].content_set, "Content not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].uri_set, "URI not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].version_set, "Version not set, but flag was updated");
-
-		TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].source_component_set, "Source component set, but flag is not updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_SIZE), "Image size not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_URI), "URI not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VERSION), "Version not set, but flag was updated");
+
+		TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_SOURCE_COMPONENT), "Source component set, but flag is not updated");
 		TEST_ASSERT_EQUAL_MESSAGE(exp_source_component, state.components[i].source_component, "Source component set with invalid value");
 
-		TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].invoke_args_set, "Invoke args set, but flag is not updated");
+		TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_INVOKE_ARGS), "Invoke args set, but flag is not updated");
 		TEST_ASSERT_EQUAL_MESSAGE(exp_args.len, state.components[i].invoke_args.len, "Invoke args set with invalid length");
 		TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_args.value, state.components[i].invoke_args.value, exp_args.len, "Invoke args set with invalid value");
 
-		TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].did_set, "Device ID set, but flag is not updated");
+		TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_DID), "Device ID set, but flag is not updated");
 		TEST_ASSERT_EQUAL_MESSAGE(exp_did.len, state.components[i].did.len, "Device ID set with invalid length");
 		TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_did.value, state.components[i].did.value, exp_did.len, "Device ID set with invalid value");
 
-		TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].encryption_info_set, "Encryption info set, but flag is not updated");
+		TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info set, but flag is not updated");
 		TEST_ASSERT_EQUAL_MESSAGE(exp_encryption_info.len, state.components[i].encryption_info.len, "Encryption info set with invalid length");
 		TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_encryption_info.value, state.components[i].encryption_info.value, exp_encryption_info.len, "Encryption info set with invalid value");
 	}
 }
 
+void test_seq_execution_override_parameter_invalid_digest(void)
+{
+	uint8_t seq_cmd[] = {
+		0x82, /* list (2 elements - 1 command) */
+		0x14, /* uint(suit-directive-override-parameters) */
+		0xa1, /* map (1 element) */
+			0x03, /* uint(suit-parameter-image-digest) */
+			0x58, 0x26, /* bytes(38) */
+			0x82, /* array (2 elements) */
+				0x2f, /* suit-digest-algorithm-id: cose-alg-sha-256 */
+				0x58, 0x20, /* suit-digest-bytes: bytes(32) */
+				0x66, 0x58, 0xea, 0x56, 0x02, 0x62, 0x69, 0x6d,
+				0xd1, 0xf1, 0x3b, 0x78, 0x22, 0x39, 0xa0, 0x64,
+				0xda, 0x7c, 0x6c, 0x5c, 0xba, 0xf5, 0x2f, 0xde,
+				0xd4, 0x28, 0xa6, 0xfc, 0x83, 0xc7, 0xe5, 0xaf,
+				0xff, 0xff,
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "The malformed digest should be rejected when the parameter is set");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+}
+
+void test_seq_execution_override_parameter_invalid_version(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+		0x14, /* uint(suit-directive-override-parameters) */
+		0xa1, /* map (1 element) */
+			0x18, 0x1c, /* uint(suit-parameter-version) */
+			0x44, /* bytes (4) */
+				0x82, /* list(2) */
+				0x01, /* suit-condition-version-comparison-greater */
+				0x81, 0x01, /* v1.*.* */
+		0x14, /* uint(suit-directive-override-parameters) */
+		0xa1, /* map (1 element) */
+			0x18, 0x1c, /* uint(suit-parameter-version) */
+			0x49, /* bytes (9) */
+				0x82, /* list(2) */
+				0x02, /* suit-condition-version-comparison-greater-equal */
+				0x86, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, /* too many elements */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+
+	int retval = execute_command_sequence(&state, &seq);
+
+	/* The invalid value does not overwrite the previously decoded one. */
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "The malformed version should be rejected when the parameter is set");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_VERSION), "Version set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(1, state.components[0].decoded.version.count, "Decoded version overwritten by the invalid value");
+	TEST_ASSERT_EQUAL_MESSAGE(1, state.components[0].decoded.version.value[0], "Decoded version overwritten by the invalid value");
+	TEST_ASSERT_EQUAL_MESSAGE(1, state.components[0].decoded.version_comparison, "Version comparison overwritten by the invalid value");
+}
+
 void test_seq_execution_override_parameter_soft_failure(void)
 {
 	uint8_t seq_cmd[] = {
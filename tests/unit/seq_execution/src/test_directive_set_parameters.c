@@ -63,30 +63,30 @@ void test_seq_execution_set_parameter_single_component_5params(void)
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, retval, "Failed to set parameters");
 
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].vid_set, "Vendor ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].cid_set, "Class ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].image_digest_set, "Image digest not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].component_slot_set, "Component slot not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].image_size_set, "Image size not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].uri_set, "URI not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].encryption_info_set, "Encryption info not set, but flag was updated");
-
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].source_component_set, "Source component set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_URI), "URI not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info not set, but flag was updated");
+
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT), "Source component set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_source_component, state.components[0].source_component, "Source component set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].invoke_args_set, "Invoke args set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_INVOKE_ARGS), "Invoke args set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_args.len, state.components[0].invoke_args.len, "Invoke args set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_args.value, state.components[0].invoke_args.value, exp_args.len, "Invoke args set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].did_set, "Device ID set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_DID), "Device ID set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_did.len, state.components[0].did.len, "Device ID set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_did.value, state.components[0].did.value, exp_did.len, "Device ID set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].content_set, "Content set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_CONTENT), "Content set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_content.len, state.components[0].content.len, "Content set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_content.value, state.components[0].content.value, exp_content.len, "Content set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].version_set, "Version set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_VERSION), "Version set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_version.len, state.components[0].version.len, "Version set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_version.value, state.components[0].version.value, exp_version.len, "Version set with invalid value");
 }
@@ -124,34 +124,34 @@ void test_seq_execution_set_parameter_single_component_6params(void)
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, retval, "Failed to set parameters");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].vid_set, "Vendor ID set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_VID), "Vendor ID set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_vid.len, state.components[0].vid.len, "Vendor ID set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_vid.value, state.components[0].vid.value, exp_vid.len, "Vendor ID set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].cid_set, "Class ID set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_CID), "Class ID set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_cid.len, state.components[0].cid.len, "Class ID set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_cid.value, state.components[0].cid.value, exp_cid.len, "Class ID set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].image_digest_set, "Image digest set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_DIGEST), "Image digest set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_digest.len, state.components[0].image_digest.len, "Image digest set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_digest.value, state.components[0].image_digest.value, exp_cid.len, "Image digest set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].component_slot_set, "Component slot set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_COMPONENT_SLOT), "Component slot set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_slot, state.components[0].component_slot, "Component slot set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].image_size_set, "Image size set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_image_size, state.components[0].image_size, "Image size set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].uri_set, "URI set, but flag is not updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_URI), "URI set, but flag is not updated");
 	TEST_ASSERT_EQUAL_MESSAGE(exp_uri.len, state.components[0].uri.len, "URI set with invalid length");
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_uri.value, state.components[0].uri.value, exp_uri.len, "URI set with invalid value");
 
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].source_component_set, "Source component not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].invoke_args_set, "Invoke args not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].did_set, "Device ID set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].content_set, "Content not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].version_set, "Version not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].encryption_info_set, "Encryption info not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT), "Source component not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_INVOKE_ARGS), "Invoke args not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_DID), "Device ID set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_VERSION), "Version not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info not set, but flag was updated");
 }
 
 void test_seq_execution_set_parameter_single_component_7params(void)
@@ -186,18 +186,18 @@ void test_seq_execution_set_parameter_single_component_7params(void)
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "Failed to set parameters");
 
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].vid_set, "Vendor ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].cid_set, "Class ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].image_digest_set, "Image digest not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].component_slot_set, "Component slot not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].image_size_set, "Image size not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].content_set, "Content not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].uri_set, "URI not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].source_component_set, "Source component not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].invoke_args_set, "Invoke args not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].did_set, "Device ID not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].version_set, "Version not set, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[0].encryption_info_set, "Encryption info not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_URI), "URI not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT), "Source component not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_INVOKE_ARGS), "Invoke args not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_DID), "Device ID not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_VERSION), "Version not set, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[0], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info not set, but flag was updated");
 }
 
 void test_seq_execution_set_parameter_multiple_components_4params(void)
@@ -226,33 +226,33 @@ void test_seq_execution_set_parameter_multiple_components_4params(void)
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_components(&state, 4);
-	state.components[0].source_component_set = true;
-	state.components[1].invoke_args_set = true;
-	state.components[2].did_set = true;
-	state.components[2].version_set = true;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT, true);
+	suit_param_set_flag(&state.components[1], SUIT_PARAM_INVOKE_ARGS, true);
+	suit_param_set_flag(&state.components[2], SUIT_PARAM_DID, true);
+	suit_param_set_flag(&state.components[2], SUIT_PARAM_VERSION, true);
 
 	int retval = execute_command_sequence(&state, &seq);
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, retval, "Failed to set parameters");
 
 	for (size_t i = 0; i < 4; i++) {
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].vid_set, "Vendor ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].cid_set, "Class ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_digest_set, "Image digest not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].component_slot_set, "Component slot not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_size_set, "Image size not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].content_set, "Content not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].uri_set, "URI not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].encryption_info_set, "Encryption info not set, but flag was updated");
-
-		TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].source_component_set, "Source component set, but flag is not updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_SIZE), "Image size not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_URI), "URI not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info not set, but flag was updated");
+
+		TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_SOURCE_COMPONENT), "Source component set, but flag is not updated");
 		if (i != 0) {
 			TEST_ASSERT_EQUAL_MESSAGE(exp_source_component, state.components[i].source_component, "Source component set with invalid value");
 		} else {
 			TEST_ASSERT_EQUAL_MESSAGE(0, state.components[i].source_component, "Source component overwritten, but was set before sequence execution");
 		}
 
-		TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].invoke_args_set, "Invoke args set, but flag is not updated");
+		TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_INVOKE_ARGS), "Invoke args set, but flag is not updated");
 		if (i != 1) {
 			TEST_ASSERT_EQUAL_MESSAGE(exp_args.len, state.components[i].invoke_args.len, "Invoke args set with invalid length");
 			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_args.value, state.components[i].invoke_args.value, exp_args.len, "Invoke args set with invalid value");
@@ -261,7 +261,7 @@ void test_seq_execution_set_parameter_multiple_components_4params(void)
 			TEST_ASSERT_NULL_MESSAGE(state.components[i].invoke_args.value, "Invoke args value overwritten, but was set before sequence execution");
 		}
 
-		TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].did_set, "Device ID set, but flag is not updated");
+		TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_DID), "Device ID set, but flag is not updated");
 		if (i != 2) {
 			TEST_ASSERT_EQUAL_MESSAGE(exp_did.len, state.components[i].did.len, "Device ID set with invalid length");
 			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_did.value, state.components[i].did.value, exp_did.len, "Device ID set with invalid value");
@@ -270,7 +270,7 @@ void test_seq_execution_set_parameter_multiple_components_4params(void)
 			TEST_ASSERT_NULL_MESSAGE(state.components[i].did.value, "Device ID value overwritten, but was set before sequence execution");
 		}
 
-		TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].version_set, "Version set, but flag is not updated");
+		TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_VERSION), "Version set, but flag is not updated");
 		if (i != 2) {
 			TEST_ASSERT_EQUAL_MESSAGE(exp_version.len, state.components[i].version.len, "Version set with invalid length");
 			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_version.value, state.components[i].version.value, exp_version.len, "Version set with invalid value");
@@ -309,69 +309,69 @@ void test_seq_execution_set_parameter_two_components_4params(void)
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_components(&state, 4);
-	state.components[0].source_component_set = true;
-	state.components[1].invoke_args_set = true;
-	state.components[2].did_set = true;
-	state.components[2].version_set = true;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_SOURCE_COMPONENT, true);
+	suit_param_set_flag(&state.components[1], SUIT_PARAM_INVOKE_ARGS, true);
+	suit_param_set_flag(&state.components[2], SUIT_PARAM_DID, true);
+	suit_param_set_flag(&state.components[2], SUIT_PARAM_VERSION, true);
 
 	int retval = execute_command_sequence(&state, &seq);
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, retval, "Failed to set parameters");
 
 	for (size_t i = 0; i < 4; i++) {
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].vid_set, "Vendor ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].cid_set, "Class ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_digest_set, "Image digest not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].component_slot_set, "Component slot not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_size_set, "Image size not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].content_set, "Content not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].uri_set, "URI not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].encryption_info_set, "Encryption info not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_SIZE), "Image size not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_URI), "URI not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info not set, but flag was updated");
 
 		if (i == 3) {
-			TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].source_component_set, "Source component set for unselected component");
+			TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_SOURCE_COMPONENT), "Source component set for unselected component");
 		} else if (i == 0) {
-			TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].source_component_set, "Source component set, but flag is not updated");
+			TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_SOURCE_COMPONENT), "Source component set, but flag is not updated");
 			TEST_ASSERT_EQUAL_MESSAGE(0, state.components[i].source_component, "Source component overwritten, but was set before sequence execution");
 		} else {
-			TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].source_component_set, "Source component set, but flag is not updated");
+			TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_SOURCE_COMPONENT), "Source component set, but flag is not updated");
 			TEST_ASSERT_EQUAL_MESSAGE(exp_source_component, state.components[i].source_component, "Source component set with invalid value");
 		}
 
 		if (i == 1) {
-			TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].invoke_args_set, "Invoke args set, but flag is not updated");
+			TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_INVOKE_ARGS), "Invoke args set, but flag is not updated");
 			TEST_ASSERT_EQUAL_MESSAGE(0, state.components[i].invoke_args.len, "Invoke args length overwritten, but was set before sequence execution");
 			TEST_ASSERT_NULL_MESSAGE(state.components[i].invoke_args.value, "Invoke args value overwritten, but was set before sequence execution");
 		} else if (i == 2) {
-			TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].invoke_args_set, "Invoke args set, but flag is not updated");
+			TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_INVOKE_ARGS), "Invoke args set, but flag is not updated");
 			TEST_ASSERT_EQUAL_MESSAGE(exp_args.len, state.components[i].invoke_args.len, "Invoke args set with invalid length");
 			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_args.value, state.components[i].invoke_args.value, exp_args.len, "Invoke args set with invalid value");
 		} else {
-			TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].invoke_args_set, "Invoke args set for unselected component");
+			TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_INVOKE_ARGS), "Invoke args set for unselected component");
 		}
 
 		if (i == 2) {
-			TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].did_set, "Device ID set, but flag is not updated");
+			TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_DID), "Device ID set, but flag is not updated");
 			TEST_ASSERT_EQUAL_MESSAGE(0, state.components[i].did.len, "Device ID length overwritten, but was set before sequence execution");
 			TEST_ASSERT_NULL_MESSAGE(state.components[i].did.value, "Device ID value overwritten, but was set before sequence execution");
 		} else if (i == 1) {
-			TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].did_set, "Device ID set, but flag is not updated");
+			TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_DID), "Device ID set, but flag is not updated");
 			TEST_ASSERT_EQUAL_MESSAGE(exp_did.len, state.components[i].did.len, "Device ID set with invalid length");
 			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_did.value, state.components[i].did.value, exp_did.len, "Device ID set with invalid value");
 		} else {
-			TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].did_set, "Device ID set for unselected component");
+			TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_DID), "Device ID set for unselected component");
 		}
 
 		if (i == 2) {
-			TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].version_set, "Version set, but flag is not updated");
+			TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_VERSION), "Version set, but flag is not updated");
 			TEST_ASSERT_EQUAL_MESSAGE(0, state.components[i].version.len, "Version length overwritten, but was set before sequence execution");
 			TEST_ASSERT_NULL_MESSAGE(state.components[i].version.value, "Version value overwritten, but was set before sequence execution");
 		} else if (i == 1) {
-			TEST_ASSERT_EQUAL_MESSAGE(true, state.components[i].version_set, "Version set, but flag is not updated");
+			TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[i], SUIT_PARAM_VERSION), "Version set, but flag is not updated");
 			TEST_ASSERT_EQUAL_MESSAGE(exp_version.len, state.components[i].version.len, "Version set with invalid length");
 			TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp_version.value, state.components[i].version.value, exp_version.len, "Version set with invalid value");
 		} else {
-			TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].version_set, "Version set for unselected component");
+			TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VERSION), "Version set for unselected component");
 		}
 	}
 }
@@ -424,10 +424,10 @@ void test_seq_execution_set_parameter_multiple_components_image_size_failed(void
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_components(&state, 4);
-	state.components[0].image_size_set = true;
-	state.components[1].image_size_set = false;
-	state.components[2].image_size_set = true;
-	state.components[3].image_size_set = false;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_IMAGE_SIZE, true);
+	suit_param_set_flag(&state.components[1], SUIT_PARAM_IMAGE_SIZE, false);
+	suit_param_set_flag(&state.components[2], SUIT_PARAM_IMAGE_SIZE, true);
+	suit_param_set_flag(&state.components[3], SUIT_PARAM_IMAGE_SIZE, false);
 
 	__cmock_suit_plat_override_image_size_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE + 1, exp_image_size, &exp_manifest_id, SUIT_ERR_CRASH);
 
@@ -436,23 +436,23 @@ void test_seq_execution_set_parameter_multiple_components_image_size_failed(void
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_CRASH, retval, "Image size set failed, but processing succeeded");
 
 	for (size_t i = 0; i < 4; i++) {
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].vid_set, "Vendor ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].cid_set, "Class ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_digest_set, "Image digest not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].component_slot_set, "Component slot not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].uri_set, "URI not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].source_component_set, "Source component not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].invoke_args_set, "Invoke args not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].did_set, "Device ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].content_set, "Content not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].version_set, "Version not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].encryption_info_set, "Encryption info not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_URI), "URI not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_SOURCE_COMPONENT), "Source component not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_INVOKE_ARGS), "Invoke args not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_DID), "Device ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VERSION), "Version not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info not set, but flag was updated");
 	}
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].image_size_set, "Image size set before command execution, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[1].image_size_set, "Image size set failed, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[2].image_size_set, "Image size set before command execution, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[3].image_size_set, "Image size set failed on previous component, but the flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size set before command execution, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[1], SUIT_PARAM_IMAGE_SIZE), "Image size set failed, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[2], SUIT_PARAM_IMAGE_SIZE), "Image size set before command execution, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[3], SUIT_PARAM_IMAGE_SIZE), "Image size set failed on previous component, but the flag was updated");
 }
 
 void test_seq_execution_set_parameter_several_components_with_invalid_index(void)
@@ -480,33 +480,33 @@ void test_seq_execution_set_parameter_several_components_with_invalid_index(void
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_components(&state, 4);
-	state.components[0].image_size_set = true;
-	state.components[1].image_size_set = false;
-	state.components[2].image_size_set = true;
-	state.components[3].image_size_set = false;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_IMAGE_SIZE, true);
+	suit_param_set_flag(&state.components[1], SUIT_PARAM_IMAGE_SIZE, false);
+	suit_param_set_flag(&state.components[2], SUIT_PARAM_IMAGE_SIZE, true);
+	suit_param_set_flag(&state.components[3], SUIT_PARAM_IMAGE_SIZE, false);
 
 	int retval = execute_command_sequence(&state, &seq);
 
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_MISSING_COMPONENT, retval, "Invalid component index not detected");
 
 	for (size_t i = 0; i < 4; i++) {
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].vid_set, "Vendor ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].cid_set, "Class ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_digest_set, "Image digest not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].component_slot_set, "Component slot not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].uri_set, "URI not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].source_component_set, "Source component not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].invoke_args_set, "Invoke args not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].did_set, "Device ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].content_set, "Content not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].version_set, "Version not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].encryption_info_set, "Encryption info not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_URI), "URI not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_SOURCE_COMPONENT), "Source component not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_INVOKE_ARGS), "Invoke args not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_DID), "Device ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VERSION), "Version not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info not set, but flag was updated");
 	}
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].image_size_set, "Image size set before command execution, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[1].image_size_set, "Image size set failed, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[2].image_size_set, "Image size set before command execution, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[3].image_size_set, "Image size set failed, but the flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size set before command execution, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[1], SUIT_PARAM_IMAGE_SIZE), "Image size set failed, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[2], SUIT_PARAM_IMAGE_SIZE), "Image size set before command execution, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[3], SUIT_PARAM_IMAGE_SIZE), "Image size set failed, but the flag was updated");
 }
 
 void test_seq_execution_set_parameter_lazy_platform_image_size_set(void)
@@ -532,10 +532,10 @@ void test_seq_execution_set_parameter_lazy_platform_image_size_set(void)
 
 	bootstrap_envelope_empty(&state);
 	bootstrap_envelope_components(&state, 4);
-	state.components[0].image_size_set = true;
-	state.components[1].image_size_set = false;
-	state.components[2].image_size_set = true;
-	state.components[3].image_size_set = false;
+	suit_param_set_flag(&state.components[0], SUIT_PARAM_IMAGE_SIZE, true);
+	suit_param_set_flag(&state.components[1], SUIT_PARAM_IMAGE_SIZE, false);
+	suit_param_set_flag(&state.components[2], SUIT_PARAM_IMAGE_SIZE, true);
+	suit_param_set_flag(&state.components[3], SUIT_PARAM_IMAGE_SIZE, false);
 
 	__cmock_suit_plat_override_image_size_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE + 1, exp_image_size, &exp_manifest_id, SUIT_ERR_AGAIN);
 
@@ -544,21 +544,21 @@ void test_seq_execution_set_parameter_lazy_platform_image_size_set(void)
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_TAMP, retval, "Image size set is not allowed to take more than one iteration");
 
 	for (size_t i = 0; i < 4; i++) {
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].vid_set, "Vendor ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].cid_set, "Class ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].image_digest_set, "Image digest not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].component_slot_set, "Component slot not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].uri_set, "URI not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].source_component_set, "Source component not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].invoke_args_set, "Invoke args not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].did_set, "Device ID not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].content_set, "Content not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].version_set, "Version not set, but flag was updated");
-		TEST_ASSERT_EQUAL_MESSAGE(false, state.components[i].encryption_info_set, "Encryption info not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VID), "Vendor ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CID), "Class ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_IMAGE_DIGEST), "Image digest not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_COMPONENT_SLOT), "Component slot not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_URI), "URI not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_SOURCE_COMPONENT), "Source component not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_INVOKE_ARGS), "Invoke args not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_DID), "Device ID not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_CONTENT), "Content not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_VERSION), "Version not set, but flag was updated");
+		TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[i], SUIT_PARAM_ENCRYPTION_INFO), "Encryption info not set, but flag was updated");
 	}
 
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[0].image_size_set, "Image size set before command execution, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[1].image_size_set, "Image size set failed, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(true, state.components[2].image_size_set, "Image size set before command execution, but flag was updated");
-	TEST_ASSERT_EQUAL_MESSAGE(false, state.components[3].image_size_set, "Image size set failed on previous component, but the flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[0], SUIT_PARAM_IMAGE_SIZE), "Image size set before command execution, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[1], SUIT_PARAM_IMAGE_SIZE), "Image size set failed, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(true, suit_param_is_set(&state.components[2], SUIT_PARAM_IMAGE_SIZE), "Image size set before command execution, but flag was updated");
+	TEST_ASSERT_EQUAL_MESSAGE(false, suit_param_is_set(&state.components[3], SUIT_PARAM_IMAGE_SIZE), "Image size set failed on previous component, but the flag was updated");
 }
@@ -8,9 +8,16 @@
 #include <stdint.h>
 #include <bootstrap_envelope.h>
 #include <suit_schedule_seq.h>
+#include "suit_platform/cmock_suit_platform.h"
+#include "suit_platform_mock_ext.h"
 
 extern struct suit_processor_state state;
 
+static struct zcbor_string unknown_manifest_component_id = {
+	.value = NULL,
+	.len = 0,
+};
+
 static int execute_command_sequence(struct suit_processor_state *state, struct zcbor_string *cmd_seq_str)
 {
 	enum suit_command_sequence seq = SUIT_SEQ_PAYLOAD_FETCH;
@@ -26,7 +33,7 @@ static int execute_command_sequence(struct suit_processor_state *state, struct z
 	return ret;
 }
 
-void test_seq_execution_swap(void)
+void test_seq_execution_swap_no_src(void)
 {
 	uint8_t seq_cmd[] = {
 		0x82, /* list (2 elements - 1 command) */
@@ -43,7 +50,99 @@ void test_seq_execution_swap(void)
 
 	int retval = execute_command_sequence(&state, &seq);
 
-	/* Swap directive is not allowed in manifest CDDL. */
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNAVAILABLE_PARAMETER, retval);
+}
+
+void test_seq_execution_swap_src_invalid(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				0x16, /* uint(suit-parameter-source-component) */
+				0x1a, /* uint (32 bit) */
+				0x1e, 0x05, 0x40, 0x00,
+			0x1f, /* uint(suit-directive-swap) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_MISSING_COMPONENT, retval);
+}
+
+void test_seq_execution_swap_ok(void)
+{
+	uint8_t seq_cmd[] = {
+		0x86, /* list (6 elements - 3 commands) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x00, /* uint(0) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				0x16, /* uint(suit-parameter-source-component) */
+				0x01, /* uint (1) */
+			0x1f, /* uint(suit-directive-swap) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+	uint32_t exp_src_handle = 0x1e054001;
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 2);
+
+	__cmock_suit_plat_swap_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_src_handle,
+					       &unknown_manifest_component_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_swap_IgnoreArg_manifest_component_id();
+
+	int retval = execute_command_sequence(&state, &seq);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
+}
+
+void test_seq_execution_swap_resumed(void)
+{
+	uint8_t seq_cmd[] = {
+		0x86, /* list (6 elements - 3 commands) */
+			0x0c, /* uint(suit-directive-set-component-index) */
+			0x00, /* uint(0) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				0x16, /* uint(suit-parameter-source-component) */
+				0x01, /* uint (1) */
+			0x1f, /* uint(suit-directive-swap) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+	uint32_t exp_src_handle = 0x1e054001;
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 2);
+
+	/* The platform splits the swap operation into three steps. */
+	for (size_t i = 0; i < 2; i++) {
+		__cmock_suit_plat_swap_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_src_handle,
+						       &unknown_manifest_component_id, NULL,
+						       SUIT_ERR_AGAIN);
+		__cmock_suit_plat_swap_IgnoreArg_manifest_component_id();
+	}
+	__cmock_suit_plat_swap_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_src_handle,
+					       &unknown_manifest_component_id, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_swap_IgnoreArg_manifest_component_id();
+
+	int retval = execute_command_sequence(&state, &seq);
 
-	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, retval);
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, retval);
 }
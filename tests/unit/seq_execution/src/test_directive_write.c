@@ -77,7 +77,7 @@ void test_seq_execution_write_content(void)
 	bootstrap_envelope_components(&state, 1);
 
 	__cmock_suit_plat_write_ExpectComplexArgsAndReturn(ASSIGNED_COMPONENT_HANDLE, &exp_content,
-							   &unknown_manifest_component_id, NULL,
+							   &unknown_manifest_component_id, NULL, NULL,
 							   SUIT_SUCCESS);
 	__cmock_suit_plat_write_IgnoreArg_manifest_component_id();
 
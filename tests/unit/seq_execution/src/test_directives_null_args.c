@@ -201,7 +201,7 @@ void test_fetch_null_args(void)
 
 	component_params.uri.value = "http://example.com/file.bin";
 	component_params.uri.len = sizeof("http://example.com/file.bin");
-	component_params.uri_set = true;
+	suit_param_set_flag(&component_params, SUIT_PARAM_URI, true);
 
 	int retval = suit_directive_fetch(NULL, NULL);
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "Invalid arguments (NULL, NULL) were not detected");
@@ -243,7 +243,7 @@ void test_write_null_args(void)
 
 	component_params.content.value = "test_data";
 	component_params.content.len = strlen("test_data");
-	component_params.content_set = true;
+	suit_param_set_flag(&component_params, SUIT_PARAM_CONTENT, true);
 
 	int retval = suit_directive_write(NULL, NULL);
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "Invalid arguments (NULL, NULL) were not detected");
@@ -271,7 +271,26 @@ void test_swap_null_args(void)
 	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "NULL arguments (NULL, _) were not detected");
 
 	retval = suit_directive_swap(&state, &component_params);
-	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_UNSUPPORTED_COMMAND, retval, "Unexpected return code from unsupported suit-directive-swap command");
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_CRASH, retval, "Invalid execution state was not detected");
+}
+
+void test_apply_delta_null_args(void)
+{
+	struct suit_manifest_params component_params;
+
+	memset(&component_params, 0, sizeof(component_params));
+
+	int retval = suit_directive_apply_delta(NULL, NULL);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "Invalid arguments (NULL, NULL) were not detected");
+
+	retval = suit_directive_apply_delta(&state, NULL);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "NULL arguments (_, NULL) were not detected");
+
+	retval = suit_directive_apply_delta(NULL, &component_params);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_DECODING, retval, "NULL arguments (NULL, _) were not detected");
+
+	retval = suit_directive_apply_delta(&state, &component_params);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_ERR_CRASH, retval, "Invalid execution state was not detected");
 }
 
 void test_invoke_null_args(void)
@@ -20,6 +20,7 @@ struct cmd_support_matrix {
 	uint8_t *test_cmd;
 	size_t test_cmd_size;
 	const uint8_t *cmd_name;
+	enum suit_seq_effect exp_effect;
 };
 
 
@@ -131,6 +132,13 @@ static uint8_t directive_override_parameters_cmd[] = {
 			0x0d, /* uint(suit-parameter-soft-failure) */
 			0xf5, /* True */
 };
+static uint8_t directive_override_image_size_cmd[] = {
+	0x82, /* list (2 elements - 1 command) */
+		0x14, /* uint(suit-directive-override-parameters) */
+		0xa1, /* map (1) */
+			0x0e, /* uint(suit-parameter-image-size) */
+			0x18, 0x20, /* uint(32) */
+};
 static uint8_t directive_fetch_cmd[] = {
 	0x82, /* list (2 elements - 1 command) */
 		0x15, /* uint(suit-directive-fetch) */
@@ -151,6 +159,11 @@ static uint8_t directive_swap_cmd[] = {
 		0x1f, /* uint(suit-directive-swap) */
 		0x00, /* uint(SUIT_Rep_Policy::None) */
 };
+static uint8_t directive_custom_apply_delta_cmd[] = {
+	0x82, /* list (2 elements - 1 command) */
+		0x2a, /* int(suit-directive-custom-apply-delta) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
 static uint8_t directive_run_empty_sequence_cmd[] = {
 	0x82, /* list (2 elements - 1 command) */
 		0x18, 0x20, /* uint(suit-directive-run-sequence) */
@@ -171,62 +184,68 @@ static uint8_t directive_unlink_cmd[] = {
 };
 
 struct cmd_support_matrix shared_support_matrix[] = {
-	{SUIT_SUCCESS, condition_vendor_identifier_cmd, sizeof(condition_vendor_identifier_cmd), "condition_vendor_identifier"},
-	{SUIT_SUCCESS, condition_class_identifier_cmd, sizeof(condition_class_identifier_cmd), "condition_class_identifier"},
-	{SUIT_SUCCESS, condition_image_match_cmd, sizeof(condition_image_match_cmd), "condition_image_match"},
-	{SUIT_SUCCESS, condition_component_slot_cmd, sizeof(condition_component_slot_cmd), "condition_component_slot"},
-	{SUIT_SUCCESS, condition_check_content_cmd, sizeof(condition_check_content_cmd), "condition_check_content"},
-	{SUIT_SUCCESS, condition_dependency_integrity_cmd, sizeof(condition_dependency_integrity_cmd), "condition_dependency_integrity"},
-	{SUIT_SUCCESS, condition_is_dependency_cmd, sizeof(condition_is_dependency_cmd), "condition_is_dependency"},
-	{SUIT_SUCCESS, condition_abort_cmd, sizeof(condition_abort_cmd), "condition_abort"},
-	{SUIT_SUCCESS, condition_device_identifier_cmd, sizeof(condition_device_identifier_cmd), "condition_device_identifier"},
-	{SUIT_SUCCESS, condition_version_cmd, sizeof(condition_version_cmd), "condition_version"},
-	{SUIT_ERR_DECODING, condition_unsupported_cmd, sizeof(condition_unsupported_cmd), "Unsupported condition"},
-	{SUIT_ERR_DECODING, directive_process_dependency_cmd, sizeof(directive_process_dependency_cmd), "directive_process_dependency"},
-	{SUIT_SUCCESS, directive_set_component_index_cmd, sizeof(directive_set_component_index_cmd), "directive_set_component_index"},
-	{ZCBOR_ERR_TO_SUIT_ERR(ZCBOR_ERR_NO_PAYLOAD), directive_try_each_empty_sequences_cmd, sizeof(directive_try_each_empty_sequences_cmd), "directive_try_each without payload"},
-	{SUIT_SUCCESS, directive_try_each_cmd, sizeof(directive_try_each_cmd), "directive_try_each"},
-	{SUIT_ERR_MANIFEST_VALIDATION, directive_set_parameters_cmd, sizeof(directive_set_parameters_cmd), "directive_set_parameters"},
-	{SUIT_SUCCESS, directive_override_parameters_cmd, sizeof(directive_override_parameters_cmd), "directive_override_parameters"},
-	{SUIT_ERR_MANIFEST_VALIDATION, directive_fetch_cmd, sizeof(directive_fetch_cmd), "directive_fetch"},
-	{SUIT_ERR_MANIFEST_VALIDATION, directive_copy_cmd, sizeof(directive_copy_cmd), "directive_copy"},
-	{SUIT_ERR_MANIFEST_VALIDATION, directive_write_cmd, sizeof(directive_write_cmd), "directive_write"},
-	{SUIT_ERR_MANIFEST_VALIDATION, directive_invoke_cmd, sizeof(directive_invoke_cmd), "directive_invoke"},
-	{SUIT_ERR_DECODING, directive_swap_cmd, sizeof(directive_swap_cmd), "directive_swap"},
-	{SUIT_ERR_DECODING, directive_run_empty_sequence_cmd, sizeof(directive_run_empty_sequence_cmd), "directive_run_sequence without payload"},
-	{SUIT_SUCCESS, directive_run_sequence_cmd, sizeof(directive_run_sequence_cmd), "directive_run_sequence"},
-	{SUIT_ERR_DECODING, directive_unlink_cmd, sizeof(directive_unlink_cmd), "directive_unlink"},
+	{SUIT_SUCCESS, condition_vendor_identifier_cmd, sizeof(condition_vendor_identifier_cmd), "condition_vendor_identifier", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_class_identifier_cmd, sizeof(condition_class_identifier_cmd), "condition_class_identifier", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_image_match_cmd, sizeof(condition_image_match_cmd), "condition_image_match", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_component_slot_cmd, sizeof(condition_component_slot_cmd), "condition_component_slot", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_check_content_cmd, sizeof(condition_check_content_cmd), "condition_check_content", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_dependency_integrity_cmd, sizeof(condition_dependency_integrity_cmd), "condition_dependency_integrity", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_is_dependency_cmd, sizeof(condition_is_dependency_cmd), "condition_is_dependency", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_abort_cmd, sizeof(condition_abort_cmd), "condition_abort", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_device_identifier_cmd, sizeof(condition_device_identifier_cmd), "condition_device_identifier", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_version_cmd, sizeof(condition_version_cmd), "condition_version", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_ERR_DECODING, condition_unsupported_cmd, sizeof(condition_unsupported_cmd), "Unsupported condition", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_ERR_DECODING, directive_process_dependency_cmd, sizeof(directive_process_dependency_cmd), "directive_process_dependency", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_SUCCESS, directive_set_component_index_cmd, sizeof(directive_set_component_index_cmd), "directive_set_component_index", SUIT_SEQ_EFFECT_PURE},
+	{ZCBOR_ERR_TO_SUIT_ERR(ZCBOR_ERR_NO_PAYLOAD), directive_try_each_empty_sequences_cmd, sizeof(directive_try_each_empty_sequences_cmd), "directive_try_each without payload", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_try_each_cmd, sizeof(directive_try_each_cmd), "directive_try_each", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_ERR_MANIFEST_VALIDATION, directive_set_parameters_cmd, sizeof(directive_set_parameters_cmd), "directive_set_parameters", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_override_parameters_cmd, sizeof(directive_override_parameters_cmd), "directive_override_parameters", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_override_image_size_cmd, sizeof(directive_override_image_size_cmd), "directive_override_image_size", SUIT_SEQ_EFFECT_LOCAL_WRITE},
+	{SUIT_ERR_MANIFEST_VALIDATION, directive_fetch_cmd, sizeof(directive_fetch_cmd), "directive_fetch", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_ERR_MANIFEST_VALIDATION, directive_copy_cmd, sizeof(directive_copy_cmd), "directive_copy", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_ERR_MANIFEST_VALIDATION, directive_write_cmd, sizeof(directive_write_cmd), "directive_write", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_ERR_MANIFEST_VALIDATION, directive_invoke_cmd, sizeof(directive_invoke_cmd), "directive_invoke", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_ERR_MANIFEST_VALIDATION, directive_swap_cmd, sizeof(directive_swap_cmd), "directive_swap", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_ERR_MANIFEST_VALIDATION, directive_custom_apply_delta_cmd, sizeof(directive_custom_apply_delta_cmd), "directive_custom_apply_delta", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_ERR_DECODING, directive_run_empty_sequence_cmd, sizeof(directive_run_empty_sequence_cmd), "directive_run_sequence without payload", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_run_sequence_cmd, sizeof(directive_run_sequence_cmd), "directive_run_sequence", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_ERR_DECODING, directive_unlink_cmd, sizeof(directive_unlink_cmd), "directive_unlink", SUIT_SEQ_EFFECT_PURE},
 };
 
 struct cmd_support_matrix command_support_matrix[] = {
-	{SUIT_SUCCESS, condition_vendor_identifier_cmd, sizeof(condition_vendor_identifier_cmd), "condition_vendor_identifier"},
-	{SUIT_SUCCESS, condition_class_identifier_cmd, sizeof(condition_class_identifier_cmd), "condition_class_identifier"},
-	{SUIT_SUCCESS, condition_image_match_cmd, sizeof(condition_image_match_cmd), "condition_image_match"},
-	{SUIT_SUCCESS, condition_component_slot_cmd, sizeof(condition_component_slot_cmd), "condition_component_slot"},
-	{SUIT_SUCCESS, condition_check_content_cmd, sizeof(condition_check_content_cmd), "condition_check_content"},
-	{SUIT_SUCCESS, condition_dependency_integrity_cmd, sizeof(condition_is_dependency_cmd), "condition_dependency_integrity"},
-	{SUIT_SUCCESS, condition_is_dependency_cmd, sizeof(condition_is_dependency_cmd), "condition_is_dependency"},
-	{SUIT_SUCCESS, condition_abort_cmd, sizeof(condition_abort_cmd), "condition_abort"},
-	{SUIT_SUCCESS, condition_device_identifier_cmd, sizeof(condition_device_identifier_cmd), "condition_device_identifier"},
-	{SUIT_SUCCESS, condition_version_cmd, sizeof(condition_version_cmd), "condition_version"},
-	{SUIT_ERR_DECODING, condition_unsupported_cmd, sizeof(condition_unsupported_cmd), "Unsupported condition"},
-	{SUIT_ERR_DECODING, directive_process_dependency_cmd, sizeof(directive_process_dependency_cmd), "directive_process_dependency"},
-	{SUIT_SUCCESS, directive_set_component_index_cmd, sizeof(directive_set_component_index_cmd), "directive_set_component_index"},
-	{ZCBOR_ERR_TO_SUIT_ERR(ZCBOR_ERR_NO_PAYLOAD), directive_try_each_empty_sequences_cmd, sizeof(directive_try_each_empty_sequences_cmd), "directive_try_each without payload"},
-	{SUIT_SUCCESS, directive_try_each_cmd, sizeof(directive_try_each_cmd), "directive_try_each"},
-	{SUIT_SUCCESS, directive_set_parameters_cmd, sizeof(directive_set_parameters_cmd), "directive_set_parameters"},
-	{SUIT_SUCCESS, directive_override_parameters_cmd, sizeof(directive_override_parameters_cmd), "directive_override_parameters"},
-	{SUIT_SUCCESS, directive_fetch_cmd, sizeof(directive_fetch_cmd), "directive_fetch"},
-	{SUIT_SUCCESS, directive_copy_cmd, sizeof(directive_copy_cmd), "directive_copy"},
-	{SUIT_SUCCESS, directive_write_cmd, sizeof(directive_write_cmd), "directive_write"},
-	{SUIT_SUCCESS, directive_invoke_cmd, sizeof(directive_invoke_cmd), "directive_invoke"},
-	{SUIT_ERR_DECODING, directive_swap_cmd, sizeof(directive_swap_cmd), "directive_swap"},
-	{SUIT_ERR_DECODING, directive_run_empty_sequence_cmd, sizeof(directive_run_empty_sequence_cmd), "directive_run_sequence without payload"},
-	{SUIT_SUCCESS, directive_run_sequence_cmd, sizeof(directive_run_sequence_cmd), "directive_run_sequence"},
-	{SUIT_ERR_DECODING, directive_unlink_cmd, sizeof(directive_unlink_cmd), "directive_unlink"},
+	{SUIT_SUCCESS, condition_vendor_identifier_cmd, sizeof(condition_vendor_identifier_cmd), "condition_vendor_identifier", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_class_identifier_cmd, sizeof(condition_class_identifier_cmd), "condition_class_identifier", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_image_match_cmd, sizeof(condition_image_match_cmd), "condition_image_match", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_component_slot_cmd, sizeof(condition_component_slot_cmd), "condition_component_slot", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_check_content_cmd, sizeof(condition_check_content_cmd), "condition_check_content", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_dependency_integrity_cmd, sizeof(condition_is_dependency_cmd), "condition_dependency_integrity", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_is_dependency_cmd, sizeof(condition_is_dependency_cmd), "condition_is_dependency", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_abort_cmd, sizeof(condition_abort_cmd), "condition_abort", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_device_identifier_cmd, sizeof(condition_device_identifier_cmd), "condition_device_identifier", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, condition_version_cmd, sizeof(condition_version_cmd), "condition_version", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_ERR_DECODING, condition_unsupported_cmd, sizeof(condition_unsupported_cmd), "Unsupported condition", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_ERR_DECODING, directive_process_dependency_cmd, sizeof(directive_process_dependency_cmd), "directive_process_dependency", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_SUCCESS, directive_set_component_index_cmd, sizeof(directive_set_component_index_cmd), "directive_set_component_index", SUIT_SEQ_EFFECT_PURE},
+	{ZCBOR_ERR_TO_SUIT_ERR(ZCBOR_ERR_NO_PAYLOAD), directive_try_each_empty_sequences_cmd, sizeof(directive_try_each_empty_sequences_cmd), "directive_try_each without payload", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_try_each_cmd, sizeof(directive_try_each_cmd), "directive_try_each", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_set_parameters_cmd, sizeof(directive_set_parameters_cmd), "directive_set_parameters", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_override_parameters_cmd, sizeof(directive_override_parameters_cmd), "directive_override_parameters", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_override_image_size_cmd, sizeof(directive_override_image_size_cmd), "directive_override_image_size", SUIT_SEQ_EFFECT_LOCAL_WRITE},
+	{SUIT_SUCCESS, directive_fetch_cmd, sizeof(directive_fetch_cmd), "directive_fetch", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_SUCCESS, directive_copy_cmd, sizeof(directive_copy_cmd), "directive_copy", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_SUCCESS, directive_write_cmd, sizeof(directive_write_cmd), "directive_write", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_SUCCESS, directive_invoke_cmd, sizeof(directive_invoke_cmd), "directive_invoke", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_SUCCESS, directive_swap_cmd, sizeof(directive_swap_cmd), "directive_swap", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_SUCCESS, directive_custom_apply_delta_cmd, sizeof(directive_custom_apply_delta_cmd), "directive_custom_apply_delta", SUIT_SEQ_EFFECT_EXTERNAL},
+	{SUIT_ERR_DECODING, directive_run_empty_sequence_cmd, sizeof(directive_run_empty_sequence_cmd), "directive_run_sequence without payload", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_SUCCESS, directive_run_sequence_cmd, sizeof(directive_run_sequence_cmd), "directive_run_sequence", SUIT_SEQ_EFFECT_PURE},
+	{SUIT_ERR_DECODING, directive_unlink_cmd, sizeof(directive_unlink_cmd), "directive_unlink", SUIT_SEQ_EFFECT_PURE},
 };
 
 
+static int validate_shared_sequence(struct suit_processor_state *state, struct zcbor_string *cmd_seq_str);
+
 static void seq_validation_nested_test_template(seq_validation_api_t validate, bootsrap_seq_hdr_generator_t generator, struct cmd_support_matrix *support_matrix, size_t n_components, size_t depth)
 {
 	struct zcbor_string seq;
@@ -262,6 +281,16 @@ static void seq_validation_nested_test_template(seq_validation_api_t validate, b
 		retval,
 		assert_msg);
 	TEST_ASSERT_EQUAL(state.seq_stack_height, 0);
+
+	if (retval == SUIT_SUCCESS) {
+		enum suit_command_sequence seq_name = (validate == validate_shared_sequence) ?
+			SUIT_SEQ_SHARED : SUIT_SEQ_PAYLOAD_FETCH;
+
+		TEST_ASSERT_EQUAL_MESSAGE(
+			support_matrix->exp_effect,
+			suit_manifest_get_seq_effect(&state.manifest_stack[0], seq_name),
+			assert_msg);
+	}
 }
 
 static int validate_command_sequence(struct suit_processor_state *state, struct zcbor_string *cmd_seq_str)
@@ -542,6 +571,50 @@ void test_seq_validation_shared_unknown_command(void)
 }
 
 
+void test_seq_validation_effect_stored_on_success(void)
+{
+	struct zcbor_string seq = {
+		.value = condition_abort_cmd,
+		.len = sizeof(condition_abort_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+
+	/* The sequences, that were not validated, may have any effect. */
+	TEST_ASSERT_EQUAL(SUIT_SEQ_EFFECT_EXTERNAL,
+			  suit_manifest_get_seq_effect(&state.manifest_stack[0], SUIT_SEQ_PAYLOAD_FETCH));
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, validate_command_sequence(&state, &seq));
+	TEST_ASSERT_EQUAL(SUIT_SEQ_EFFECT_PURE,
+			  suit_manifest_get_seq_effect(&state.manifest_stack[0], SUIT_SEQ_PAYLOAD_FETCH));
+	TEST_ASSERT_EQUAL(SUIT_SEQ_EFFECT_EXTERNAL,
+			  suit_manifest_get_seq_effect(&state.manifest_stack[0], SUIT_SEQ_INSTALL));
+}
+
+void test_seq_validation_effect_not_stored_on_failure(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x0e, /* uint(suit-condition-abort) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x18, 0x20, /* uint(suit-directive-run-sequence), but without payload */
+	};
+	struct zcbor_string seq = {
+		.value = seq_cmd,
+		.len = sizeof(seq_cmd),
+	};
+
+	bootstrap_envelope_empty(&state);
+	bootstrap_envelope_components(&state, 1);
+
+	/* The commands, validated before the failure, do not define the effect of the sequence. */
+	TEST_ASSERT_NOT_EQUAL(SUIT_SUCCESS, validate_command_sequence(&state, &seq));
+	TEST_ASSERT_EQUAL(SUIT_SEQ_EFFECT_EXTERNAL,
+			  suit_manifest_get_seq_effect(&state.manifest_stack[0], SUIT_SEQ_PAYLOAD_FETCH));
+}
+
+
 void test_seq_validation_shared_nested_run_sequence(void)
 {
 	for (size_t depth = 0; depth < (SUIT_MAX_SEQ_DEPTH - 1); depth++) {
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <bootstrap_envelope.h>
+#include <bootstrap_params.h>
+#include <suit_manifest.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+struct suit_processor_state state;
+
+static uint8_t fetch_cmd[] = {
+	0x84, /* list (4 elements - 2 commands) */
+		0x14, /* uint(suit-directive-override-parameters) */
+		0xa2, /* map (2) */
+			IMAGE_DIGEST_PARAMETER,
+			URI_PARAMETER,
+		0x15, /* uint(suit-directive-fetch) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
+
+static uint8_t copy_cmd[] = {
+	0x86, /* list (6 elements - 3 commands) */
+		0x0c, /* uint(suit-directive-set-component-index) */
+		0x00, /* uint(0) */
+		0x14, /* uint(suit-directive-override-parameters) */
+		0xa2, /* map (2) */
+			IMAGE_DIGEST_PARAMETER,
+			0x16, /* uint(suit-parameter-source-component) */
+			0x01, /* uint (1) */
+		0x16, /* uint(suit-directive-copy) */
+		0x00, /* uint(SUIT_Rep_Policy::None) */
+};
+
+static void expect_image_match(int result)
+{
+	__cmock_suit_plat_check_image_match_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE,
+							    suit_cose_sha256, NULL, result);
+	__cmock_suit_plat_check_image_match_IgnoreArg_digest();
+}
+
+void setUp(void)
+{
+	int err = bootstrap_envelope_init(&state);
+	TEST_ASSERT_EQUAL_MESSAGE(SUIT_SUCCESS, err, "Unable to initialize SUIT processor");
+}
+
+void test_fetch_skipped_if_image_matches(void)
+{
+	bootstrap_envelope_components(&state, 1);
+
+	expect_image_match(SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_INSTALL, fetch_cmd, sizeof(fetch_cmd)));
+}
+
+void test_fetch_executed_if_image_differs(void)
+{
+	bootstrap_envelope_components(&state, 1);
+
+	expect_image_match(SUIT_FAIL_CONDITION);
+	__cmock_suit_plat_fetch_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, NULL, NULL, NULL, NULL,
+						SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_IgnoreArg_uri();
+	__cmock_suit_plat_fetch_IgnoreArg_manifest_component_id();
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_INSTALL, fetch_cmd, sizeof(fetch_cmd)));
+}
+
+void test_fetch_executed_without_image_digest(void)
+{
+	uint8_t seq_cmd[] = {
+		0x84, /* list (4 elements - 2 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa1, /* map (1) */
+				URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	bootstrap_envelope_components(&state, 1);
+
+	__cmock_suit_plat_fetch_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, NULL, NULL, NULL, NULL,
+						SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_IgnoreArg_uri();
+	__cmock_suit_plat_fetch_IgnoreArg_manifest_component_id();
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_INSTALL, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_fetch_repeated_after_modification(void)
+{
+	uint8_t seq_cmd[] = {
+		0x86, /* list (6 elements - 3 commands) */
+			0x14, /* uint(suit-directive-override-parameters) */
+			0xa2, /* map (2) */
+				IMAGE_DIGEST_PARAMETER,
+				URI_PARAMETER,
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+			0x15, /* uint(suit-directive-fetch) */
+			0x00, /* uint(SUIT_Rep_Policy::None) */
+	};
+
+	bootstrap_envelope_components(&state, 1);
+
+	/* The failed image match result is dropped once the component is modified by the fetch. */
+	expect_image_match(SUIT_FAIL_CONDITION);
+	__cmock_suit_plat_fetch_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, NULL, NULL, NULL, NULL,
+						SUIT_SUCCESS);
+	__cmock_suit_plat_fetch_IgnoreArg_uri();
+	__cmock_suit_plat_fetch_IgnoreArg_manifest_component_id();
+	expect_image_match(SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_INSTALL, seq_cmd, sizeof(seq_cmd)));
+}
+
+void test_copy_skipped_if_image_matches(void)
+{
+	bootstrap_envelope_components(&state, 2);
+
+	expect_image_match(SUIT_SUCCESS);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_INSTALL, copy_cmd, sizeof(copy_cmd)));
+}
+
+void test_copy_executed_if_image_differs(void)
+{
+	uint32_t exp_src_handle = 0x1e054001;
+
+	bootstrap_envelope_components(&state, 2);
+
+	expect_image_match(SUIT_FAIL_CONDITION);
+	__cmock_suit_plat_copy_ExpectAndReturn(ASSIGNED_COMPONENT_HANDLE, exp_src_handle, NULL,
+					       NULL, NULL, SUIT_SUCCESS);
+	__cmock_suit_plat_copy_IgnoreArg_manifest_component_id();
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS,
+			  bootstrap_envelope_execute(&state, SUIT_SEQ_INSTALL, copy_cmd, sizeof(copy_cmd)));
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
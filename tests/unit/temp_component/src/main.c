@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit_temp_component.h>
+
+#define AREA_ADDRESS 0x1000
+#define AREA_SIZE    256
+#define REGIONS_MAX  6
+
+/* ['temp', 'a', h'1864' (100), h'04' (4)] */
+static uint8_t temp_id_cbor[] = {
+	0x84,
+		0x44, 't', 'e', 'm', 'p',
+		0x41, 'a',
+		0x42, 0x18, 0x64,
+		0x41, 0x04,
+};
+
+/* ['temp', 'b', h'10' (16), h'00' (0), 'ext'] */
+static uint8_t temp_id_context_cbor[] = {
+	0x85,
+		0x44, 't', 'e', 'm', 'p',
+		0x41, 'b',
+		0x41, 0x10,
+		0x41, 0x00,
+		0x43, 'e', 'x', 't',
+};
+
+/* ['app', 'fw'] */
+static uint8_t app_id_cbor[] = {
+	0x82,
+		0x43, 'a', 'p', 'p',
+		0x42, 'f', 'w',
+};
+
+static struct suit_temp_allocator alloc;
+static struct suit_temp_region regions[REGIONS_MAX];
+
+static struct suit_temp_component_id temp_id(const char *uid, size_t size, size_t align)
+{
+	struct suit_temp_component_id id = {
+		.uid = {
+			.value = (const uint8_t *)uid,
+			.len = strlen(uid),
+		},
+		.size = size,
+		.align = align,
+	};
+
+	return id;
+}
+
+static uintptr_t alloc_ok(const char *uid, size_t size, size_t align)
+{
+	struct suit_temp_component_id id = temp_id(uid, size, align);
+	uintptr_t address = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_alloc(&alloc, &id, &address));
+
+	return address;
+}
+
+void setUp(void)
+{
+	memset(regions, 0, sizeof(regions));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_allocator_init(&alloc, AREA_ADDRESS, AREA_SIZE,
+								 regions, REGIONS_MAX));
+}
+
+void test_temp_component_id_decode(void)
+{
+	struct zcbor_string component_id = {
+		.value = temp_id_cbor,
+		.len = sizeof(temp_id_cbor),
+	};
+	struct suit_temp_component_id id;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_component_id_decode(&component_id, &id));
+	TEST_ASSERT_EQUAL(1, id.uid.len);
+	TEST_ASSERT_EQUAL('a', id.uid.value[0]);
+	TEST_ASSERT_EQUAL(100, id.size);
+	TEST_ASSERT_EQUAL(4, id.align);
+	TEST_ASSERT_EQUAL(0, id.context.len);
+}
+
+void test_temp_component_id_decode_context(void)
+{
+	struct zcbor_string component_id = {
+		.value = temp_id_context_cbor,
+		.len = sizeof(temp_id_context_cbor),
+	};
+	struct suit_temp_component_id id;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_component_id_decode(&component_id, &id));
+	TEST_ASSERT_EQUAL(16, id.size);
+	/* Zero alignment does not impose any requirements. */
+	TEST_ASSERT_EQUAL(1, id.align);
+	TEST_ASSERT_EQUAL(3, id.context.len);
+	TEST_ASSERT_EQUAL_MEMORY("ext", id.context.value, 3);
+}
+
+void test_temp_component_id_decode_not_temp(void)
+{
+	struct zcbor_string component_id = {
+		.value = app_id_cbor,
+		.len = sizeof(app_id_cbor),
+	};
+	struct suit_temp_component_id id;
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_COMPONENT_ID,
+			  suit_temp_component_id_decode(&component_id, &id));
+}
+
+void test_temp_component_id_decode_invalid(void)
+{
+	uint8_t corrupted[sizeof(temp_id_cbor)];
+	struct zcbor_string component_id = {
+		.value = corrupted,
+		.len = sizeof(corrupted),
+	};
+	struct suit_temp_component_id id;
+
+	/* Alignment, which is not a power of two. */
+	memcpy(corrupted, temp_id_cbor, sizeof(corrupted));
+	corrupted[sizeof(corrupted) - 1] = 0x03;
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, suit_temp_component_id_decode(&component_id, &id));
+
+	/* Size, which is not a wrapped integer. */
+	memcpy(corrupted, temp_id_cbor, sizeof(corrupted));
+	corrupted[8] = 0x41;
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, suit_temp_component_id_decode(&component_id, &id));
+
+	/* Missing alignment. */
+	memcpy(corrupted, temp_id_cbor, sizeof(corrupted));
+	corrupted[0] = 0x83;
+	component_id.len = sizeof(corrupted) - 2;
+	TEST_ASSERT_EQUAL(SUIT_ERR_DECODING, suit_temp_component_id_decode(&component_id, &id));
+}
+
+void test_temp_alloc_bump(void)
+{
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 10, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 16, alloc_ok("b", 20, 16));
+	/* The alignment padding is kept as a free region, so it can be used later. */
+	TEST_ASSERT_EQUAL(3, alloc.regions_count);
+	TEST_ASSERT_EQUAL(36, alloc.top);
+
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 12, alloc_ok("c", 4, 4));
+	TEST_ASSERT_EQUAL(4, alloc.regions_count);
+	TEST_ASSERT_EQUAL(36, alloc.top);
+}
+
+void test_temp_alloc_same_uid(void)
+{
+	struct suit_temp_component_id id = temp_id("a", 20, 4);
+	uintptr_t address = 0;
+
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 10, 4));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 10, 4));
+	TEST_ASSERT_EQUAL(1, alloc.regions_count);
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_COMPONENT_ID, suit_temp_alloc(&alloc, &id, &address));
+}
+
+void test_temp_alloc_uid_copied(void)
+{
+	char uid[] = "a";
+	struct suit_temp_component_id id = temp_id(uid, 16, 1);
+	uintptr_t address = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_alloc(&alloc, &id, &address));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, address);
+
+	/* The buffer with the component ID may be reused after the allocation. */
+	uid[0] = 'b';
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 16, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 16, alloc_ok("b", 16, 1));
+}
+
+void test_temp_alloc_uid_too_long(void)
+{
+	struct suit_temp_component_id id = temp_id("0123456789abcdefg", 16, 1);
+	uintptr_t address = 0;
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_UNSUPPORTED_COMPONENT_ID, suit_temp_alloc(&alloc, &id, &address));
+	TEST_ASSERT_EQUAL(0, alloc.regions_count);
+}
+
+void test_temp_alloc_overflow(void)
+{
+	struct suit_temp_component_id id = temp_id("b", AREA_SIZE - 100 + 1, 1);
+	uintptr_t address = 0;
+
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 100, 1));
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_temp_alloc(&alloc, &id, &address));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 100, alloc_ok("b", AREA_SIZE - 100, 1));
+}
+
+void test_temp_alloc_regions_overflow(void)
+{
+	struct suit_temp_component_id id = temp_id("g", 1, 1);
+	uintptr_t address = 0;
+	const char *uids[REGIONS_MAX] = {"a", "b", "c", "d", "e", "f"};
+
+	for (size_t i = 0; i < REGIONS_MAX; i++) {
+		TEST_ASSERT_EQUAL(AREA_ADDRESS + i, alloc_ok(uids[i], 1, 1));
+	}
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_OVERFLOW, suit_temp_alloc(&alloc, &id, &address));
+}
+
+void test_temp_alloc_first_fit(void)
+{
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 12, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 12, alloc_ok("b", 32, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 44, alloc_ok("c", 16, 1));
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_free(&alloc, AREA_ADDRESS + 12));
+
+	/* Too big for the free region - allocated at the top. */
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 60, alloc_ok("d", 40, 1));
+	/* Fits in the free region, with the alignment padding and the unused tail. */
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 16, alloc_ok("e", 8, 8));
+	TEST_ASSERT_EQUAL(6, alloc.regions_count);
+	/* The padding is reused as well. */
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 12, alloc_ok("f", 4, 1));
+	TEST_ASSERT_EQUAL(6, alloc.regions_count);
+	TEST_ASSERT_EQUAL(100, alloc.top);
+}
+
+void test_temp_free_coalesce(void)
+{
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 16, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 16, alloc_ok("b", 16, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 32, alloc_ok("c", 16, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 48, alloc_ok("d", 16, 1));
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_free(&alloc, AREA_ADDRESS));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_free(&alloc, AREA_ADDRESS + 32));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_free(&alloc, AREA_ADDRESS + 16));
+
+	/* All three regions are merged into one. */
+	TEST_ASSERT_EQUAL(2, alloc.regions_count);
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("e", 48, 1));
+	TEST_ASSERT_EQUAL(64, alloc.top);
+}
+
+void test_temp_free_top(void)
+{
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 16, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 16, alloc_ok("b", 16, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 32, alloc_ok("c", 16, 1));
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_free(&alloc, AREA_ADDRESS + 16));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_free(&alloc, AREA_ADDRESS + 32));
+
+	/* The free regions at the end are given back to the bump allocator. */
+	TEST_ASSERT_EQUAL(1, alloc.regions_count);
+	TEST_ASSERT_EQUAL(16, alloc.top);
+}
+
+void test_temp_free_missing(void)
+{
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 16, 1));
+
+	TEST_ASSERT_EQUAL(SUIT_ERR_MISSING_COMPONENT, suit_temp_free(&alloc, AREA_ADDRESS + 1));
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_free(&alloc, AREA_ADDRESS));
+	TEST_ASSERT_EQUAL(SUIT_ERR_MISSING_COMPONENT, suit_temp_free(&alloc, AREA_ADDRESS));
+}
+
+void test_temp_free_all(void)
+{
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("a", 16, 1));
+	TEST_ASSERT_EQUAL(AREA_ADDRESS + 16, alloc_ok("b", 16, 1));
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_temp_free_all(&alloc));
+	TEST_ASSERT_EQUAL(0, alloc.regions_count);
+	TEST_ASSERT_EQUAL(AREA_ADDRESS, alloc_ok("b", 32, 1));
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit_trace.h>
+#include "suit_platform/cmock_suit_platform.h"
+
+static struct suit_trace_stats stats[SUIT_TRACE_EVENT_MAX + 1];
+
+static suit_command_t condition(int choice)
+{
+	suit_command_t command = {
+		.type = SUIT_COMMAND_CONDITION,
+	};
+
+	command.condition.SUIT_Condition_choice = choice;
+
+	return command;
+}
+
+static suit_command_t directive(int choice)
+{
+	suit_command_t command = {
+		.type = SUIT_COMMAND_DIRECTIVE,
+	};
+
+	command.directive.SUIT_Directive_choice = choice;
+
+	return command;
+}
+
+void setUp(void)
+{
+	suit_trace_reset();
+	memset(stats, 0xff, sizeof(stats));
+}
+
+void test_snapshot_empty(void)
+{
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_trace_snapshot(stats, SUIT_TRACE_EVENT_MAX));
+
+	for (size_t i = 0; i < SUIT_TRACE_EVENT_MAX; i++) {
+		TEST_ASSERT_EQUAL(0, stats[i].count);
+		TEST_ASSERT_EQUAL(0, stats[i].min);
+		TEST_ASSERT_EQUAL(0, stats[i].max);
+		TEST_ASSERT_EQUAL(0, stats[i].total);
+	}
+}
+
+void test_snapshot_invalid_args(void)
+{
+	TEST_ASSERT_EQUAL(SUIT_ERR_CRASH, suit_trace_snapshot(NULL, SUIT_TRACE_EVENT_MAX));
+}
+
+void test_record_stats(void)
+{
+	suit_trace_record(SUIT_TRACE_PLAT_FETCH, 100);
+	suit_trace_record(SUIT_TRACE_PLAT_FETCH, 20);
+	suit_trace_record(SUIT_TRACE_PLAT_FETCH, 300);
+	suit_trace_record(SUIT_TRACE_CMD_FETCH, 500);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_trace_snapshot(stats, SUIT_TRACE_EVENT_MAX));
+
+	TEST_ASSERT_EQUAL(3, stats[SUIT_TRACE_PLAT_FETCH].count);
+	TEST_ASSERT_EQUAL(20, stats[SUIT_TRACE_PLAT_FETCH].min);
+	TEST_ASSERT_EQUAL(300, stats[SUIT_TRACE_PLAT_FETCH].max);
+	TEST_ASSERT_EQUAL(420, stats[SUIT_TRACE_PLAT_FETCH].total);
+
+	TEST_ASSERT_EQUAL(1, stats[SUIT_TRACE_CMD_FETCH].count);
+	TEST_ASSERT_EQUAL(500, stats[SUIT_TRACE_CMD_FETCH].min);
+	TEST_ASSERT_EQUAL(500, stats[SUIT_TRACE_CMD_FETCH].max);
+	TEST_ASSERT_EQUAL(500, stats[SUIT_TRACE_CMD_FETCH].total);
+
+	TEST_ASSERT_EQUAL(0, stats[SUIT_TRACE_PLAT_COPY].count);
+}
+
+void test_record_total_overflow(void)
+{
+	/* The total is wider than a single duration. */
+	suit_trace_record(SUIT_TRACE_PLAT_COPY, UINT32_MAX);
+	suit_trace_record(SUIT_TRACE_PLAT_COPY, UINT32_MAX);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_trace_snapshot(stats, SUIT_TRACE_EVENT_MAX));
+	TEST_ASSERT_TRUE(stats[SUIT_TRACE_PLAT_COPY].total == 2 * (uint64_t)UINT32_MAX);
+}
+
+void test_record_invalid_event(void)
+{
+	suit_trace_record(SUIT_TRACE_EVENT_MAX, 100);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_trace_snapshot(stats, SUIT_TRACE_EVENT_MAX));
+
+	for (size_t i = 0; i < SUIT_TRACE_EVENT_MAX; i++) {
+		TEST_ASSERT_EQUAL(0, stats[i].count);
+	}
+}
+
+void test_snapshot_truncated(void)
+{
+	suit_trace_record(SUIT_TRACE_CMD_VENDOR_IDENTIFIER, 10);
+	suit_trace_record(SUIT_TRACE_CMD_CLASS_IDENTIFIER, 10);
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_trace_snapshot(stats, 1));
+	TEST_ASSERT_EQUAL(1, stats[SUIT_TRACE_CMD_VENDOR_IDENTIFIER].count);
+	/* The remaining entries are not modified. */
+	TEST_ASSERT_EQUAL(UINT32_MAX, stats[SUIT_TRACE_CMD_CLASS_IDENTIFIER].count);
+}
+
+void test_snapshot_oversized(void)
+{
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_trace_snapshot(stats, SUIT_TRACE_EVENT_MAX + 1));
+	TEST_ASSERT_EQUAL(0, stats[SUIT_TRACE_EVENT_MAX - 1].count);
+	/* Only SUIT_TRACE_EVENT_MAX entries are filled. */
+	TEST_ASSERT_EQUAL(UINT32_MAX, stats[SUIT_TRACE_EVENT_MAX].count);
+}
+
+void test_reset(void)
+{
+	suit_trace_record(SUIT_TRACE_DECODE_ENVELOPE, 10);
+	suit_trace_reset();
+
+	TEST_ASSERT_EQUAL(SUIT_SUCCESS, suit_trace_snapshot(stats, SUIT_TRACE_EVENT_MAX));
+	TEST_ASSERT_EQUAL(0, stats[SUIT_TRACE_DECODE_ENVELOPE].count);
+	TEST_ASSERT_EQUAL(0, stats[SUIT_TRACE_DECODE_ENVELOPE].total);
+}
+
+void test_command_event(void)
+{
+	suit_command_t command = condition(SUIT_Condition_suit_condition_image_match_m_l_c);
+
+	TEST_ASSERT_EQUAL(SUIT_TRACE_CMD_IMAGE_MATCH, suit_trace_command_event(&command));
+
+	command = condition(SUIT_Condition_suit_condition_version_m_l_c);
+	TEST_ASSERT_EQUAL(SUIT_TRACE_CMD_VERSION, suit_trace_command_event(&command));
+
+	command = directive(SUIT_Directive_suit_directive_fetch_m_l_c);
+	TEST_ASSERT_EQUAL(SUIT_TRACE_CMD_FETCH, suit_trace_command_event(&command));
+
+	command = directive(SUIT_Directive_suit_directive_custom_apply_delta_m_l_c);
+	TEST_ASSERT_EQUAL(SUIT_TRACE_CMD_APPLY_DELTA, suit_trace_command_event(&command));
+
+	command = directive(SUIT_Directive_suit_directive_run_sequence_m_l_c);
+	TEST_ASSERT_EQUAL(SUIT_TRACE_CMD_RUN_SEQUENCE, suit_trace_command_event(&command));
+}
+
+void test_command_event_other(void)
+{
+	/* Zero is not assigned to any condition nor directive. */
+	suit_command_t command = directive(0);
+
+	TEST_ASSERT_EQUAL(SUIT_TRACE_CMD_OTHER, suit_trace_command_event(&command));
+
+	command = condition(0);
+	TEST_ASSERT_EQUAL(SUIT_TRACE_CMD_OTHER, suit_trace_command_event(&command));
+	TEST_ASSERT_EQUAL(SUIT_TRACE_CMD_OTHER, suit_trace_command_event(NULL));
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
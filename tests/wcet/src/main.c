@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2023 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <stdint.h>
+#include <string.h>
+#include <suit.h>
+#include <suit_trace.h>
+#include <platform_stub.h>
+
+/* The stack size of the thread, executing the measured entry point. */
+#define WCET_STACK_SIZE 16384
+
+/* The number of executions of each entry point, from which the maximum is reported. */
+#define WCET_ITERATIONS 4
+
+/* The sample envelope with two integrated dependency manifests. */
+extern uint8_t manifest_buf[];
+extern const size_t manifest_len;
+
+/* The adversarial envelopes, generated by the scripts/suit_envelope_gen.py. */
+extern uint8_t worst_nesting[];
+extern const size_t worst_nesting_len;
+extern uint8_t worst_components[];
+extern const size_t worst_components_len;
+extern uint8_t worst_dependencies[];
+extern const size_t worst_dependencies_len;
+extern uint8_t worst_payloads[];
+extern const size_t worst_payloads_len;
+
+enum wcet_entry {
+	WCET_ENTRY_PROCESS_SEQUENCE,
+	WCET_ENTRY_GET_MANIFEST_METADATA,
+	WCET_ENTRY_MAX,
+};
+
+struct wcet_envelope {
+	const char *name;
+	const uint8_t *buf;
+	const size_t *len;
+};
+
+struct wcet_result {
+	uint32_t cycles;
+	size_t stack;
+	int status;
+	const char *envelope;
+	enum suit_command_sequence seq;
+};
+
+static const struct wcet_envelope envelopes[] = {
+	{"sample", manifest_buf, &manifest_len},
+	{"worst_nesting", worst_nesting, &worst_nesting_len},
+	{"worst_components", worst_components, &worst_components_len},
+	{"worst_dependencies", worst_dependencies, &worst_dependencies_len},
+	{"worst_payloads", worst_payloads, &worst_payloads_len},
+};
+
+static const char *entry_names[] = {
+	"suit_process_sequence",
+	"suit_processor_get_manifest_metadata",
+};
+
+static const struct {
+	const char *name;
+	enum suit_trace_event event;
+} dependency_paths[] = {
+	{"suit_condition_dependency_integrity", SUIT_TRACE_CMD_DEPENDENCY_INTEGRITY},
+	{"suit_directive_process_dependency", SUIT_TRACE_CMD_PROCESS_DEPENDENCY},
+};
+
+K_THREAD_STACK_DEFINE(wcet_stack, WCET_STACK_SIZE);
+static struct k_thread wcet_thread;
+
+static struct wcet_result maxima[WCET_ENTRY_MAX];
+static struct suit_trace_stats trace_stats[SUIT_TRACE_EVENT_MAX];
+
+
+/** @brief Execute the entry point, measuring the number of cycles.
+ *
+ * @param[in]  p1  Pointer to the envelope.
+ * @param[in]  p2  Entry point, casted to a pointer.
+ * @param[in]  p3  Pointer to the result, containing the sequence to process.
+ */
+static void wcet_entry_run(void *p1, void *p2, void *p3)
+{
+	const struct wcet_envelope *envelope = p1;
+	enum wcet_entry entry = (enum wcet_entry)(uintptr_t)p2;
+	struct wcet_result *result = p3;
+	struct zcbor_string manifest_component_id;
+	struct zcbor_string digest;
+	enum suit_cose_alg alg;
+	unsigned int seq_num;
+	uint32_t start;
+
+	start = k_cycle_get_32();
+	if (entry == WCET_ENTRY_PROCESS_SEQUENCE) {
+		result->status = suit_process_sequence(envelope->buf, *envelope->len, result->seq);
+	} else {
+		result->status = suit_processor_get_manifest_metadata(envelope->buf, *envelope->len, true,
+			&manifest_component_id, NULL, NULL, &digest, &alg, &seq_num);
+	}
+	result->cycles = k_cycle_get_32() - start;
+}
+
+/** @brief Run the entry point inside a thread with a freshly painted stack. */
+static void wcet_measure(const struct wcet_envelope *envelope, enum wcet_entry entry,
+			 enum suit_command_sequence seq)
+{
+	struct wcet_result result = {
+		.envelope = envelope->name,
+		.seq = seq,
+	};
+	struct wcet_result worst = result;
+	size_t unused = 0;
+
+	for (size_t i = 0; i < WCET_ITERATIONS; i++) {
+		platform_stub_reset();
+
+		/* With CONFIG_INIT_STACKS, the stack is filled with a known pattern on thread creation. */
+		(void)k_thread_create(&wcet_thread, wcet_stack, K_THREAD_STACK_SIZEOF(wcet_stack),
+				      wcet_entry_run, (void *)envelope, (void *)(uintptr_t)entry, &result,
+				      K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+		(void)k_thread_join(&wcet_thread, K_FOREVER);
+		(void)k_thread_stack_space_get(&wcet_thread, &unused);
+
+		result.stack = K_THREAD_STACK_SIZEOF(wcet_stack) - unused;
+		if (result.cycles > worst.cycles) {
+			worst.cycles = result.cycles;
+		}
+		if (result.stack > worst.stack) {
+			worst.stack = result.stack;
+		}
+		worst.status = result.status;
+	}
+
+	printk("SUIT_WCET {\"entry\":\"%s\",\"envelope\":\"%s\",\"seq\":%d,\"cycles\":%u,"
+	       "\"stack\":%u,\"status\":%d}\n", entry_names[entry], envelope->name, seq,
+	       worst.cycles, (unsigned int)worst.stack, worst.status);
+
+	if (worst.cycles > maxima[entry].cycles) {
+		maxima[entry].cycles = worst.cycles;
+		maxima[entry].envelope = worst.envelope;
+		maxima[entry].seq = worst.seq;
+	}
+	if (worst.stack > maxima[entry].stack) {
+		maxima[entry].stack = worst.stack;
+	}
+}
+
+int main(void)
+{
+	(void)suit_processor_init();
+	suit_trace_reset();
+
+	printk("SUIT_WCET_START {\"board\":\"%s\",\"stack_size\":%u}\n", CONFIG_BOARD,
+	       (unsigned int)K_THREAD_STACK_SIZEOF(wcet_stack));
+
+	for (size_t i = 0; i < ARRAY_SIZE(envelopes); i++) {
+		wcet_measure(&envelopes[i], WCET_ENTRY_GET_MANIFEST_METADATA, SUIT_SEQ_INVALID);
+
+		for (enum suit_command_sequence seq = SUIT_SEQ_PARSE; seq < SUIT_SEQ_MAX; seq++) {
+			if (seq == SUIT_SEQ_SHARED) {
+				/* The shared sequence is executed as part of all other sequences. */
+				continue;
+			}
+			wcet_measure(&envelopes[i], WCET_ENTRY_PROCESS_SEQUENCE, seq);
+		}
+	}
+
+	for (size_t i = 0; i < WCET_ENTRY_MAX; i++) {
+		printk("SUIT_WCET_MAX {\"entry\":\"%s\",\"cycles\":%u,\"envelope\":\"%s\",\"seq\":%d,"
+		       "\"stack\":%u}\n", entry_names[i], maxima[i].cycles, maxima[i].envelope,
+		       maxima[i].seq, (unsigned int)maxima[i].stack);
+	}
+
+	/* The dependency paths are executed within suit_process_sequence, so their stack usage
+	 * is included above. The duration of a single call is taken from the tracepoints.
+	 */
+	(void)suit_trace_snapshot(trace_stats, ARRAY_SIZE(trace_stats));
+	for (size_t i = 0; i < ARRAY_SIZE(dependency_paths); i++) {
+		const struct suit_trace_stats *stats = &trace_stats[dependency_paths[i].event];
+
+		printk("SUIT_WCET_MAX {\"entry\":\"%s\",\"cycles\":%u,\"calls\":%u}\n",
+		       dependency_paths[i].name, stats->max, stats->count);
+	}
+
+	printk("SUIT_WCET_DONE\n");
+
+	return 0;
+}